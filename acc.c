@@ -1,6 +1,12 @@
 #include <math.h>
 #include <stdio.h>
 #include "acc.h"
+#include "mode_table.h"
+
+/* mode_table.h 의 표 값 / 열거 사본이 acc.h 와 일치 */
+MODE_TABLE_STATIC_ASSERT(MODE_TABLE_ACC_TARGET_STOPPED == ACC_TARGET_STOPPED, acc_target_stopped);
+MODE_TABLE_STATIC_ASSERT(MODE_TABLE_ACC_TARGET_CUT_IN == ACC_TARGET_CUT_IN, acc_target_cut_in);
+MODE_TABLE_STATIC_ASSERT(ACC_MODE_SPEED == 0 && ACC_MODE_DISTANCE == 1 && ACC_MODE_STOP == 2, acc_mode_values);
 
 /* Distance PID 적분, 과거오차 저장 */
 float s_distIntegral  = 0.0f;
@@ -13,6 +19,15 @@ float s_speedPrevError = 0.0f;
 /* 이전 시간 저장(예: 거리 PID에서 Delta Time 계산용) */
 float s_prevTimeDistance = 0.0f;
 
+void acc_pid_reset(void)
+{
+    s_distIntegral     = 0.0f;
+    s_distPrevError    = 0.0f;
+    s_speedIntegral    = 0.0f;
+    s_speedPrevError   = 0.0f;
+    s_prevTimeDistance = 0.0f;
+}
+
 /**
  * @brief 2.2.4.1.1 ACC 모드 결정
  */
@@ -26,12 +41,12 @@ ACC_Mode_e acc_mode_selection(
     if(pAccTargetData->ACC_Target_ID < 0)      return ACC_MODE_SPEED;
 
     float dist = pAccTargetData->ACC_Target_Distance;
-    if(dist > 55.0f) {
+    if(dist > ACC_SPEED_MODE_DIST) {
         // 멀리 있으면 무조건 Speed
         return ACC_MODE_SPEED;
     }
-    else if(dist < 45.0f) {
-        /* (추가) 45m 미만에서도 Stopped + Ego 정지이면 Stop 모드 */
+    else if(dist < ACC_DIST_MODE_DIST) {
+        /* (추가) ACC_DIST_MODE_DIST 미만에서도 Stopped + Ego 정지이면 Stop 모드 */
         if ((pAccTargetData->ACC_Target_Status == ACC_TARGET_STOPPED) &&
             (pEgoData->Ego_Velocity_X < 0.5f))
         {
@@ -40,7 +55,7 @@ ACC_Mode_e acc_mode_selection(
         return ACC_MODE_DISTANCE;
     }
     else {
-        // 중간 구간(45~55)에서만 STOP/CUT-IN 적용
+        // 중간 구간(ACC_DIST_MODE_DIST ~ ACC_SPEED_MODE_DIST)에서만 STOP/CUT-IN 적용
         if(pAccTargetData->ACC_Target_Status == ACC_TARGET_STOPPED &&
            pEgoData->Ego_Velocity_X            < 0.5f)
         {
@@ -53,6 +68,22 @@ ACC_Mode_e acc_mode_selection(
         return ACC_MODE_SPEED;
     }
 }
+
+ACC_Mode_e acc_mode_selection_lut(
+    const ACC_Target_Data_t *pAccTargetData,
+    const Ego_Data_t        *pEgoData,
+    const Lane_Data_t       *pLaneData
+)
+{
+    if(!pAccTargetData || !pEgoData || !pLaneData) return ACC_MODE_SPEED;
+
+    uint32_t idx = mode_table_acc_index(pAccTargetData->ACC_Target_ID,
+                                        pAccTargetData->ACC_Target_Distance,
+                                        (int32_t)pAccTargetData->ACC_Target_Status,
+                                        (int32_t)pAccTargetData->ACC_Target_Situation,
+                                        pEgoData->Ego_Velocity_X);
+    return (ACC_Mode_e)g_AccModeTable[idx];
+}
 /**
  * @brief 2.2.4.1.2 거리 PID 계산
  */
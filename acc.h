@@ -86,6 +86,15 @@ ACC_Mode_e acc_mode_selection(
     const Lane_Data_t       *pLaneData
 );
 
+/**
+ * @brief acc_mode_selection 의 분기 없는 표 조회판 (mode_table.h, 결과 동일)
+ */
+ACC_Mode_e acc_mode_selection_lut(
+    const ACC_Target_Data_t *pAccTargetData,
+    const Ego_Data_t        *pEgoData,
+    const Lane_Data_t       *pLaneData
+);
+
 /**
  * @brief 2.2.4.1.2 calculate_accel_for_distance_pid
  * 거리 모드에서의 종방향 가속도 계산
@@ -117,6 +126,11 @@ float acc_output_selection(
     float      Accel_Speed_X
 );
 
+/**
+ * @brief 거리/속도 PID 내부 상태(적분, 이전 오차, 이전 시각) 초기화
+ */
+void acc_pid_reset(void);
+
 #ifdef __cplusplus
 }
 #endif
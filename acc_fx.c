@@ -0,0 +1,144 @@
+#include <string.h>
+#include "acc_fx.h"
+
+/* acc.c 와 동일한 설계 파라미터 (Q16) */
+#define ACC_FX_SPEED_MODE_DIST   FX16_INT(55)
+#define ACC_FX_DIST_MODE_DIST    FX16_INT(45)
+#define ACC_FX_STOP_EGO_SPEED    FX16_C(0.5)
+#define ACC_FX_TARGET_DIST       FX16_INT(40)
+#define ACC_FX_DEFAULT_DT_MS     10                 /* Δt <= 0 → 0.01 s */
+#define ACC_FX_ACCEL_LIMIT       FX16_INT(10)
+#define ACC_FX_RESTART_ACCEL     FX16_C(1.2)
+#define ACC_FX_HOLD_ACCEL        FX16_C(-3.0)
+#define ACC_FX_BASE_SPEED        FX16_C(22.22)
+#define ACC_FX_CURVE_SPEED       FX16_INT(15)
+#define SPEED_KD_X1E5            5000               /* Kd 0.05 × 1e5 (Q16 게인 양자화 6e-5 회피) */
+
+static const fx16_t DIST_KP  = FX16_C(0.4);
+static const fx16_t DIST_KI  = FX16_C(0.05);
+static const fx16_t DIST_KD  = FX16_C(0.1);
+static const fx16_t SPEED_KP = FX16_C(0.5);
+static const fx16_t SPEED_KI = FX16_C(0.1);
+
+void acc_fx_state_reset(ACC_Fx_State_t *pState)
+{
+    if (!pState) return;
+    memset(pState, 0, sizeof(*pState));
+}
+
+/**
+ * @brief 2.2.4.1.1 ACC 모드 결정 (acc_mode_selection 과 동일 분기)
+ */
+ACC_Mode_e acc_mode_selection_fx(const ACC_Fx_Target_Data_t *pAccTargetData,
+                                 const ACC_Fx_Ego_Data_t    *pEgoData,
+                                 const ACC_Fx_Lane_Data_t   *pLaneData)
+{
+    if (!pAccTargetData || !pEgoData || !pLaneData) return ACC_MODE_SPEED;
+    if (pAccTargetData->ACC_Target_ID < 0)          return ACC_MODE_SPEED;
+
+    fx16_t dist    = pAccTargetData->ACC_Target_Distance;
+    int    stopped = (pAccTargetData->ACC_Target_Status == ACC_TARGET_STOPPED) &&
+                     (pEgoData->Ego_Velocity_X < ACC_FX_STOP_EGO_SPEED);
+
+    if (dist > ACC_FX_SPEED_MODE_DIST) {
+        return ACC_MODE_SPEED;
+    }
+    if (dist < ACC_FX_DIST_MODE_DIST) {
+        return stopped ? ACC_MODE_STOP : ACC_MODE_DISTANCE;
+    }
+    if (stopped) {
+        return ACC_MODE_STOP;
+    }
+    if (pAccTargetData->ACC_Target_Situation == ACC_TARGET_CUT_IN) {
+        return ACC_MODE_DISTANCE;
+    }
+    return ACC_MODE_SPEED;
+}
+
+/**
+ * @brief 2.2.4.1.2 거리 PID
+ * - 적분은 [m·ms] 단위로 정확히 누적 (Δt[ms] 정수 곱 → 반올림 오차 없음)
+ * - 미분은 Δerr × 1000 / Δt[ms]
+ */
+fx16_t calculate_accel_for_distance_pid_fx(ACC_Fx_State_t             *pState,
+                                           ACC_Mode_e                  accMode,
+                                           const ACC_Fx_Target_Data_t *pAccTargetData,
+                                           const ACC_Fx_Ego_Data_t    *pEgoData,
+                                           int32_t                     current_time_ms)
+{
+    if (!pState || !pAccTargetData || !pEgoData) {
+        return 0;
+    }
+    if ((accMode != ACC_MODE_DISTANCE) && (accMode != ACC_MODE_STOP)) {
+        return 0;
+    }
+
+    int64_t dtMs = (int64_t)current_time_ms - pState->Prev_Time_Distance_Ms;
+    if (dtMs <= 0) dtMs = ACC_FX_DEFAULT_DT_MS;
+    if (dtMs > INT32_MAX) dtMs = INT32_MAX;
+    pState->Prev_Time_Distance_Ms = current_time_ms;
+
+    fx16_t distErr = fx16_sub(pAccTargetData->ACC_Target_Distance, ACC_FX_TARGET_DIST);
+
+    pState->Dist_Integral = fx16w_add(pState->Dist_Integral, (int64_t)distErr * dtMs);
+    fx16_t dDiff = fx16_sub(distErr, pState->Dist_Prev_Error);
+    fx16_t dErr  = fx16_sat(((int64_t)dDiff * 1000 + (dDiff >= 0 ? dtMs / 2 : -(dtMs / 2))) / dtMs);
+    pState->Dist_Prev_Error = distErr;
+
+    fx16_t accelDist = fx16_mul(DIST_KP, distErr);
+    accelDist = fx16_add(accelDist, fx16w_mul_div(pState->Dist_Integral, DIST_KI, 1000));
+    accelDist = fx16_add(accelDist, fx16_mul(DIST_KD, dErr));
+    accelDist = fx16_clamp(accelDist, -ACC_FX_ACCEL_LIMIT, ACC_FX_ACCEL_LIMIT);
+
+    /* Stop 모드 : 정지 유지 / 재출발 */
+    if (accMode == ACC_MODE_STOP &&
+        pAccTargetData->ACC_Target_Status == ACC_TARGET_STOPPED &&
+        pEgoData->Ego_Velocity_X < ACC_FX_STOP_EGO_SPEED)
+    {
+        accelDist = (pAccTargetData->ACC_Target_Velocity_X > ACC_FX_STOP_EGO_SPEED)
+                  ? ACC_FX_RESTART_ACCEL
+                  : ACC_FX_HOLD_ACCEL;
+    }
+    return accelDist;
+}
+
+/**
+ * @brief 2.2.4.1.3 속도 PID
+ */
+fx16_t calculate_accel_for_speed_pid_fx(ACC_Fx_State_t           *pState,
+                                        const ACC_Fx_Ego_Data_t  *pEgoData,
+                                        const ACC_Fx_Lane_Data_t *pLaneData,
+                                        int32_t                   delta_time_ms)
+{
+    if (!pState || !pEgoData || !pLaneData || delta_time_ms <= 0) {
+        return 0;
+    }
+
+    fx16_t target = pLaneData->LS_Is_Curved_Lane ? ACC_FX_CURVE_SPEED : ACC_FX_BASE_SPEED;
+    fx16_t speedErr = fx16_sub(target, pEgoData->Ego_Velocity_X);
+
+    /* 적분 [m/s·ms], 미분 분모 = Δt + 1e-5 s (float 경로와 동일, 단위 10 µs) */
+    pState->Speed_Integral = fx16w_add(pState->Speed_Integral, (int64_t)speedErr * delta_time_ms);
+    int64_t dDiff = (int64_t)speedErr - pState->Speed_Prev_Error;
+    int64_t den   = (int64_t)delta_time_ms * 100 + 1;
+    int64_t dNum  = dDiff * SPEED_KD_X1E5;
+    fx16_t  dTerm = fx16_sat((dNum + (dNum >= 0 ? den / 2 : -(den / 2))) / den);
+    pState->Speed_Prev_Error = speedErr;
+
+    fx16_t accelSpeed = fx16_mul(SPEED_KP, speedErr);
+    accelSpeed = fx16_add(accelSpeed, fx16w_mul_div(pState->Speed_Integral, SPEED_KI, 1000));
+    accelSpeed = fx16_add(accelSpeed, dTerm);
+    return accelSpeed;
+}
+
+/**
+ * @brief 2.2.4.1.4 최종 ACC 가속도 선택
+ */
+fx16_t acc_output_selection_fx(ACC_Mode_e accMode,
+                               fx16_t     Accel_Distance_X,
+                               fx16_t     Accel_Speed_X)
+{
+    if (accMode == ACC_MODE_SPEED)    return Accel_Speed_X;
+    if (accMode == ACC_MODE_DISTANCE) return Accel_Distance_X;
+    return 0;
+}
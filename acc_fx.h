@@ -0,0 +1,87 @@
+/****************************************************************************
+ * acc_fx.h
+ *
+ * - ACC 고정소수점(Q15.16) 구성 : acc.c 와 동일 알고리즘, 정수 연산 전용
+ * - PID 내부 상태는 전역 대신 ACC_Fx_State_t 로 분리 (호출측 소유)
+ * - 시간 입력은 int32 [ms]
+ *
+ * float 참조(acc.c) 대비 오차 (acc_fx_test.cpp 교차검증):
+ *   mode        : 일치 (경계값 ±1 LSB 제외)
+ *   Accel 출력  : |err| <= 2e-3 [m/s²]  (연속 주행 1000 틱 누적 포함)
+ ****************************************************************************/
+#ifndef ACC_FX_H
+#define ACC_FX_H
+
+#include "fixed_point.h"
+#include "acc.h"      /* ACC_Mode_e, ACC_Target_Status_e, ACC_Target_Situation_e */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct
+{
+    int    ACC_Target_ID;                           /* (0, N) */
+    fx16_t ACC_Target_Distance;                     /* Q16 [m] */
+    ACC_Target_Status_e    ACC_Target_Status;
+    ACC_Target_Situation_e ACC_Target_Situation;
+    fx16_t ACC_Target_Velocity_X;                   /* Q16 [m/s] */
+} ACC_Fx_Target_Data_t;
+
+typedef struct
+{
+    fx16_t Ego_Velocity_X;                          /* Q16 [m/s] */
+    fx16_t Ego_Acceleration_X;                      /* Q16 [m/s²] */
+} ACC_Fx_Ego_Data_t;
+
+typedef struct
+{
+    int    LS_Is_Curved_Lane;                       /* (True=1, False=0) */
+} ACC_Fx_Lane_Data_t;
+
+/**
+ * @brief PID 내부 상태 (acc.c 의 s_dist* / s_speed* 전역에 대응)
+ */
+typedef struct
+{
+    fx16w_t Dist_Integral;                          /* Q47.16 [m·ms] (Δt 정수 곱 누적) */
+    fx16_t  Dist_Prev_Error;                        /* Q16 [m] */
+    fx16w_t Speed_Integral;                         /* Q47.16 [m/s·ms] */
+    fx16_t  Speed_Prev_Error;                       /* Q16 [m/s] */
+    int32_t Prev_Time_Distance_Ms;                  /* [ms] */
+} ACC_Fx_State_t;
+
+void acc_fx_state_reset(ACC_Fx_State_t *pState);
+
+ACC_Mode_e acc_mode_selection_fx(const ACC_Fx_Target_Data_t *pAccTargetData,
+                                 const ACC_Fx_Ego_Data_t    *pEgoData,
+                                 const ACC_Fx_Lane_Data_t   *pLaneData);
+
+/**
+ * @brief 거리 PID (Q16 [m/s²], ±10 포화)
+ * @param current_time_ms 제어루프 시각 [ms]
+ */
+fx16_t calculate_accel_for_distance_pid_fx(ACC_Fx_State_t             *pState,
+                                           ACC_Mode_e                  accMode,
+                                           const ACC_Fx_Target_Data_t *pAccTargetData,
+                                           const ACC_Fx_Ego_Data_t    *pEgoData,
+                                           int32_t                     current_time_ms);
+
+/**
+ * @brief 속도 PID (Q16 [m/s²])
+ * @param delta_time_ms 제어 주기 [ms] (Q16 [s] 로는 0.01 s 가 1.5e-5 양자화)
+ */
+fx16_t calculate_accel_for_speed_pid_fx(ACC_Fx_State_t           *pState,
+                                        const ACC_Fx_Ego_Data_t  *pEgoData,
+                                        const ACC_Fx_Lane_Data_t *pLaneData,
+                                        int32_t                   delta_time_ms);
+
+fx16_t acc_output_selection_fx(ACC_Mode_e accMode,
+                               fx16_t     Accel_Distance_X,
+                               fx16_t     Accel_Speed_X);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ACC_FX_H */
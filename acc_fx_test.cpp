@@ -0,0 +1,148 @@
+/*********************************************************************
+ * acc_fx_test.cpp  ―  ACC 고정소수점 구성 교차검증 (float 참조 acc.c 대비)
+ * DUT : acc_mode_selection_fx / calculate_accel_for_distance_pid_fx
+ *       calculate_accel_for_speed_pid_fx / acc_output_selection_fx
+ *********************************************************************/
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#include "acc_fx.h"
+#include "test_rng.hpp"
+
+extern float s_distIntegral;
+extern float s_distPrevError;
+extern float s_speedIntegral;
+extern float s_speedPrevError;
+extern float s_prevTimeDistance;
+
+static constexpr float ACCEL_MAX_ERR = 2e-3f;   /* acc_fx.h 문서화 오차 */
+
+class AccFxTest : public ::testing::Test
+{
+protected:
+    ACC_Fx_State_t fx;
+    TestRng        rng{7u};
+
+    void SetUp() override {
+        s_distIntegral = s_distPrevError = 0.0f;
+        s_speedIntegral = s_speedPrevError = 0.0f;
+        s_prevTimeDistance = 0.0f;
+        acc_fx_state_reset(&fx);
+    }
+    static ACC_Fx_Target_Data_t toFx(const ACC_Target_Data_t &t) {
+        return { t.ACC_Target_ID, fx16_from_float(t.ACC_Target_Distance),
+                 t.ACC_Target_Status, t.ACC_Target_Situation,
+                 fx16_from_float(t.ACC_Target_Velocity_X) };
+    }
+    static ACC_Fx_Ego_Data_t toFx(const Ego_Data_t &e) {
+        return { fx16_from_float(e.Ego_Velocity_X), fx16_from_float(e.Ego_Acceleration_X) };
+    }
+};
+
+/* 모드 : 임의 입력 10⁴ 건 전부 일치 */
+TEST_F(AccFxTest, TC_ACC_FX_EQ_01_ModeMatchesFloat)
+{
+    for (int i = 0; i < 10000; i++) {
+        ACC_Target_Data_t t{};
+        t.ACC_Target_ID         = (i % 17 == 0) ? -1 : 1;
+        t.ACC_Target_Distance   = rng.uni(0.0f, 80.0f);
+        t.ACC_Target_Status     = (ACC_Target_Status_e)(i % 4);
+        t.ACC_Target_Situation  = (ACC_Target_Situation_e)((i / 4) % 3);
+        t.ACC_Target_Velocity_X = rng.uni(0.0f, 30.0f);
+        Ego_Data_t e{ rng.uni(0.0f, 1.0f), 0.0f };
+        Lane_Data_t l{};
+
+        ACC_Fx_Target_Data_t tf = toFx(t);
+        ACC_Fx_Ego_Data_t    ef = toFx(e);
+        ACC_Fx_Lane_Data_t   lf{ 0 };
+        ASSERT_EQ(acc_mode_selection_fx(&tf, &ef, &lf), acc_mode_selection(&t, &e, &l)) << i;
+    }
+}
+
+/* 거리 PID : 10 ms 루프 1000 틱 (선행차 속도 변동) 누적 오차 */
+TEST_F(AccFxTest, TC_ACC_FX_EQ_02_DistancePidTrajectory)
+{
+    ACC_Target_Data_t t{ 1, 30.0f, ACC_TARGET_MOVING, ACC_TARGET_NORMAL, 15.0f };
+    Ego_Data_t e{ 15.0f, 0.0f };
+    float maxErr = 0.0f;
+
+    for (int k = 1; k <= 1000; k++) {
+        float now = 10.0f * k;
+        float a = calculate_accel_for_distance_pid(ACC_MODE_DISTANCE, &t, &e, now);
+
+        ACC_Fx_Target_Data_t tf = toFx(t);
+        ACC_Fx_Ego_Data_t    ef = toFx(e);
+        fx16_t af = calculate_accel_for_distance_pid_fx(&fx, ACC_MODE_DISTANCE, &tf, &ef, 10 * k);
+        maxErr = std::fmax(maxErr, std::fabs(fx16_to_float(af) - a));
+
+        /* 간이 종방향 거동 */
+        t.ACC_Target_Velocity_X = 15.0f + 3.0f * std::sin(0.004f * k);
+        e.Ego_Velocity_X       += 0.01f * a;
+        t.ACC_Target_Distance  += 0.01f * (t.ACC_Target_Velocity_X - e.Ego_Velocity_X);
+    }
+    EXPECT_LE(maxErr, ACCEL_MAX_ERR);
+}
+
+/* 속도 PID : 가감속 궤적 누적 오차 */
+TEST_F(AccFxTest, TC_ACC_FX_EQ_03_SpeedPidTrajectory)
+{
+    Ego_Data_t  e{ 10.0f, 0.0f };
+    Lane_Data_t l{};
+    float maxErr = 0.0f;
+
+    for (int k = 1; k <= 1000; k++) {
+        l.LS_Is_Curved_Lane = (k / 250) % 2;
+        float a = calculate_accel_for_speed_pid(&e, &l, 0.01f);
+
+        ACC_Fx_Ego_Data_t  ef = toFx(e);
+        ACC_Fx_Lane_Data_t lf{ l.LS_Is_Curved_Lane };
+        fx16_t af = calculate_accel_for_speed_pid_fx(&fx, &ef, &lf, 10);
+        maxErr = std::fmax(maxErr, std::fabs(fx16_to_float(af) - a));
+
+        e.Ego_Velocity_X += 0.01f * std::fmax(-3.0f, std::fmin(3.0f, a));
+    }
+    EXPECT_LE(maxErr, ACCEL_MAX_ERR);
+}
+
+/* Stop 모드 : 정지 유지 / 재출발 값 일치 */
+TEST_F(AccFxTest, TC_ACC_FX_BV_01_StopMode)
+{
+    ACC_Target_Data_t t{ 1, 5.0f, ACC_TARGET_STOPPED, ACC_TARGET_NORMAL, 0.0f };
+    Ego_Data_t e{ 0.2f, 0.0f };
+    ACC_Fx_Target_Data_t tf = toFx(t);
+    ACC_Fx_Ego_Data_t    ef = toFx(e);
+    EXPECT_EQ(calculate_accel_for_distance_pid_fx(&fx, ACC_MODE_STOP, &tf, &ef, 10), FX16_C(-3.0));
+    tf.ACC_Target_Velocity_X = FX16_C(1.0);
+    EXPECT_EQ(calculate_accel_for_distance_pid_fx(&fx, ACC_MODE_STOP, &tf, &ef, 20), FX16_C(1.2));
+    EXPECT_EQ(calculate_accel_for_distance_pid_fx(&fx, ACC_MODE_SPEED, &tf, &ef, 30), 0);
+}
+
+/* 출력 포화 : ±10 m/s² / 큰 Δt 에서도 오버플로 없음 */
+TEST_F(AccFxTest, TC_ACC_FX_BV_02_Saturation)
+{
+    ACC_Fx_Target_Data_t tf{ 1, FX16_INT(200), ACC_TARGET_MOVING, ACC_TARGET_NORMAL, 0 };
+    ACC_Fx_Ego_Data_t    ef{ FX16_INT(20), 0 };
+    EXPECT_EQ(calculate_accel_for_distance_pid_fx(&fx, ACC_MODE_DISTANCE, &tf, &ef, INT32_MAX),
+              FX16_INT(10));
+    acc_fx_state_reset(&fx);
+    tf.ACC_Target_Distance = 0;
+    for (int i = 0; i < 100; i++) {
+        EXPECT_EQ(calculate_accel_for_distance_pid_fx(&fx, ACC_MODE_DISTANCE, &tf, &ef, i),
+                  -FX16_INT(10));
+    }
+}
+
+/* 무효 입력 / 출력 선택 */
+TEST_F(AccFxTest, TC_ACC_FX_RA_01_InvalidAndSelection)
+{
+    ACC_Fx_Ego_Data_t  ef{ 0, 0 };
+    ACC_Fx_Lane_Data_t lf{ 0 };
+    EXPECT_EQ(calculate_accel_for_distance_pid_fx(nullptr, ACC_MODE_DISTANCE, nullptr, &ef, 0), 0);
+    EXPECT_EQ(calculate_accel_for_speed_pid_fx(&fx, &ef, &lf, 0), 0);
+    EXPECT_EQ(acc_mode_selection_fx(nullptr, &ef, &lf), ACC_MODE_SPEED);
+    EXPECT_EQ(acc_output_selection_fx(ACC_MODE_SPEED, 1, 2), 2);
+    EXPECT_EQ(acc_output_selection_fx(ACC_MODE_DISTANCE, 1, 2), 1);
+    EXPECT_EQ(acc_output_selection_fx(ACC_MODE_STOP, 1, 2), 0);
+}
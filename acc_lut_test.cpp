@@ -0,0 +1,121 @@
+/*********************************************************************
+ * acc_lut_test.cpp  ―  ACC 모드 표 조회판 교차검증 (분기판 acc_mode_selection 대비)
+ * DUT : acc_mode_selection_lut / acc_mode_selection_batch (mode_table.c)
+ *********************************************************************/
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "acc.h"
+#include "mode_table.h"
+
+namespace {
+
+const int   kIds[]    = { -5, -1, 0, 5 };
+const float kDists[]  = { -1.0f, 0.0f, 44.99f, 45.0f, 45.01f, 50.0f, 54.99f, 55.0f, 55.01f, 200.0f,
+                          std::numeric_limits<float>::quiet_NaN(),
+                          std::numeric_limits<float>::infinity(),
+                          -std::numeric_limits<float>::infinity() };
+const int   kStatus[] = { 0, 1, 2, 3, 7 };
+const int   kSit[]    = { 0, 1, 2, -1 };
+const float kEgo[]    = { 0.0f, 0.49f, 0.5f, 0.51f, 20.0f, std::numeric_limits<float>::quiet_NaN() };
+
+struct AccCase { ACC_Target_Data_t t; Ego_Data_t e; };
+
+std::vector<AccCase> allCases()
+{
+    std::vector<AccCase> v;
+    for (int id : kIds) for (float d : kDists) for (int st : kStatus)
+    for (int si : kSit) for (float ego : kEgo) {
+        AccCase c = {};
+        c.t.ACC_Target_ID        = id;
+        c.t.ACC_Target_Distance  = d;
+        c.t.ACC_Target_Status    = (ACC_Target_Status_e)st;
+        c.t.ACC_Target_Situation = (ACC_Target_Situation_e)si;
+        c.e.Ego_Velocity_X       = ego;
+        v.push_back(c);
+    }
+    return v;
+}
+
+}  // namespace
+
+/* TC_ACC_LUT_EQ_01 : 경계값 전수 교차 (NaN / ±inf / 범위 밖 열거 포함) → 분기판과 동일 */
+TEST(AccLutTest, TC_ACC_LUT_EQ_01_ExhaustiveBoundaries)
+{
+    Lane_Data_t lane = {};
+    for (const AccCase &c : allCases()) {
+        ASSERT_EQ(acc_mode_selection_lut(&c.t, &c.e, &lane), acc_mode_selection(&c.t, &c.e, &lane))
+            << "id " << c.t.ACC_Target_ID << " d " << c.t.ACC_Target_Distance
+            << " st " << c.t.ACC_Target_Status << " sit " << c.t.ACC_Target_Situation
+            << " ego " << c.e.Ego_Velocity_X;
+    }
+}
+
+/* TC_ACC_LUT_EQ_02 : 배치(SoA) = 스칼라, 4 의 배수가 아닌 길이 (SIMD 본체 + 꼬리) */
+TEST(AccLutTest, TC_ACC_LUT_EQ_02_BatchMatchesScalar)
+{
+    std::vector<AccCase> cs = allCases();
+    Lane_Data_t lane = {};
+    for (int n : { 0, 1, 3, 4, 5, 7, (int)cs.size() }) {
+        std::vector<int32_t> id(n), st(n), si(n), mode(n, -1);
+        std::vector<float>   d(n), ego(n);
+        for (int i = 0; i < n; i++) {
+            id[i]  = cs[i].t.ACC_Target_ID;
+            d[i]   = cs[i].t.ACC_Target_Distance;
+            st[i]  = (int32_t)cs[i].t.ACC_Target_Status;
+            si[i]  = (int32_t)cs[i].t.ACC_Target_Situation;
+            ego[i] = cs[i].e.Ego_Velocity_X;
+        }
+        ASSERT_EQ(acc_mode_selection_batch(id.data(), d.data(), st.data(), si.data(), ego.data(),
+                                           n, mode.data()), 0);
+        for (int i = 0; i < n; i++) {
+            ASSERT_EQ(mode[i], (int32_t)acc_mode_selection(&cs[i].t, &cs[i].e, &lane)) << "n " << n << " i " << i;
+        }
+    }
+}
+
+/* TC_ACC_LUT_BV_01 : 45 / 55 m 경계, 정지 타겟 + Ego 0.5 m/s 경계 */
+TEST(AccLutTest, TC_ACC_LUT_BV_01_BandEdges)
+{
+    ACC_Target_Data_t t = {};
+    Ego_Data_t        e = {};
+    Lane_Data_t       l = {};
+    t.ACC_Target_ID = 1;
+    e.Ego_Velocity_X = 10.0f;
+
+    t.ACC_Target_Distance = 44.99f; EXPECT_EQ(acc_mode_selection_lut(&t, &e, &l), ACC_MODE_DISTANCE);
+    t.ACC_Target_Distance = 45.0f;  EXPECT_EQ(acc_mode_selection_lut(&t, &e, &l), ACC_MODE_SPEED);
+    t.ACC_Target_Situation = ACC_TARGET_CUT_IN;
+    EXPECT_EQ(acc_mode_selection_lut(&t, &e, &l), ACC_MODE_DISTANCE);
+    t.ACC_Target_Distance = 55.0f;  EXPECT_EQ(acc_mode_selection_lut(&t, &e, &l), ACC_MODE_DISTANCE);
+    t.ACC_Target_Distance = 55.01f; EXPECT_EQ(acc_mode_selection_lut(&t, &e, &l), ACC_MODE_SPEED);
+
+    t.ACC_Target_Distance = 50.0f;
+    t.ACC_Target_Status   = ACC_TARGET_STOPPED;
+    e.Ego_Velocity_X = 0.49f; EXPECT_EQ(acc_mode_selection_lut(&t, &e, &l), ACC_MODE_STOP);
+    e.Ego_Velocity_X = 0.5f;  EXPECT_EQ(acc_mode_selection_lut(&t, &e, &l), ACC_MODE_DISTANCE);
+}
+
+/* TC_ACC_LUT_RA_01 : NULL 인자 → Speed, 배치 인자 오류 → -1 */
+TEST(AccLutTest, TC_ACC_LUT_RA_01_InvalidArgs)
+{
+    ACC_Target_Data_t t = {};
+    Ego_Data_t        e = {};
+    Lane_Data_t       l = {};
+    t.ACC_Target_ID = 1;
+    t.ACC_Target_Distance = 10.0f;
+    EXPECT_EQ(acc_mode_selection_lut(nullptr, &e, &l), ACC_MODE_SPEED);
+    EXPECT_EQ(acc_mode_selection_lut(&t, nullptr, &l), ACC_MODE_SPEED);
+    EXPECT_EQ(acc_mode_selection_lut(&t, &e, nullptr), ACC_MODE_SPEED);
+
+    int32_t id = 1, st = 0, si = 0, mode = -1;
+    float   d = 10.0f, ego = 5.0f;
+    EXPECT_EQ(acc_mode_selection_batch(&id, &d, &st, &si, &ego, -1, &mode), -1);
+    EXPECT_EQ(acc_mode_selection_batch(&id, &d, &st, &si, &ego, 1, nullptr), -1);
+    EXPECT_EQ(acc_mode_selection_batch(nullptr, &d, &st, &si, &ego, 1, &mode), -1);
+    EXPECT_EQ(acc_mode_selection_batch(nullptr, nullptr, nullptr, nullptr, nullptr, 0, nullptr), 0);
+    EXPECT_EQ(mode, -1);
+}
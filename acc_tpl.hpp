@@ -0,0 +1,48 @@
+/****************************************************************************
+ * acc_tpl.hpp
+ *
+ * - acc_mode_selection (acc.c) 의 컴파일 타임 구성 템플릿
+ * - 모드 대역 : Cfg::AccDistModeDist (미만 → Distance) / Cfg::AccSpeedModeDist (초과 → Speed)
+ * - PID / 출력 선택은 구성 값이 없어 C API 그대로 사용
+ ****************************************************************************/
+#ifndef ACC_TPL_HPP
+#define ACC_TPL_HPP
+
+#include "adas_config.hpp"
+#include "acc.h"
+
+namespace adas {
+
+template <class Cfg = DefaultConfig>
+ACC_Mode_e acc_mode_selection(const ACC_Target_Data_t *pAccTargetData,
+                              const Ego_Data_t        *pEgoData,
+                              const Lane_Data_t       *pLaneData)
+{
+    static_assert(config_is_valid<Cfg>(), "");
+
+    if (!pAccTargetData || !pEgoData || !pLaneData) return ACC_MODE_SPEED;
+    if (pAccTargetData->ACC_Target_ID < 0)          return ACC_MODE_SPEED;
+
+    float dist    = pAccTargetData->ACC_Target_Distance;
+    bool  stopped = (pAccTargetData->ACC_Target_Status == ACC_TARGET_STOPPED) &&
+                    (pEgoData->Ego_Velocity_X < 0.5f);
+
+    if (dist > Cfg::AccSpeedModeDist) {
+        return ACC_MODE_SPEED;
+    }
+    if (dist < Cfg::AccDistModeDist) {
+        return stopped ? ACC_MODE_STOP : ACC_MODE_DISTANCE;
+    }
+    /* 중간 대역 : Stop / Cut-in 만 반영 */
+    if (stopped) {
+        return ACC_MODE_STOP;
+    }
+    if (pAccTargetData->ACC_Target_Situation == ACC_TARGET_CUT_IN) {
+        return ACC_MODE_DISTANCE;
+    }
+    return ACC_MODE_SPEED;
+}
+
+} /* namespace adas */
+
+#endif /* ACC_TPL_HPP */
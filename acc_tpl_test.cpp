@@ -0,0 +1,102 @@
+/*********************************************************************
+ * acc_tpl_test.cpp  ―  ACC 모드 선택 구성 템플릿
+ * DUT : adas::acc_mode_selection<Cfg>
+ * REF : acc_mode_selection (acc.c)
+ *********************************************************************/
+#include <gtest/gtest.h>
+#include <cfloat>
+#include <climits>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#include "acc_tpl.hpp"
+#include "test_rng.hpp"
+
+/* 모드 대역 40 / 60 m */
+struct WideBandConfig : adas::DefaultConfig {
+    static constexpr float AccSpeedModeDist = 60.0f;
+    static constexpr float AccDistModeDist  = 40.0f;
+};
+
+/* 기본 인스턴스 == C API : 0 ~ 70 m, 상태/상황 전체 조합 */
+TEST(AccTplTest, TC_ACC_TPL_EQ_01_DefaultMatchesCApi)
+{
+    Lane_Data_t l{};
+    for (int i = 0; i <= 7000; i++) {
+        for (int k = 0; k < 12; k++) {
+            ACC_Target_Data_t t{ (k == 11) ? -1 : 1, 0.01f * i, (ACC_Target_Status_e)(k % 4),
+                                 (ACC_Target_Situation_e)(k % 3), 0.0f };
+            Ego_Data_t e{ (k & 4) ? 0.2f : 10.0f, 0.0f };
+            ASSERT_EQ(adas::acc_mode_selection<>(&t, &e, &l), acc_mode_selection(&t, &e, &l)) << i << "," << k;
+        }
+    }
+}
+
+/* 기본 인스턴스 == C API : 대역 경계 ±1 ulp, 비유한 거리 / 속도, 범위 밖 열거값 + 임의 비트 패턴 */
+TEST(AccTplTest, TC_ACC_TPL_EQ_02_DefaultMatchesCApiBoundary)
+{
+    const float D[] = { -0.0f, 0.0f, std::nextafter(ACC_DIST_MODE_DIST, 0.0f), ACC_DIST_MODE_DIST,
+                        std::nextafter(ACC_DIST_MODE_DIST, 1e9f), std::nextafter(ACC_SPEED_MODE_DIST, 0.0f),
+                        ACC_SPEED_MODE_DIST, std::nextafter(ACC_SPEED_MODE_DIST, 1e9f), FLT_MAX, -FLT_MAX,
+                        INFINITY, -INFINITY, NAN };
+    const float V[] = { 0.0f, std::nextafter(0.5f, 0.0f), 0.5f, 30.0f, -INFINITY, INFINITY, NAN };
+    const int   Id[] = { -1, 0, INT_MAX, INT_MIN };
+    Lane_Data_t l{};
+    for (float d : D) {
+        for (float v : V) {
+            for (int id : Id) {
+                for (int st = 0; st < 6; st++) {
+                    for (int si = 0; si < 4; si++) {
+                        ACC_Target_Data_t t{ id, d, (ACC_Target_Status_e)st, (ACC_Target_Situation_e)si, 0.0f };
+                        Ego_Data_t e{ v, 0.0f };
+                        ASSERT_EQ(adas::acc_mode_selection<>(&t, &e, &l), acc_mode_selection(&t, &e, &l))
+                            << d << "," << v << "," << id << "," << st << "," << si;
+                    }
+                }
+            }
+        }
+    }
+
+    TestRng rng(11u);
+    for (int i = 0; i < 200000; i++) {
+        ACC_Target_Data_t t;
+        Ego_Data_t        e;
+        uint32_t          u[3] = { rng.next(), rng.next(), rng.next() };
+        std::memcpy(&t.ACC_Target_Distance, &u[0], sizeof(float));
+        std::memcpy(&e.Ego_Velocity_X, &u[1], sizeof(float));
+        t.ACC_Target_ID        = (int)(u[2] & 0xFu) - 2;
+        t.ACC_Target_Status    = (ACC_Target_Status_e)((u[2] >> 4) & 0x3u);
+        t.ACC_Target_Situation = (ACC_Target_Situation_e)((u[2] >> 6) % 3u);
+        t.ACC_Target_Velocity_X = 0.0f;
+        e.Ego_Acceleration_X   = 0.0f;
+        ASSERT_EQ(adas::acc_mode_selection<>(&t, &e, &l), acc_mode_selection(&t, &e, &l)) << i;
+    }
+}
+
+/* 사용자 대역 경계 */
+TEST(AccTplTest, TC_ACC_TPL_BV_01_CustomBands)
+{
+    Lane_Data_t l{};
+    Ego_Data_t  e{ 10.0f, 0.0f };
+    ACC_Target_Data_t t{ 1, 42.0f, ACC_TARGET_MOVING, ACC_TARGET_NORMAL, 0.0f };
+    EXPECT_EQ(adas::acc_mode_selection<adas::DefaultConfig>(&t, &e, &l), ACC_MODE_DISTANCE);
+    EXPECT_EQ(adas::acc_mode_selection<WideBandConfig>(&t, &e, &l), ACC_MODE_SPEED);
+
+    t.ACC_Target_Distance = 58.0f;
+    t.ACC_Target_Situation = ACC_TARGET_CUT_IN;
+    EXPECT_EQ(adas::acc_mode_selection<adas::DefaultConfig>(&t, &e, &l), ACC_MODE_SPEED);
+    EXPECT_EQ(adas::acc_mode_selection<WideBandConfig>(&t, &e, &l), ACC_MODE_DISTANCE);
+
+    t.ACC_Target_Distance = 60.0f;
+    EXPECT_EQ(adas::acc_mode_selection<WideBandConfig>(&t, &e, &l), ACC_MODE_DISTANCE);
+    t.ACC_Target_Distance = 60.001f;
+    EXPECT_EQ(adas::acc_mode_selection<WideBandConfig>(&t, &e, &l), ACC_MODE_SPEED);
+}
+
+TEST(AccTplTest, TC_ACC_TPL_RA_01_Invalid)
+{
+    Lane_Data_t l{};
+    Ego_Data_t  e{ 10.0f, 0.0f };
+    EXPECT_EQ(adas::acc_mode_selection<WideBandConfig>(nullptr, &e, &l), ACC_MODE_SPEED);
+}
@@ -0,0 +1,172 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "adas_arena.h"
+#include "target_selection.h"
+
+#if (ADAS_ARENA_ALIGN & (ADAS_ARENA_ALIGN - 1)) != 0
+#error "ADAS_ARENA_ALIGN must be a power of two"
+#endif
+
+static size_t align_up(size_t n, size_t a)
+{
+    return (n + a - 1u) & ~(a - 1u);
+}
+
+static int config_valid(const AdasArenaConfig_t *c)
+{
+    return c && c->Max_Objects >= 1
+        && c->Max_Tracks >= 0 && c->Max_Tracks <= OBJ_TRACK_MAX
+        && c->History_Depth >= 0 && c->Extra_Scratch >= 0;
+}
+
+/* 틱 스크래치 : adas_arena_target_selection 한 번 (Filtered + Predicted) + 추가분 */
+static size_t scratch_bytes(const AdasArenaConfig_t *c)
+{
+    size_t n = (size_t)c->Max_Objects;
+    return align_up(n * sizeof(FilteredObject_t), ADAS_ARENA_ALIGN)
+         + align_up(n * sizeof(PredictedObject_t), ADAS_ARENA_ALIGN)
+         + align_up((size_t)c->Extra_Scratch, ADAS_ARENA_ALIGN);
+}
+
+int adas_arena_plan(const AdasArenaConfig_t *pCfg, AdasArenaFootprint_t *pPlan)
+{
+    if (!config_valid(pCfg) || !pPlan) return -1;
+
+    memset(pPlan, 0, sizeof(*pPlan));
+    if (pCfg->Max_Tracks > 0) {
+        pPlan->Track_Bytes   = align_up(sizeof(ObjectTrackTable_t), ADAS_ARENA_ALIGN);
+        pPlan->History_Bytes = align_up((size_t)pCfg->Max_Tracks * (size_t)pCfg->History_Depth
+                                        * sizeof(FilteredObject_t), ADAS_ARENA_ALIGN);
+    }
+    pPlan->Scratch_Bytes = scratch_bytes(pCfg);
+    pPlan->Total_Bytes   = pPlan->Track_Bytes + pPlan->History_Bytes + pPlan->Scratch_Bytes
+                         + ADAS_ARENA_ALIGN;                    /* 시작 정렬 여유 */
+    return 0;
+}
+
+int adas_arena_init(AdasArena_t *pArena, const AdasArenaConfig_t *pCfg, void *pBuf, size_t bufSize)
+{
+    AdasArenaFootprint_t plan;
+
+    if (!pArena || adas_arena_plan(pCfg, &plan) != 0) return -1;
+    if (pBuf && bufSize < plan.Total_Bytes) return -1;
+
+    memset(pArena, 0, sizeof(*pArena));
+    pArena->Cfg  = *pCfg;
+    pArena->Plan = plan;
+
+    uint8_t *raw = (uint8_t *)pBuf;
+    if (!raw) {
+        raw = (uint8_t *)malloc(plan.Total_Bytes);
+        pArena->Heap_Calls++;
+        if (!raw) return -1;
+        pArena->Raw = raw;
+    }
+    pArena->Base = (uint8_t *)align_up((size_t)(uintptr_t)raw, ADAS_ARENA_ALIGN);
+
+    uint8_t *p = pArena->Base;
+    if (plan.Track_Bytes) {
+        pArena->Tracks = (ObjectTrackTable_t *)p;
+        p += plan.Track_Bytes;
+    }
+    if (pCfg->Max_Tracks > 0 && pCfg->History_Depth > 0) pArena->History = (FilteredObject_t *)p;
+    p += plan.History_Bytes;
+    pArena->Scratch = p;
+
+    memset(pArena->Base, 0, plan.Track_Bytes + plan.History_Bytes);
+    return 0;
+}
+
+void adas_arena_destroy(AdasArena_t *pArena)
+{
+    if (!pArena) return;
+
+    if (pArena->Raw) {
+        free(pArena->Raw);
+        pArena->Heap_Calls++;
+    }
+    pArena->Raw = NULL;
+    pArena->Base = NULL;
+    pArena->Tracks = NULL;
+    pArena->History = NULL;
+    pArena->Scratch = NULL;
+    pArena->Scratch_Used = 0;
+}
+
+void adas_arena_frame_begin(AdasArena_t *pArena)
+{
+    if (!pArena) return;
+
+    pArena->Scratch_Used = 0;
+    pArena->Frame++;
+}
+
+void *adas_arena_alloc(AdasArena_t *pArena, size_t bytes, size_t align)
+{
+    if (!pArena || !pArena->Scratch) return NULL;
+    if (align == 0) align = ADAS_ARENA_ALIGN;
+    if ((align & (align - 1u)) != 0 || align > ADAS_ARENA_ALIGN) return NULL;
+
+    /* Scratch 는 ADAS_ARENA_ALIGN 정렬 → 오프셋 정렬로 충분 */
+    size_t off = align_up(pArena->Scratch_Used, align);
+    if (off > pArena->Plan.Scratch_Bytes || bytes > pArena->Plan.Scratch_Bytes - off) {
+        pArena->Frame_Fail++;
+        return NULL;
+    }
+    pArena->Scratch_Used = off + bytes;
+    if (pArena->Scratch_Used > pArena->Frame_High_Water) pArena->Frame_High_Water = pArena->Scratch_Used;
+    return pArena->Scratch + off;
+}
+
+FilteredObject_t *adas_arena_history(AdasArena_t *pArena, int slot)
+{
+    if (!pArena || !pArena->History || slot < 0 || slot >= pArena->Cfg.Max_Tracks) return NULL;
+
+    return pArena->History + (size_t)slot * (size_t)pArena->Cfg.History_Depth;
+}
+
+int adas_arena_footprint(const AdasArena_t *pArena, AdasArenaFootprint_t *pFoot)
+{
+    if (!pArena || !pFoot || !pArena->Base) return -1;
+
+    *pFoot = pArena->Plan;
+    pFoot->Frame_High_Water = pArena->Frame_High_Water;
+    return 0;
+}
+
+int adas_arena_target_selection(AdasArena_t              *pArena,
+                                const ObjectData_t       *pObjList,
+                                int                       objCount,
+                                const EgoData_t          *pEgo,
+                                const LaneData_t         *pLane,
+                                const LaneSelectOutput_t *pLs,
+                                ACC_Target_t             *pAccTarget,
+                                AEB_Target_t             *pAebTarget,
+                                int                      *pFilteredCount)
+{
+    if (pFilteredCount) *pFilteredCount = 0;
+    if (!pArena || (!pObjList && objCount > 0) || !pEgo || !pLane || !pLs || !pAccTarget || !pAebTarget
+        || objCount < 0 || objCount > pArena->Cfg.Max_Objects)
+    {
+        return -1;
+    }
+
+    /* 스크래치 되감기 지점 : 중간 리스트는 이 호출 안에서만 사용 */
+    size_t mark = pArena->Scratch_Used;
+    size_t n = (size_t)pArena->Cfg.Max_Objects;
+    FilteredObject_t  *filtered  = (FilteredObject_t *)adas_arena_alloc(pArena, n * sizeof(FilteredObject_t), 0);
+    PredictedObject_t *predicted = (PredictedObject_t *)adas_arena_alloc(pArena, n * sizeof(PredictedObject_t), 0);
+    if (!filtered || !predicted) {
+        pArena->Scratch_Used = mark;
+        return -1;
+    }
+
+    int fc = select_target_from_object_list(pObjList, objCount, pEgo, pLs, filtered, (int)n);
+    int pc = predict_object_future_path(filtered, fc, pLane, pLs, predicted, (int)n);
+    select_targets_for_acc_aeb(pEgo, predicted, pc, pLs, pAccTarget, pAebTarget);
+
+    pArena->Scratch_Used = mark;
+    if (pFilteredCount) *pFilteredCount = fc;
+    return pc;
+}
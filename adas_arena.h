@@ -0,0 +1,117 @@
+/****************************************************************************
+ * adas_arena.h
+ *
+ * - 파이프라인 메모리 계획 : 초기화 시 정렬된 아레나 1 개를 예약하고 이후 힙 호출 없음
+ *     . 크기는 구성(최대 객체 수 / 트랙 수 / 이력 깊이)에서 산출 (adas_arena_plan)
+ *     . 버퍼를 넘기면 그 버퍼를 사용 (정적 배치), NULL 이면 init 에서 malloc 1 회
+ * - 배치 (영역 시작은 ADAS_ARENA_ALIGN 정렬)
+ *     . 영구 : 트랙 테이블 (Max_Tracks > 0), 트랙별 이력 링 [Max_Tracks × History_Depth]
+ *     . 틱 스크래치 : bump 포인터, adas_arena_frame_begin 에서 매 틱 되감기
+ *       (Filtered / Predicted [Max_Objects] + Extra_Scratch 바이트)
+ * - 스크래치 할당 실패(용량 초과)는 NULL + Frame_Fail 카운트, 기존 할당은 유지
+ * - adas_arena_target_selection : 객체 수가 ADAS_PIPELINE_MAX_OBJ 를 넘는 통합 코드용
+ *   select → predict → ACC/AEB 대상 선정 (중간 리스트는 스크래치, 스택 사용량 일정)
+ * - 단일 스레드 전용 (스레드마다 아레나 1 개)
+ ****************************************************************************/
+#ifndef ADAS_ARENA_H
+#define ADAS_ARENA_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "adas_shared.h"
+#include "object_tracking.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ADAS_ARENA_ALIGN        64      /* [byte] 캐시 라인, 2 의 거듭제곱 */
+
+typedef struct {
+    int32_t Max_Objects;                /* 틱당 입력 객체 상한 (>= 1) */
+    int32_t Max_Tracks;                 /* 트랙 테이블 / 이력 링 수 (0 .. OBJ_TRACK_MAX) */
+    int32_t History_Depth;              /* 트랙별 이력 프레임 수 (>= 0) */
+    int32_t Extra_Scratch;              /* [byte] 통합 코드용 추가 틱 스크래치 (>= 0) */
+} AdasArenaConfig_t;
+
+/* 영역별 크기 [byte] (정렬 여유 포함) */
+typedef struct {
+    size_t Track_Bytes;
+    size_t History_Bytes;
+    size_t Scratch_Bytes;
+    size_t Total_Bytes;                 /* 예약 크기 (시작 정렬 여유 포함) */
+    size_t Frame_High_Water;            /* [byte] 틱 스크래치 최대 사용량 (adas_arena_footprint) */
+} AdasArenaFootprint_t;
+
+typedef struct {
+    AdasArenaConfig_t Cfg;
+    AdasArenaFootprint_t Plan;
+
+    uint8_t *Raw;                       /* malloc 결과 (소유 시), 아니면 NULL */
+    uint8_t *Base;                      /* 정렬된 시작 */
+
+    ObjectTrackTable_t *Tracks;         /* Max_Tracks == 0 이면 NULL */
+    FilteredObject_t   *History;        /* [Max_Tracks × History_Depth], 없으면 NULL */
+
+    uint8_t *Scratch;
+    size_t   Scratch_Used;
+    size_t   Frame_High_Water;
+    uint32_t Frame_Fail;                /* 누적 할당 실패 수 */
+    int64_t  Frame;                     /* adas_arena_frame_begin 호출 수 */
+    uint32_t Heap_Calls;                /* 누적 malloc / free 호출 수 (초기화 후 증가 없음) */
+} AdasArena_t;
+
+/**
+ * @brief 구성 → 영역별 크기 (할당 없음)
+ * @return 0 on success, -1 on invalid argument / 구성 오류
+ */
+int adas_arena_plan(const AdasArenaConfig_t *pCfg, AdasArenaFootprint_t *pPlan);
+
+/**
+ * @brief 아레나 예약 + 배치 (영구 영역 0 초기화, 트랙 테이블은 obj_track_init 으로 따로 초기화)
+ * @param[in] pBuf    : 외부 버퍼 (NULL 이면 malloc 1 회)
+ * @param[in] bufSize : 외부 버퍼 크기 (>= adas_arena_plan 의 Total_Bytes)
+ * @return 0 on success, -1 on invalid argument / 구성 오류 / 버퍼 부족 / 할당 실패
+ */
+int adas_arena_init(AdasArena_t *pArena, const AdasArenaConfig_t *pCfg, void *pBuf, size_t bufSize);
+
+/** @brief 소유한 버퍼 해제 (외부 버퍼는 그대로) */
+void adas_arena_destroy(AdasArena_t *pArena);
+
+/** @brief 틱 시작 : 스크래치 되감기 (이전 틱 스크래치 포인터는 무효) */
+void adas_arena_frame_begin(AdasArena_t *pArena);
+
+/**
+ * @brief 틱 스크래치 할당 (내용 미초기화)
+ * @param[in] align : 2 의 거듭제곱 (<= ADAS_ARENA_ALIGN), 0 이면 ADAS_ARENA_ALIGN
+ * @return 포인터, 용량 초과 / 인자 오류면 NULL
+ */
+void *adas_arena_alloc(AdasArena_t *pArena, size_t bytes, size_t align);
+
+/** @brief 트랙 slot 의 이력 링 (History_Depth 개), 범위 밖 / 이력 없음이면 NULL */
+FilteredObject_t *adas_arena_history(AdasArena_t *pArena, int slot);
+
+/** @brief 예약 크기 / 영역별 크기 / 틱 스크래치 최대 사용량 @return 0 / -1 */
+int adas_arena_footprint(const AdasArena_t *pArena, AdasArenaFootprint_t *pFoot);
+
+/**
+ * @brief 스크래치 위에서 select_target_from_object_list → predict_object_future_path
+ *        → select_targets_for_acc_aeb (결과는 호출자 배열 사용 시와 동일)
+ * @param[out] pFilteredCount : 필터링 결과 수 (NULL 허용)
+ * @return 예측 객체 수, -1 on invalid argument / objCount > Max_Objects / 스크래치 부족
+ */
+int adas_arena_target_selection(AdasArena_t              *pArena,
+                                const ObjectData_t       *pObjList,
+                                int                       objCount,
+                                const EgoData_t          *pEgo,
+                                const LaneData_t         *pLane,
+                                const LaneSelectOutput_t *pLs,
+                                ACC_Target_t             *pAccTarget,
+                                AEB_Target_t             *pAebTarget,
+                                int                      *pFilteredCount);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADAS_ARENA_H */
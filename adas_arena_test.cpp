@@ -0,0 +1,257 @@
+/*********************************************************************
+ * adas_arena_test.cpp  ―  파이프라인 메모리 계획 (정렬 아레나 / 틱 스크래치)
+ * DUT : adas_arena.c
+ *********************************************************************/
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "adas_arena.h"
+#include "target_selection.h"
+#include "test_rng.hpp"
+
+namespace {
+
+class AdasArenaTest : public ::testing::Test {
+protected:
+    AdasArena_t        arena;
+    AdasArenaConfig_t  cfg;
+    EgoData_t          ego;
+    LaneData_t         lane;
+    LaneSelectOutput_t ls;
+
+    void SetUp() override
+    {
+        std::memset(&arena, 0, sizeof(arena));
+        cfg.Max_Objects   = 512;
+        cfg.Max_Tracks    = 64;
+        cfg.History_Depth = 8;
+        cfg.Extra_Scratch = 1000;
+
+        std::memset(&ego, 0, sizeof(ego));
+        ego.Ego_Velocity_X = 20.0f;
+        std::memset(&lane, 0, sizeof(lane));
+        lane.Lane_Type  = LANE_TYPE_STRAIGHT;
+        lane.Lane_Width = 3.5f;
+        std::memset(&ls, 0, sizeof(ls));
+        ls.LS_Lane_Type      = LANE_TYPE_STRAIGHT;
+        ls.LS_Lane_Width     = 3.5f;
+        ls.LS_Is_Within_Lane = true;
+    }
+
+    void TearDown() override { adas_arena_destroy(&arena); }
+
+    static void random_objects(std::vector<ObjectData_t> &v, uint32_t seed)
+    {
+        TestRng rng(seed);
+        for (size_t i = 0; i < v.size(); i++) {
+            ObjectData_t &o = v[i];
+            std::memset(&o, 0, sizeof(o));
+            o.Object_ID     = (int)i + 1;
+            o.Object_Type   = (i % 5 == 0) ? OBJTYPE_PEDESTRIAN : OBJTYPE_CAR;
+            o.Position_X    = rng.uni(-20.0f, 200.0f);
+            o.Position_Y    = rng.uni(-6.0f, 6.0f);
+            o.Distance      = o.Position_X;
+            o.Velocity_X    = rng.uni(0.0f, 30.0f);
+            o.Velocity_Y    = rng.uni(-1.0f, 1.0f);
+            o.Heading       = rng.uni(-20.0f, 20.0f);
+            o.Object_Status = OBJSTAT_MOVING;
+        }
+    }
+};
+
+/* TC_ARENA_EQ_01 : 계획 크기 = 영역 합, 영역 정렬 / 겹침 없음, 조회 = 계획 */
+TEST_F(AdasArenaTest, TC_ARENA_EQ_01)
+{
+    AdasArenaFootprint_t plan, foot;
+    ASSERT_EQ(adas_arena_plan(&cfg, &plan), 0);
+    EXPECT_GE(plan.Track_Bytes, sizeof(ObjectTrackTable_t));
+    EXPECT_GE(plan.History_Bytes, 64u * 8u * sizeof(FilteredObject_t));
+    EXPECT_GE(plan.Scratch_Bytes, 512u * (sizeof(FilteredObject_t) + sizeof(PredictedObject_t)) + 1000u);
+    EXPECT_EQ(plan.Total_Bytes, plan.Track_Bytes + plan.History_Bytes + plan.Scratch_Bytes + ADAS_ARENA_ALIGN);
+
+    ASSERT_EQ(adas_arena_init(&arena, &cfg, nullptr, 0), 0);
+    EXPECT_EQ(arena.Heap_Calls, 1u);
+    ASSERT_EQ(adas_arena_footprint(&arena, &foot), 0);
+    EXPECT_EQ(foot.Total_Bytes, plan.Total_Bytes);
+    EXPECT_EQ(foot.Frame_High_Water, 0u);
+
+    uintptr_t base = (uintptr_t)arena.Base;
+    EXPECT_EQ(base % ADAS_ARENA_ALIGN, 0u);
+    EXPECT_EQ((uintptr_t)arena.Tracks, base);
+    EXPECT_EQ((uintptr_t)arena.History, base + plan.Track_Bytes);
+    EXPECT_EQ((uintptr_t)arena.Scratch, base + plan.Track_Bytes + plan.History_Bytes);
+    EXPECT_EQ((uintptr_t)arena.Scratch % ADAS_ARENA_ALIGN, 0u);
+
+    EXPECT_EQ(adas_arena_history(&arena, 0), arena.History);
+    EXPECT_EQ(adas_arena_history(&arena, 63), arena.History + 63 * 8);
+    EXPECT_EQ(adas_arena_history(&arena, 64), nullptr);
+    EXPECT_EQ(adas_arena_history(&arena, -1), nullptr);
+
+    /* 트랙 테이블은 아레나 안에서 초기화 / 사용 가능 */
+    ObjTrackConfig_t tc;
+    obj_track_default_config(&tc);
+    EXPECT_EQ(obj_track_init(arena.Tracks, &tc), 0);
+}
+
+/* TC_ARENA_EQ_02 : 아레나 경유 대상 선정 = 호출자 배열 경유 (객체 512 개, 200 틱) */
+TEST_F(AdasArenaTest, TC_ARENA_EQ_02)
+{
+    ASSERT_EQ(adas_arena_init(&arena, &cfg, nullptr, 0), 0);
+    std::vector<ObjectData_t>      obj(512);
+    std::vector<FilteredObject_t>  f(512);
+    std::vector<PredictedObject_t> p(512);
+
+    for (int t = 0; t < 200; t++) {
+        random_objects(obj, 100u + (uint32_t)t);
+        int n = 1 + (t * 37) % 512;
+
+        ACC_Target_t accRef, accA;
+        AEB_Target_t aebRef, aebA;
+        std::memset(&accRef, 0, sizeof(accRef));
+        std::memset(&aebRef, 0, sizeof(aebRef));
+        std::memset(&accA, 0, sizeof(accA));
+        std::memset(&aebA, 0, sizeof(aebA));
+        int fcRef = select_target_from_object_list(obj.data(), n, &ego, &ls, f.data(), 512);
+        int pcRef = predict_object_future_path(f.data(), fcRef, &lane, &ls, p.data(), 512);
+        select_targets_for_acc_aeb(&ego, p.data(), pcRef, &ls, &accRef, &aebRef);
+
+        adas_arena_frame_begin(&arena);
+        int fc = -1;
+        int pc = adas_arena_target_selection(&arena, obj.data(), n, &ego, &lane, &ls, &accA, &aebA, &fc);
+        ASSERT_EQ(pc, pcRef) << "t " << t;
+        ASSERT_EQ(fc, fcRef);
+        ASSERT_EQ(std::memcmp(&accA, &accRef, sizeof(accA)), 0);
+        ASSERT_EQ(std::memcmp(&aebA, &aebRef, sizeof(aebA)), 0);
+        EXPECT_EQ(arena.Scratch_Used, 0u);          /* 중간 리스트 반환 */
+    }
+    EXPECT_EQ(arena.Heap_Calls, 1u);                /* 초기화 후 힙 호출 없음 */
+    EXPECT_EQ(arena.Frame, 200);
+    EXPECT_EQ(arena.Frame_Fail, 0u);
+    EXPECT_GE(arena.Frame_High_Water, 512u * (sizeof(FilteredObject_t) + sizeof(PredictedObject_t)));
+}
+
+/* TC_ARENA_EQ_03 : 틱마다 되감기 → 같은 주소 재사용, 외부(정적) 버퍼는 힙 호출 0 */
+TEST_F(AdasArenaTest, TC_ARENA_EQ_03)
+{
+    AdasArenaFootprint_t plan;
+    ASSERT_EQ(adas_arena_plan(&cfg, &plan), 0);
+    std::vector<uint8_t> buf(plan.Total_Bytes);
+    ASSERT_EQ(adas_arena_init(&arena, &cfg, buf.data() + 1, plan.Total_Bytes - 1), -1);    /* 부족 */
+    ASSERT_EQ(adas_arena_init(&arena, &cfg, buf.data(), buf.size()), 0);
+    EXPECT_EQ(arena.Heap_Calls, 0u);
+    EXPECT_GE(arena.Base, buf.data());
+    EXPECT_LE(arena.Scratch + plan.Scratch_Bytes, buf.data() + buf.size());
+
+    void *first = nullptr;
+    for (int t = 0; t < 1000; t++) {
+        adas_arena_frame_begin(&arena);
+        void *a = adas_arena_alloc(&arena, 100, 4);
+        void *b = adas_arena_alloc(&arena, 10, 16);
+        ASSERT_NE(a, nullptr);
+        ASSERT_NE(b, nullptr);
+        EXPECT_EQ((uintptr_t)b % 16u, 0u);
+        EXPECT_GE((uint8_t *)b, (uint8_t *)a + 100);
+        if (t == 0) first = a;
+        ASSERT_EQ(a, first);
+    }
+    adas_arena_destroy(&arena);
+    EXPECT_EQ(arena.Heap_Calls, 0u);                /* 외부 버퍼는 해제 안 함 */
+}
+
+/* TC_ARENA_BV_01 : 스크래치 경계 (정확히 가득 → 성공, 1 바이트 초과 → NULL), 트랙 / 이력 없음 */
+TEST_F(AdasArenaTest, TC_ARENA_BV_01)
+{
+    cfg.Max_Objects   = 1;
+    cfg.Max_Tracks    = 0;
+    cfg.History_Depth = 0;
+    cfg.Extra_Scratch = 0;
+    ASSERT_EQ(adas_arena_init(&arena, &cfg, nullptr, 0), 0);
+    EXPECT_EQ(arena.Tracks, nullptr);
+    EXPECT_EQ(arena.History, nullptr);
+    EXPECT_EQ(adas_arena_history(&arena, 0), nullptr);
+
+    size_t cap = arena.Plan.Scratch_Bytes;
+    adas_arena_frame_begin(&arena);
+    EXPECT_NE(adas_arena_alloc(&arena, cap, 1), nullptr);
+    EXPECT_EQ(adas_arena_alloc(&arena, 1, 1), nullptr);
+    EXPECT_EQ(adas_arena_alloc(&arena, 0, 1), arena.Scratch + cap);    /* 0 바이트는 끝 주소 */
+    EXPECT_EQ(arena.Frame_Fail, 1u);
+
+    adas_arena_frame_begin(&arena);
+    EXPECT_EQ(adas_arena_alloc(&arena, cap + 1, 1), nullptr);
+    EXPECT_EQ(adas_arena_alloc(&arena, (size_t)-1, 1), nullptr);
+    EXPECT_EQ(arena.Frame_Fail, 3u);
+    EXPECT_EQ(arena.Scratch_Used, 0u);              /* 실패는 사용량 그대로 */
+
+    /* Max_Objects 초과 객체 수는 거부, 상한 정확히는 허용 */
+    ObjectData_t obj[2];
+    std::memset(obj, 0, sizeof(obj));
+    ACC_Target_t acc;
+    AEB_Target_t aeb;
+    EXPECT_EQ(adas_arena_target_selection(&arena, obj, 2, &ego, &lane, &ls, &acc, &aeb, nullptr), -1);
+    EXPECT_GE(adas_arena_target_selection(&arena, obj, 1, &ego, &lane, &ls, &acc, &aeb, nullptr), 0);
+    EXPECT_EQ(adas_arena_target_selection(&arena, nullptr, 0, &ego, &lane, &ls, &acc, &aeb, nullptr), 0);
+
+    /* 스크래치가 이미 차 있으면 중간 리스트 할당 실패 → -1, 사용량 복원 */
+    adas_arena_frame_begin(&arena);
+    ASSERT_NE(adas_arena_alloc(&arena, 64, 0), nullptr);
+    size_t used = arena.Scratch_Used;
+    EXPECT_EQ(adas_arena_target_selection(&arena, obj, 1, &ego, &lane, &ls, &acc, &aeb, nullptr), -1);
+    EXPECT_EQ(arena.Scratch_Used, used);
+}
+
+/* TC_ARENA_RA_01 : 인자 / 구성 오류 */
+TEST_F(AdasArenaTest, TC_ARENA_RA_01)
+{
+    AdasArenaFootprint_t plan;
+    EXPECT_EQ(adas_arena_plan(nullptr, &plan), -1);
+    EXPECT_EQ(adas_arena_plan(&cfg, nullptr), -1);
+
+    AdasArenaConfig_t bad = cfg;
+    bad.Max_Objects = 0;
+    EXPECT_EQ(adas_arena_plan(&bad, &plan), -1);
+    bad = cfg;
+    bad.Max_Tracks = OBJ_TRACK_MAX + 1;
+    EXPECT_EQ(adas_arena_plan(&bad, &plan), -1);
+    bad = cfg;
+    bad.History_Depth = -1;
+    EXPECT_EQ(adas_arena_plan(&bad, &plan), -1);
+    bad = cfg;
+    bad.Extra_Scratch = -1;
+    EXPECT_EQ(adas_arena_init(&arena, &bad, nullptr, 0), -1);
+    EXPECT_EQ(adas_arena_init(nullptr, &cfg, nullptr, 0), -1);
+
+    /* 초기화 전 / 해제 후 */
+    EXPECT_EQ(adas_arena_alloc(&arena, 1, 0), nullptr);
+    EXPECT_EQ(adas_arena_footprint(&arena, &plan), -1);
+    ASSERT_EQ(adas_arena_init(&arena, &cfg, nullptr, 0), 0);
+    EXPECT_EQ(adas_arena_alloc(&arena, 1, 3), nullptr);                    /* 2 의 거듭제곱 아님 */
+    EXPECT_EQ(adas_arena_alloc(&arena, 1, 2 * ADAS_ARENA_ALIGN), nullptr);
+    EXPECT_EQ(adas_arena_alloc(nullptr, 1, 0), nullptr);
+    EXPECT_EQ(adas_arena_footprint(nullptr, &plan), -1);
+    EXPECT_EQ(adas_arena_footprint(&arena, nullptr), -1);
+    EXPECT_EQ(adas_arena_history(nullptr, 0), nullptr);
+
+    ACC_Target_t acc;
+    AEB_Target_t aeb;
+    ObjectData_t obj;
+    std::memset(&obj, 0, sizeof(obj));
+    int fc = 7;
+    EXPECT_EQ(adas_arena_target_selection(nullptr, &obj, 1, &ego, &lane, &ls, &acc, &aeb, &fc), -1);
+    EXPECT_EQ(fc, 0);
+    EXPECT_EQ(adas_arena_target_selection(&arena, &obj, -1, &ego, &lane, &ls, &acc, &aeb, &fc), -1);
+    EXPECT_EQ(adas_arena_target_selection(&arena, nullptr, 1, &ego, &lane, &ls, &acc, &aeb, &fc), -1);
+    EXPECT_EQ(adas_arena_target_selection(&arena, &obj, 1, nullptr, &lane, &ls, &acc, &aeb, &fc), -1);
+    EXPECT_EQ(adas_arena_target_selection(&arena, &obj, 1, &ego, &lane, &ls, nullptr, &aeb, &fc), -1);
+
+    adas_arena_destroy(&arena);
+    EXPECT_EQ(arena.Heap_Calls, 2u);
+    EXPECT_EQ(adas_arena_alloc(&arena, 1, 0), nullptr);
+    adas_arena_destroy(&arena);                     /* 두 번 해제 안전 */
+    adas_arena_destroy(nullptr);
+    EXPECT_EQ(arena.Heap_Calls, 2u);
+}
+
+}  // namespace
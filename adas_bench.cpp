@@ -0,0 +1,121 @@
+/*********************************************************************
+ * adas_bench.cpp  ―  구성 템플릿 벤치마크
+ *
+ * 사용 : adas_bench [반복 횟수(기본 200)]
+ *   - 곡선/직선 혼합 임의 프레임 1024 개를 변형별로 반복 실행
+ *   - 프레임당 지연 [ns] (5 회 중 최소) 와 C API 대비 배율 출력
+ *   - C API 와 DefaultConfig 결과 일치 확인 (불일치 시 exit 1)
+ *   - 코드 크기는 `cmake --build . --target adas_bench_size` (변형 오브젝트 size)
+ *   - 최적화 빌드(-DCMAKE_BUILD_TYPE=Release) 에서 측정할 것
+ *********************************************************************/
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "adas_bench.h"
+
+namespace {
+
+typedef void (*BenchFn)(const AdasBenchFrame_t *, int, AdasBenchResult_t *);
+
+struct Variant {
+    const char *name;
+    BenchFn     fn;
+};
+
+const Variant kVariants[] = {
+    { "c_api",                  adas_bench_run_capi    },
+    { "tpl<DefaultConfig>",     adas_bench_run_default },
+    { "tpl<NoCurveConfig>",     adas_bench_run_nocurve },
+    { "tpl<PedestrianAebConfig>", adas_bench_run_pedaeb },
+};
+
+uint32_t g_seed = 29u;
+
+float uni(float lo, float hi)
+{
+    g_seed = g_seed * 1664525u + 1013904223u;
+    return lo + (hi - lo) * (float)(g_seed >> 8) / 16777216.0f;
+}
+
+void make_frames(std::vector<AdasBenchFrame_t> &frames)
+{
+    for (AdasBenchFrame_t &f : frames) {
+        std::memset(&f, 0, sizeof(f));
+        bool curve = (uni(0.0f, 1.0f) < 0.5f);
+        f.Lane.Lane_Type           = curve ? LANE_TYPE_CURVE : LANE_TYPE_STRAIGHT;
+        f.Lane.Lane_Curvature      = curve ? uni(150.0f, 790.0f) : 0.0f;
+        f.Lane.Next_Lane_Curvature = curve ? uni(150.0f, 1500.0f) : 0.0f;
+        f.Lane.Lane_Offset         = uni(-0.5f, 0.5f);
+        f.Lane.Lane_Heading        = uni(-10.0f, 10.0f);
+        f.Lane.Lane_Width          = 3.5f;
+        f.Ego.Ego_Velocity_X       = uni(5.0f, 35.0f);
+        f.Ego.Ego_Heading          = uni(-10.0f, 10.0f);
+        f.Obj_Count                = ADAS_BENCH_MAX_OBJ;
+        for (int i = 0; i < f.Obj_Count; i++) {
+            ObjectData_t &o = f.Obj[i];
+            o.Object_ID     = i + 1;
+            o.Object_Type   = (ObjectType_e)(g_seed % 4);
+            o.Position_X    = uni(0.0f, 210.0f);
+            o.Position_Y    = uni(-4.0f, 4.0f);
+            o.Distance      = o.Position_X;
+            o.Velocity_X    = uni(0.0f, 35.0f);
+            o.Velocity_Y    = uni(-0.5f, 0.5f);
+            o.Heading       = uni(-20.0f, 20.0f);
+            o.Object_Status = OBJSTAT_MOVING;
+        }
+    }
+}
+
+double run_ns_per_frame(const Variant &v, const std::vector<AdasBenchFrame_t> &frames,
+                        std::vector<AdasBenchResult_t> &out, int reps)
+{
+    double best = 1e30;
+    for (int trial = 0; trial < 5; trial++) {
+        auto t0 = std::chrono::steady_clock::now();
+        for (int r = 0; r < reps; r++) {
+            v.fn(frames.data(), (int)frames.size(), out.data());
+        }
+        auto t1 = std::chrono::steady_clock::now();
+        double ns = std::chrono::duration<double, std::nano>(t1 - t0).count() /
+                    ((double)reps * (double)frames.size());
+        if (ns < best) best = ns;
+    }
+    return best;
+}
+
+} /* namespace */
+
+int main(int argc, char **argv)
+{
+    int reps = (argc > 1) ? std::atoi(argv[1]) : 200;
+    if (reps <= 0) reps = 1;
+
+    std::vector<AdasBenchFrame_t>  frames(1024);
+    std::vector<AdasBenchResult_t> ref(frames.size()), out(frames.size());
+    make_frames(frames);
+
+#ifndef NDEBUG
+    std::printf("[주의] 비최적화 빌드 : -DCMAKE_BUILD_TYPE=Release 로 측정 권장\n");
+#endif
+
+    double baseNs = 0.0;
+    int rc = 0;
+    std::printf("%-26s %12s %8s\n", "variant", "ns/frame", "vs C");
+    for (const Variant &v : kVariants) {
+        std::vector<AdasBenchResult_t> &dst = (&v == &kVariants[0]) ? ref : out;
+        double ns = run_ns_per_frame(v, frames, dst, reps);
+        if (&v == &kVariants[0]) baseNs = ns;
+        std::printf("%-26s %12.1f %7.2fx\n", v.name, ns, baseNs / ns);
+
+        if (&v == &kVariants[1] &&
+            std::memcmp(ref.data(), out.data(), sizeof(AdasBenchResult_t) * ref.size()) != 0) {
+            std::printf("  !! DefaultConfig 결과가 C API 와 다름\n");
+            rc = 1;
+        }
+    }
+    return rc;
+}
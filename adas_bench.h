@@ -0,0 +1,51 @@
+/****************************************************************************
+ * adas_bench.h
+ *
+ * - 구성 템플릿 벤치마크 (adas_bench) 공용 정의
+ * - 변형마다 adas_bench_variant.cpp 를 별도 오브젝트로 컴파일
+ *   (ADAS_BENCH_VARIANT / ADAS_BENCH_FN) → 오브젝트 .text 크기 = 변형 코드 크기
+ * - 측정 구간 : LaneSelection → select_target_from_object_list
+ *               → predict_object_future_path → select_targets_for_acc_aeb
+ *               → acc_mode_selection
+ ****************************************************************************/
+#ifndef ADAS_BENCH_H
+#define ADAS_BENCH_H
+
+#include "adas_shared.h"
+
+#define ADAS_BENCH_MAX_OBJ  32
+
+/* 변형 번호 (ADAS_BENCH_VARIANT) */
+#define ADAS_BENCH_CAPI        0    /* C API (libadas) */
+#define ADAS_BENCH_DEFAULT     1    /* adas::DefaultConfig */
+#define ADAS_BENCH_NOCURVE     2    /* adas::NoCurveConfig */
+#define ADAS_BENCH_PEDAEB      3    /* adas::PedestrianAebConfig */
+
+typedef struct {
+    LaneData_t   Lane;
+    EgoData_t    Ego;
+    ObjectData_t Obj[ADAS_BENCH_MAX_OBJ];
+    int          Obj_Count;
+} AdasBenchFrame_t;
+
+typedef struct {
+    int Acc_Target_ID;
+    int Aeb_Target_ID;
+    int Acc_Mode;
+    int Filtered_Count;
+} AdasBenchResult_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void adas_bench_run_capi(const AdasBenchFrame_t *pFrames, int count, AdasBenchResult_t *pOut);
+void adas_bench_run_default(const AdasBenchFrame_t *pFrames, int count, AdasBenchResult_t *pOut);
+void adas_bench_run_nocurve(const AdasBenchFrame_t *pFrames, int count, AdasBenchResult_t *pOut);
+void adas_bench_run_pedaeb(const AdasBenchFrame_t *pFrames, int count, AdasBenchResult_t *pOut);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADAS_BENCH_H */
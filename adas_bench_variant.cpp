@@ -0,0 +1,79 @@
+/*********************************************************************
+ * adas_bench_variant.cpp  ―  adas_bench 변형 1 개 (ADAS_BENCH_VARIANT)
+ * - CMake 에서 변형마다 OBJECT 라이브러리로 따로 컴파일
+ *********************************************************************/
+#include "adas_bench.h"
+#include "lane_selection_tpl.hpp"
+#include "target_selection_tpl.hpp"
+#include "acc_tpl.hpp"
+
+#if !defined(ADAS_BENCH_VARIANT) || !defined(ADAS_BENCH_FN)
+#error "ADAS_BENCH_VARIANT / ADAS_BENCH_FN 정의 필요"
+#endif
+
+#if ADAS_BENCH_VARIANT == ADAS_BENCH_NOCURVE
+using BenchCfg = adas::NoCurveConfig;
+#elif ADAS_BENCH_VARIANT == ADAS_BENCH_PEDAEB
+using BenchCfg = adas::PedestrianAebConfig;
+#else
+using BenchCfg = adas::DefaultConfig;
+#endif
+
+namespace {
+
+/* ACC_Target_t (Target Selection 출력) → ACC_Target_Data_t (ACC 입력) */
+ACC_Target_Data_t to_acc_input(const ACC_Target_t &t)
+{
+    ACC_Target_Data_t d{};
+    d.ACC_Target_ID         = t.ACC_Target_ID;
+    d.ACC_Target_Distance   = t.ACC_Target_Distance;
+    d.ACC_Target_Status     = (ACC_Target_Status_e)t.ACC_Target_Status;
+    d.ACC_Target_Situation  = (t.ACC_Target_Situation == TGT_SITU_CUTIN) ? ACC_TARGET_CUT_IN
+                            : (t.ACC_Target_Situation == TGT_SITU_CUTOUT) ? ACC_TARGET_CUT_OUT
+                            : ACC_TARGET_NORMAL;
+    d.ACC_Target_Velocity_X = t.ACC_Target_Vel_X;
+    return d;
+}
+
+} /* namespace */
+
+extern "C" void ADAS_BENCH_FN(const AdasBenchFrame_t *pFrames, int count, AdasBenchResult_t *pOut)
+{
+    LaneSelectOutput_t ls;
+    FilteredObject_t   fl[ADAS_BENCH_MAX_OBJ];
+    PredictedObject_t  pl[ADAS_BENCH_MAX_OBJ];
+    ACC_Target_t       acc;
+    AEB_Target_t       aeb;
+
+    for (int i = 0; i < count; i++) {
+        const AdasBenchFrame_t *f = &pFrames[i];
+        int fc;
+#if ADAS_BENCH_VARIANT == ADAS_BENCH_CAPI
+        LaneSelection(&f->Lane, &f->Ego, &ls);
+        fc = select_target_from_object_list(f->Obj, f->Obj_Count, &f->Ego, &ls, fl, ADAS_BENCH_MAX_OBJ);
+#else
+        adas::LaneSelection<BenchCfg>(&f->Lane, &f->Ego, &ls);
+        fc = adas::select_target_from_object_list<BenchCfg>(f->Obj, f->Obj_Count, &f->Ego, &ls,
+                                                            fl, ADAS_BENCH_MAX_OBJ);
+#endif
+        int pc = predict_object_future_path(fl, fc, &f->Lane, &ls, pl, ADAS_BENCH_MAX_OBJ);
+#if ADAS_BENCH_VARIANT == ADAS_BENCH_CAPI
+        select_targets_for_acc_aeb(&f->Ego, pl, pc, &ls, &acc, &aeb);
+#else
+        adas::select_targets_for_acc_aeb<BenchCfg>(&f->Ego, pl, pc, &ls, &acc, &aeb);
+#endif
+        ACC_Target_Data_t accIn = to_acc_input(acc);
+        Ego_Data_t        accEgo{ f->Ego.Ego_Velocity_X, f->Ego.Ego_Acceleration_X };
+        Lane_Data_t       accLane{ f->Lane.Lane_Curvature, f->Lane.Next_Lane_Curvature,
+                                   ls.LS_Heading_Error, ls.LS_Is_Curved_Lane };
+#if ADAS_BENCH_VARIANT == ADAS_BENCH_CAPI
+        ACC_Mode_e mode = acc_mode_selection(&accIn, &accEgo, &accLane);
+#else
+        ACC_Mode_e mode = adas::acc_mode_selection<BenchCfg>(&accIn, &accEgo, &accLane);
+#endif
+        pOut[i].Acc_Target_ID  = acc.ACC_Target_ID;
+        pOut[i].Aeb_Target_ID  = aeb.AEB_Target_ID;
+        pOut[i].Acc_Mode       = (int)mode;
+        pOut[i].Filtered_Count = fc;
+    }
+}
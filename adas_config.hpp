@@ -0,0 +1,85 @@
+/****************************************************************************
+ * adas_config.hpp
+ *
+ * - 컴파일 타임 구성(C++17) : 흩어진 #define / 리터럴 임계값을 구성 타입의
+ *   static constexpr 멤버로 모음 → *_tpl.hpp 템플릿 인자로 전달
+ * - 구성 값/플래그가 상수이므로 컴파일러가 분기를 상수 접기 / 제거
+ *   (예: CurveHandling = false → 곡선 보정 코드 및 cosf 호출 자체가 없어짐)
+ * - DefaultConfig 는 C API(lane_selection.c, target_selection.c, acc.c, aeb.c,
+ *   lfa.c) 와 같은 값 → 템플릿 기본 인스턴스 결과가 C API 와 비트 단위 일치
+ * - 변형 구성은 DefaultConfig 를 상속해 필요한 멤버만 다시 선언
+ ****************************************************************************/
+#ifndef ADAS_CONFIG_HPP
+#define ADAS_CONFIG_HPP
+
+#include "adas_shared.h"
+
+namespace adas {
+
+/* ObjectType_e → 비트마스크 */
+constexpr unsigned objtype_bit(ObjectType_e t)
+{
+    return 1u << static_cast<unsigned>(t);
+}
+
+constexpr unsigned OBJTYPE_MASK_ALL = objtype_bit(OBJTYPE_CAR) | objtype_bit(OBJTYPE_PEDESTRIAN) |
+                                      objtype_bit(OBJTYPE_BICYCLE) | objtype_bit(OBJTYPE_MOTORCYCLE);
+
+/*---------------------------------------------------------
+ * 기본 구성 : C API 와 동일
+ *---------------------------------------------------------*/
+struct DefaultConfig {
+    /* Lane Selection */
+    static constexpr float    LaneCurveThreshold     = LANE_CURVE_THRESHOLD;       /* 곡률 반경 [m] 미만 → 곡선 */
+    static constexpr float    LaneCurveDiffThreshold = LANE_CURVE_DIFF_THRESHOLD;  /* 곡률 전이 [m] */
+
+    /* Target Selection */
+    static constexpr float    MaxObjectDistance      = MAX_OBJECT_DISTANCE;        /* 범위 필터 / 점수 기준 [m] */
+    static constexpr float    InPathHalfWidth        = 1.75f;                      /* 정면(|y|) [m] */
+    static constexpr float    SideHalfWidth          = 3.5f;                       /* 측면(|y|) [m] */
+    static constexpr unsigned AebObjectTypes         = OBJTYPE_MASK_ALL;           /* AEB 후보 객체 유형 */
+
+    /* ACC */
+    static constexpr float    AccSpeedModeDist       = ACC_SPEED_MODE_DIST;        /* 초과 → Speed [m] */
+    static constexpr float    AccDistModeDist        = ACC_DIST_MODE_DIST;         /* 미만 → Distance [m] */
+
+    /* AEB */
+    static constexpr float    AebAlertBufferTime     = AEB_ALERT_BUFFER_TIME;      /* [s] */
+
+    /* LFA */
+    static constexpr float    LfaSpeedThreshold      = LFA_LOW_SPEED_THRESHOLD;    /* [m/s] */
+
+    /* 곡선 차로 처리 (곡선 판정, 횡방향 임계 / 거리 보정, ACC 곡선 가점) */
+    static constexpr bool     CurveHandling          = true;
+};
+
+/* 곡선 처리 없음 : 직선 전용 도로(고속도로 구간 등) */
+struct NoCurveConfig : DefaultConfig {
+    static constexpr bool     CurveHandling          = false;
+};
+
+/* 보행자 전용 AEB */
+struct PedestrianAebConfig : DefaultConfig {
+    static constexpr unsigned AebObjectTypes         = objtype_bit(OBJTYPE_PEDESTRIAN);
+};
+
+/*---------------------------------------------------------
+ * 구성 검증 : 템플릿 인스턴스화 시 static_assert
+ *---------------------------------------------------------*/
+template <class Cfg>
+constexpr bool config_is_valid()
+{
+    static_assert(Cfg::LaneCurveThreshold > 0.0f,                "LaneCurveThreshold > 0");
+    static_assert(Cfg::MaxObjectDistance > 0.0f,                 "MaxObjectDistance > 0");
+    static_assert(Cfg::InPathHalfWidth > 0.0f &&
+                  Cfg::InPathHalfWidth <= Cfg::SideHalfWidth,    "0 < InPathHalfWidth <= SideHalfWidth");
+    static_assert((Cfg::AebObjectTypes & ~OBJTYPE_MASK_ALL) == 0, "AebObjectTypes : ObjectType_e 비트만");
+    static_assert(Cfg::AccDistModeDist <= Cfg::AccSpeedModeDist, "AccDistModeDist <= AccSpeedModeDist");
+    static_assert(Cfg::AebAlertBufferTime >= 0.0f,               "AebAlertBufferTime >= 0");
+    static_assert(Cfg::LfaSpeedThreshold > 0.0f,                 "LfaSpeedThreshold > 0");
+    return true;
+}
+
+} /* namespace adas */
+
+#endif /* ADAS_CONFIG_HPP */
@@ -0,0 +1,90 @@
+#include <string.h>
+
+#include "adas_multirate.h"
+#include "aeb.h"            /* AEB_MODE_BRAKE */
+
+void adas_mr_default_config(AdasMultirateConfig_t *pCfg)
+{
+    if (!pCfg) return;
+
+    pCfg->Fast_Period_Ms    = 2.0f;
+    pCfg->Acc_Divider       = 5;
+    pCfg->Lfa_Divider       = 10;
+    pCfg->Max_Output_Age_Ms = 50.0f;
+}
+
+int adas_mr_init(AdasMultirate_t *pMr, const AdasMultirateConfig_t *pCfg)
+{
+    if (!pMr || !pCfg || !(pCfg->Fast_Period_Ms > 0.0f)
+        || pCfg->Acc_Divider < 1 || pCfg->Lfa_Divider < 1 || !(pCfg->Max_Output_Age_Ms >= 0.0f))
+    {
+        return -1;
+    }
+
+    memset(pMr, 0, sizeof(*pMr));
+    pMr->Cfg = *pCfg;
+    adas_pipeline_init(&pMr->Pipe);
+    return 0;
+}
+
+int adas_mr_step(AdasMultirate_t *pMr, const AdasPipelineInput_t *pIn, float objTimeMs,
+                 AdasMultirateOutput_t *pOut)
+{
+    if (!pMr || !pIn || !pOut || !(pMr->Cfg.Fast_Period_Ms > 0.0f)) return -1;
+
+    AdasPipelineOutput_t *o = &pOut->Out;
+    AdasPipelineTargets_t tgt;
+    const float now = pIn->Time.Current_Time;
+
+    memset(pOut, 0, sizeof(*pOut));
+    pOut->Brake_Latency_Ms = -1.0f;
+
+    /* 빠른 경로 : Ego / Lane / Target → AEB (매 틱) */
+    if (adas_pipeline_stage_ego_lane(&pMr->Pipe, pIn, o) != 0) return -1;
+    adas_pipeline_stage_target(&pMr->Pipe, pIn, o, &tgt);
+    o->Decel_Aeb = adas_pipeline_aeb_stage(&tgt.Aeb_Target, &o->Ego, &o->Aeb_Mode, &o->Ttc);
+
+    /* 느린 경로 : 분주 틱에서만 실행, 나머지 틱은 최신 출력 유지 */
+    if (pMr->Tick % pMr->Cfg.Acc_Divider == 0) {
+        float dt = pMr->Cfg.Fast_Period_Ms * (float)pMr->Cfg.Acc_Divider / 1000.0f;
+        pMr->Accel_Acc = adas_pipeline_acc_stage(&tgt.Acc_Target, &o->Ego, &pIn->Lane, &o->Ls,
+                                                 now, dt, &pMr->Acc_Mode);
+        pMr->Acc_Time  = now;
+        pMr->Acc_Valid = 1;
+        pOut->Ran_Acc  = 1;
+    }
+    if (pMr->Tick % pMr->Cfg.Lfa_Divider == 0) {
+        float dt = pMr->Cfg.Fast_Period_Ms * (float)pMr->Cfg.Lfa_Divider / 1000.0f;
+        pMr->Steer_Lfa = adas_pipeline_lfa_stage(&o->Ego, &o->Ls, pMr->Pipe.Prev_Steer,
+                                                 dt, &pMr->Lfa_Mode);
+        pMr->Pipe.Prev_Steer = pMr->Steer_Lfa;
+        pMr->Lfa_Time  = now;
+        pMr->Lfa_Valid = 1;
+        pOut->Ran_Lfa  = 1;
+    }
+    pMr->Tick++;
+
+    /* 병합 : 최신 출력 + 나이 검사 */
+    pOut->Acc_Age_Ms = now - pMr->Acc_Time;
+    pOut->Lfa_Age_Ms = now - pMr->Lfa_Time;
+    pOut->Acc_Stale  = (uint8_t)(!pMr->Acc_Valid || pOut->Acc_Age_Ms > pMr->Cfg.Max_Output_Age_Ms);
+    pOut->Lfa_Stale  = (uint8_t)(!pMr->Lfa_Valid || pOut->Lfa_Age_Ms > pMr->Cfg.Max_Output_Age_Ms);
+    o->Acc_Mode  = pMr->Acc_Mode;
+    o->Lfa_Mode  = pMr->Lfa_Mode;
+    o->Accel_Acc = pOut->Acc_Stale ? 0.0f : pMr->Accel_Acc;
+    o->Steer_Lfa = pOut->Lfa_Stale ? 0.0f : pMr->Steer_Lfa;
+    adas_pipeline_arbitration_stage(o->Accel_Acc, o->Decel_Aeb, o->Steer_Lfa, o->Aeb_Mode,
+                                    &o->Throttle, &o->Brake, &o->Steer);
+
+    /* 제동 반응 지연 : AEB BRAKE 전이 틱 */
+    if (o->Aeb_Mode == AEB_MODE_BRAKE && pMr->Prev_Aeb_Mode != AEB_MODE_BRAKE) {
+        float lat = now - objTimeMs;
+        pOut->Brake_Latency_Ms = lat;
+        pMr->Last_Brake_Latency_Ms = lat;
+        if (pMr->Brake_Onset_Count == 0 || lat > pMr->Max_Brake_Latency_Ms) pMr->Max_Brake_Latency_Ms = lat;
+        pMr->Sum_Brake_Latency_Ms += lat;
+        pMr->Brake_Onset_Count++;
+    }
+    pMr->Prev_Aeb_Mode = o->Aeb_Mode;
+    return 0;
+}
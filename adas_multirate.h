@@ -0,0 +1,87 @@
+/****************************************************************************
+ * adas_multirate.h
+ *
+ * - 다중 주기 스케줄러 : 기본 틱(Fast_Period_Ms, 기본 2 ms) 마다
+ *     Ego / Lane / Target Selection → AEB (최신 객체 스냅샷으로 즉시 판단)
+ *   ACC / LFA 는 기본 틱의 Acc_Divider / Lfa_Divider 배 주기로만 실행 (기본 10 / 20 ms)
+ * - Arbitration : 매 틱, 각 기능의 최신 출력 + 출력 시각으로 병합
+ *     . 출력 나이(현재 시각 - 산출 시각) > Max_Output_Age_Ms 인 ACC / LFA 출력은 0 으로 대체
+ * - 제동 반응 지연 측정 : AEB 가 BRAKE 로 전이한 틱에서
+ *     지연 = 현재 틱 시각 - 판단에 쓴 객체 스냅샷 시각 (스냅샷 대기 + 스케줄 지연)
+ * - Fast_Period_Ms = 10, 분주비 1 / 1 이면 adas_pipeline_step 과 비트 동일
+ * - ACC / LFA PID 상태는 모듈 전역 → 프로세스당 스케줄러 1 개 (adas_pipeline 과 같은 제약)
+ ****************************************************************************/
+#ifndef ADAS_MULTIRATE_H
+#define ADAS_MULTIRATE_H
+
+#include <stdint.h>
+#include "adas_pipeline.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    float   Fast_Period_Ms;             /* [ms] 기본 틱 (AEB) */
+    int32_t Acc_Divider;                /* ACC 주기 = Fast × Acc_Divider */
+    int32_t Lfa_Divider;                /* LFA 주기 = Fast × Lfa_Divider */
+    float   Max_Output_Age_Ms;          /* [ms] 초과 시 해당 출력 무효 */
+} AdasMultirateConfig_t;
+
+typedef struct {
+    AdasMultirateConfig_t Cfg;
+    AdasPipelineState_t   Pipe;         /* Ego KF + LFA 이전 조향각 */
+    int64_t               Tick;
+
+    /* 기능별 최신 출력 + 산출 시각 [ms] */
+    float   Accel_Acc;
+    int32_t Acc_Mode;
+    float   Acc_Time;
+    float   Steer_Lfa;
+    int32_t Lfa_Mode;
+    float   Lfa_Time;
+    int32_t Acc_Valid;                  /* 한 번이라도 실행됨 */
+    int32_t Lfa_Valid;
+    int32_t Prev_Aeb_Mode;
+
+    /* 제동 반응 지연 통계 [ms] */
+    int32_t Brake_Onset_Count;
+    float   Last_Brake_Latency_Ms;
+    float   Max_Brake_Latency_Ms;
+    float   Sum_Brake_Latency_Ms;
+} AdasMultirate_t;
+
+typedef struct {
+    AdasPipelineOutput_t Out;           /* Accel_Acc / Steer_Lfa 등은 병합에 쓴 최신 값 */
+    uint8_t Ran_Acc;                    /* 이번 틱 실행 여부 */
+    uint8_t Ran_Lfa;
+    uint8_t Acc_Stale;                  /* 나이 초과로 0 대체 */
+    uint8_t Lfa_Stale;
+    float   Acc_Age_Ms;
+    float   Lfa_Age_Ms;
+    float   Brake_Latency_Ms;           /* 이번 틱 AEB 제동 개시면 지연, 아니면 -1 */
+} AdasMultirateOutput_t;
+
+/** @brief 기본 구성 (2 ms / ACC 10 ms / LFA 20 ms / 최대 나이 50 ms) */
+void adas_mr_default_config(AdasMultirateConfig_t *pCfg);
+
+/**
+ * @brief 초기화 (ACC / LFA 전역 PID 상태 포함)
+ * @return 0 on success, -1 on invalid argument / 구성 오류
+ */
+int adas_mr_init(AdasMultirate_t *pMr, const AdasMultirateConfig_t *pCfg);
+
+/**
+ * @brief 기본 틱 1 회
+ * @param[in] pIn       : Time.Current_Time = 이번 틱 시각, Obj = 최신 객체 스냅샷
+ * @param[in] objTimeMs : 객체 스냅샷 시각 [ms] (<= 틱 시각)
+ * @return 0 on success, -1 on invalid argument
+ */
+int adas_mr_step(AdasMultirate_t *pMr, const AdasPipelineInput_t *pIn, float objTimeMs,
+                 AdasMultirateOutput_t *pOut);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADAS_MULTIRATE_H */
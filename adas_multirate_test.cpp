@@ -0,0 +1,208 @@
+/*********************************************************************
+ * adas_multirate_test.cpp  ―  다중 주기 스케줄러 (AEB 빠른 경로 / ACC·LFA 분주)
+ * DUT : adas_multirate.c
+ *********************************************************************/
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#include "adas_multirate.h"
+#include "golden_trace.h"
+
+namespace {
+
+class AdasMultirateTest : public ::testing::Test {
+protected:
+    AdasMultirate_t       mr;
+    AdasMultirateConfig_t cfg;
+
+    void SetUp() override { adas_mr_default_config(&cfg); }
+
+    /* 직진 Ego (10 m/s^2 로 20 m/s 까지 가속 후 등속), 전방 160 m Ego 차로 정지 차량
+       (객체 프레임 시각 tObj 기준 상대 위치) */
+    static float ego_travel(float tMs)
+    {
+        float t = tMs / 1000.0f;
+        return (t <= 2.0f) ? 5.0f * t * t : 20.0f + 20.0f * (t - 2.0f);
+    }
+
+    static void stopped_car_input(float nowMs, float tObjMs, AdasPipelineInput_t *pIn)
+    {
+        std::memset(pIn, 0, sizeof(*pIn));
+        pIn->Time.Current_Time  = nowMs;
+        pIn->Gps.GPS_Velocity_X = std::fmin(20.0f, 0.01f * nowMs);
+        pIn->Gps.GPS_Timestamp  = nowMs;
+        pIn->Lane.Lane_Type     = LANE_TYPE_STRAIGHT;
+        pIn->Lane.Lane_Width    = 3.5f;
+        pIn->Obj_Count          = 1;
+        ObjectData_t *o = &pIn->Obj[0];
+        o->Object_ID     = 1;
+        o->Object_Type   = OBJTYPE_CAR;
+        o->Position_X    = 160.0f - ego_travel(tObjMs);
+        o->Distance      = o->Position_X;
+        o->Object_Status = OBJSTAT_STOPPED;
+    }
+
+    /* 주기 periodMs 로 실행 → 첫 AEB 제동 개시 시각 [ms] (없으면 -1) */
+    float brake_onset(float periodMs, int div, float *pLatency)
+    {
+        cfg.Fast_Period_Ms = periodMs;
+        cfg.Acc_Divider    = div;
+        cfg.Lfa_Divider    = div;
+        EXPECT_EQ(adas_mr_init(&mr, &cfg), 0);
+        AdasPipelineInput_t   in;
+        AdasMultirateOutput_t out;
+        for (int t = 0; t < (int)(8000.0f / periodMs); t++) {
+            float now  = periodMs * (float)t;
+            float tObj = 2.0f * std::floor(now / 2.0f);     /* 최신 객체 프레임 */
+            stopped_car_input(now, tObj, &in);
+            EXPECT_EQ(adas_mr_step(&mr, &in, tObj, &out), 0);
+            if (out.Brake_Latency_Ms >= 0.0f) {
+                *pLatency = out.Brake_Latency_Ms;
+                return now;
+            }
+        }
+        return -1.0f;
+    }
+};
+
+} /* namespace */
+
+/* 10 ms / 분주 1 : adas_pipeline_step 과 비트 동일 */
+TEST_F(AdasMultirateTest, TC_MRATE_EQ_01)
+{
+    const int kTicks = 3000;
+    GoldenScene_t        scene;
+    AdasPipelineState_t  st;
+    AdasPipelineInput_t  in;
+    std::vector<AdasPipelineOutput_t> ref(kTicks);
+    golden_scene_init(&scene, 9u, 0);
+    adas_pipeline_init(&st);
+    for (int t = 0; t < kTicks; t++) {
+        golden_scene_next(&scene, &in);
+        ASSERT_EQ(adas_pipeline_step(&st, &in, &ref[t]), 0);
+    }
+
+    cfg.Fast_Period_Ms = 10.0f;
+    cfg.Acc_Divider    = 1;
+    cfg.Lfa_Divider    = 1;
+    ASSERT_EQ(adas_mr_init(&mr, &cfg), 0);
+    golden_scene_init(&scene, 9u, 0);
+    for (int t = 0; t < kTicks; t++) {
+        AdasMultirateOutput_t out;
+        golden_scene_next(&scene, &in);
+        ASSERT_EQ(adas_mr_step(&mr, &in, in.Time.Current_Time, &out), 0);
+        ASSERT_EQ(std::memcmp(&out.Out, &ref[t], sizeof(AdasPipelineOutput_t)), 0) << "tick " << t;
+        EXPECT_TRUE(out.Ran_Acc && out.Ran_Lfa);
+        EXPECT_FALSE(out.Acc_Stale || out.Lfa_Stale);
+    }
+}
+
+/* 기본 구성 : ACC 5 틱 / LFA 10 틱마다 실행, 사이 틱은 최신 출력 + 나이 */
+TEST_F(AdasMultirateTest, TC_MRATE_EQ_02)
+{
+    ASSERT_EQ(adas_mr_init(&mr, &cfg), 0);
+    GoldenScene_t       scene;
+    AdasPipelineInput_t in;
+    golden_scene_init(&scene, 4u, 0);
+    float lastAcc = 0.0f, lastLfa = 0.0f;
+    for (int t = 0; t < 2000; t++) {
+        AdasMultirateOutput_t out;
+        golden_scene_next(&scene, &in);
+        in.Time.Current_Time = 2.0f * (float)t;
+        in.Gps.GPS_Timestamp = in.Time.Current_Time;
+        ASSERT_EQ(adas_mr_step(&mr, &in, in.Time.Current_Time, &out), 0);
+        EXPECT_EQ(out.Ran_Acc, (t % 5 == 0) ? 1 : 0);
+        EXPECT_EQ(out.Ran_Lfa, (t % 10 == 0) ? 1 : 0);
+        EXPECT_FLOAT_EQ(out.Acc_Age_Ms, 2.0f * (float)(t % 5));
+        EXPECT_FLOAT_EQ(out.Lfa_Age_Ms, 2.0f * (float)(t % 10));
+        if (out.Ran_Acc) lastAcc = out.Out.Accel_Acc;
+        if (out.Ran_Lfa) lastLfa = out.Out.Steer_Lfa;
+        EXPECT_EQ(out.Out.Accel_Acc, lastAcc);
+        EXPECT_EQ(out.Out.Steer_Lfa, lastLfa);
+        EXPECT_EQ(out.Out.Steer_Lfa, mr.Pipe.Prev_Steer);
+    }
+}
+
+/* 제동 반응 : 2 ms 빠른 경로는 10 ms 단일 주기보다 늦지 않고 1 주기 이내로 앞섬 */
+TEST_F(AdasMultirateTest, TC_MRATE_EQ_03)
+{
+    float latFast = -1.0f, latSlow = -1.0f;
+    float onsetFast = brake_onset(2.0f, 5, &latFast);
+    float onsetSlow = brake_onset(10.0f, 1, &latSlow);
+    ASSERT_GT(onsetFast, 0.0f);
+    ASSERT_GT(onsetSlow, 0.0f);
+    EXPECT_LE(onsetFast, onsetSlow);
+    EXPECT_LT(onsetSlow - onsetFast, 10.0f);
+    EXPECT_FLOAT_EQ(latFast, 0.0f);
+    EXPECT_EQ(mr.Brake_Onset_Count, 1);
+
+    /* 지연 = 틱 시각 - 스냅샷 시각 */
+    ASSERT_EQ(adas_mr_init(&mr, &cfg), 0);
+    AdasPipelineInput_t   in;
+    AdasMultirateOutput_t out;
+    float onset = -1.0f;
+    for (int t = 0; t < 4000 && onset < 0.0f; t++) {
+        float now = 2.0f * (float)t;
+        stopped_car_input(now, now - 6.0f, &in);
+        ASSERT_EQ(adas_mr_step(&mr, &in, now - 6.0f, &out), 0);
+        if (out.Brake_Latency_Ms >= 0.0f) onset = now;
+    }
+    ASSERT_GT(onset, 0.0f);
+    EXPECT_FLOAT_EQ(out.Brake_Latency_Ms, 6.0f);
+    EXPECT_FLOAT_EQ(mr.Max_Brake_Latency_Ms, 6.0f);
+    EXPECT_TRUE(out.Out.Brake > 0.0f);
+}
+
+/* 경계 : 출력 나이 초과 → ACC / LFA 출력 0 대체 (AEB 는 매 틱) */
+TEST_F(AdasMultirateTest, TC_MRATE_BV_01)
+{
+    cfg.Acc_Divider       = 100;
+    cfg.Lfa_Divider       = 100;
+    cfg.Max_Output_Age_Ms = 20.0f;
+    ASSERT_EQ(adas_mr_init(&mr, &cfg), 0);
+    GoldenScene_t       scene;
+    AdasPipelineInput_t in;
+    golden_scene_init(&scene, 4u, 0);
+    for (int t = 0; t < 300; t++) {
+        AdasMultirateOutput_t out;
+        golden_scene_next(&scene, &in);
+        in.Time.Current_Time = 2.0f * (float)t;
+        ASSERT_EQ(adas_mr_step(&mr, &in, in.Time.Current_Time, &out), 0);
+        bool stale = (t % 100) > 10;                     /* 나이 > 20 ms */
+        EXPECT_EQ(out.Acc_Stale, stale ? 1 : 0) << t;
+        EXPECT_EQ(out.Lfa_Stale, stale ? 1 : 0) << t;
+        if (stale) {
+            EXPECT_EQ(out.Out.Accel_Acc, 0.0f);
+            EXPECT_EQ(out.Out.Steer_Lfa, 0.0f);
+        }
+    }
+}
+
+/* 잘못된 인자 / 구성 */
+TEST_F(AdasMultirateTest, TC_MRATE_RA_01)
+{
+    AdasPipelineInput_t   in;
+    AdasMultirateOutput_t out;
+    std::memset(&in, 0, sizeof(in));
+    EXPECT_EQ(adas_mr_init(nullptr, &cfg), -1);
+    EXPECT_EQ(adas_mr_init(&mr, nullptr), -1);
+    AdasMultirateConfig_t bad = cfg;
+    bad.Fast_Period_Ms = 0.0f;
+    EXPECT_EQ(adas_mr_init(&mr, &bad), -1);
+    bad = cfg;
+    bad.Acc_Divider = 0;
+    EXPECT_EQ(adas_mr_init(&mr, &bad), -1);
+    bad = cfg;
+    bad.Max_Output_Age_Ms = NAN;
+    EXPECT_EQ(adas_mr_init(&mr, &bad), -1);
+
+    ASSERT_EQ(adas_mr_init(&mr, &cfg), 0);
+    EXPECT_EQ(adas_mr_step(nullptr, &in, 0.0f, &out), -1);
+    EXPECT_EQ(adas_mr_step(&mr, nullptr, 0.0f, &out), -1);
+    EXPECT_EQ(adas_mr_step(&mr, &in, 0.0f, nullptr), -1);
+    in.Obj_Count = ADAS_PIPELINE_MAX_OBJ + 1;
+    EXPECT_EQ(adas_mr_step(&mr, &in, 0.0f, &out), -1);
+    EXPECT_EQ(mr.Tick, 0);
+}
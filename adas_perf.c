@@ -0,0 +1,198 @@
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE                 /* syscall, clock_gettime */
+#endif
+
+#include <string.h>
+#include <time.h>
+
+#include "adas_perf.h"
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define ADAS_PERF_HAVE_EVENTS   1
+#else
+#define ADAS_PERF_HAVE_EVENTS   0
+#endif
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+#if ADAS_PERF_HAVE_EVENTS
+static int open_counter(AdasPerfCounter_e c)
+{
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size           = sizeof(attr);
+    attr.type           = PERF_TYPE_HARDWARE;
+    attr.read_format    = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv     = 1;
+
+    switch (c) {
+    case ADAS_PERF_CYCLES:        attr.config = PERF_COUNT_HW_CPU_CYCLES;          break;
+    case ADAS_PERF_INSTRUCTIONS:  attr.config = PERF_COUNT_HW_INSTRUCTIONS;        break;
+    case ADAS_PERF_BRANCHES:      attr.config = PERF_COUNT_HW_BRANCH_INSTRUCTIONS; break;
+    case ADAS_PERF_BRANCH_MISSES: attr.config = PERF_COUNT_HW_BRANCH_MISSES;       break;
+    case ADAS_PERF_LLC_MISSES:    attr.config = PERF_COUNT_HW_CACHE_MISSES;        break;
+    case ADAS_PERF_L1D_MISSES:
+        attr.type   = PERF_TYPE_HW_CACHE;
+        attr.config = PERF_COUNT_HW_CACHE_L1D
+                    | ((uint64_t)PERF_COUNT_HW_CACHE_OP_READ << 8)
+                    | ((uint64_t)PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        break;
+    default:
+        return -1;
+    }
+
+    long fd = syscall(__NR_perf_event_open, &attr, 0 /* 이 스레드 */, -1 /* 모든 CPU */, -1, 0UL);
+    return (fd < 0) ? -1 : (int)fd;
+}
+
+/* [값, time_enabled, time_running] */
+static int read_counter(int fd, uint64_t v[3])
+{
+    return (read(fd, v, 3 * sizeof(uint64_t)) == (ssize_t)(3 * sizeof(uint64_t))) ? 0 : -1;
+}
+#endif
+
+int adas_perf_open(AdasPerf_t *pPerf)
+{
+    if (!pPerf) return -1;
+
+    memset(pPerf, 0, sizeof(*pPerf));
+    pPerf->Active_Stage = -1;
+
+    int opened = 0;
+    for (int c = 0; c < ADAS_PERF_COUNTER_COUNT; c++) {
+#if ADAS_PERF_HAVE_EVENTS
+        pPerf->Fd[c] = open_counter((AdasPerfCounter_e)c);
+#else
+        pPerf->Fd[c] = -1;
+#endif
+        if (pPerf->Fd[c] >= 0) {
+            pPerf->Available |= 1u << c;
+            opened++;
+        }
+    }
+    return opened;
+}
+
+void adas_perf_close(AdasPerf_t *pPerf)
+{
+    if (!pPerf) return;
+
+    for (int c = 0; c < ADAS_PERF_COUNTER_COUNT; c++) {
+#if ADAS_PERF_HAVE_EVENTS
+        if (pPerf->Fd[c] >= 0) close(pPerf->Fd[c]);
+#endif
+        pPerf->Fd[c] = -1;
+    }
+    pPerf->Available    = 0;
+    pPerf->Active_Stage = -1;
+}
+
+void adas_perf_reset(AdasPerf_t *pPerf)
+{
+    if (!pPerf) return;
+
+    memset(pPerf->Stage, 0, sizeof(pPerf->Stage));
+    pPerf->Active_Stage = -1;
+}
+
+void adas_perf_begin(AdasPerf_t *pPerf, AdasPerfStage_e stage)
+{
+    if (!pPerf || pPerf->Active_Stage >= 0 || (unsigned)stage >= ADAS_PERF_STAGE_COUNT) return;
+
+    pPerf->Active_Stage = (int32_t)stage;
+#if ADAS_PERF_HAVE_EVENTS
+    for (int c = 0; c < ADAS_PERF_COUNTER_COUNT; c++) {
+        uint64_t v[3] = { 0, 0, 0 };
+        if ((pPerf->Available & (1u << c)) && read_counter(pPerf->Fd[c], v) != 0) {
+            v[0] = v[1] = v[2] = 0;
+        }
+        pPerf->Begin_Value[c]   = v[0];
+        pPerf->Begin_Enabled[c] = v[1];
+        pPerf->Begin_Running[c] = v[2];
+    }
+#endif
+    pPerf->Begin_Ns = now_ns();                 /* 카운터 읽기 이후 → 읽기 시간 제외 */
+}
+
+void adas_perf_end(AdasPerf_t *pPerf, AdasPerfStage_e stage)
+{
+    if (!pPerf || pPerf->Active_Stage != (int32_t)stage) return;
+
+    uint64_t t = now_ns();
+    AdasPerfStageStat_t *s = &pPerf->Stage[stage];
+    s->Calls++;
+    s->Wall_Ns += t - pPerf->Begin_Ns;
+
+#if ADAS_PERF_HAVE_EVENTS
+    for (int c = 0; c < ADAS_PERF_COUNTER_COUNT; c++) {
+        uint64_t v[3];
+        if (!(pPerf->Available & (1u << c)) || read_counter(pPerf->Fd[c], v) != 0) continue;
+
+        uint64_t dv = v[0] - pPerf->Begin_Value[c];
+        uint64_t de = v[1] - pPerf->Begin_Enabled[c];
+        uint64_t dr = v[2] - pPerf->Begin_Running[c];
+        if (dr == 0) continue;                  /* 이 구간 동안 PMU 에 올라가지 못함 */
+        if (dr < de) dv = (uint64_t)((double)dv * (double)de / (double)dr);   /* 다중화 보정 */
+        s->Count[c] += dv;
+    }
+#endif
+    pPerf->Active_Stage = -1;
+}
+
+static double ratio(const AdasPerf_t *p, int num, int den, const AdasPerfStageStat_t *s, double scale)
+{
+    if (!(p->Available & (1u << num)) || !(p->Available & (1u << den)) || s->Count[den] == 0) return -1.0;
+
+    return scale * (double)s->Count[num] / (double)s->Count[den];
+}
+
+int adas_perf_summary(const AdasPerf_t *pPerf, AdasPerfStage_e stage, AdasPerfSummary_t *pSum)
+{
+    if (!pPerf || !pSum || (unsigned)stage >= ADAS_PERF_STAGE_COUNT) return -1;
+
+    const AdasPerfStageStat_t *s = &pPerf->Stage[stage];
+    pSum->Calls            = s->Calls;
+    pSum->Ns_Per_Call      = s->Calls ? (double)s->Wall_Ns / (double)s->Calls : -1.0;
+    pSum->Ipc              = ratio(pPerf, ADAS_PERF_INSTRUCTIONS, ADAS_PERF_CYCLES, s, 1.0);
+    pSum->Branch_Miss_Rate = ratio(pPerf, ADAS_PERF_BRANCH_MISSES, ADAS_PERF_BRANCHES, s, 1.0);
+    pSum->L1d_Mpki         = ratio(pPerf, ADAS_PERF_L1D_MISSES, ADAS_PERF_INSTRUCTIONS, s, 1000.0);
+    pSum->Llc_Mpki         = ratio(pPerf, ADAS_PERF_LLC_MISSES, ADAS_PERF_INSTRUCTIONS, s, 1000.0);
+    return 0;
+}
+
+const char *adas_perf_stage_name(AdasPerfStage_e stage)
+{
+    static const char *const names[ADAS_PERF_STAGE_COUNT] = {
+        "ego_lane", "target", "acc", "aeb", "lfa", "arbitration"
+    };
+    return ((unsigned)stage < ADAS_PERF_STAGE_COUNT) ? names[stage] : "?";
+}
+
+void adas_perf_report(const AdasPerf_t *pPerf, FILE *pOut)
+{
+    if (!pPerf || !pOut) return;
+
+    fprintf(pOut, "%-12s %10s %10s %6s %8s %8s %8s\n",
+            "stage", "calls", "ns/call", "IPC", "br-miss%", "L1D-MPKI", "LLC-MPKI");
+    for (int k = 0; k < ADAS_PERF_STAGE_COUNT; k++) {
+        AdasPerfSummary_t s;
+        adas_perf_summary(pPerf, (AdasPerfStage_e)k, &s);
+        fprintf(pOut, "%-12s %10llu %10.1f ", adas_perf_stage_name((AdasPerfStage_e)k),
+                (unsigned long long)s.Calls, s.Ns_Per_Call);
+        if (s.Ipc >= 0.0)              fprintf(pOut, "%6.2f ", s.Ipc);              else fprintf(pOut, "%6s ", "n/a");
+        if (s.Branch_Miss_Rate >= 0.0) fprintf(pOut, "%8.2f ", 100.0 * s.Branch_Miss_Rate); else fprintf(pOut, "%8s ", "n/a");
+        if (s.L1d_Mpki >= 0.0)         fprintf(pOut, "%8.2f ", s.L1d_Mpki);         else fprintf(pOut, "%8s ", "n/a");
+        if (s.Llc_Mpki >= 0.0)         fprintf(pOut, "%8.2f\n", s.Llc_Mpki);        else fprintf(pOut, "%8s\n", "n/a");
+    }
+    if (!pPerf->Available) fprintf(pOut, "(hardware counters unavailable : wall time only)\n");
+}
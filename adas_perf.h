@@ -0,0 +1,106 @@
+/****************************************************************************
+ * adas_perf.h
+ *
+ * - 선택적 프로파일링 : 하드웨어 성능 카운터(Linux perf_event_open)를 파이프라인 단계마다 읽어 누적
+ *     . 카운터 : cycles, instructions, branches, branch-misses, L1D 읽기 미스, LLC 미스
+ *     . 단계 : Ego/Lane, Target, ACC, AEB, LFA, Arbitration (adas_pipeline_step_perf)
+ *     . 집계 : 단계별 IPC, 분기 미스율, L1D / LLC MPKI(천 명령당 미스), 호출당 시간
+ * - 카운터는 각자 따로 열어(그룹 아님) 열리는 것만 사용, PMU 부족 시 커널 다중화 →
+ *   time_enabled / time_running 비율로 보정
+ * - 컨테이너 / perf_event_paranoid / 비 Linux 로 카운터를 못 열면 Available 0 인 채로
+ *   벽시계 시간과 호출 수만 누적 (오류 아님), 해당 비율은 -1
+ * - 읽기 = 단계 경계마다 카운터당 read() 1 회 → 측정 자체 부하가 있으므로 상대 비교용
+ * - 스레드 단위 카운터 (연 스레드에서만 begin / end 호출)
+ ****************************************************************************/
+#ifndef ADAS_PERF_H
+#define ADAS_PERF_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    ADAS_PERF_CYCLES = 0,
+    ADAS_PERF_INSTRUCTIONS,
+    ADAS_PERF_BRANCHES,
+    ADAS_PERF_BRANCH_MISSES,
+    ADAS_PERF_L1D_MISSES,
+    ADAS_PERF_LLC_MISSES,
+    ADAS_PERF_COUNTER_COUNT
+} AdasPerfCounter_e;
+
+typedef enum {
+    ADAS_PERF_STAGE_EGO_LANE = 0,
+    ADAS_PERF_STAGE_TARGET,
+    ADAS_PERF_STAGE_ACC,
+    ADAS_PERF_STAGE_AEB,
+    ADAS_PERF_STAGE_LFA,
+    ADAS_PERF_STAGE_ARBITRATION,
+    ADAS_PERF_STAGE_COUNT
+} AdasPerfStage_e;
+
+typedef struct {
+    uint64_t Calls;
+    uint64_t Wall_Ns;
+    uint64_t Count[ADAS_PERF_COUNTER_COUNT];   /* 다중화 보정 값 */
+} AdasPerfStageStat_t;
+
+typedef struct {
+    int32_t  Fd[ADAS_PERF_COUNTER_COUNT];       /* 열지 못한 카운터 -1 */
+    uint32_t Available;                         /* 열린 카운터 비트 마스크 (1 << AdasPerfCounter_e) */
+
+    /* 진행 중 단계의 시작 값 */
+    int32_t  Active_Stage;                      /* 없음 -1 */
+    uint64_t Begin_Ns;
+    uint64_t Begin_Value[ADAS_PERF_COUNTER_COUNT];
+    uint64_t Begin_Enabled[ADAS_PERF_COUNTER_COUNT];
+    uint64_t Begin_Running[ADAS_PERF_COUNTER_COUNT];
+
+    AdasPerfStageStat_t Stage[ADAS_PERF_STAGE_COUNT];
+} AdasPerf_t;
+
+/* 단계 요약 (해당 카운터 없음 / 분모 0 이면 -1) */
+typedef struct {
+    uint64_t Calls;
+    double   Ns_Per_Call;
+    double   Ipc;
+    double   Branch_Miss_Rate;                  /* branch-misses / branches */
+    double   L1d_Mpki;
+    double   Llc_Mpki;
+} AdasPerfSummary_t;
+
+/**
+ * @brief 카운터 열기 (사용자 공간, 커널 제외) + 누적 초기화
+ * @return 열린 카운터 수 (0 = 카운터 없음, 시간만 측정), -1 on invalid argument
+ */
+int adas_perf_open(AdasPerf_t *pPerf);
+
+/** @brief 카운터 닫기 (누적 값은 유지) */
+void adas_perf_close(AdasPerf_t *pPerf);
+
+/** @brief 단계별 누적 초기화 (카운터는 열린 채 유지) */
+void adas_perf_reset(AdasPerf_t *pPerf);
+
+/** @brief 단계 시작 (진행 중 단계가 있으면 무시) */
+void adas_perf_begin(AdasPerf_t *pPerf, AdasPerfStage_e stage);
+
+/** @brief 단계 끝 : 시작 이후 증가분 누적 (stage 가 진행 중 단계와 다르면 무시) */
+void adas_perf_end(AdasPerf_t *pPerf, AdasPerfStage_e stage);
+
+/** @return 0 on success, -1 on invalid argument */
+int adas_perf_summary(const AdasPerf_t *pPerf, AdasPerfStage_e stage, AdasPerfSummary_t *pSum);
+
+/** @brief 단계 이름 ("ego_lane" ...), 범위 밖 "?" */
+const char *adas_perf_stage_name(AdasPerfStage_e stage);
+
+/** @brief 단계별 요약 표 출력 */
+void adas_perf_report(const AdasPerf_t *pPerf, FILE *pOut);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADAS_PERF_H */
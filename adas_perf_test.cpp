@@ -0,0 +1,163 @@
+/*********************************************************************
+ * adas_perf_test.cpp  ―  단계별 하드웨어 성능 카운터 (perf_event_open, 없으면 시간만)
+ * DUT : adas_perf.c, adas_pipeline.c (adas_pipeline_step_perf)
+ *********************************************************************/
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "adas_perf.h"
+#include "adas_pipeline.h"
+#include "golden_trace.h"
+
+namespace {
+
+class AdasPerfTest : public ::testing::Test {
+protected:
+    AdasPerf_t perf;
+
+    void SetUp() override { std::memset(&perf, 0, sizeof(perf)); }
+    void TearDown() override { adas_perf_close(&perf); }
+
+    static void spin(volatile uint32_t *p, int n)
+    {
+        for (int i = 0; i < n; i++) *p = *p * 1664525u + 1013904223u;
+    }
+};
+
+/* TC_PERF_EQ_01 : 계측 실행 출력 = 직렬 실행, 단계별 호출 수 / 시간 누적 (카운터 유무 무관) */
+TEST_F(AdasPerfTest, TC_PERF_EQ_01)
+{
+    GoldenScene_t        scene;
+    AdasPipelineState_t  st;
+    AdasPipelineInput_t  in;
+    AdasPipelineOutput_t out;
+
+    std::vector<AdasPipelineOutput_t> ref;
+    golden_scene_init(&scene, 47u, 0);
+    adas_pipeline_init(&st);
+    for (int t = 0; t < 500; t++) {
+        golden_scene_next(&scene, &in);
+        ASSERT_EQ(adas_pipeline_step(&st, &in, &out), 0);
+        ref.push_back(out);
+    }
+
+    int opened = adas_perf_open(&perf);
+    ASSERT_GE(opened, 0);
+    ASSERT_LE(opened, ADAS_PERF_COUNTER_COUNT);
+    golden_scene_init(&scene, 47u, 0);
+    adas_pipeline_init(&st);
+    for (int t = 0; t < 500; t++) {
+        golden_scene_next(&scene, &in);
+        ASSERT_EQ(adas_pipeline_step_perf(&st, &in, &out, &perf), 0);
+        ASSERT_EQ(std::memcmp(&out, &ref[(size_t)t], sizeof(out)), 0) << "tick " << t;
+    }
+
+    uint64_t wall = 0;
+    for (int k = 0; k < ADAS_PERF_STAGE_COUNT; k++) {
+        AdasPerfSummary_t s;
+        ASSERT_EQ(adas_perf_summary(&perf, (AdasPerfStage_e)k, &s), 0);
+        EXPECT_EQ(s.Calls, 500u) << adas_perf_stage_name((AdasPerfStage_e)k);
+        EXPECT_GE(s.Ns_Per_Call, 0.0);
+        wall += perf.Stage[k].Wall_Ns;
+        if (!(perf.Available & (1u << ADAS_PERF_CYCLES)) || !(perf.Available & (1u << ADAS_PERF_INSTRUCTIONS))) {
+            EXPECT_EQ(s.Ipc, -1.0);
+        }
+    }
+    EXPECT_GT(wall, 0u);
+
+    /* 명령 수 카운터가 열렸으면 Target 단계는 명령을 실행했음 */
+    if (perf.Available & (1u << ADAS_PERF_INSTRUCTIONS)) {
+        EXPECT_GT(perf.Stage[ADAS_PERF_STAGE_TARGET].Count[ADAS_PERF_INSTRUCTIONS], 0u);
+    }
+
+    /* 계측 없음 = adas_pipeline_step */
+    golden_scene_init(&scene, 47u, 0);
+    adas_pipeline_init(&st);
+    golden_scene_next(&scene, &in);
+    ASSERT_EQ(adas_pipeline_step_perf(&st, &in, &out, nullptr), 0);
+    EXPECT_EQ(std::memcmp(&out, &ref[0], sizeof(out)), 0);
+}
+
+/* TC_PERF_EQ_02 : begin / end 짝 검사 (중첩 begin, 다른 단계 end 무시), reset, 요약 표 */
+TEST_F(AdasPerfTest, TC_PERF_EQ_02)
+{
+    ASSERT_GE(adas_perf_open(&perf), 0);
+    volatile uint32_t x = 1u;
+
+    adas_perf_begin(&perf, ADAS_PERF_STAGE_ACC);
+    adas_perf_begin(&perf, ADAS_PERF_STAGE_AEB);            /* 진행 중 → 무시 */
+    spin(&x, 100000);
+    adas_perf_end(&perf, ADAS_PERF_STAGE_AEB);              /* 다른 단계 → 무시 */
+    adas_perf_end(&perf, ADAS_PERF_STAGE_ACC);
+    adas_perf_end(&perf, ADAS_PERF_STAGE_ACC);              /* 진행 중 없음 → 무시 */
+    EXPECT_EQ(perf.Stage[ADAS_PERF_STAGE_ACC].Calls, 1u);
+    EXPECT_EQ(perf.Stage[ADAS_PERF_STAGE_AEB].Calls, 0u);
+    EXPECT_GT(perf.Stage[ADAS_PERF_STAGE_ACC].Wall_Ns, 0u);
+    if (perf.Available & (1u << ADAS_PERF_INSTRUCTIONS)) {
+        EXPECT_GE(perf.Stage[ADAS_PERF_STAGE_ACC].Count[ADAS_PERF_INSTRUCTIONS], 100000u);
+    }
+
+    AdasPerfSummary_t s;
+    ASSERT_EQ(adas_perf_summary(&perf, ADAS_PERF_STAGE_AEB, &s), 0);
+    EXPECT_EQ(s.Calls, 0u);
+    EXPECT_EQ(s.Ns_Per_Call, -1.0);
+    EXPECT_EQ(s.Ipc, -1.0);                                 /* 분모 0 */
+
+    std::FILE *f = std::tmpfile();
+    ASSERT_NE(f, nullptr);
+    adas_perf_report(&perf, f);
+    EXPECT_GT(std::ftell(f), 0L);
+    std::fclose(f);
+
+    adas_perf_reset(&perf);
+    EXPECT_EQ(perf.Stage[ADAS_PERF_STAGE_ACC].Calls, 0u);
+
+    /* 닫은 뒤에는 시간만 (비율 -1) */
+    adas_perf_close(&perf);
+    EXPECT_EQ(perf.Available, 0u);
+    adas_perf_begin(&perf, ADAS_PERF_STAGE_LFA);
+    spin(&x, 1000);
+    adas_perf_end(&perf, ADAS_PERF_STAGE_LFA);
+    ASSERT_EQ(adas_perf_summary(&perf, ADAS_PERF_STAGE_LFA, &s), 0);
+    EXPECT_EQ(s.Calls, 1u);
+    EXPECT_EQ(s.Ipc, -1.0);
+    EXPECT_EQ(s.Branch_Miss_Rate, -1.0);
+    EXPECT_EQ(s.L1d_Mpki, -1.0);
+    EXPECT_EQ(s.Llc_Mpki, -1.0);
+}
+
+/* TC_PERF_RA_01 : 인자 오류 / 범위 밖 단계 */
+TEST_F(AdasPerfTest, TC_PERF_RA_01)
+{
+    AdasPerfSummary_t s;
+    EXPECT_EQ(adas_perf_open(nullptr), -1);
+    EXPECT_EQ(adas_perf_summary(nullptr, ADAS_PERF_STAGE_ACC, &s), -1);
+    ASSERT_GE(adas_perf_open(&perf), 0);
+    EXPECT_EQ(adas_perf_summary(&perf, ADAS_PERF_STAGE_COUNT, &s), -1);
+    EXPECT_EQ(adas_perf_summary(&perf, ADAS_PERF_STAGE_ACC, nullptr), -1);
+    EXPECT_STREQ(adas_perf_stage_name(ADAS_PERF_STAGE_COUNT), "?");
+    EXPECT_STREQ(adas_perf_stage_name(ADAS_PERF_STAGE_TARGET), "target");
+
+    adas_perf_begin(&perf, ADAS_PERF_STAGE_COUNT);
+    EXPECT_EQ(perf.Active_Stage, -1);
+    adas_perf_begin(nullptr, ADAS_PERF_STAGE_ACC);
+    adas_perf_end(nullptr, ADAS_PERF_STAGE_ACC);
+    adas_perf_reset(nullptr);
+    adas_perf_close(nullptr);
+    adas_perf_report(nullptr, stdout);
+    adas_perf_report(&perf, nullptr);
+
+    AdasPipelineState_t  st;
+    AdasPipelineInput_t  in;
+    AdasPipelineOutput_t out;
+    adas_pipeline_init(&st);
+    std::memset(&in, 0, sizeof(in));
+    in.Obj_Count = ADAS_PIPELINE_MAX_OBJ + 1;
+    EXPECT_EQ(adas_pipeline_step_perf(&st, &in, &out, &perf), -1);
+    EXPECT_EQ(adas_pipeline_step_perf(nullptr, &in, &out, &perf), -1);
+    EXPECT_EQ(perf.Stage[ADAS_PERF_STAGE_EGO_LANE].Calls, 0u);
+}
+
+}  // namespace
@@ -0,0 +1,428 @@
+#include <string.h>
+
+#include "adas_pipeline.h"
+#include "lane_selection.h"
+#include "target_selection.h"
+#include "arbitration.h"      /* aeb.h 포함 */
+
+static AEB_Target_Situation_e to_aeb_situation(TargetSituation_e s)
+{
+    if (s == TGT_SITU_CUTIN)  return AEB_TARGET_CUT_IN;
+    if (s == TGT_SITU_CUTOUT) return AEB_TARGET_CUT_OUT;
+    return AEB_TARGET_NORMAL;
+}
+
+void adas_pipeline_init(AdasPipelineState_t *pState)
+{
+    if (!pState) return;
+
+    memset(pState, 0, sizeof(*pState));
+    InitEgoVehicleKFState(&pState->Kf);
+    adas_pipeline_acc_reset();
+    adas_pipeline_lfa_reset();
+}
+
+void adas_pipeline_set_incremental(AdasPipelineState_t *pState, int enable)
+{
+    if (!pState) return;
+
+    LaneSelectionMemoReset(&pState->Memo.Lane);
+    target_curve_memo_reset(&pState->Memo.Curve);
+    pState->Memo.Enabled = enable ? 1 : 0;
+}
+
+void adas_pipeline_set_object_status(AdasPipelineState_t *pState, ObjectStatusTable_t *pTable)
+{
+    if (!pState) return;
+
+    pState->Obj_Status = pTable;
+}
+
+/*─────────────────────────────
+  단계 (직렬 / 작업 그래프 공용)
+─────────────────────────────*/
+
+/* 1) Ego 추정 → 2) Lane Selection */
+static void stage_ego_lane(AdasPipelineState_t *pState, const AdasPipelineInput_t *pIn,
+                           AdasPipelineOutput_t *pOut)
+{
+    EgoVehicleEstimation(&pIn->Time, &pIn->Gps, &pIn->Imu, &pOut->Ego, &pState->Kf);
+
+    LaneSelectionIncremental(&pIn->Lane, &pOut->Ego, &pOut->Ls,
+                             pState->Memo.Enabled ? &pState->Memo.Lane : NULL);
+}
+
+/* 3) Target Selection */
+static void stage_target(AdasPipelineState_t *pState, const AdasPipelineInput_t *pIn,
+                         AdasPipelineOutput_t *pOut, ACC_Target_t *pAcc, AEB_Target_t *pAeb)
+{
+    FilteredObject_t  filtered[ADAS_PIPELINE_MAX_OBJ];
+    PredictedObject_t predicted[ADAS_PIPELINE_MAX_OBJ];
+
+    const TargetCurveTerms_t *terms = pState->Memo.Enabled
+                                    ? target_curve_terms_memo(&pState->Memo.Curve, &pOut->Ls) : NULL;
+    int fc = select_target_from_object_list_terms(pIn->Obj, pIn->Obj_Count, &pOut->Ego, &pOut->Ls,
+                                                  terms, filtered, ADAS_PIPELINE_MAX_OBJ);
+    if (pState->Obj_Status) {
+        /* 이력 기반 Moving / Stopped / Stationary (예측 / 대상 선정 전에 제자리 갱신) */
+        (void)object_status_update(pState->Obj_Status, &pOut->Ego, filtered, fc);
+    }
+    int pc = predict_object_future_path(filtered, fc, &pIn->Lane, &pOut->Ls,
+                                        predicted, ADAS_PIPELINE_MAX_OBJ);
+    select_targets_for_acc_aeb(&pOut->Ego, predicted, pc, &pOut->Ls, pAcc, pAeb);
+    pOut->Filtered_Count = fc;
+    pOut->Acc_Target_ID  = pAcc->ACC_Target_ID;
+    pOut->Aeb_Target_ID  = pAeb->AEB_Target_ID;
+}
+
+static void stage_front(AdasPipelineState_t *pState, const AdasPipelineInput_t *pIn,
+                        AdasPipelineOutput_t *pOut, ACC_Target_t *pAcc, AEB_Target_t *pAeb)
+{
+    stage_ego_lane(pState, pIn, pOut);
+    stage_target(pState, pIn, pOut, pAcc, pAeb);
+}
+
+/* 4) ACC */
+static void stage_acc(const ACC_Target_t *pAcc, const AdasPipelineInput_t *pIn, AdasPipelineOutput_t *pOut)
+{
+    pOut->Accel_Acc = adas_pipeline_acc_stage(pAcc, &pOut->Ego, &pIn->Lane, &pOut->Ls,
+                                              pIn->Time.Current_Time, ADAS_PIPELINE_DT, &pOut->Acc_Mode);
+}
+
+/* 5) AEB */
+float adas_pipeline_aeb_stage(const AEB_Target_t *pTarget,
+                              const EgoData_t    *pEgo,
+                              int32_t            *pMode,
+                              float              *pTtc)
+{
+    if (!pTarget || !pEgo || !pMode || !pTtc) return 0.0f;
+
+    AEB_Target_Data_t aebIn;
+    aebIn.AEB_Target_ID         = pTarget->AEB_Target_ID;
+    aebIn.AEB_Target_Distance   = pTarget->AEB_Target_Distance;
+    aebIn.AEB_Target_Velocity_X = pTarget->AEB_Target_Vel_X;
+    aebIn.AEB_Target_Situation  = to_aeb_situation(pTarget->AEB_Target_Situation);
+    Ego_Data_t aebEgo;
+    aebEgo.Ego_Velocity_X = pEgo->Ego_Velocity_X;
+
+    TTC_Data_t ttc;
+    calculate_ttc_for_aeb(&aebIn, &aebEgo, &ttc);
+    AEB_Mode_e aebMode = aeb_mode_selection(&aebIn, &aebEgo, &ttc);
+    *pMode = (int32_t)aebMode;
+    *pTtc  = ttc.TTC;
+    return calculate_decel_for_aeb(aebMode, &ttc);
+}
+
+static void stage_aeb(const AEB_Target_t *pAeb, AdasPipelineOutput_t *pOut)
+{
+    pOut->Decel_Aeb = adas_pipeline_aeb_stage(pAeb, &pOut->Ego, &pOut->Aeb_Mode, &pOut->Ttc);
+}
+
+/* 6) LFA */
+static void stage_lfa(AdasPipelineState_t *pState, AdasPipelineOutput_t *pOut)
+{
+    pOut->Steer_Lfa = adas_pipeline_lfa_stage(&pOut->Ego, &pOut->Ls, pState->Prev_Steer,
+                                              ADAS_PIPELINE_DT, &pOut->Lfa_Mode);
+    pState->Prev_Steer = pOut->Steer_Lfa;
+}
+
+/* 7) Arbitration */
+void adas_pipeline_arbitration_stage(float accel, float decel, float steer, int32_t aebMode,
+                                     float *pThrottle, float *pBrake, float *pSteer)
+{
+    if (!pThrottle || !pBrake || !pSteer) return;
+
+    VehicleControl_t ctrl;
+    Arbitration(accel, decel, steer, (AEB_Mode_e)aebMode, &ctrl);
+    *pThrottle = ctrl.throttle;
+    *pBrake    = ctrl.brake;
+    *pSteer    = ctrl.steer;
+}
+
+static void stage_arbitration(AdasPipelineOutput_t *pOut)
+{
+    adas_pipeline_arbitration_stage(pOut->Accel_Acc, pOut->Decel_Aeb, pOut->Steer_Lfa, pOut->Aeb_Mode,
+                                    &pOut->Throttle, &pOut->Brake, &pOut->Steer);
+}
+
+static int step_args_valid(const AdasPipelineState_t *pState, const AdasPipelineInput_t *pIn,
+                           const AdasPipelineOutput_t *pOut)
+{
+    return pState && pIn && pOut
+        && pIn->Obj_Count >= 0 && pIn->Obj_Count <= ADAS_PIPELINE_MAX_OBJ;
+}
+
+int adas_pipeline_step(AdasPipelineState_t       *pState,
+                       const AdasPipelineInput_t *pIn,
+                       AdasPipelineOutput_t      *pOut)
+{
+    if (!step_args_valid(pState, pIn, pOut)) return -1;
+
+    ACC_Target_t accTarget;
+    AEB_Target_t aebTarget;
+
+    memset(pOut, 0, sizeof(*pOut));
+    stage_front(pState, pIn, pOut, &accTarget, &aebTarget);
+    stage_acc(&accTarget, pIn, pOut);
+    stage_aeb(&aebTarget, pOut);
+    stage_lfa(pState, pOut);
+    stage_arbitration(pOut);
+    return 0;
+}
+
+int adas_pipeline_step_perf(AdasPipelineState_t       *pState,
+                            const AdasPipelineInput_t *pIn,
+                            AdasPipelineOutput_t      *pOut,
+                            AdasPerf_t                *pPerf)
+{
+    if (!pPerf) return adas_pipeline_step(pState, pIn, pOut);
+    if (!step_args_valid(pState, pIn, pOut)) return -1;
+
+    ACC_Target_t accTarget;
+    AEB_Target_t aebTarget;
+
+    memset(pOut, 0, sizeof(*pOut));
+    adas_perf_begin(pPerf, ADAS_PERF_STAGE_EGO_LANE);
+    stage_ego_lane(pState, pIn, pOut);
+    adas_perf_end(pPerf, ADAS_PERF_STAGE_EGO_LANE);
+
+    adas_perf_begin(pPerf, ADAS_PERF_STAGE_TARGET);
+    stage_target(pState, pIn, pOut, &accTarget, &aebTarget);
+    adas_perf_end(pPerf, ADAS_PERF_STAGE_TARGET);
+
+    adas_perf_begin(pPerf, ADAS_PERF_STAGE_ACC);
+    stage_acc(&accTarget, pIn, pOut);
+    adas_perf_end(pPerf, ADAS_PERF_STAGE_ACC);
+
+    adas_perf_begin(pPerf, ADAS_PERF_STAGE_AEB);
+    stage_aeb(&aebTarget, pOut);
+    adas_perf_end(pPerf, ADAS_PERF_STAGE_AEB);
+
+    adas_perf_begin(pPerf, ADAS_PERF_STAGE_LFA);
+    stage_lfa(pState, pOut);
+    adas_perf_end(pPerf, ADAS_PERF_STAGE_LFA);
+
+    adas_perf_begin(pPerf, ADAS_PERF_STAGE_ARBITRATION);
+    stage_arbitration(pOut);
+    adas_perf_end(pPerf, ADAS_PERF_STAGE_ARBITRATION);
+    return 0;
+}
+
+/*─────────────────────────────
+  단계 분할 공개 함수 (프레임 간 파이프라인)
+─────────────────────────────*/
+int adas_pipeline_stage_ego_lane(AdasPipelineState_t       *pState,
+                                 const AdasPipelineInput_t *pIn,
+                                 AdasPipelineOutput_t      *pOut)
+{
+    if (!step_args_valid(pState, pIn, pOut)) return -1;
+
+    memset(pOut, 0, sizeof(*pOut));
+    stage_ego_lane(pState, pIn, pOut);
+    return 0;
+}
+
+int adas_pipeline_stage_target(AdasPipelineState_t       *pState,
+                               const AdasPipelineInput_t *pIn,
+                               AdasPipelineOutput_t      *pOut,
+                               AdasPipelineTargets_t     *pTargets)
+{
+    if (!step_args_valid(pState, pIn, pOut) || !pTargets) return -1;
+
+    stage_target(pState, pIn, pOut, &pTargets->Acc_Target, &pTargets->Aeb_Target);
+    return 0;
+}
+
+int adas_pipeline_stage_control(AdasPipelineState_t         *pState,
+                                const AdasPipelineInput_t   *pIn,
+                                AdasPipelineOutput_t        *pOut,
+                                const AdasPipelineTargets_t *pTargets)
+{
+    if (!step_args_valid(pState, pIn, pOut) || !pTargets) return -1;
+
+    stage_acc(&pTargets->Acc_Target, pIn, pOut);
+    stage_aeb(&pTargets->Aeb_Target, pOut);
+    stage_lfa(pState, pOut);
+    stage_arbitration(pOut);
+    return 0;
+}
+
+/*─────────────────────────────
+  작업 그래프 실행
+   - ACC / AEB / LFA 는 pOut 의 서로 다른 필드만 기록 (공유 입력은 읽기 전용)
+─────────────────────────────*/
+static void task_front(void *pCtx, int chunk)
+{
+    AdasPipelineMt_t *m = (AdasPipelineMt_t *)pCtx;
+    (void)chunk;
+    stage_front(m->State, m->In, m->Out, &m->Acc_Target, &m->Aeb_Target);
+}
+
+static void task_acc(void *pCtx, int chunk)
+{
+    AdasPipelineMt_t *m = (AdasPipelineMt_t *)pCtx;
+    (void)chunk;
+    stage_acc(&m->Acc_Target, m->In, m->Out);
+}
+
+static void task_aeb(void *pCtx, int chunk)
+{
+    AdasPipelineMt_t *m = (AdasPipelineMt_t *)pCtx;
+    (void)chunk;
+    stage_aeb(&m->Aeb_Target, m->Out);
+}
+
+static void task_lfa(void *pCtx, int chunk)
+{
+    AdasPipelineMt_t *m = (AdasPipelineMt_t *)pCtx;
+    (void)chunk;
+    stage_lfa(m->State, m->Out);
+}
+
+static void task_arbitration(void *pCtx, int chunk)
+{
+    AdasPipelineMt_t *m = (AdasPipelineMt_t *)pCtx;
+    (void)chunk;
+    stage_arbitration(m->Out);
+}
+
+int adas_pipeline_mt_init(AdasPipelineMt_t *pMt, TaskPool_t *pPool)
+{
+    if (!pMt) return -1;
+
+    memset(pMt, 0, sizeof(*pMt));
+    pMt->Pool = pPool;
+    task_graph_init(&pMt->Graph);
+
+    int front = task_graph_add(&pMt->Graph, task_front, pMt, 1, 0u);
+    int acc   = task_graph_add(&pMt->Graph, task_acc, pMt, 1, 1u << front);
+    int aeb   = task_graph_add(&pMt->Graph, task_aeb, pMt, 1, 1u << front);
+    int lfa   = task_graph_add(&pMt->Graph, task_lfa, pMt, 1, 1u << front);
+    int arb   = task_graph_add(&pMt->Graph, task_arbitration, pMt, 1,
+                               (1u << acc) | (1u << aeb) | (1u << lfa));
+    return (arb < 0) ? -1 : 0;
+}
+
+int adas_pipeline_step_mt(AdasPipelineMt_t          *pMt,
+                          AdasPipelineState_t       *pState,
+                          const AdasPipelineInput_t *pIn,
+                          AdasPipelineOutput_t      *pOut)
+{
+    if (!pMt || pMt->Graph.Count == 0 || !step_args_valid(pState, pIn, pOut)) return -1;
+
+    memset(pOut, 0, sizeof(*pOut));
+    pMt->State = pState;
+    pMt->In    = pIn;
+    pMt->Out   = pOut;
+    return task_graph_run(pMt->Pool, &pMt->Graph);
+}
+
+/*─────────────────────────────
+  대량 객체 select / predict 조각 병렬
+   - select  : 조각 k 가 입력 [k·C, k·C + len) 을 Filtered 의 같은 오프셋에 기록 (maxFiltered >= n)
+   - compact : 조각 결과를 순서대로 앞으로 당김 (목적지 <= 원본 → memmove 안전)
+   - predict : 조각 k 가 Filtered [k·C, ...) → Predicted 같은 오프셋 (객체별 독립)
+─────────────────────────────*/
+static void sel_task_select(void *pCtx, int chunk)
+{
+    AdasSelectMt_t *s = (AdasSelectMt_t *)pCtx;
+    int off = chunk * s->Chunk_Size;
+    int len = s->Obj_Count - off;
+    if (len > s->Chunk_Size) len = s->Chunk_Size;
+    s->Seg_Count[chunk] = (len > 0)
+        ? select_target_from_object_list(s->Obj + off, len, s->Ego, s->Ls, s->Filtered + off, len)
+        : 0;
+}
+
+static void sel_task_compact(void *pCtx, int chunk)
+{
+    AdasSelectMt_t *s = (AdasSelectMt_t *)pCtx;
+    int chunks = s->Graph.Task[s->Select_Task].Chunks;
+    int fc = 0;
+    (void)chunk;
+    for (int k = 0; k < chunks; k++) {
+        int off = k * s->Chunk_Size;
+        if (fc != off && s->Seg_Count[k] > 0) {
+            memmove(s->Filtered + fc, s->Filtered + off, (size_t)s->Seg_Count[k] * sizeof(FilteredObject_t));
+        }
+        fc += s->Seg_Count[k];
+    }
+    s->Filtered_Count = fc;
+}
+
+static void sel_task_predict(void *pCtx, int chunk)
+{
+    AdasSelectMt_t *s = (AdasSelectMt_t *)pCtx;
+    int n   = (s->Filtered_Count < s->Max_Pred) ? s->Filtered_Count : s->Max_Pred;
+    int off = chunk * s->Chunk_Size;
+    int len = n - off;
+    if (len > s->Chunk_Size) len = s->Chunk_Size;
+    s->Seg_Count[chunk] = (len > 0)
+        ? predict_object_future_path(s->Filtered + off, len, s->Lane, s->Ls, s->Predicted + off, len)
+        : 0;
+}
+
+int adas_select_mt_init(AdasSelectMt_t *pSel, TaskPool_t *pPool)
+{
+    if (!pSel) return -1;
+
+    memset(pSel, 0, sizeof(*pSel));
+    pSel->Pool = pPool;
+    task_graph_init(&pSel->Graph);
+
+    int sel = task_graph_add(&pSel->Graph, sel_task_select, pSel, 1, 0u);
+    int cmp = task_graph_add(&pSel->Graph, sel_task_compact, pSel, 1, 1u << sel);
+    int prd = task_graph_add(&pSel->Graph, sel_task_predict, pSel, 1, 1u << cmp);
+    pSel->Select_Task  = sel;
+    pSel->Predict_Task = prd;
+    return (prd < 0) ? -1 : 0;
+}
+
+int adas_select_predict_mt(AdasSelectMt_t           *pSel,
+                           const ObjectData_t       *pObjList,
+                           int                       objCount,
+                           const EgoData_t          *pEgo,
+                           const LaneData_t         *pLane,
+                           const LaneSelectOutput_t *pLs,
+                           FilteredObject_t         *pFiltered,
+                           int                       maxFiltered,
+                           PredictedObject_t        *pPredicted,
+                           int                       maxPred,
+                           int                      *pFilteredCount)
+{
+    int fc, pc;
+
+    /* 직렬 경로 : 인자 오류(직렬 함수가 0 반환) / 조각별 기록 영역 부족 */
+    if (!pSel || pSel->Graph.Count == 0 || !pObjList || !pEgo || !pLs || !pFiltered
+        || objCount <= 0 || maxFiltered < objCount)
+    {
+        fc = select_target_from_object_list(pObjList, objCount, pEgo, pLs, pFiltered, maxFiltered);
+        pc = predict_object_future_path(pFiltered, fc, pLane, pLs, pPredicted, maxPred);
+        if (pFilteredCount) *pFilteredCount = fc;
+        return pc;
+    }
+
+    int size   = ADAS_SELECT_CHUNK;
+    int minSz  = (objCount + ADAS_SELECT_MAX_CHUNKS - 1) / ADAS_SELECT_MAX_CHUNKS;
+    if (size < minSz) size = minSz;
+    int chunks = (objCount + size - 1) / size;
+
+    pSel->Obj        = pObjList;
+    pSel->Obj_Count  = objCount;
+    pSel->Ego        = pEgo;
+    pSel->Lane       = pLane;
+    pSel->Ls         = pLs;
+    pSel->Filtered   = pFiltered;
+    pSel->Predicted  = pPredicted;
+    pSel->Max_Pred   = (pPredicted && maxPred > 0) ? maxPred : 0;
+    pSel->Chunk_Size = size;
+    /* 예측 조각 수 : 필터링 결과 수를 미리 알 수 없어 상한(입력 조각 수)으로 두고 남는 조각은 빈 실행 */
+    task_graph_set_chunks(&pSel->Graph, pSel->Select_Task, chunks);
+    task_graph_set_chunks(&pSel->Graph, pSel->Predict_Task, chunks);
+    task_graph_run(pSel->Pool, &pSel->Graph);
+
+    pc = 0;
+    for (int k = 0; k < chunks; k++) pc += pSel->Seg_Count[k];
+    if (pFilteredCount) *pFilteredCount = pSel->Filtered_Count;
+    return pc;
+}
@@ -0,0 +1,251 @@
+/****************************************************************************
+ * adas_pipeline.h
+ *
+ * - 1 틱(10 ms) 전체 파이프라인 :
+ *     EgoVehicleEstimation → LaneSelection → select_target_from_object_list
+ *     → predict_object_future_path → select_targets_for_acc_aeb
+ *     → ACC / AEB / LFA → Arbitration
+ * - 회귀 검증(golden_trace) 과 통합 실행용 단일 진입점
+ * - ACC / LFA PID 상태는 모듈 전역 → 프로세스당 파이프라인 1 개
+ *   (adas_pipeline_init 이 전역 상태까지 초기화, 병렬 실행은 프로세스 단위)
+ * - acc.h / aeb.h / lfa.h 의 Ego_Data_t 가 서로 달라 단계별 번역 단위로 분리
+ *   (adas_pipeline.c : Ego/Lane/Target/AEB/Arbitration,
+ *    adas_pipeline_acc.c : ACC, adas_pipeline_lfa.c : LFA)
+ * - adas_pipeline_step_mt : 같은 틱을 정적 작업 그래프(task_graph)로 실행
+ *     Ego/Lane/Target → { ACC ∥ AEB ∥ LFA } → Arbitration (join 후)
+ *   ACC / LFA PID 전역은 서로 독립, AEB 는 상태 없음 → 출력은 adas_pipeline_step 과 비트 동일
+ * - adas_select_predict_mt : 대량 객체 리스트의 select / predict 를 조각 병렬 실행
+ *   (조각별 필터링 → 순서 보존 압축 → 조각별 예측, 결과는 직렬 호출과 동일)
+ * - adas_pipeline_step_perf : adas_pipeline_step 과 같되 단계마다 성능 카운터 구간 기록 (adas_perf.h)
+ * - adas_pipeline_set_object_status : 객체 상태 머신(object_status.h) 연결 (기본 꺼짐)
+ *     select_target_from_object_list 직후 Filtered_Object_Status 를 이력 기반으로 갱신
+ *     → 정지한 선행차가 Stopped 로 남아 ACC 대상 유지 (꺼져 있으면 골든 트레이스와 비트 동일)
+ ****************************************************************************/
+#ifndef ADAS_PIPELINE_H
+#define ADAS_PIPELINE_H
+
+#include <stdint.h>
+#include "adas_shared.h"
+#include "adas_perf.h"
+#include "ego_vehicle_estimation.h"
+#include "lane_selection.h"
+#include "object_status.h"
+#include "target_selection.h"
+#include "task_graph.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ADAS_PIPELINE_MAX_OBJ   32
+#define ADAS_PIPELINE_DT        0.01f   /* [s] 제어 주기 */
+
+/* 1 틱 입력 (센서) */
+typedef struct {
+    TimeData_t   Time;                  /* [ms] */
+    GPSData_t    Gps;
+    IMUData_t    Imu;
+    LaneData_t   Lane;
+    int32_t      Obj_Count;
+    ObjectData_t Obj[ADAS_PIPELINE_MAX_OBJ];
+} AdasPipelineInput_t;
+
+/* 1 틱 출력 (중간 결과 포함) */
+typedef struct {
+    EgoData_t          Ego;
+    LaneSelectOutput_t Ls;
+    int32_t Filtered_Count;
+    int32_t Acc_Target_ID;              /* 없음 : -1 */
+    int32_t Aeb_Target_ID;
+    int32_t Acc_Mode;                   /* ACC_Mode_e */
+    int32_t Aeb_Mode;                   /* AEB_Mode_e */
+    int32_t Lfa_Mode;                   /* LFA_Mode_e */
+    float   Accel_Acc;                  /* [m/s^2] */
+    float   Ttc;                        /* [s] */
+    float   Decel_Aeb;                  /* [m/s^2] */
+    float   Steer_Lfa;                  /* [°] */
+    float   Throttle;                   /* Arbitration 최종 출력 */
+    float   Brake;
+    float   Steer;
+} AdasPipelineOutput_t;
+
+/* 증분 평가 (입력 변화 없으면 재계산 생략, 결과는 비트 동일) */
+typedef struct {
+    int32_t             Enabled;
+    LaneSelectionMemo_t Lane;           /* LaneSelection 차선 부분 */
+    TargetCurveMemo_t   Curve;          /* 곡선 보정 횡방향 한계 / cos(Heading Error) */
+} AdasPipelineMemo_t;
+
+typedef struct {
+    EgoVehicleKFState_t Kf;
+    float               Prev_Steer;     /* [°] LFA 입력 조향각 (이전 틱 출력) */
+    AdasPipelineMemo_t  Memo;
+    ObjectStatusTable_t *Obj_Status;    /* NULL : 끔 (테이블은 호출자 소유, 상태 복사 시 공유됨) */
+} AdasPipelineState_t;
+
+/**
+ * @brief 상태 + ACC/LFA 모듈 전역 PID 상태 초기화
+ */
+void adas_pipeline_init(AdasPipelineState_t *pState);
+
+/**
+ * @brief 증분 평가 켜기 / 끄기 (기본 꺼짐, 바꿀 때 캐시 / 적중 카운터 초기화)
+ */
+void adas_pipeline_set_incremental(AdasPipelineState_t *pState, int enable);
+
+/**
+ * @brief 객체 상태 머신 연결 / 해제 (기본 해제, adas_pipeline_init 이 해제)
+ * @param pTable : object_status_init 을 마친 테이블 (NULL : 해제), 연결 동안 유효해야 함
+ */
+void adas_pipeline_set_object_status(AdasPipelineState_t *pState, ObjectStatusTable_t *pTable);
+
+/**
+ * @brief 1 틱 실행
+ * @return 0 on success, -1 on invalid argument (Obj_Count 범위 밖 포함)
+ */
+int adas_pipeline_step(AdasPipelineState_t       *pState,
+                       const AdasPipelineInput_t *pIn,
+                       AdasPipelineOutput_t      *pOut);
+
+/**
+ * @brief 1 틱 실행 + 단계별 성능 카운터 누적 (pPerf NULL 이면 adas_pipeline_step 과 동일)
+ *        출력은 adas_pipeline_step 과 비트 동일
+ * @return 0 on success, -1 on invalid argument
+ */
+int adas_pipeline_step_perf(AdasPipelineState_t       *pState,
+                            const AdasPipelineInput_t *pIn,
+                            AdasPipelineOutput_t      *pOut,
+                            AdasPerf_t                *pPerf);
+
+/*--------------- 단계 분할 (프레임 간 파이프라인, adas_replay) ---------------*/
+/*  ego_lane → target → control 순서로 호출하면 adas_pipeline_step 과 같은 결과
+ *  - ego_lane : pOut 초기화 + Ego 추정 + Lane Selection (pState->Kf, Memo.Lane 만 갱신)
+ *  - target   : 객체 필터링 / 예측 / ACC·AEB 대상 선정 (pState->Memo.Curve, *Obj_Status 만 갱신)
+ *  - control  : ACC / AEB / LFA / Arbitration (pState->Prev_Steer 만 갱신)
+ *  → 단계마다 다른 스레드에서 서로 다른 프레임을 동시에 처리 가능 (단계 내 프레임 순서 유지) */
+
+typedef struct {
+    ACC_Target_t Acc_Target;
+    AEB_Target_t Aeb_Target;
+} AdasPipelineTargets_t;
+
+/** @return 0 on success, -1 on invalid argument */
+int adas_pipeline_stage_ego_lane(AdasPipelineState_t       *pState,
+                                 const AdasPipelineInput_t *pIn,
+                                 AdasPipelineOutput_t      *pOut);
+
+/** @return 0 on success, -1 on invalid argument */
+int adas_pipeline_stage_target(AdasPipelineState_t       *pState,
+                               const AdasPipelineInput_t *pIn,
+                               AdasPipelineOutput_t      *pOut,
+                               AdasPipelineTargets_t     *pTargets);
+
+/** @return 0 on success, -1 on invalid argument */
+int adas_pipeline_stage_control(AdasPipelineState_t         *pState,
+                                const AdasPipelineInput_t   *pIn,
+                                AdasPipelineOutput_t        *pOut,
+                                const AdasPipelineTargets_t *pTargets);
+
+/*--------------- 병렬 실행 (task_graph) ---------------*/
+
+typedef struct {
+    TaskGraph_t  Graph;                 /* 초기화 시 1 회 구성 */
+    TaskPool_t  *Pool;                  /* NULL 이면 호출 스레드만 */
+
+    /* 틱 문맥 (adas_pipeline_step_mt 가 채움) */
+    AdasPipelineState_t       *State;
+    const AdasPipelineInput_t *In;
+    AdasPipelineOutput_t      *Out;
+    ACC_Target_t Acc_Target;
+    AEB_Target_t Aeb_Target;
+} AdasPipelineMt_t;
+
+/** @brief 작업 그래프 구성 @return 0 / -1 */
+int adas_pipeline_mt_init(AdasPipelineMt_t *pMt, TaskPool_t *pPool);
+
+/**
+ * @brief 1 틱 실행 (ACC / AEB / LFA 병렬), 결과는 adas_pipeline_step 과 동일
+ * @return 0 on success, -1 on invalid argument
+ */
+int adas_pipeline_step_mt(AdasPipelineMt_t          *pMt,
+                          AdasPipelineState_t       *pState,
+                          const AdasPipelineInput_t *pIn,
+                          AdasPipelineOutput_t      *pOut);
+
+#define ADAS_SELECT_CHUNK       256     /* 최소 조각 크기 [객체] */
+#define ADAS_SELECT_MAX_CHUNKS  64
+
+typedef struct {
+    TaskGraph_t  Graph;
+    TaskPool_t  *Pool;
+    int32_t      Select_Task;
+    int32_t      Predict_Task;
+
+    /* 호출 문맥 */
+    const ObjectData_t       *Obj;
+    int32_t                   Obj_Count;
+    const EgoData_t          *Ego;
+    const LaneData_t         *Lane;
+    const LaneSelectOutput_t *Ls;
+    FilteredObject_t         *Filtered;
+    PredictedObject_t        *Predicted;
+    int32_t                   Max_Pred;
+    int32_t                   Chunk_Size;
+    int32_t                   Filtered_Count;
+    int32_t                   Seg_Count[ADAS_SELECT_MAX_CHUNKS];   /* 조각별 결과 수 */
+} AdasSelectMt_t;
+
+/** @brief 작업 그래프 구성 @return 0 / -1 */
+int adas_select_mt_init(AdasSelectMt_t *pSel, TaskPool_t *pPool);
+
+/**
+ * @brief select_target_from_object_list + predict_object_future_path 조각 병렬 실행
+ *        (maxFiltered < objCount 이면 조각별 기록 영역이 모자라 직렬 실행)
+ * @param[out] pFilteredCount : 필터링 결과 수 (NULL 허용)
+ * @return 예측 객체 수 (직렬 호출과 같은 값 / 같은 배열 내용)
+ */
+int adas_select_predict_mt(AdasSelectMt_t           *pSel,
+                           const ObjectData_t       *pObjList,
+                           int                       objCount,
+                           const EgoData_t          *pEgo,
+                           const LaneData_t         *pLane,
+                           const LaneSelectOutput_t *pLs,
+                           FilteredObject_t         *pFiltered,
+                           int                       maxFiltered,
+                           PredictedObject_t        *pPredicted,
+                           int                       maxPred,
+                           int                      *pFilteredCount);
+
+/*--------------- 단계 함수 (adas_pipeline_acc.c / _lfa.c / adas_pipeline.c) ---------------*/
+
+void  adas_pipeline_acc_reset(void);
+float adas_pipeline_acc_stage(const ACC_Target_t       *pTarget,
+                              const EgoData_t          *pEgo,
+                              const LaneData_t         *pLane,
+                              const LaneSelectOutput_t *pLs,
+                              float                     currentTimeMs,
+                              float                     dt,         /* [s] ACC 실행 주기 */
+                              int32_t                  *pMode);
+
+void  adas_pipeline_lfa_reset(void);
+float adas_pipeline_lfa_stage(const EgoData_t          *pEgo,
+                              const LaneSelectOutput_t *pLs,
+                              float                     prevSteer,
+                              float                     dt,         /* [s] LFA 실행 주기 */
+                              int32_t                  *pMode);
+
+/* adas_pipeline.c : AEB (상태 없음), 반환 = 감속 요구 [m/s^2] */
+float adas_pipeline_aeb_stage(const AEB_Target_t *pTarget,
+                              const EgoData_t    *pEgo,
+                              int32_t            *pMode,
+                              float              *pTtc);
+
+/* adas_pipeline.c : Arbitration (aebMode = AEB_Mode_e) */
+void  adas_pipeline_arbitration_stage(float accel, float decel, float steer, int32_t aebMode,
+                                      float *pThrottle, float *pBrake, float *pSteer);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADAS_PIPELINE_H */
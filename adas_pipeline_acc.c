@@ -0,0 +1,45 @@
+#include "adas_pipeline.h"
+#include "acc.h"
+
+void adas_pipeline_acc_reset(void)
+{
+    acc_pid_reset();
+}
+
+float adas_pipeline_acc_stage(const ACC_Target_t       *pTarget,
+                              const EgoData_t          *pEgo,
+                              const LaneData_t         *pLane,
+                              const LaneSelectOutput_t *pLs,
+                              float                     currentTimeMs,
+                              float                     dt,
+                              int32_t                  *pMode)
+{
+    if (!pTarget || !pEgo || !pLane || !pLs || !pMode) return 0.0f;
+
+    /* ACC_Target_t (Target Selection 출력) → ACC_Target_Data_t (ACC 입력) */
+    ACC_Target_Data_t in;
+    in.ACC_Target_ID         = pTarget->ACC_Target_ID;
+    in.ACC_Target_Distance   = pTarget->ACC_Target_Distance;
+    in.ACC_Target_Status     = (ACC_Target_Status_e)pTarget->ACC_Target_Status;
+    in.ACC_Target_Situation  = (pTarget->ACC_Target_Situation == TGT_SITU_CUTIN)  ? ACC_TARGET_CUT_IN
+                             : (pTarget->ACC_Target_Situation == TGT_SITU_CUTOUT) ? ACC_TARGET_CUT_OUT
+                             : ACC_TARGET_NORMAL;
+    in.ACC_Target_Velocity_X = pTarget->ACC_Target_Vel_X;
+
+    Ego_Data_t ego;
+    ego.Ego_Velocity_X     = pEgo->Ego_Velocity_X;
+    ego.Ego_Acceleration_X = pEgo->Ego_Acceleration_X;
+
+    Lane_Data_t lane;
+    lane.Lane_Curvature      = pLane->Lane_Curvature;
+    lane.Next_Lane_Curvature = pLane->Next_Lane_Curvature;
+    lane.LS_Heading_Error    = pLs->LS_Heading_Error;
+    lane.LS_Is_Curved_Lane   = pLs->LS_Is_Curved_Lane ? 1 : 0;
+
+    ACC_Mode_e mode = acc_mode_selection(&in, &ego, &lane);
+    float accelDist  = calculate_accel_for_distance_pid(mode, &in, &ego, currentTimeMs);
+    float accelSpeed = calculate_accel_for_speed_pid(&ego, &lane, dt);
+
+    *pMode = (int32_t)mode;
+    return acc_output_selection(mode, accelDist, accelSpeed);
+}
@@ -0,0 +1,35 @@
+#include "adas_pipeline.h"
+#include "lfa.h"
+
+void adas_pipeline_lfa_reset(void)
+{
+    pid_set_gains(0.1f, 0.01f, 0.005f);     /* 기본 게인 + 적분 초기화 */
+}
+
+float adas_pipeline_lfa_stage(const EgoData_t          *pEgo,
+                              const LaneSelectOutput_t *pLs,
+                              float                     prevSteer,
+                              float                     dt,
+                              int32_t                  *pMode)
+{
+    if (!pEgo || !pLs || !pMode) return 0.0f;
+
+    Ego_Data_t ego;
+    ego.Ego_Velocity_X     = pEgo->Ego_Velocity_X;
+    ego.Ego_Yaw_Rate       = pEgo->Ego_Yaw_Rate;
+    ego.Ego_Steering_Angle = prevSteer;
+
+    Lane_Data_LS_t lane;
+    lane.LS_Heading_Error    = pLs->LS_Heading_Error;
+    lane.LS_Lane_Offset      = pLs->LS_Lane_Offset;
+    lane.LS_Is_Changing_Lane = pLs->LS_Is_Changing_Lane ? 1 : 0;
+    lane.LS_Is_Within_Lane   = pLs->LS_Is_Within_Lane ? 1 : 0;
+    lane.LS_Is_Curved_Lane   = pLs->LS_Is_Curved_Lane ? 1 : 0;
+
+    LFA_Mode_e mode = lfa_mode_selection(&ego);
+    float steerPid     = calculate_steer_in_low_speed_pid(&lane, dt);
+    float steerStanley = calculate_steer_in_high_speed_stanley(&ego, &lane);
+
+    *pMode = (int32_t)mode;
+    return lfa_output_selection(mode, steerPid, steerStanley, &lane, &ego);
+}
@@ -0,0 +1,337 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "adas_recorder.h"
+#include "aeb.h"                /* AEB_MODE_BRAKE */
+
+#define REC_NO_GUARD    INT64_MAX
+
+/*─────────────────────────────
+  사건 창 → 파일 (대기열에 있는 동안 창의 칸은 이 함수만 읽음)
+─────────────────────────────*/
+static int write_event_file(const AdasRecorder_t *pRec, AdasRecEvent_t *pEv)
+{
+    char path[1024];
+    int n = snprintf(path, sizeof(path), ADAS_REC_FILE_FORMAT,
+                     pRec->Cfg.Output_Dir, (unsigned long long)pEv->Header.Sequence);
+    if (n < 0 || n >= (int)sizeof(path)) return -1;
+
+    /* 기록하지 못한 틱(Skipped)의 칸에는 Size 틱 이전 내용이 남아 있음 → Tick 으로 걸러냄 */
+    uint64_t count = 0;
+    for (int64_t t = pEv->First_Tick; t <= pEv->Last_Tick; t++) {
+        if (pRec->Ring[t % pRec->Size].Tick == t) count++;
+    }
+    pEv->Header.Count = count;
+
+    FILE *fp = fopen(path, "wb");
+    if (!fp) return -1;
+
+    int rc = (fwrite(&pEv->Header, sizeof(pEv->Header), 1, fp) == 1) ? 0 : -1;
+    for (int64_t t = pEv->First_Tick; rc == 0 && t <= pEv->Last_Tick; t++) {
+        const AdasRecTick_t *r = &pRec->Ring[t % pRec->Size];
+        if (r->Tick == t && fwrite(r, sizeof(*r), 1, fp) != 1) rc = -1;
+    }
+    if (fclose(fp) != 0) rc = -1;
+    return rc;
+}
+
+/* Queue[0] 기록 후 꺼냄 (Lock 잡은 채 호출, 반환 시에도 잡은 상태) */
+static void flush_head_locked(AdasRecorder_t *pRec)
+{
+    AdasRecEvent_t ev = pRec->Queue[0];
+    pRec->Writing = 1;
+    pthread_mutex_unlock(&pRec->Lock);
+
+    int rc = write_event_file(pRec, &ev);
+
+    pthread_mutex_lock(&pRec->Lock);
+    if (rc == 0) pRec->Stats.Flushed++;
+    else         pRec->Stats.Write_Errors++;
+    pRec->Queue_Count--;
+    memmove(&pRec->Queue[0], &pRec->Queue[1], (size_t)pRec->Queue_Count * sizeof(pRec->Queue[0]));
+    pRec->Writing = 0;
+    pthread_cond_broadcast(&pRec->Idle);
+}
+
+static void *writer_main(void *pArg)
+{
+    AdasRecorder_t *pRec = (AdasRecorder_t *)pArg;
+
+    pthread_mutex_lock(&pRec->Lock);
+    for (;;) {
+        while (!pRec->Stop && pRec->Queue_Count == 0) pthread_cond_wait(&pRec->Wake, &pRec->Lock);
+        if (pRec->Queue_Count == 0) break;                  /* Stop, 대기 사건 없음 */
+        flush_head_locked(pRec);
+    }
+    pthread_mutex_unlock(&pRec->Lock);
+    return NULL;
+}
+
+/*─────────────────────────────
+  얼리기 : 창 [last - Capacity + 1, last] 를 대기열에 넣음 (복사 없음)
+─────────────────────────────*/
+static int freeze(AdasRecorder_t *pRec, int64_t last)
+{
+    AdasRecEvent_t ev;
+    memset(&ev, 0, sizeof(ev));
+    ev.Header.Magic        = ADAS_REC_MAGIC;
+    ev.Header.Version      = ADAS_REC_VERSION;
+    ev.Header.Record_Size  = (uint32_t)sizeof(AdasRecTick_t);
+    ev.Header.Trigger      = pRec->Event_Trigger;
+    ev.Header.Trigger_Tick = pRec->Event_Tick;
+    ev.Last_Tick           = last;
+    ev.First_Tick          = last - pRec->Cfg.Capacity + 1;
+    if (ev.First_Tick < 0) ev.First_Tick = 0;
+
+    pthread_mutex_lock(&pRec->Lock);
+    if (pRec->Queue_Count == ADAS_REC_MAX_PENDING) {
+        /* 가득 참 : Brake 사건만 기록 중이 아닌 가장 최근의 Brake 없는 사건을 밀어냄 */
+        int victim = -1;
+        if (ev.Header.Trigger & ADAS_REC_TRIG_AEB_BRAKE) {
+            for (int i = pRec->Queue_Count - 1; i >= pRec->Writing; i--) {
+                if (!(pRec->Queue[i].Header.Trigger & ADAS_REC_TRIG_AEB_BRAKE)) {
+                    victim = i;
+                    break;
+                }
+            }
+        }
+        pRec->Stats.Dropped++;
+        if (victim < 0) {
+            pthread_mutex_unlock(&pRec->Lock);
+            return 0;
+        }
+        pRec->Queue_Count--;
+        memmove(&pRec->Queue[victim], &pRec->Queue[victim + 1],
+                (size_t)(pRec->Queue_Count - victim) * sizeof(pRec->Queue[0]));
+    }
+    ev.Header.Sequence = pRec->Stats.Events++;
+    pRec->Queue[pRec->Queue_Count++] = ev;
+    pRec->Guard_Tick = pRec->Queue[0].First_Tick + pRec->Size;
+
+    if (pRec->Cfg.Async) {
+        pthread_cond_signal(&pRec->Wake);
+    } else {
+        while (pRec->Queue_Count > 0) flush_head_locked(pRec);
+    }
+    pthread_mutex_unlock(&pRec->Lock);
+    return 1;
+}
+
+/* tick 칸이 대기 중인 창과 겹치면 0 (보수적 캐시 Guard_Tick 에 걸릴 때만 대기열 확인) */
+static int slot_free(AdasRecorder_t *pRec, int64_t tick)
+{
+    if (tick < pRec->Guard_Tick) return 1;
+
+    pthread_mutex_lock(&pRec->Lock);
+    pRec->Guard_Tick = (pRec->Queue_Count > 0) ? pRec->Queue[0].First_Tick + pRec->Size : REC_NO_GUARD;
+    pthread_mutex_unlock(&pRec->Lock);
+    return tick < pRec->Guard_Tick;
+}
+
+/* 다음 칸 쓰기 예취 : 링이 캐시보다 커서 매 틱 새 줄에 쓰므로 미스를 다음 틱 전까지 겹침
+   (이번 틱 객체 수만큼) */
+static void prefetch_slot(const AdasRecTick_t *r, int objCount)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    const char *p   = (const char *)r;
+    const char *end = (const char *)&r->Obj[objCount];
+    for (; p < end; p += 64) __builtin_prefetch(p, 1, 0);
+#else
+    (void)r;
+    (void)objCount;
+#endif
+}
+
+static uint32_t detect_triggers(AdasRecorder_t *pRec, const AdasPipelineOutput_t *pOut, uint64_t stepNs)
+{
+    uint32_t mask = pRec->Cfg.Trigger_Mask;
+    uint32_t trig = pRec->Manual;
+    pRec->Manual = 0;
+
+    int brake = (pOut->Aeb_Mode == (int32_t)AEB_MODE_BRAKE);
+    if (pRec->Have_Prev) {
+        if (brake && pRec->Prev_Aeb_Mode != (int32_t)AEB_MODE_BRAKE) trig |= mask & ADAS_REC_TRIG_AEB_BRAKE;
+        if (pOut->Acc_Mode != pRec->Prev_Acc_Mode || pOut->Aeb_Mode != pRec->Prev_Aeb_Mode
+            || pOut->Lfa_Mode != pRec->Prev_Lfa_Mode) {
+            trig |= mask & ADAS_REC_TRIG_MODE_FLIP;
+        }
+    } else if (brake) {
+        trig |= mask & ADAS_REC_TRIG_AEB_BRAKE;
+    }
+    if (pRec->Cfg.Deadline_Ns > 0 && stepNs > pRec->Cfg.Deadline_Ns) trig |= mask & ADAS_REC_TRIG_DEADLINE;
+
+    pRec->Have_Prev     = 1;
+    pRec->Prev_Acc_Mode = pOut->Acc_Mode;
+    pRec->Prev_Aeb_Mode = pOut->Aeb_Mode;
+    pRec->Prev_Lfa_Mode = pOut->Lfa_Mode;
+    return trig;
+}
+
+/*─────────────────────────────
+  공개 함수
+─────────────────────────────*/
+int adas_recorder_init(AdasRecorder_t *pRec, const AdasRecorderConfig_t *pCfg)
+{
+    if (!pRec || !pCfg || !pCfg->Output_Dir) return -1;
+    if (pCfg->Capacity <= 0 || pCfg->Capacity > 0x3FFFFFFF) return -1;
+    if (pCfg->Post_Ticks < 0 || pCfg->Post_Ticks >= pCfg->Capacity) return -1;
+
+    memset(pRec, 0, sizeof(*pRec));
+    pRec->Cfg        = *pCfg;
+    pRec->Size       = 2 * pCfg->Capacity;
+    pRec->Post_Left  = -1;
+    pRec->Guard_Tick = REC_NO_GUARD;
+
+    pRec->Ring = (AdasRecTick_t *)calloc((size_t)pRec->Size, sizeof(AdasRecTick_t));
+    if (!pRec->Ring) return -1;
+
+    if (pthread_mutex_init(&pRec->Lock, NULL) != 0) {
+        free(pRec->Ring);
+        pRec->Ring = NULL;
+        return -1;
+    }
+    pthread_cond_init(&pRec->Wake, NULL);
+    pthread_cond_init(&pRec->Idle, NULL);
+
+    if (pCfg->Async) {
+        if (pthread_create(&pRec->Thread, NULL, writer_main, pRec) != 0) {
+            adas_recorder_destroy(pRec);
+            return -1;
+        }
+        pRec->Thread_Started = 1;
+    }
+    return 0;
+}
+
+void adas_recorder_destroy(AdasRecorder_t *pRec)
+{
+    if (!pRec || !pRec->Ring) return;
+
+    if (pRec->Thread_Started) {
+        pthread_mutex_lock(&pRec->Lock);
+        pRec->Stop = 1;
+        pthread_cond_signal(&pRec->Wake);
+        pthread_mutex_unlock(&pRec->Lock);
+        pthread_join(pRec->Thread, NULL);                   /* 대기 사건은 마치고 종료 */
+        pRec->Thread_Started = 0;
+    }
+    pthread_cond_destroy(&pRec->Idle);
+    pthread_cond_destroy(&pRec->Wake);
+    pthread_mutex_destroy(&pRec->Lock);
+    free(pRec->Ring);
+    pRec->Ring = NULL;
+}
+
+int adas_recorder_record(AdasRecorder_t *pRec, const AdasPipelineInput_t *pIn,
+                         const AdasPipelineOutput_t *pOut, uint64_t stepNs)
+{
+    if (!pRec || !pIn || !pOut || !pRec->Ring) return -1;
+    if (pIn->Obj_Count < 0 || pIn->Obj_Count > ADAS_PIPELINE_MAX_OBJ) return -1;
+
+    int64_t  tick = pRec->Tick;
+    uint32_t trig = detect_triggers(pRec, pOut, stepNs);
+
+    if (slot_free(pRec, tick)) {
+        AdasRecTick_t *r = &pRec->Ring[tick % pRec->Size];
+        r->Tick      = tick;
+        r->Step_Ns   = stepNs;
+        r->Time      = pIn->Time;
+        r->Gps       = pIn->Gps;
+        r->Imu       = pIn->Imu;
+        r->Lane      = pIn->Lane;
+        r->Out       = *pOut;
+        r->Obj_Count = pIn->Obj_Count;
+        r->Trigger   = trig;
+        memcpy(r->Obj, pIn->Obj, (size_t)pIn->Obj_Count * sizeof(r->Obj[0]));
+        prefetch_slot(&pRec->Ring[(tick + 1) % pRec->Size], pIn->Obj_Count);
+        pRec->Stats.Ticks++;
+    } else {
+        pRec->Stats.Skipped++;
+    }
+    pRec->Tick++;
+
+    if (trig) {
+        if (pRec->Post_Left < 0) {
+            pRec->Post_Left     = pRec->Cfg.Post_Ticks;
+            pRec->Event_Trigger = trig;
+            pRec->Event_Tick    = tick;
+        } else if ((trig & ADAS_REC_TRIG_AEB_BRAKE) && !(pRec->Event_Trigger & ADAS_REC_TRIG_AEB_BRAKE)) {
+            pRec->Post_Left      = pRec->Cfg.Post_Ticks;    /* Brake 기준으로 다시 잡음 */
+            pRec->Event_Trigger |= trig;
+            pRec->Event_Tick     = tick;
+        } else {
+            pRec->Event_Trigger |= trig;                    /* 같은 사건으로 병합 */
+        }
+    }
+    if (pRec->Post_Left < 0) return 0;
+    if (pRec->Post_Left > 0) {
+        pRec->Post_Left--;
+        return 0;
+    }
+    pRec->Post_Left = -1;
+    return freeze(pRec, tick);
+}
+
+void adas_recorder_trigger(AdasRecorder_t *pRec)
+{
+    if (!pRec) return;
+    pRec->Manual |= ADAS_REC_TRIG_MANUAL;
+}
+
+void adas_recorder_flush_wait(AdasRecorder_t *pRec)
+{
+    if (!pRec || !pRec->Ring) return;
+
+    pthread_mutex_lock(&pRec->Lock);
+    while (pRec->Queue_Count > 0) pthread_cond_wait(&pRec->Idle, &pRec->Lock);
+    pthread_mutex_unlock(&pRec->Lock);
+}
+
+int adas_recorder_stats(AdasRecorder_t *pRec, AdasRecorderStats_t *pStats)
+{
+    if (!pRec || !pStats || !pRec->Ring) return -1;
+
+    pthread_mutex_lock(&pRec->Lock);
+    *pStats = pRec->Stats;
+    pthread_mutex_unlock(&pRec->Lock);
+    return 0;
+}
+
+int adas_recorder_load(const char *path, AdasRecFileHeader_t *pHdr, AdasRecTick_t *pRecs, int maxCount)
+{
+    if (!path || !pHdr) return -1;
+
+    FILE *fp = fopen(path, "rb");
+    if (!fp) return -1;
+
+    int rc = -1;
+    if (fread(pHdr, sizeof(*pHdr), 1, fp) == 1
+        && pHdr->Magic == ADAS_REC_MAGIC && pHdr->Version == ADAS_REC_VERSION
+        && pHdr->Record_Size == (uint32_t)sizeof(AdasRecTick_t) && pHdr->Count <= 0x7FFFFFFFu)
+    {
+        int count = (int)pHdr->Count;
+        if (!pRecs) {
+            rc = count;
+        } else if (count <= maxCount && fread(pRecs, sizeof(AdasRecTick_t), (size_t)count, fp) == (size_t)count) {
+            rc = count;
+        }
+    }
+    fclose(fp);
+    return rc;
+}
+
+int adas_rec_tick_to_input(const AdasRecTick_t *pTick, AdasPipelineInput_t *pIn)
+{
+    if (!pTick || !pIn) return -1;
+    if (pTick->Obj_Count < 0 || pTick->Obj_Count > ADAS_PIPELINE_MAX_OBJ) return -1;
+
+    memset(pIn, 0, sizeof(*pIn));
+    pIn->Time      = pTick->Time;
+    pIn->Gps       = pTick->Gps;
+    pIn->Imu       = pTick->Imu;
+    pIn->Lane      = pTick->Lane;
+    pIn->Obj_Count = pTick->Obj_Count;
+    memcpy(pIn->Obj, pTick->Obj, (size_t)pTick->Obj_Count * sizeof(pIn->Obj[0]));
+    return 0;
+}
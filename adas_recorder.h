@@ -0,0 +1,170 @@
+/****************************************************************************
+ * adas_recorder.h
+ *
+ * - 사전 트리거 비행 기록기 : 최근 틱의 입력 + 중간 결과를 메모리 링에 계속 기록,
+ *   트리거가 걸리면 Post_Ticks 만큼 더 기록한 뒤 최근 Capacity 틱 창을 얼려 파일로 비동기 기록
+ *     . 트리거 : AEB Brake 진입, 모드 전이(ACC / AEB / LFA), 마감 초과(Step_Ns > Deadline_Ns), 수동
+ *     . 창 안에서 다시 걸린 트리거는 같은 사건으로 병합 (창 연장 없음)
+ *       단 AEB Brake 는 Brake 없는 열린 사건을 Brake 틱 기준으로 다시 잡음 (사후 창 재시작)
+ * - 틱 레코드 (고정 크기) : 센서 입력(시각 / GPS / IMU / 차선 / 객체 ObjectData_t 그대로)
+ *   + 파이프라인 출력(중간값 포함) → adas_rec_tick_to_input 으로 비트 동일 복원
+ * - 링 1 개 = 2 × Capacity 칸 (틱 T → 칸 T % (2 × Capacity)), 초기화 시 1 회 할당
+ *     . 얼리기는 창 [T - Capacity + 1, T] 를 대기열에 넣기만 함 (O(1), 복사 없음)
+ *       → 기록은 끊기지 않고, 연달아 걸린 사건도 각자 Capacity 틱 사전 구간을 가짐
+ *     . 대기 중인 창의 칸은 덮어쓰지 않음 : 기록 스레드가 얼린 뒤 Capacity 틱 안에 끝내지
+ *       못하면 그동안의 틱은 기록하지 않음 (Skipped, 파일에서는 빠진 틱)
+ *     . 대기열 ADAS_REC_MAX_PENDING 개 (기록 중 포함)가 차면 새 사건은 버림 (Dropped),
+ *       단 AEB Brake 사건은 기록 중이 아닌 가장 최근의 Brake 없는 사건을 밀어내고 들어감
+ * - 틱당 비용 상한 : 고정 필드 + 객체 Obj_Count 개 복사, 틱 경로에 동적 할당 / 파일 I/O 없음
+ * - Async 0 : 얼리는 틱에서 호출 스레드가 바로 기록 (시험 / 단일 스레드 환경)
+ * - 파일 : AdasRecFileHeader_t + 레코드 Count 개 (오래된 틱부터), ADAS_REC_FILE_FORMAT 경로
+ * - 메모리 : 2 × Capacity × sizeof(AdasRecTick_t) (~1.9 KB / 틱, 30 s @ 10 ms ≈ 11 MB)
+ * - 한 스레드에서만 adas_recorder_record / trigger 호출 (기록 스레드와의 공유는 잠금)
+ ****************************************************************************/
+#ifndef ADAS_RECORDER_H
+#define ADAS_RECORDER_H
+
+#include <pthread.h>
+#include <stdint.h>
+#include "adas_pipeline.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ADAS_REC_MAGIC          0x43455241u     /* 'AREC' */
+#define ADAS_REC_VERSION        2u
+#define ADAS_REC_FILE_FORMAT    "%s/adas_rec_%06llu.bin"   /* 디렉터리, 사건 번호 */
+#define ADAS_REC_DEFAULT_TICKS  3000            /* 30 s @ 10 ms */
+#define ADAS_REC_MAX_PENDING    4               /* 기록 대기열 (기록 중인 사건 포함) */
+
+/* 트리거 비트 */
+#define ADAS_REC_TRIG_AEB_BRAKE     0x01u       /* Aeb_Mode 가 Brake 로 전이 (우선 사건) */
+#define ADAS_REC_TRIG_MODE_FLIP     0x02u       /* ACC / AEB / LFA 모드 변경 */
+#define ADAS_REC_TRIG_DEADLINE      0x04u       /* Step_Ns > Deadline_Ns */
+#define ADAS_REC_TRIG_MANUAL        0x08u       /* adas_recorder_trigger */
+
+typedef struct {
+    int32_t     Capacity;           /* 사건 창 틱 수 (사전 + 사후 구간) */
+    int32_t     Post_Ticks;         /* 트리거 후 추가 기록 틱 (0 .. Capacity - 1) */
+    uint32_t    Trigger_Mask;       /* ADAS_REC_TRIG_* */
+    uint64_t    Deadline_Ns;        /* 0 : 마감 검사 안 함 */
+    const char *Output_Dir;         /* 사건 파일 디렉터리 (문자열은 기록기 수명 동안 유효해야 함) */
+    int32_t     Async;              /* 1 : 기록 스레드, 0 : 호출 스레드에서 바로 기록 */
+} AdasRecorderConfig_t;
+
+/* 틱 레코드 (고정 크기) */
+typedef struct {
+    int64_t              Tick;
+    uint64_t             Step_Ns;               /* 호출자가 잰 틱 처리 시간 (0 : 미측정) */
+    TimeData_t           Time;
+    GPSData_t            Gps;
+    IMUData_t            Imu;
+    LaneData_t           Lane;
+    AdasPipelineOutput_t Out;
+    int32_t              Obj_Count;
+    uint32_t             Trigger;               /* 이 틱에 걸린 트리거 */
+    ObjectData_t         Obj[ADAS_PIPELINE_MAX_OBJ];    /* Obj_Count 이후 칸은 이전 내용 그대로 */
+} AdasRecTick_t;
+
+/* 파일 머리 */
+typedef struct {
+    uint32_t Magic;
+    uint32_t Version;
+    uint32_t Record_Size;
+    uint32_t Trigger;               /* 사건 트리거 (병합) */
+    int64_t  Trigger_Tick;          /* 사건 기준 틱 (첫 트리거, Brake 로 다시 잡으면 Brake 틱) */
+    uint64_t Sequence;              /* 사건 번호 (0 부터, 버린 사건 번호는 비어 있음) */
+    uint64_t Count;                 /* 레코드 수 */
+} AdasRecFileHeader_t;
+
+typedef struct {
+    uint64_t Ticks;                 /* 기록 틱 */
+    uint64_t Skipped;               /* 대기 중인 창을 덮어쓰게 되어 기록하지 않은 틱 */
+    uint64_t Events;                /* 동결 사건 (대기열에 넣음, 나중에 밀려난 사건 포함) */
+    uint64_t Flushed;               /* 파일 기록 완료 */
+    uint64_t Dropped;               /* 대기열이 차서 버리거나 Brake 사건에 밀려난 사건 */
+    uint64_t Write_Errors;
+} AdasRecorderStats_t;
+
+/* 대기 사건 : 창 [First_Tick, Last_Tick] */
+typedef struct {
+    AdasRecFileHeader_t Header;     /* Count 는 기록 시 채움 (빠진 틱 제외) */
+    int64_t             First_Tick;
+    int64_t             Last_Tick;
+} AdasRecEvent_t;
+
+typedef struct {
+    AdasRecorderConfig_t Cfg;
+    AdasRecTick_t       *Ring;                  /* Size 칸 */
+    int32_t              Size;                  /* 2 × Capacity */
+
+    /* 기록 상태 (기록 스레드 전용) */
+    int64_t  Tick;                              /* 다음 틱 번호 */
+    int64_t  Guard_Tick;                        /* 이 틱부터는 대기열 확인 후 기록 (보수적 캐시) */
+    int32_t  Post_Left;                         /* 사건 없음 -1 */
+    uint32_t Event_Trigger;
+    int64_t  Event_Tick;
+    uint32_t Manual;                            /* 다음 틱에 걸 수동 트리거 */
+    int32_t  Have_Prev;
+    int32_t  Prev_Acc_Mode;
+    int32_t  Prev_Aeb_Mode;
+    int32_t  Prev_Lfa_Mode;
+
+    /* 대기열 (Lock 보호) */
+    pthread_mutex_t     Lock;
+    pthread_cond_t      Wake;
+    pthread_cond_t      Idle;
+    pthread_t           Thread;
+    int32_t             Thread_Started;
+    int32_t             Stop;
+    int32_t             Writing;                /* Queue[0] 기록 중 */
+    int32_t             Queue_Count;
+    AdasRecEvent_t      Queue[ADAS_REC_MAX_PENDING];
+    AdasRecorderStats_t Stats;
+} AdasRecorder_t;
+
+/**
+ * @brief 링 할당 + (Async) 기록 스레드 시작
+ * @return 0 on success, -1 : 인자 오류 / 할당 / 스레드 생성 실패
+ */
+int adas_recorder_init(AdasRecorder_t *pRec, const AdasRecorderConfig_t *pCfg);
+
+/** @brief 대기 중인 기록을 마친 뒤 스레드 종료 + 해제 (사후 구간 진행 중인 사건은 버림) */
+void adas_recorder_destroy(AdasRecorder_t *pRec);
+
+/**
+ * @brief 1 틱 기록 + 트리거 검사 (adas_pipeline_step 직후 호출)
+ * @param stepNs : 틱 처리 시간 [ns] (0 : 마감 검사 생략)
+ * @return 1 : 이번 틱에 사건을 얼려 대기열에 넣음, 0 : 기록만 (또는 사건 버림), -1 on invalid argument
+ */
+int adas_recorder_record(AdasRecorder_t *pRec, const AdasPipelineInput_t *pIn,
+                         const AdasPipelineOutput_t *pOut, uint64_t stepNs);
+
+/** @brief 수동 트리거 (다음 adas_recorder_record 에서 처리, Trigger_Mask 무관) */
+void adas_recorder_trigger(AdasRecorder_t *pRec);
+
+/** @brief 대기열의 파일 기록이 모두 끝날 때까지 대기 */
+void adas_recorder_flush_wait(AdasRecorder_t *pRec);
+
+/** @return 0 on success, -1 on invalid argument */
+int adas_recorder_stats(AdasRecorder_t *pRec, AdasRecorderStats_t *pStats);
+
+/**
+ * @brief 기록 파일 읽기
+ * @param[out] pRecs : NULL 이면 머리만 (maxCount 무시)
+ * @return 읽은 레코드 수, -1 : 파일 / 형식 오류 또는 용량 부족
+ */
+int adas_recorder_load(const char *path, AdasRecFileHeader_t *pHdr, AdasRecTick_t *pRecs, int maxCount);
+
+/**
+ * @brief 레코드 → 파이프라인 입력 복원 (재생용, 비트 동일)
+ * @return 0 on success, -1 on invalid argument
+ */
+int adas_rec_tick_to_input(const AdasRecTick_t *pTick, AdasPipelineInput_t *pIn);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADAS_RECORDER_H */
@@ -0,0 +1,381 @@
+/*********************************************************************
+ * adas_recorder_test.cpp  ―  사전 트리거 비행 기록기 (연속 링 + 사건 대기열 + 비동기 파일 기록)
+ * DUT : adas_recorder.c
+ *********************************************************************/
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "adas_recorder.h"
+#include "aeb.h"
+#include "golden_trace.h"
+
+namespace {
+
+class AdasRecorderTest : public ::testing::Test {
+protected:
+    std::unique_ptr<AdasRecorder_t>    rec{ new AdasRecorder_t() };
+    std::string                        dir;
+    std::vector<AdasPipelineInput_t>   ins;
+    std::vector<AdasPipelineOutput_t>  outs;
+
+    void SetUp() override
+    {
+        char tmpl[] = "/tmp/adas_rec_XXXXXX";
+        ASSERT_NE(mkdtemp(tmpl), nullptr);
+        dir = tmpl;
+
+        GoldenScene_t        scene;
+        AdasPipelineState_t  st;
+        AdasPipelineInput_t  in;
+        AdasPipelineOutput_t out;
+        golden_scene_init(&scene, 50u, 0);
+        adas_pipeline_init(&st);
+        for (int t = 0; t < 300; t++) {
+            golden_scene_next(&scene, &in);
+            adas_pipeline_step(&st, &in, &out);
+            out.Aeb_Mode = AEB_MODE_NORMAL;                 /* 트리거는 시험에서 직접 건다 */
+            out.Acc_Mode = out.Lfa_Mode = 0;
+            ins.push_back(in);
+            outs.push_back(out);
+        }
+    }
+    void TearDown() override
+    {
+        adas_recorder_destroy(rec.get());
+        for (unsigned long long s = 0; s < 16; s++) std::remove(path(s).c_str());
+        rmdir(dir.c_str());
+    }
+
+    std::string path(unsigned long long seq) const
+    {
+        char buf[512];
+        std::snprintf(buf, sizeof(buf), ADAS_REC_FILE_FORMAT, dir.c_str(), seq);
+        return buf;
+    }
+    AdasRecorderConfig_t config(int cap, int post, uint32_t mask, int async) const
+    {
+        AdasRecorderConfig_t c = { cap, post, mask, 0u, dir.c_str(), async };
+        return c;
+    }
+    int feed(int begin, int end, int brakeAt = -1)
+    {
+        int frozen = 0;
+        for (int t = begin; t < end; t++) {
+            AdasPipelineOutput_t o = outs[(size_t)t];
+            if (t == brakeAt) o.Aeb_Mode = AEB_MODE_BRAKE;
+            int rc = adas_recorder_record(rec.get(), &ins[(size_t)t], &o, 1000u);
+            EXPECT_GE(rc, 0);
+            frozen += rc;
+        }
+        return frozen;
+    }
+};
+
+/* TC_REC_EQ_01 : AEB Brake 진입 → 사전 + 사후 창 파일, 레코드 → 입력 비트 동일 복원, 출력 보존 */
+TEST_F(AdasRecorderTest, TC_REC_EQ_01)
+{
+    AdasRecorderConfig_t cfg = config(50, 10, ADAS_REC_TRIG_AEB_BRAKE, 0);
+    ASSERT_EQ(adas_recorder_init(rec.get(), &cfg), 0);
+
+    EXPECT_EQ(feed(0, 131, 120), 1);                        /* 120 + 10 틱에서 동결 */
+    EXPECT_EQ(rec->Queue_Count, 0);                         /* 호출 스레드에서 바로 기록 */
+
+    std::vector<AdasRecTick_t> r(50);
+    AdasRecFileHeader_t hdr;
+    ASSERT_EQ(adas_recorder_load(path(0).c_str(), &hdr, r.data(), (int)r.size()), 50);
+    EXPECT_EQ(hdr.Trigger, ADAS_REC_TRIG_AEB_BRAKE);
+    EXPECT_EQ(hdr.Trigger_Tick, 120);
+    EXPECT_EQ(hdr.Sequence, 0u);
+
+    for (int i = 0; i < 50; i++) {
+        int t = 81 + i;
+        ASSERT_EQ(r[(size_t)i].Tick, t);
+        EXPECT_EQ(r[(size_t)i].Trigger, t == 120 ? ADAS_REC_TRIG_AEB_BRAKE : 0u);
+        EXPECT_EQ(r[(size_t)i].Step_Ns, 1000u);
+
+        AdasPipelineInput_t in;
+        ASSERT_EQ(adas_rec_tick_to_input(&r[(size_t)i], &in), 0);
+        EXPECT_EQ(std::memcmp(&in, &ins[(size_t)t], sizeof(in)), 0) << "tick " << t;
+        EXPECT_EQ(std::memcmp(&r[(size_t)i].Out.Ego, &outs[(size_t)t].Ego, sizeof(EgoData_t)), 0);
+        EXPECT_EQ(r[(size_t)i].Out.Aeb_Mode, t == 120 ? (int32_t)AEB_MODE_BRAKE : (int32_t)AEB_MODE_NORMAL);
+    }
+
+    /* Brake 진입 → 사건 시작, Brake 유지 (진입 아님) → 트리거 없음 */
+    AdasPipelineOutput_t o = outs[131];
+    o.Aeb_Mode = AEB_MODE_BRAKE;
+    EXPECT_EQ(adas_recorder_record(rec.get(), &ins[131], &o, 0u), 0);
+    EXPECT_EQ(rec->Post_Left, 9);
+    EXPECT_EQ(adas_recorder_record(rec.get(), &ins[132], &o, 0u), 0);
+    EXPECT_EQ(rec->Post_Left, 8);
+    EXPECT_EQ(rec->Ring[132 % rec->Size].Trigger, 0u);
+    EXPECT_EQ(rec->Event_Tick, 131);
+
+    AdasRecorderStats_t s;
+    ASSERT_EQ(adas_recorder_stats(rec.get(), &s), 0);
+    EXPECT_EQ(s.Ticks, 133u);
+    EXPECT_EQ(s.Events, 1u);
+    EXPECT_EQ(s.Flushed, 1u);
+    EXPECT_EQ(s.Dropped, 0u);
+}
+
+/* TC_REC_EQ_02 : 비동기 기록 스레드 + 모드 전이 / 마감 초과 / 수동 트리거 */
+TEST_F(AdasRecorderTest, TC_REC_EQ_02)
+{
+    AdasRecorderConfig_t cfg = config(40, 5, ADAS_REC_TRIG_MODE_FLIP | ADAS_REC_TRIG_DEADLINE, 1);
+    cfg.Deadline_Ns = 5000u;
+    ASSERT_EQ(adas_recorder_init(rec.get(), &cfg), 0);
+
+    int frozen = 0;
+    for (int t = 0; t < 300; t++) {
+        AdasPipelineOutput_t o = outs[(size_t)t];
+        uint64_t ns = 1000u;
+        if (t == 60)  o.Lfa_Mode = 1;                       /* 60, 61 (복귀) 전이 → 한 사건 */
+        if (t == 150) ns = 9000u;                           /* 마감 초과 */
+        if (t == 240) adas_recorder_trigger(rec.get());
+        int rc = adas_recorder_record(rec.get(), &ins[(size_t)t], &o, ns);
+        ASSERT_GE(rc, 0);
+        frozen += rc;
+        if (rc) adas_recorder_flush_wait(rec.get());        /* 시험 루프는 틱 간격이 없음 → 창 덮어쓰기(Skipped) 전 대기 */
+    }
+    adas_recorder_flush_wait(rec.get());
+
+    AdasRecorderStats_t s;
+    ASSERT_EQ(adas_recorder_stats(rec.get(), &s), 0);
+    EXPECT_EQ((uint64_t)frozen, s.Events);
+    EXPECT_EQ(s.Flushed, s.Events);
+    EXPECT_EQ(s.Write_Errors, 0u);
+    EXPECT_EQ(s.Events, 3u);
+    EXPECT_EQ(s.Dropped, 0u);
+    EXPECT_EQ(s.Skipped, 0u);
+
+    const uint32_t expect[3] = { ADAS_REC_TRIG_MODE_FLIP, ADAS_REC_TRIG_DEADLINE, ADAS_REC_TRIG_MANUAL };
+    const int64_t  tick[3]   = { 60, 150, 240 };
+    for (unsigned k = 0; k < 3; k++) {
+        AdasRecFileHeader_t hdr;
+        std::vector<AdasRecTick_t> r(40);
+        int n = adas_recorder_load(path(k).c_str(), &hdr, r.data(), (int)r.size());
+        ASSERT_EQ(n, 40) << k;
+        EXPECT_EQ(hdr.Trigger, expect[k]);
+        EXPECT_EQ(hdr.Trigger_Tick, tick[k]);
+        EXPECT_EQ(r[(size_t)n - 1].Tick, tick[k] + 5);
+        for (int i = 1; i < n; i++) {
+            EXPECT_EQ(r[(size_t)i].Tick, r[(size_t)i - 1].Tick + 1);
+        }
+    }
+}
+
+/* TC_REC_EQ_03 : AEB Normal → Alert(모드 전이 사건) → Brake
+ *   - 전이 사건이 얼린 뒤의 Brake 도 버리지 않고 자기 사전 창 전체를 가짐
+ *   - 전이 사건의 사후 창 안에서 걸린 Brake 는 Brake 틱 기준으로 사건을 다시 잡음 */
+TEST_F(AdasRecorderTest, TC_REC_EQ_03)
+{
+    AdasRecorderConfig_t cfg = config(50, 5, ADAS_REC_TRIG_AEB_BRAKE | ADAS_REC_TRIG_MODE_FLIP, 1);
+    ASSERT_EQ(adas_recorder_init(rec.get(), &cfg), 0);
+
+    int frozen = 0;
+    for (int t = 0; t < 300; t++) {
+        AdasPipelineOutput_t o = outs[(size_t)t];
+        if ((t >= 100 && t < 110) || (t >= 200 && t < 202)) o.Aeb_Mode = AEB_MODE_ALERT;
+        if ((t >= 110 && t < 130) || (t >= 202 && t < 230)) o.Aeb_Mode = AEB_MODE_BRAKE;
+        int rc = adas_recorder_record(rec.get(), &ins[(size_t)t], &o, 1000u);
+        ASSERT_GE(rc, 0);
+        frozen += rc;
+        if (rc && t != 105) adas_recorder_flush_wait(rec.get());        /* 115 Brake 는 105 전이 사건 기록 중에 얼림 */
+    }
+    adas_recorder_flush_wait(rec.get());
+
+    AdasRecorderStats_t s;
+    ASSERT_EQ(adas_recorder_stats(rec.get(), &s), 0);
+    EXPECT_EQ(frozen, 5);           /* 100 Alert, 110 Brake, 130 Normal, 200 Alert + 202 Brake, 230 Normal */
+    EXPECT_EQ(s.Events, 5u);
+    EXPECT_EQ(s.Flushed, 5u);
+    EXPECT_EQ(s.Dropped, 0u);
+
+    const uint32_t expect[3] = { ADAS_REC_TRIG_MODE_FLIP,
+                                 ADAS_REC_TRIG_AEB_BRAKE | ADAS_REC_TRIG_MODE_FLIP,
+                                 ADAS_REC_TRIG_AEB_BRAKE | ADAS_REC_TRIG_MODE_FLIP };
+    const unsigned seq[3]    = { 0u, 1u, 3u };
+    const int64_t  tick[3]   = { 100, 110, 202 };
+    for (unsigned k = 0; k < 3; k++) {
+        AdasRecFileHeader_t hdr;
+        std::vector<AdasRecTick_t> r(50);
+        ASSERT_EQ(adas_recorder_load(path(seq[k]).c_str(), &hdr, r.data(), (int)r.size()), 50) << k;
+        EXPECT_EQ(hdr.Trigger, expect[k]) << k;
+        EXPECT_EQ(hdr.Trigger_Tick, tick[k]) << k;
+        EXPECT_EQ(r[0].Tick, tick[k] + 5 - 49) << k;        /* Alert 이전까지 사전 창 전체 */
+        EXPECT_EQ(r[49].Tick, tick[k] + 5) << k;
+        for (int i = 1; i < 50; i++) {
+            EXPECT_EQ(r[(size_t)i].Tick, r[(size_t)i - 1].Tick + 1);
+        }
+    }
+}
+
+/* TC_REC_BV_01 : 사후 0 틱, 창 안 트리거 병합, 링이 차기 전 사건, 연달아 걸린 사건, 큰 / 음수 객체 ID */
+TEST_F(AdasRecorderTest, TC_REC_BV_01)
+{
+    AdasRecorderConfig_t cfg = config(30, 0, ADAS_REC_TRIG_AEB_BRAKE | ADAS_REC_TRIG_MODE_FLIP, 0);
+    ASSERT_EQ(adas_recorder_init(rec.get(), &cfg), 0);
+
+    /* 링이 차기 전 (12 틱), 사후 0 → 같은 틱 동결 */
+    EXPECT_EQ(feed(0, 12, 11), 1);
+    AdasRecFileHeader_t hdr;
+    ASSERT_EQ(adas_recorder_load(path(0).c_str(), &hdr, nullptr, 0), 12);
+    EXPECT_EQ(hdr.Trigger, ADAS_REC_TRIG_AEB_BRAKE | ADAS_REC_TRIG_MODE_FLIP);
+
+    /* 바로 다음 틱 사건 (Brake → Normal 복귀도 전이) : 앞 사건 틱까지 사전 창에 포함 */
+    EXPECT_EQ(feed(12, 15), 1);
+    ASSERT_EQ(adas_recorder_load(path(1).c_str(), &hdr, nullptr, 0), 13);
+    EXPECT_EQ(hdr.Trigger_Tick, 12);
+
+    /* 링 순환 후 창 = 최근 30 틱 */
+    EXPECT_EQ(feed(15, 100, 99), 1);
+    std::vector<AdasRecTick_t> r(30);
+    ASSERT_EQ(adas_recorder_load(path(2).c_str(), &hdr, r.data(), 30), 30);
+    EXPECT_EQ(r[0].Tick, 70);
+    EXPECT_EQ(r[29].Tick, 99);
+    EXPECT_EQ(adas_recorder_load(path(2).c_str(), &hdr, r.data(), 29), -1);   /* 용량 부족 */
+    adas_recorder_destroy(rec.get());
+
+    /* 사후 구간 안에서 다시 걸린 트리거는 병합 (창 연장 없음) */
+    cfg = config(30, 4, ADAS_REC_TRIG_AEB_BRAKE | ADAS_REC_TRIG_MODE_FLIP, 0);
+    ASSERT_EQ(adas_recorder_init(rec.get(), &cfg), 0);
+    EXPECT_EQ(feed(0, 31, 26), 1);                          /* 26 Brake, 27 복귀(전이), 30 에서 동결 */
+    ASSERT_EQ(adas_recorder_load(path(0).c_str(), &hdr, r.data(), 30), 30);
+    EXPECT_EQ(hdr.Trigger, ADAS_REC_TRIG_AEB_BRAKE | ADAS_REC_TRIG_MODE_FLIP);
+    EXPECT_EQ(hdr.Trigger_Tick, 26);
+    EXPECT_EQ(r[0].Tick, 1);
+    EXPECT_EQ(r[29].Tick, 30);
+    EXPECT_EQ(r[26].Trigger, ADAS_REC_TRIG_MODE_FLIP);
+
+    /* 카메라 단독 ID(+100000), 계속 늘어나는 ID, 음수 ID / 범위 밖 열거값도 비트 동일 복원 */
+    AdasPipelineInput_t in = ins[40];
+    ASSERT_GE(in.Obj_Count, 3);
+    in.Obj[0].Object_ID   = 100000 + 7;
+    in.Obj[1].Object_ID   = 0x7FFFFFFF;
+    in.Obj[2].Object_ID   = -5;
+    in.Obj[2].Object_Type = (ObjectType_e)300;
+    ASSERT_EQ(adas_recorder_record(rec.get(), &in, &outs[40], 0u), 0);
+    const AdasRecTick_t *t = &rec->Ring[(rec->Tick - 1) % rec->Size];
+    AdasPipelineInput_t back;
+    ASSERT_EQ(adas_rec_tick_to_input(t, &back), 0);
+    EXPECT_EQ(std::memcmp(&back, &in, sizeof(in)), 0);
+}
+
+/* TC_REC_BV_02 : 기록 스레드 정체 (FIFO 파일이라 읽을 때까지 fopen 대기)
+ *   - 대기열이 차면 새 사건 버림, Brake 사건은 가장 최근의 Brake 없는 사건을 밀어냄
+ *   - 대기 중인 창을 덮어쓸 틱은 기록 안 함 (Skipped) → 뒤 사건 파일에서 빠짐 */
+TEST_F(AdasRecorderTest, TC_REC_BV_02)
+{
+    AdasRecorderConfig_t cfg = config(20, 0, ADAS_REC_TRIG_AEB_BRAKE, 1);
+    ASSERT_EQ(mkfifo(path(0).c_str(), 0600), 0);
+    ASSERT_EQ(adas_recorder_init(rec.get(), &cfg), 0);
+
+    EXPECT_EQ(feed(0, 21), 0);
+    adas_recorder_trigger(rec.get());
+    EXPECT_EQ(feed(21, 22), 1);                             /* 사건 0 : 창 2 .. 21, 기록 스레드 정체 */
+    for (int writing = 0; !writing; usleep(1000)) {
+        pthread_mutex_lock(&rec->Lock);
+        writing = rec->Writing;
+        pthread_mutex_unlock(&rec->Lock);
+    }
+    for (int t = 22; t < 25; t++) {                         /* 사건 1, 2, 3 → 대기열 가득 */
+        adas_recorder_trigger(rec.get());
+        EXPECT_EQ(feed(t, t + 1), 1);
+    }
+    adas_recorder_trigger(rec.get());
+    EXPECT_EQ(feed(25, 26), 0);                             /* 버림 */
+    EXPECT_EQ(feed(26, 27, 26), 1);                         /* Brake : 사건 3 을 밀어내고 사건 4 */
+    EXPECT_EQ(rec->Queue_Count, ADAS_REC_MAX_PENDING);
+    EXPECT_EQ(feed(27, 51), 0);                             /* 42 .. 50 : 사건 0 창(2 ..)을 덮어씀 → 안 함 */
+
+    std::FILE *f = std::fopen(path(0).c_str(), "rb");       /* 정체 해제 */
+    ASSERT_NE(f, nullptr);
+    AdasRecFileHeader_t hdr;
+    std::vector<AdasRecTick_t> r(20);
+    EXPECT_EQ(std::fread(&hdr, sizeof(hdr), 1, f), 1u);
+    EXPECT_EQ(std::fread(r.data(), sizeof(r[0]), r.size(), f), r.size());
+    std::fclose(f);
+    adas_recorder_flush_wait(rec.get());
+    EXPECT_EQ(hdr.Count, 20u);
+    EXPECT_EQ(r[0].Tick, 2);
+    EXPECT_EQ(r[19].Tick, 21);
+
+    AdasRecorderStats_t s;
+    ASSERT_EQ(adas_recorder_stats(rec.get(), &s), 0);
+    EXPECT_EQ(s.Events, 5u);
+    EXPECT_EQ(s.Dropped, 2u);
+    EXPECT_EQ(s.Flushed, 4u);
+    EXPECT_EQ(s.Skipped, 9u);
+    EXPECT_EQ(s.Ticks, 51u - 9u);
+
+    EXPECT_EQ(adas_recorder_load(path(3).c_str(), &hdr, nullptr, 0), -1);
+    ASSERT_EQ(adas_recorder_load(path(4).c_str(), &hdr, r.data(), 20), 20);
+    EXPECT_EQ(hdr.Trigger, ADAS_REC_TRIG_AEB_BRAKE);
+    EXPECT_EQ(r[0].Tick, 7);
+
+    /* 정체 해제 후 기록 재개, 빠진 틱은 파일에서 제외 */
+    adas_recorder_trigger(rec.get());
+    EXPECT_EQ(feed(51, 56), 1);
+    adas_recorder_flush_wait(rec.get());
+    ASSERT_EQ(adas_recorder_load(path(5).c_str(), &hdr, r.data(), 20), 11);   /* 창 32 .. 51 - 빠진 9 */
+    EXPECT_EQ(r[9].Tick, 41);
+    EXPECT_EQ(r[10].Tick, 51);
+}
+
+/* TC_REC_RA_01 : 인자 오류, 기록 실패 디렉터리, 형식 오류 파일 */
+TEST_F(AdasRecorderTest, TC_REC_RA_01)
+{
+    AdasRecorderConfig_t cfg = config(10, 2, ADAS_REC_TRIG_AEB_BRAKE, 0);
+    AdasRecorderConfig_t bad = cfg;
+    EXPECT_EQ(adas_recorder_init(nullptr, &cfg), -1);
+    EXPECT_EQ(adas_recorder_init(rec.get(), nullptr), -1);
+    bad.Capacity = 0;          EXPECT_EQ(adas_recorder_init(rec.get(), &bad), -1);
+    bad = cfg; bad.Post_Ticks = 10;  EXPECT_EQ(adas_recorder_init(rec.get(), &bad), -1);
+    bad = cfg; bad.Post_Ticks = -1;  EXPECT_EQ(adas_recorder_init(rec.get(), &bad), -1);
+    bad = cfg; bad.Output_Dir = nullptr; EXPECT_EQ(adas_recorder_init(rec.get(), &bad), -1);
+
+    EXPECT_EQ(adas_recorder_record(rec.get(), &ins[0], &outs[0], 0u), -1);   /* 초기화 안 됨 */
+
+    std::string missing = dir + "/none";
+    bad = cfg; bad.Output_Dir = missing.c_str();
+    ASSERT_EQ(adas_recorder_init(rec.get(), &bad), 0);
+    AdasPipelineInput_t in = ins[0];
+    in.Obj_Count = ADAS_PIPELINE_MAX_OBJ + 1;
+    EXPECT_EQ(adas_recorder_record(rec.get(), &in, &outs[0], 0u), -1);
+    EXPECT_EQ(adas_recorder_record(rec.get(), nullptr, &outs[0], 0u), -1);
+    EXPECT_EQ(adas_recorder_record(rec.get(), &ins[0], nullptr, 0u), -1);
+    EXPECT_EQ(feed(0, 3, 0), 1);                            /* 디렉터리 없음 → 기록 오류 */
+    AdasRecorderStats_t s;
+    ASSERT_EQ(adas_recorder_stats(rec.get(), &s), 0);
+    EXPECT_EQ(s.Write_Errors, 1u);
+    EXPECT_EQ(s.Flushed, 0u);
+    EXPECT_EQ(adas_recorder_stats(rec.get(), nullptr), -1);
+
+    AdasRecFileHeader_t hdr;
+    EXPECT_EQ(adas_recorder_load(missing.c_str(), &hdr, nullptr, 0), -1);
+    std::FILE *f = std::fopen(path(9).c_str(), "wb");
+    ASSERT_NE(f, nullptr);
+    std::fputs("not a recording", f);
+    std::fclose(f);
+    EXPECT_EQ(adas_recorder_load(path(9).c_str(), &hdr, nullptr, 0), -1);
+    EXPECT_EQ(adas_recorder_load(path(9).c_str(), nullptr, nullptr, 0), -1);
+
+    AdasRecTick_t t = {};
+    t.Obj_Count = -1;
+    EXPECT_EQ(adas_rec_tick_to_input(&t, &in), -1);
+    EXPECT_EQ(adas_rec_tick_to_input(nullptr, &in), -1);
+
+    adas_recorder_trigger(nullptr);
+    adas_recorder_flush_wait(nullptr);
+    adas_recorder_destroy(nullptr);
+}
+
+}  // namespace
@@ -0,0 +1,126 @@
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L     /* pthread, sched_yield */
+#endif
+
+#include <pthread.h>
+#include <sched.h>
+
+#include "adas_replay.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define CPU_RELAX()         _mm_pause()
+#else
+#define CPU_RELAX()         ((void)0)
+#endif
+
+#define LOAD_ACQ(p)         __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define STORE_REL(p, v)     __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+
+#define SLOT_MASK           (ADAS_REPLAY_SLOTS - 1)
+
+#if (ADAS_REPLAY_SLOTS & SLOT_MASK) != 0
+#error "ADAS_REPLAY_SLOTS must be a power of two"
+#endif
+
+/*─────────────────────────────
+  대기 : *pCursor >= need 이면 1,
+         끝(useEnd 이고 f >= End) / 중단이면 0
+─────────────────────────────*/
+static int wait_cursor(AdasReplay_t *r, const int64_t *pCursor, int64_t need, int useEnd, int64_t f)
+{
+    int spins = 0;
+    for (;;) {
+        if (LOAD_ACQ(pCursor) >= need) return 1;
+        if (useEnd) {
+            int64_t end = LOAD_ACQ(&r->End);
+            if (end >= 0 && f >= end) return 0;
+        }
+        if (LOAD_ACQ(&r->Abort)) return 0;
+        if (++spins < ADAS_REPLAY_SPIN) {
+            CPU_RELAX();
+        } else {
+            sched_yield();
+            spins = 0;
+        }
+    }
+}
+
+/* 단계 0 : 소스 → Ego / Lane (단계 2 가 비운 칸만 채움) */
+static void *stage0_main(void *pArg)
+{
+    AdasReplay_t *r = (AdasReplay_t *)pArg;
+    int64_t f = 0;
+
+    for (;; f++) {
+        if (!wait_cursor(r, &r->Cursor[2].Value, f - ADAS_REPLAY_SLOTS + 1, 0, f)) break;
+
+        AdasReplayFrame_t *s = &r->Slot[f & SLOT_MASK];
+        int rc = r->Source(r->Source_Ctx, &s->In);
+        if (rc != 1) {
+            if (rc < 0) STORE_REL(&r->Error, -1);
+            break;
+        }
+        if (adas_pipeline_stage_ego_lane(r->State, &s->In, &s->Out) != 0) {
+            STORE_REL(&r->Error, -1);
+            break;
+        }
+        STORE_REL(&r->Cursor[0].Value, f + 1);
+    }
+    STORE_REL(&r->End, f);                          /* 마지막 커서 기록 후 */
+    return NULL;
+}
+
+/* 단계 1 : Target Selection */
+static void *stage1_main(void *pArg)
+{
+    AdasReplay_t *r = (AdasReplay_t *)pArg;
+
+    for (int64_t f = 0; wait_cursor(r, &r->Cursor[0].Value, f + 1, 1, f); f++) {
+        AdasReplayFrame_t *s = &r->Slot[f & SLOT_MASK];
+        adas_pipeline_stage_target(r->State, &s->In, &s->Out, &s->Targets);   /* 입력은 단계 0 에서 검증됨 */
+        STORE_REL(&r->Cursor[1].Value, f + 1);
+    }
+    return NULL;
+}
+
+int adas_replay_run(AdasReplay_t *pRep, AdasPipelineState_t *pState,
+                    AdasReplaySource_t source, void *pSourceCtx,
+                    AdasReplaySink_t sink, void *pSinkCtx,
+                    int64_t *pFrames)
+{
+    if (pFrames) *pFrames = 0;
+    if (!pRep || !pState || !source) return -1;
+
+    for (int k = 0; k < ADAS_REPLAY_STAGES; k++) pRep->Cursor[k].Value = 0;
+    pRep->End        = -1;
+    pRep->Error      = 0;
+    pRep->Abort      = 0;
+    pRep->State      = pState;
+    pRep->Source     = source;
+    pRep->Source_Ctx = pSourceCtx;
+    pRep->Sink       = sink;
+    pRep->Sink_Ctx   = pSinkCtx;
+
+    pthread_t th0, th1;
+    if (pthread_create(&th0, NULL, stage0_main, pRep) != 0) return -1;
+    if (pthread_create(&th1, NULL, stage1_main, pRep) != 0) {
+        STORE_REL(&pRep->Abort, 1);
+        pthread_join(th0, NULL);
+        return -1;
+    }
+
+    /* 단계 2 (호출 스레드) : 제어 → 싱크 → 칸 반환 */
+    int64_t f = 0;
+    for (; wait_cursor(pRep, &pRep->Cursor[1].Value, f + 1, 1, f); f++) {
+        AdasReplayFrame_t *s = &pRep->Slot[f & SLOT_MASK];
+        adas_pipeline_stage_control(pState, &s->In, &s->Out, &s->Targets);
+        if (sink) sink(pSinkCtx, f, &s->In, &s->Out);
+        STORE_REL(&pRep->Cursor[2].Value, f + 1);
+    }
+
+    pthread_join(th1, NULL);
+    pthread_join(th0, NULL);
+    if (pFrames) *pFrames = f;
+    return LOAD_ACQ(&pRep->Error);
+}
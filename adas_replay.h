@@ -0,0 +1,85 @@
+/****************************************************************************
+ * adas_replay.h
+ *
+ * - 프레임 간 파이프라인 재생 : 단계마다 전용 스레드, 프레임 N+1 의 Ego 추정과
+ *   프레임 N 의 Target Selection, 프레임 N-1 의 제어를 동시에 실행
+ *     . 단계 0 (스레드) : 소스 콜백 → adas_pipeline_stage_ego_lane
+ *     . 단계 1 (스레드) : adas_pipeline_stage_target
+ *     . 단계 2 (호출 스레드) : adas_pipeline_stage_control → 싱크 콜백
+ * - 단계 사이 큐 : ADAS_REPLAY_SLOTS 칸 고정 링 1 개를 단계별 진행 커서(원자)로 공유
+ *   (단계 k 는 단계 k-1 커서가 지난 칸만 처리, 단계 0 은 단계 2 가 비운 칸만 채움)
+ *   → 락 / 동적 할당 / 프레임 복사 없음, 대기는 spin 후 sched_yield
+ * - 각 단계가 프레임을 순서대로 처리하고 단계별 상태(Kf / Prev_Steer)가 분리되어
+ *   출력은 adas_pipeline_step 직렬 실행과 비트 동일, 싱크 호출 순서 = 프레임 순서
+ * - 처리량 상한 = 가장 느린 단계 (직렬 실행은 단계 합)
+ * - AdasReplay_t 는 크다 (~ADAS_REPLAY_SLOTS × 2 KB) → static 또는 힙에 둘 것
+ ****************************************************************************/
+#ifndef ADAS_REPLAY_H
+#define ADAS_REPLAY_H
+
+#include <stdint.h>
+#include "adas_pipeline.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ADAS_REPLAY_SLOTS       16      /* 2 의 거듭제곱 */
+#define ADAS_REPLAY_STAGES      3
+#define ADAS_REPLAY_SPIN        256     /* sched_yield 전 spin 횟수 */
+
+/**
+ * @brief 다음 프레임 입력
+ * @return 1 = 프레임 있음, 0 = 끝, -1 = 오류 (재생 중단)
+ */
+typedef int  (*AdasReplaySource_t)(void *pCtx, AdasPipelineInput_t *pIn);
+
+/** @brief 프레임 결과 (프레임 순서대로 호출, 포인터는 호출 중에만 유효) */
+typedef void (*AdasReplaySink_t)(void *pCtx, int64_t frame,
+                                 const AdasPipelineInput_t  *pIn,
+                                 const AdasPipelineOutput_t *pOut);
+
+typedef struct {
+    AdasPipelineInput_t   In;
+    AdasPipelineOutput_t  Out;
+    AdasPipelineTargets_t Targets;
+} AdasReplayFrame_t;
+
+/* 단계 진행 커서 : 캐시 라인 분리 */
+typedef struct {
+    int64_t Value;                      /* 처리 완료 프레임 수 (원자) */
+    char    Pad[56];
+} AdasReplayCursor_t;
+
+typedef struct {
+    AdasReplayCursor_t   Cursor[ADAS_REPLAY_STAGES];
+    int64_t              End;           /* 전체 프레임 수, 미정 -1 (원자) */
+    int32_t              Error;         /* 0 / -1 (원자) */
+    int32_t              Abort;         /* 단계 스레드 중단 요청 (원자) */
+
+    AdasPipelineState_t *State;
+    AdasReplaySource_t   Source;
+    void                *Source_Ctx;
+    AdasReplaySink_t     Sink;
+    void                *Sink_Ctx;
+
+    AdasReplayFrame_t    Slot[ADAS_REPLAY_SLOTS];
+} AdasReplay_t;
+
+/**
+ * @brief 소스가 끝날 때까지 파이프라인 재생 (pState 는 adas_pipeline_init 된 상태에서 이어감)
+ * @param[in] sink      : NULL 허용
+ * @param[out] pFrames  : 처리한 프레임 수 (NULL 허용)
+ * @return 0 on success, -1 on invalid argument / 소스 오류 / 잘못된 입력 프레임 /
+ *         스레드 생성 실패 (오류 전까지의 프레임은 싱크에 전달됨)
+ */
+int adas_replay_run(AdasReplay_t *pRep, AdasPipelineState_t *pState,
+                    AdasReplaySource_t source, void *pSourceCtx,
+                    AdasReplaySink_t sink, void *pSinkCtx,
+                    int64_t *pFrames);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADAS_REPLAY_H */
@@ -0,0 +1,173 @@
+/*********************************************************************
+ * adas_replay_test.cpp  ―  프레임 간 파이프라인 재생 (직렬 실행과 비트 동일)
+ * DUT : adas_replay.c, adas_pipeline.c (단계 분할 함수)
+ *********************************************************************/
+#include <gtest/gtest.h>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "adas_replay.h"
+#include "golden_trace.h"
+
+namespace {
+
+/* 합성 시나리오 소스 (Limit 프레임 후 끝, Fail_At 에서 오류, Bad_At 에서 잘못된 객체 수) */
+struct SceneSource {
+    GoldenScene_t scene;
+    int64_t       next    = 0;
+    int64_t       limit   = 0;
+    int64_t       fail_at = -1;
+    int64_t       bad_at  = -1;
+};
+
+int scene_source(void *pCtx, AdasPipelineInput_t *pIn)
+{
+    SceneSource *s = static_cast<SceneSource *>(pCtx);
+    if (s->next == s->fail_at) return -1;
+    if (s->next >= s->limit) return 0;
+    golden_scene_next(&s->scene, pIn);
+    if (s->next == s->bad_at) pIn->Obj_Count = ADAS_PIPELINE_MAX_OBJ + 1;
+    s->next++;
+    return 1;
+}
+
+struct Collector {
+    std::vector<AdasPipelineOutput_t> out;
+    int64_t                           order_errors = 0;
+};
+
+void collect(void *pCtx, int64_t frame, const AdasPipelineInput_t *, const AdasPipelineOutput_t *pOut)
+{
+    Collector *c = static_cast<Collector *>(pCtx);
+    if (frame != (int64_t)c->out.size()) c->order_errors++;
+    c->out.push_back(*pOut);
+}
+
+class AdasReplayTest : public ::testing::Test {
+protected:
+    std::unique_ptr<AdasReplay_t> rep{ new AdasReplay_t };
+    AdasPipelineState_t           st;
+
+    /* 같은 시나리오의 직렬 실행 결과 */
+    static std::vector<AdasPipelineOutput_t> serial(uint64_t seed, int64_t frames)
+    {
+        GoldenScene_t        scene;
+        AdasPipelineState_t  s;
+        AdasPipelineInput_t  in;
+        std::vector<AdasPipelineOutput_t> v((size_t)frames);
+        golden_scene_init(&scene, seed, 0);
+        adas_pipeline_init(&s);
+        for (int64_t t = 0; t < frames; t++) {
+            golden_scene_next(&scene, &in);
+            adas_pipeline_step(&s, &in, &v[(size_t)t]);
+        }
+        return v;
+    }
+};
+
+} /* namespace */
+
+/* 합성 시나리오 5000 프레임 : 출력 비트 일치, 싱크 호출 = 프레임 순서 */
+TEST_F(AdasReplayTest, TC_REPLAY_EQ_01)
+{
+    const int64_t kFrames = 5000;
+    auto ref = serial(11u, kFrames);
+
+    SceneSource src;
+    golden_scene_init(&src.scene, 11u, 0);
+    src.limit = kFrames;
+    Collector col;
+    int64_t   frames = -1;
+    adas_pipeline_init(&st);
+    ASSERT_EQ(adas_replay_run(rep.get(), &st, scene_source, &src, collect, &col, &frames), 0);
+    EXPECT_EQ(frames, kFrames);
+    EXPECT_EQ(col.order_errors, 0);
+    ASSERT_EQ((int64_t)col.out.size(), kFrames);
+    for (int64_t t = 0; t < kFrames; t++) {
+        ASSERT_EQ(std::memcmp(&col.out[(size_t)t], &ref[(size_t)t], sizeof(AdasPipelineOutput_t)), 0)
+            << "frame " << t;
+    }
+}
+
+/* 재생을 나눠 실행해도 상태가 이어짐 (Kf / Prev_Steer) */
+TEST_F(AdasReplayTest, TC_REPLAY_EQ_02)
+{
+    auto ref = serial(23u, 3000);
+
+    SceneSource src;
+    golden_scene_init(&src.scene, 23u, 0);
+    Collector col;
+    adas_pipeline_init(&st);
+    for (int64_t part : { 1000, 1, 1999 }) {
+        src.limit = src.next + part;
+        int64_t frames = -1;
+        ASSERT_EQ(adas_replay_run(rep.get(), &st, scene_source, &src, collect, &col, &frames), 0);
+        EXPECT_EQ(frames, part);
+        col.order_errors = 0;                           /* 프레임 번호는 실행마다 0 부터 */
+    }
+    ASSERT_EQ(col.out.size(), ref.size());
+    for (size_t t = 0; t < ref.size(); t++) {
+        ASSERT_EQ(std::memcmp(&col.out[t], &ref[t], sizeof(AdasPipelineOutput_t)), 0) << "frame " << t;
+    }
+}
+
+/* 경계 : 0 프레임, 링 크기 ±1 프레임, 싱크 없음 */
+TEST_F(AdasReplayTest, TC_REPLAY_BV_01)
+{
+    for (int64_t n : { (int64_t)0, (int64_t)1, (int64_t)ADAS_REPLAY_SLOTS - 1,
+                       (int64_t)ADAS_REPLAY_SLOTS, (int64_t)ADAS_REPLAY_SLOTS + 1 }) {
+        auto ref = serial(5u, n);
+        SceneSource src;
+        golden_scene_init(&src.scene, 5u, 0);
+        src.limit = n;
+        Collector col;
+        int64_t   frames = -1;
+        adas_pipeline_init(&st);
+        ASSERT_EQ(adas_replay_run(rep.get(), &st, scene_source, &src, collect, &col, &frames), 0);
+        EXPECT_EQ(frames, n);
+        ASSERT_EQ((int64_t)col.out.size(), n);
+        for (int64_t t = 0; t < n; t++) {
+            EXPECT_EQ(std::memcmp(&col.out[(size_t)t], &ref[(size_t)t], sizeof(AdasPipelineOutput_t)), 0);
+        }
+    }
+
+    SceneSource src;
+    golden_scene_init(&src.scene, 5u, 0);
+    src.limit = 100;
+    int64_t frames = -1;
+    adas_pipeline_init(&st);
+    EXPECT_EQ(adas_replay_run(rep.get(), &st, scene_source, &src, nullptr, nullptr, &frames), 0);
+    EXPECT_EQ(frames, 100);
+}
+
+/* 잘못된 인자 / 소스 오류 / 잘못된 입력 프레임 : 오류 전 프레임까지만 전달 */
+TEST_F(AdasReplayTest, TC_REPLAY_RA_01)
+{
+    SceneSource src;
+    int64_t     frames = -1;
+    adas_pipeline_init(&st);
+    EXPECT_EQ(adas_replay_run(nullptr, &st, scene_source, &src, nullptr, nullptr, &frames), -1);
+    EXPECT_EQ(frames, 0);
+    EXPECT_EQ(adas_replay_run(rep.get(), nullptr, scene_source, &src, nullptr, nullptr, nullptr), -1);
+    EXPECT_EQ(adas_replay_run(rep.get(), &st, nullptr, &src, nullptr, nullptr, nullptr), -1);
+
+    golden_scene_init(&src.scene, 3u, 0);
+    src.limit   = 100;
+    src.fail_at = 40;
+    Collector col;
+    EXPECT_EQ(adas_replay_run(rep.get(), &st, scene_source, &src, collect, &col, &frames), -1);
+    EXPECT_EQ(frames, 40);
+    EXPECT_EQ(col.out.size(), 40u);
+
+    SceneSource bad;
+    golden_scene_init(&bad.scene, 3u, 0);
+    bad.limit  = 100;
+    bad.bad_at = 7;
+    Collector col2;
+    adas_pipeline_init(&st);
+    EXPECT_EQ(adas_replay_run(rep.get(), &st, scene_source, &bad, collect, &col2, &frames), -1);
+    EXPECT_EQ(frames, 7);
+    EXPECT_EQ(col2.out.size(), 7u);
+    EXPECT_EQ(col2.order_errors, 0);
+}
@@ -65,10 +65,12 @@ typedef enum {
     LANE_CHANGE_DONE
 } LaneChangeStatus_e;
 
+/* 곡률(Curvature) 필드는 부호 있는 곡률 반경 [m] : + 좌회전, - 우회전, 0 = 데이터 없음(직선)
+   곡선 판정 / 전이 판정은 |반경| 으로 (LaneSelection) */
 typedef struct {
     LaneType_e  Lane_Type;
-    float       Lane_Curvature;      
-    float       Next_Lane_Curvature; 
+    float       Lane_Curvature;      /* [m] 부호 있는 반경 (+ 좌, - 우) */
+    float       Next_Lane_Curvature; /* [m] 다음 구간, 부호 규약 동일 */
     float       Lane_Offset;         
     float       Lane_Heading;        
     float       Lane_Width;          
@@ -210,6 +212,10 @@ typedef struct {
 #define MAX_ACCEL  10.0f
 #define MIN_ACCEL -10.0f
 
+/* ACC 모드 대역 (acc.c, mode_table, adas_config.hpp 공용) */
+#define ACC_SPEED_MODE_DIST  55.0f   /* 초과 → Speed [m] */
+#define ACC_DIST_MODE_DIST   45.0f   /* 미만 → Distance [m] */
+
 /* AEB 상수들 */
 #define AEB_MAX_BRAKE_DECEL  -10.0f
 #define AEB_MIN_BRAKE_DECEL  -2.0f
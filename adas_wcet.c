@@ -0,0 +1,417 @@
+#include <float.h>
+#include <math.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "adas_wcet.h"
+
+/*─────────────────────────────
+  난수 (LCG, 상위 24 bit)
+─────────────────────────────*/
+static uint32_t rnd_u24(uint32_t *r)
+{
+    *r = *r * 1664525u + 1013904223u;
+    return *r >> 8;
+}
+
+static int rnd_int(uint32_t *r, int n)
+{
+    return (n > 0) ? (int)(rnd_u24(r) % (uint32_t)n) : 0;
+}
+
+static float rnd_uni(uint32_t *r, float lo, float hi)
+{
+    return lo + (hi - lo) * (float)rnd_u24(r) / 16777216.0f;
+}
+
+/*─────────────────────────────
+  변이 대상 필드
+─────────────────────────────*/
+static const size_t k_InputFloat[] = {
+    offsetof(AdasPipelineInput_t, Time.Current_Time),
+    offsetof(AdasPipelineInput_t, Gps.GPS_Velocity_X),
+    offsetof(AdasPipelineInput_t, Gps.GPS_Velocity_Y),
+    offsetof(AdasPipelineInput_t, Gps.GPS_Timestamp),
+    offsetof(AdasPipelineInput_t, Imu.Linear_Acceleration_X),
+    offsetof(AdasPipelineInput_t, Imu.Linear_Acceleration_Y),
+    offsetof(AdasPipelineInput_t, Imu.Yaw_Rate),
+    offsetof(AdasPipelineInput_t, Lane.Lane_Curvature),
+    offsetof(AdasPipelineInput_t, Lane.Next_Lane_Curvature),
+    offsetof(AdasPipelineInput_t, Lane.Lane_Offset),
+    offsetof(AdasPipelineInput_t, Lane.Lane_Heading),
+    offsetof(AdasPipelineInput_t, Lane.Lane_Width)
+};
+#define INPUT_FLOAT_COUNT   (int)(sizeof(k_InputFloat) / sizeof(k_InputFloat[0]))
+
+static const size_t k_ObjFloat[] = {
+    offsetof(ObjectData_t, Position_X),
+    offsetof(ObjectData_t, Position_Y),
+    offsetof(ObjectData_t, Position_Z),
+    offsetof(ObjectData_t, Velocity_X),
+    offsetof(ObjectData_t, Velocity_Y),
+    offsetof(ObjectData_t, Accel_X),
+    offsetof(ObjectData_t, Accel_Y),
+    offsetof(ObjectData_t, Heading),
+    offsetof(ObjectData_t, Distance)
+};
+#define OBJ_FLOAT_COUNT     (int)(sizeof(k_ObjFloat) / sizeof(k_ObjFloat[0]))
+
+/* 분기 / 반복 경계를 건드리는 특수값 */
+static float special_value(uint32_t *r)
+{
+    switch (rnd_int(r, 12)) {
+    case 0:  return NAN;
+    case 1:  return INFINITY;
+    case 2:  return -INFINITY;
+    case 3:  return 0.0f;
+    case 4:  return -0.0f;
+    case 5:  return 1e30f;
+    case 6:  return -1e30f;
+    case 7:  return FLT_MIN * 0.5f;         /* 비정규 */
+    case 8:  return 540.0f;
+    case 9:  return -540.0f;
+    case 10: return 1e7f;
+    default: return -1e7f;
+    }
+}
+
+static float *pick_float(AdasPipelineInput_t *pIn, uint32_t *r)
+{
+    int n = INPUT_FLOAT_COUNT + OBJ_FLOAT_COUNT * pIn->Obj_Count;
+    int k = rnd_int(r, n);
+    if (k < INPUT_FLOAT_COUNT) return (float *)((char *)pIn + k_InputFloat[k]);
+
+    k -= INPUT_FLOAT_COUNT;
+    return (float *)((char *)&pIn->Obj[k / OBJ_FLOAT_COUNT] + k_ObjFloat[k % OBJ_FLOAT_COUNT]);
+}
+
+/* 차로 안 근거리 (필터 / 타겟 선정 통과) */
+static void place_in_path(ObjectData_t *o, uint32_t *r)
+{
+    o->Object_Type   = OBJTYPE_CAR;
+    o->Position_X    = rnd_uni(r, 2.0f, 60.0f);
+    o->Position_Y    = rnd_uni(r, -1.5f, 1.5f);
+    o->Position_Z    = 0.0f;
+    o->Velocity_X    = rnd_uni(r, -5.0f, 30.0f);
+    o->Velocity_Y    = rnd_uni(r, -1.0f, 1.0f);
+    o->Accel_X       = rnd_uni(r, -3.0f, 3.0f);
+    o->Accel_Y       = 0.0f;
+    o->Heading       = rnd_uni(r, -10.0f, 10.0f);
+    o->Distance      = sqrtf(o->Position_X * o->Position_X + o->Position_Y * o->Position_Y);
+    o->Object_Status = OBJSTAT_MOVING;
+    o->Object_Cell_ID = 0;
+}
+
+static void mutate_once(AdasPipelineInput_t *pIn, uint32_t *r)
+{
+    switch (rnd_int(r, 7)) {
+    case 0: {                                           /* 수치 흔들기 */
+        float *f = pick_float(pIn, r);
+        *f = isfinite(*f) ? *f * rnd_uni(r, 0.5f, 1.5f) + rnd_uni(r, -5.0f, 5.0f)
+                          : rnd_uni(r, -100.0f, 100.0f);
+        break;
+    }
+    case 1:                                             /* 특수값 */
+        *pick_float(pIn, r) = special_value(r);
+        break;
+    case 2: {                                           /* 큰 heading (정규화 반복) */
+        float mag = powf(10.0f, rnd_uni(r, 2.0f, 8.0f));
+        if (rnd_int(r, 2)) mag = -mag;
+        if (pIn->Obj_Count > 0 && rnd_int(r, 3)) pIn->Obj[rnd_int(r, pIn->Obj_Count)].Heading = mag;
+        else if (rnd_int(r, 2))                  pIn->Lane.Lane_Heading = mag;
+        else                                     pIn->Imu.Yaw_Rate = mag;
+        break;
+    }
+    case 3: {                                           /* 객체 수 변경 (늘린 슬롯은 복제 / 차로 안 배치) */
+        int old = pIn->Obj_Count;
+        int n   = rnd_int(r, ADAS_PIPELINE_MAX_OBJ + 1);
+        for (int i = old; i < n; i++) {
+            if (old > 0) pIn->Obj[i] = pIn->Obj[rnd_int(r, old)];
+            else         place_in_path(&pIn->Obj[i], r);
+            pIn->Obj[i].Object_ID = 1000 + i;
+            pIn->Obj[i].Position_X += rnd_uni(r, -2.0f, 2.0f);
+        }
+        pIn->Obj_Count = n;
+        break;
+    }
+    case 4:                                             /* 차로 안 근거리 배치 */
+        if (pIn->Obj_Count == 0) pIn->Obj_Count = 1;
+        place_in_path(&pIn->Obj[rnd_int(r, pIn->Obj_Count)], r);
+        break;
+    case 5: {                                           /* 열거 / 정수 (범위 밖 포함) */
+        int v = rnd_int(r, 8) - 2;
+        ObjectData_t *o = (pIn->Obj_Count > 0) ? &pIn->Obj[rnd_int(r, pIn->Obj_Count)] : NULL;
+        switch (rnd_int(r, 5)) {
+        case 0:  if (o) o->Object_Type   = (ObjectType_e)v;   break;
+        case 1:  if (o) o->Object_Status = (ObjectStatus_e)v; break;
+        case 2:  if (o) o->Object_ID     = v;                 break;
+        case 3:  pIn->Lane.Lane_Type          = (LaneType_e)v;         break;
+        default: pIn->Lane.Lane_Change_Status = (LaneChangeStatus_e)v; break;
+        }
+        break;
+    }
+    default:                                            /* 시각 점프 */
+        if (rnd_int(r, 4)) pIn->Time.Current_Time += rnd_uni(r, -1000.0f, 1000.0f);
+        else               pIn->Time.Current_Time  = special_value(r);
+        break;
+    }
+}
+
+static void mutate(AdasPipelineInput_t *pIn, uint32_t *r)
+{
+    int n = 1 + rnd_int(r, 3);
+    for (int i = 0; i < n; i++) mutate_once(pIn, r);
+}
+
+static void crossover(const AdasPipelineInput_t *a, const AdasPipelineInput_t *b,
+                      AdasPipelineInput_t *c, uint32_t *r)
+{
+    *c = *a;
+    if (rnd_int(r, 2)) c->Time = b->Time;
+    if (rnd_int(r, 2)) c->Gps  = b->Gps;
+    if (rnd_int(r, 2)) c->Imu  = b->Imu;
+    if (rnd_int(r, 2)) c->Lane = b->Lane;
+
+    c->Obj_Count = rnd_int(r, 2) ? a->Obj_Count : b->Obj_Count;
+    for (int i = 0; i < c->Obj_Count; i++) {
+        const AdasPipelineInput_t *src = rnd_int(r, 2) ? a : b;
+        if (i >= src->Obj_Count) src = (src == a) ? b : a;
+        c->Obj[i] = src->Obj[i];
+    }
+}
+
+/*─────────────────────────────
+  측정
+─────────────────────────────*/
+static uint64_t metric_delta(const AdasWcet_t *w, const AdasPerfStageStat_t *before,
+                             const AdasPerfStageStat_t *after)
+{
+    switch (w->Metric) {
+    case ADAS_WCET_METRIC_INSTRUCTIONS:
+        return after->Count[ADAS_PERF_INSTRUCTIONS] - before->Count[ADAS_PERF_INSTRUCTIONS];
+    case ADAS_WCET_METRIC_CYCLES:
+        return after->Count[ADAS_PERF_CYCLES] - before->Count[ADAS_PERF_CYCLES];
+    default:
+        return after->Wall_Ns - before->Wall_Ns;
+    }
+}
+
+static void measure(AdasWcet_t *w, const AdasPipelineInput_t *pIn, uint64_t cost[ADAS_PERF_STAGE_COUNT])
+{
+    uint64_t worst[ADAS_PERF_STAGE_COUNT];
+    for (int k = 0; k < ADAS_PERF_STAGE_COUNT; k++) {
+        cost[k]  = UINT64_MAX;
+        worst[k] = 0;
+    }
+
+    for (int rep = 0; rep < w->Cfg.Repeats; rep++) {
+        AdasPipelineState_t  st;
+        AdasPipelineOutput_t out;
+        AdasPerfStageStat_t  before[ADAS_PERF_STAGE_COUNT];
+
+        adas_pipeline_init(&st);                        /* ACC / LFA 전역 초기화 */
+        st = w->Base;
+        memcpy(before, w->Perf.Stage, sizeof(before));
+        adas_pipeline_step_perf(&st, pIn, &out, &w->Perf);
+
+        for (int k = 0; k < ADAS_PERF_STAGE_COUNT; k++) {
+            const AdasPerfStageStat_t *after = &w->Perf.Stage[k];
+            uint64_t ns = after->Wall_Ns - before[k].Wall_Ns;
+            uint64_t m  = metric_delta(w, &before[k], after);
+            if (m < cost[k])  cost[k]  = m;
+            if (m > worst[k]) worst[k] = m;
+            if (ns > w->Stage[k].Worst_Ns) w->Stage[k].Worst_Ns = ns;
+        }
+    }
+
+    for (int k = 0; k < ADAS_PERF_STAGE_COUNT; k++) {
+        AdasWcetStage_t *s = &w->Stage[k];
+        if (s->Found_At < 0 || worst[k] > s->Worst_Metric) {
+            s->Worst_Metric = worst[k];
+            s->Found_At     = w->Evaluations;
+            s->Worst_Input  = *pIn;
+        }
+    }
+    w->Evaluations++;
+}
+
+static void evaluate_pending(AdasWcet_t *w)
+{
+    for (int i = 0; i < w->Cfg.Population; i++) {
+        AdasWcetIndividual_t *p = &w->Pop[i];
+        if (p->Evaluated) continue;
+        measure(w, &p->Input, p->Cost);
+        p->Evaluated = 1;
+    }
+}
+
+/* 목표 단계 비용 내림차순 (삽입 정렬, 개체 수 ≤ 64) */
+static void sort_population(AdasWcet_t *w)
+{
+    AdasWcetIndividual_t tmp;
+    for (int i = 1; i < w->Cfg.Population; i++) {
+        int j = i;
+        tmp = w->Pop[i];
+        while (j > 0 && w->Pop[j - 1].Cost[w->Target] < tmp.Cost[w->Target]) {
+            w->Pop[j] = w->Pop[j - 1];
+            j--;
+        }
+        w->Pop[j] = tmp;
+    }
+}
+
+/* 2-토너먼트 */
+static const AdasPipelineInput_t *select_parent(AdasWcet_t *w)
+{
+    const AdasWcetIndividual_t *a = &w->Pop[rnd_int(&w->Rng, w->Cfg.Population)];
+    const AdasWcetIndividual_t *b = &w->Pop[rnd_int(&w->Rng, w->Cfg.Population)];
+    return (a->Cost[w->Target] >= b->Cost[w->Target]) ? &a->Input : &b->Input;
+}
+
+static void breed(AdasWcet_t *w)
+{
+    sort_population(w);
+
+    for (int i = 0; i < w->Cfg.Elite; i++) w->Next[i] = w->Pop[i];
+    for (int i = w->Cfg.Elite; i < w->Cfg.Population; i++) {
+        AdasWcetIndividual_t *c = &w->Next[i];
+        const AdasPipelineInput_t *a = select_parent(w);
+        if (rnd_int(&w->Rng, 10) < 7) crossover(a, select_parent(w), &c->Input, &w->Rng);
+        else                          c->Input = *a;
+        mutate(&c->Input, &w->Rng);
+        c->Evaluated = 0;
+    }
+    memcpy(w->Pop, w->Next, sizeof(w->Pop[0]) * (size_t)w->Cfg.Population);
+    w->Generation++;
+}
+
+/*─────────────────────────────
+  공개 함수
+─────────────────────────────*/
+int adas_wcet_init(AdasWcet_t *pW, const AdasWcetConfig_t *pCfg,
+                   const AdasPipelineInput_t *pSeeds, int nSeeds,
+                   const AdasPipelineState_t *pBase)
+{
+    if (!pW || !pCfg || !pSeeds || nSeeds <= 0) return -1;
+    if (pCfg->Population < 2 || pCfg->Population > ADAS_WCET_MAX_POPULATION) return -1;
+    if (pCfg->Elite < 0 || pCfg->Elite >= pCfg->Population || pCfg->Repeats < 1) return -1;
+    for (int i = 0; i < nSeeds; i++) {
+        if (pSeeds[i].Obj_Count < 0 || pSeeds[i].Obj_Count > ADAS_PIPELINE_MAX_OBJ) return -1;
+    }
+
+    memset(pW, 0, sizeof(*pW));
+    pW->Cfg    = *pCfg;
+    pW->Rng    = pCfg->Seed;
+    pW->Target = ADAS_PERF_STAGE_TARGET;
+
+    adas_perf_open(&pW->Perf);
+    if (!pCfg->Use_Counters) adas_perf_close(&pW->Perf);
+    if      (pW->Perf.Available & (1u << ADAS_PERF_INSTRUCTIONS)) pW->Metric = ADAS_WCET_METRIC_INSTRUCTIONS;
+    else if (pW->Perf.Available & (1u << ADAS_PERF_CYCLES))       pW->Metric = ADAS_WCET_METRIC_CYCLES;
+    else                                                          pW->Metric = ADAS_WCET_METRIC_NS;
+
+    if (pBase) pW->Base = *pBase;
+    else       adas_pipeline_init(&pW->Base);
+
+    for (int k = 0; k < ADAS_PERF_STAGE_COUNT; k++) pW->Stage[k].Found_At = -1;
+
+    for (int i = 0; i < pCfg->Population; i++) {
+        pW->Pop[i].Input = pSeeds[i % nSeeds];
+        if (i >= nSeeds) mutate(&pW->Pop[i].Input, &pW->Rng);
+    }
+    return 0;
+}
+
+void adas_wcet_close(AdasWcet_t *pW)
+{
+    if (!pW) return;
+    adas_perf_close(&pW->Perf);
+}
+
+int adas_wcet_set_target(AdasWcet_t *pW, AdasPerfStage_e stage)
+{
+    if (!pW || (unsigned)stage >= ADAS_PERF_STAGE_COUNT) return -1;
+    pW->Target = stage;
+    return 0;
+}
+
+int adas_wcet_run(AdasWcet_t *pW, int generations)
+{
+    if (!pW || generations < 0 || pW->Cfg.Population < 2) return -1;
+
+    evaluate_pending(pW);
+    for (int g = 0; g < generations; g++) {
+        breed(pW);
+        evaluate_pending(pW);
+    }
+    return 0;
+}
+
+int adas_wcet_evaluate(AdasWcet_t *pW, const AdasPipelineInput_t *pIn,
+                       uint64_t pCost[ADAS_PERF_STAGE_COUNT])
+{
+    if (!pW || !pIn || pW->Cfg.Repeats < 1) return -1;
+    if (pIn->Obj_Count < 0 || pIn->Obj_Count > ADAS_PIPELINE_MAX_OBJ) return -1;
+
+    uint64_t cost[ADAS_PERF_STAGE_COUNT];
+    measure(pW, pIn, cost);
+    if (pCost) memcpy(pCost, cost, sizeof(cost));
+    return 0;
+}
+
+const char *adas_wcet_metric_name(AdasWcetMetric_e metric)
+{
+    switch (metric) {
+    case ADAS_WCET_METRIC_INSTRUCTIONS: return "instructions";
+    case ADAS_WCET_METRIC_CYCLES:       return "cycles";
+    default:                            return "ns";
+    }
+}
+
+void adas_wcet_print_input(const AdasPipelineInput_t *pIn, FILE *fp)
+{
+    if (!pIn || !fp) return;
+
+    fprintf(fp, "time %.9g\n", pIn->Time.Current_Time);
+    fprintf(fp, "gps vx %.9g vy %.9g ts %.9g\n",
+            pIn->Gps.GPS_Velocity_X, pIn->Gps.GPS_Velocity_Y, pIn->Gps.GPS_Timestamp);
+    fprintf(fp, "imu ax %.9g ay %.9g yaw %.9g\n",
+            pIn->Imu.Linear_Acceleration_X, pIn->Imu.Linear_Acceleration_Y, pIn->Imu.Yaw_Rate);
+    fprintf(fp, "lane type %d curv %.9g next %.9g offset %.9g heading %.9g width %.9g change %d\n",
+            (int)pIn->Lane.Lane_Type, pIn->Lane.Lane_Curvature, pIn->Lane.Next_Lane_Curvature,
+            pIn->Lane.Lane_Offset, pIn->Lane.Lane_Heading, pIn->Lane.Lane_Width,
+            (int)pIn->Lane.Lane_Change_Status);
+    fprintf(fp, "objects %d\n", (int)pIn->Obj_Count);
+    for (int i = 0; i < pIn->Obj_Count && i < ADAS_PIPELINE_MAX_OBJ; i++) {
+        const ObjectData_t *o = &pIn->Obj[i];
+        fprintf(fp, "  [%2d] id %d type %d status %d cell %d pos %.9g %.9g %.9g vel %.9g %.9g "
+                    "acc %.9g %.9g hdg %.9g dist %.9g\n",
+                i, o->Object_ID, (int)o->Object_Type, (int)o->Object_Status, o->Object_Cell_ID,
+                o->Position_X, o->Position_Y, o->Position_Z, o->Velocity_X, o->Velocity_Y,
+                o->Accel_X, o->Accel_Y, o->Heading, o->Distance);
+    }
+}
+
+void adas_wcet_report(const AdasWcet_t *pW, FILE *fp)
+{
+    if (!pW || !fp) return;
+
+    const char *metric = adas_wcet_metric_name(pW->Metric);
+    fprintf(fp, "wcet search : metric %s, generations %d, evaluations %lld, repeats %d\n",
+            metric, (int)pW->Generation, (long long)pW->Evaluations, (int)pW->Cfg.Repeats);
+    fprintf(fp, "%-12s %12s %14s %10s\n", "stage", "worst-ns", metric, "found-at");
+    for (int k = 0; k < ADAS_PERF_STAGE_COUNT; k++) {
+        const AdasWcetStage_t *s = &pW->Stage[k];
+        fprintf(fp, "%-12s %12llu %14llu %10lld\n", adas_perf_stage_name((AdasPerfStage_e)k),
+                (unsigned long long)s->Worst_Ns, (unsigned long long)s->Worst_Metric,
+                (long long)s->Found_At);
+    }
+    for (int k = 0; k < ADAS_PERF_STAGE_COUNT; k++) {
+        const AdasWcetStage_t *s = &pW->Stage[k];
+        if (s->Found_At < 0) continue;
+        fprintf(fp, "--- worst input : %s (%s %llu, evaluation %lld) ---\n",
+                adas_perf_stage_name((AdasPerfStage_e)k), metric,
+                (unsigned long long)s->Worst_Metric, (long long)s->Found_At);
+        adas_wcet_print_input(&s->Worst_Input, fp);
+    }
+}
@@ -0,0 +1,121 @@
+/****************************************************************************
+ * adas_wcet.h
+ *
+ * - 단계별 최악 실행 시간(WCET) 측정 : 유전 탐색으로 입력을 바꿔 가며 관측 최댓값 추적
+ *     . 개체 = 1 틱 입력 (AdasPipelineInput_t), 평가 = 기준 상태에서 adas_pipeline_step_perf 1 회
+ *     . 적합도 = 목표 단계 비용 (명령 수 > 사이클 > 벽시계 ns 중 열린 것, adas_perf.h)
+ *       명령 수는 잡음 없는 반복 횟수 대용 → 카운터가 있으면 탐색이 결정적으로 수렴
+ *     . 변이 : 수치 흔들기, 특수값(NaN / ±inf / ±1e30 / 비정규), 큰 heading(±1e2 ~ ±1e8),
+ *              객체 수 변경 / 복제, 차로 안 근거리 배치(필터 통과), 열거값 범위 밖, 시각 점프
+ *     . 교차 : 객체 슬롯 단위 + 차선 / GPS / IMU / 시각 묶음 단위 균등 교차
+ * - 최악 기록 : 모든 평가에서 단계마다 관측 최대 ns, 최대 지표 값과 그 입력 (목표 단계와 무관)
+ *     . 카운터가 없으면 지표 = ns → 최악 입력이 곧 최대 ns 입력
+ * - 후보당 Repeats 회 측정 : 적합도는 최솟값(잡음 제거), 최악 기록은 최댓값
+ * - 매 평가마다 adas_pipeline_init 후 기준 상태 복사 → ACC / LFA PID 전역은 0 에서 시작
+ * - 관측값은 하한 추정 (정적 분석 WCET 대체 아님), 측정은 최적화 빌드에서
+ ****************************************************************************/
+#ifndef ADAS_WCET_H
+#define ADAS_WCET_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include "adas_perf.h"
+#include "adas_pipeline.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ADAS_WCET_MAX_POPULATION    64
+
+typedef enum {
+    ADAS_WCET_METRIC_NS = 0,        /* 벽시계 (카운터 없음) */
+    ADAS_WCET_METRIC_CYCLES,
+    ADAS_WCET_METRIC_INSTRUCTIONS
+} AdasWcetMetric_e;
+
+typedef struct {
+    uint32_t Seed;                  /* 변이 난수 시드 */
+    int32_t  Population;            /* 2 ~ ADAS_WCET_MAX_POPULATION */
+    int32_t  Elite;                 /* 다음 세대로 그대로 넘기는 상위 개체 수 (< Population) */
+    int32_t  Repeats;               /* 후보당 측정 반복 (>= 1) */
+    int32_t  Use_Counters;          /* 0 : 벽시계만 (카운터를 열지 않음) */
+} AdasWcetConfig_t;
+
+/* 단계별 관측 최악 */
+typedef struct {
+    uint64_t            Worst_Ns;           /* 관측 최대 [ns] (모든 측정) */
+    uint64_t            Worst_Metric;       /* 관측 최대 지표 값 */
+    int64_t             Found_At;           /* Worst_Metric 평가 번호 (없음 -1) */
+    AdasPipelineInput_t Worst_Input;        /* Worst_Metric 입력 */
+} AdasWcetStage_t;
+
+typedef struct {
+    AdasPipelineInput_t Input;
+    uint64_t            Cost[ADAS_PERF_STAGE_COUNT];    /* 반복 중 최솟값 (적합도 지표) */
+    int32_t             Evaluated;
+} AdasWcetIndividual_t;
+
+typedef struct {
+    AdasWcetConfig_t     Cfg;
+    AdasWcetMetric_e     Metric;
+    AdasPerfStage_e      Target;            /* 적합도 단계 */
+    uint32_t             Rng;
+    int64_t              Evaluations;
+    int32_t              Generation;
+
+    AdasPerf_t           Perf;
+    AdasPipelineState_t  Base;              /* 평가 시작 상태 */
+
+    AdasWcetIndividual_t Pop[ADAS_WCET_MAX_POPULATION];
+    AdasWcetIndividual_t Next[ADAS_WCET_MAX_POPULATION];
+
+    AdasWcetStage_t      Stage[ADAS_PERF_STAGE_COUNT];
+} AdasWcet_t;
+
+/**
+ * @brief 탐색 초기화 : 씨앗 입력을 순환 배치(씨앗 수 초과분은 변이), 카운터 열기
+ * @param pBase : 평가 시작 상태 (NULL : adas_pipeline_init 상태)
+ * @return 0 on success, -1 on invalid argument (씨앗 없음 / Obj_Count 범위 밖 포함)
+ */
+int adas_wcet_init(AdasWcet_t *pW, const AdasWcetConfig_t *pCfg,
+                   const AdasPipelineInput_t *pSeeds, int nSeeds,
+                   const AdasPipelineState_t *pBase);
+
+/** @brief 카운터 닫기 */
+void adas_wcet_close(AdasWcet_t *pW);
+
+/**
+ * @brief 적합도 단계 변경 (개체별 비용은 단계마다 보관 → 재평가 없음)
+ * @return 0 on success, -1 on invalid argument
+ */
+int adas_wcet_set_target(AdasWcet_t *pW, AdasPerfStage_e stage);
+
+/**
+ * @brief 세대 진행 (미평가 개체 평가 → 정렬 → 엘리트 보존 + 토너먼트 선택 / 교차 / 변이)
+ * @return 0 on success, -1 on invalid argument
+ */
+int adas_wcet_run(AdasWcet_t *pW, int generations);
+
+/**
+ * @brief 입력 1 개 평가 (최악 기록 갱신, 탐색 개체와 무관한 재측정 / 회귀 확인용)
+ * @param[out] pCost : 단계별 지표 (NULL 허용)
+ * @return 0 on success, -1 on invalid argument
+ */
+int adas_wcet_evaluate(AdasWcet_t *pW, const AdasPipelineInput_t *pIn,
+                       uint64_t pCost[ADAS_PERF_STAGE_COUNT]);
+
+/** @brief 지표 이름 ("ns", "cycles", "instructions") */
+const char *adas_wcet_metric_name(AdasWcetMetric_e metric);
+
+/** @brief 단계별 최악 표 + 각 최악 입력 출력 */
+void adas_wcet_report(const AdasWcet_t *pW, FILE *fp);
+
+/** @brief 입력 전체 필드 텍스트 출력 (비유한 값은 nan / inf 그대로) */
+void adas_wcet_print_input(const AdasPipelineInput_t *pIn, FILE *fp);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADAS_WCET_H */
@@ -0,0 +1,212 @@
+/*********************************************************************
+ * adas_wcet_test.cpp  ―  단계별 WCET 유전 탐색 + heading 정규화 반복 상한
+ * DUT : adas_wcet.c, target_selection.c / lane_selection.c (heading 정규화)
+ *       + 템플릿 사본 (target_selection_tpl.hpp / lane_selection_tpl.hpp)
+ *********************************************************************/
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "adas_wcet.h"
+#include "golden_trace.h"
+#include "lane_selection_tpl.hpp"
+#include "target_selection_tpl.hpp"
+
+namespace {
+
+class AdasWcetTest : public ::testing::Test {
+protected:
+    std::unique_ptr<AdasWcet_t>      w{ new AdasWcet_t() };
+    std::vector<AdasPipelineInput_t> seeds;
+    AdasPipelineState_t              base;
+    AdasWcetConfig_t                 cfg = { 49u, 8, 2, 1, 0 };
+
+    void SetUp() override
+    {
+        for (int32_t &fd : w->Perf.Fd) fd = -1;                      /* init 실패 시 close 안전 */
+        GoldenScene_t        scene;
+        AdasPipelineInput_t  in;
+        AdasPipelineOutput_t out;
+        golden_scene_init(&scene, 49u, 0);
+        adas_pipeline_init(&base);
+        for (int t = 0; t < 200; t++) {
+            golden_scene_next(&scene, &in);
+            adas_pipeline_step(&base, &in, &out);
+        }
+        for (int i = 0; i < 4; i++) {
+            golden_scene_next(&scene, &in);
+            seeds.push_back(in);
+        }
+    }
+    void TearDown() override { adas_wcet_close(w.get()); }
+
+    static uint32_t bits(float f)
+    {
+        uint32_t u;
+        std::memcpy(&u, &f, sizeof(u));
+        return u;
+    }
+
+    static float loop_wrap(float h)
+    {
+        while (h > 180.0f)  h -= 360.0f;
+        while (h < -180.0f) h += 360.0f;
+        return h;
+    }
+};
+
+/* TC_WCET_EQ_01 : 세대 진행 → 평가 수, 개체 입력 유효, 단계별 최악 기록 + 최악 입력 재실행 */
+TEST_F(AdasWcetTest, TC_WCET_EQ_01)
+{
+    ASSERT_EQ(adas_wcet_init(w.get(), &cfg, seeds.data(), (int)seeds.size(), &base), 0);
+    EXPECT_EQ(w->Metric, ADAS_WCET_METRIC_NS);                      /* Use_Counters 0 */
+    EXPECT_EQ(std::memcmp(&w->Pop[1].Input, &seeds[1], sizeof(seeds[1])), 0);
+
+    ASSERT_EQ(adas_wcet_run(w.get(), 5), 0);
+    EXPECT_EQ(w->Generation, 5);
+    EXPECT_EQ(w->Evaluations, 8 + 5 * (8 - 2));
+
+    for (int i = 0; i < cfg.Population; i++) {
+        EXPECT_TRUE(w->Pop[i].Evaluated);
+        EXPECT_GE(w->Pop[i].Input.Obj_Count, 0);
+        EXPECT_LE(w->Pop[i].Input.Obj_Count, ADAS_PIPELINE_MAX_OBJ);
+    }
+
+    uint64_t total = 0;
+    for (int k = 0; k < ADAS_PERF_STAGE_COUNT; k++) {
+        const AdasWcetStage_t &s = w->Stage[k];
+        EXPECT_GE(s.Found_At, 0);
+        EXPECT_LT(s.Found_At, w->Evaluations);
+        EXPECT_GE(s.Worst_Ns, s.Worst_Metric);                      /* 지표 = ns */
+        total += s.Worst_Ns;
+
+        AdasPipelineState_t  st = base;
+        AdasPipelineOutput_t out;
+        EXPECT_EQ(adas_pipeline_step(&st, &s.Worst_Input, &out), 0);
+    }
+    EXPECT_GT(total, 0u);
+
+    std::FILE *f = std::tmpfile();
+    ASSERT_NE(f, nullptr);
+    adas_wcet_report(w.get(), f);
+    EXPECT_GT(std::ftell(f), 0L);
+    std::fclose(f);
+}
+
+/* TC_WCET_EQ_02 : 엘리트 보존 → 목표 단계 최대 비용은 세대마다 감소하지 않음, 목표 변경 시 재평가 없음 */
+TEST_F(AdasWcetTest, TC_WCET_EQ_02)
+{
+    ASSERT_EQ(adas_wcet_init(w.get(), &cfg, seeds.data(), (int)seeds.size(), nullptr), 0);
+    ASSERT_EQ(adas_wcet_set_target(w.get(), ADAS_PERF_STAGE_LFA), 0);
+
+    uint64_t prev = 0;
+    for (int g = 0; g < 6; g++) {
+        ASSERT_EQ(adas_wcet_run(w.get(), 1), 0);
+        uint64_t best = 0;
+        for (int i = 0; i < cfg.Population; i++) best = std::max(best, w->Pop[i].Cost[ADAS_PERF_STAGE_LFA]);
+        EXPECT_GE(best, prev) << "generation " << g;
+        prev = best;
+    }
+
+    int64_t evals = w->Evaluations;
+    ASSERT_EQ(adas_wcet_set_target(w.get(), ADAS_PERF_STAGE_TARGET), 0);
+    ASSERT_EQ(adas_wcet_run(w.get(), 0), 0);
+    EXPECT_EQ(w->Evaluations, evals);
+}
+
+/* TC_WCET_BV_01 : 큰 / 비유한 heading → 정규화 반복 상한 (종료), |x| < 2^27 은 반복 빼기와 동일 */
+TEST_F(AdasWcetTest, TC_WCET_BV_01)
+{
+    const float inf = std::numeric_limits<float>::infinity();
+    const float hdg[] = { 181.0f, -539.0f, 541.0f, 1e6f, -7.5e7f, 1.3e8f, 1e20f, -3e38f, inf, -inf,
+                          std::numeric_limits<float>::quiet_NaN() };
+
+    EgoData_t          ego = {};
+    LaneSelectOutput_t ls  = {};
+    ego.Ego_Velocity_X = 10.0f;
+    ls.LS_Lane_Width   = 3.5f;
+    for (float h : hdg) {
+        ObjectData_t o = {};
+        o.Object_ID  = 1;
+        o.Position_X = o.Distance = 20.0f;
+        o.Velocity_X = 5.0f;
+        o.Heading    = h;
+        FilteredObject_t f;
+        ASSERT_EQ(select_target_from_object_list(&o, 1, &ego, &ls, &f, 1), 1) << h;
+        if (std::isfinite(h)) {
+            EXPECT_LE(std::fabs(f.Filtered_Heading), 180.0f) << h;
+#ifndef ADAS_USE_FAST_MATH
+            if (std::fabs(h) < 134217728.0f) {
+                EXPECT_EQ(f.Filtered_Heading, loop_wrap(h)) << h;
+            }
+#endif
+        } else {
+            EXPECT_TRUE(std::isnan(f.Filtered_Heading)) << h;
+        }
+
+        /* 템플릿 사본 : 같은 상한, C API 와 비트 동일 */
+        FilteredObject_t ft{};
+        ASSERT_EQ(adas::select_target_from_object_list<>(&o, 1, &ego, &ls, &ft, 1), 1) << h;
+        EXPECT_EQ(bits(ft.Filtered_Heading), bits(f.Filtered_Heading)) << h;
+
+        LaneData_t         lane = {};
+        EgoData_t          e    = {};
+        LaneSelectOutput_t out, outT;
+        lane.Lane_Width   = 3.5f;
+        lane.Lane_Heading = -h;
+        ASSERT_EQ(LaneSelection(&lane, &e, &out), 0);
+        if (std::isfinite(h)) {
+            EXPECT_LE(std::fabs(out.LS_Heading_Error), 180.0f) << h;
+        }
+        ASSERT_EQ(adas::LaneSelection<>(&lane, &e, &outT), 0);
+        EXPECT_EQ(bits(outT.LS_Heading_Error), bits(out.LS_Heading_Error)) << h;
+    }
+
+    /* 탐색 평가도 종료 (전 단계 최악 기록) */
+    ASSERT_EQ(adas_wcet_init(w.get(), &cfg, seeds.data(), 1, &base), 0);
+    AdasPipelineInput_t in = seeds[0];
+    in.Lane.Lane_Heading = inf;
+    in.Imu.Yaw_Rate      = -inf;
+    for (int i = 0; i < in.Obj_Count; i++) in.Obj[i].Heading = (i & 1) ? inf : 1e30f;
+    uint64_t cost[ADAS_PERF_STAGE_COUNT];
+    ASSERT_EQ(adas_wcet_evaluate(w.get(), &in, cost), 0);
+    EXPECT_EQ(w->Evaluations, 1);
+    for (int k = 0; k < ADAS_PERF_STAGE_COUNT; k++) EXPECT_EQ(w->Stage[k].Found_At, 0);
+}
+
+/* TC_WCET_RA_01 : 인자 오류 */
+TEST_F(AdasWcetTest, TC_WCET_RA_01)
+{
+    AdasWcetConfig_t bad = cfg;
+    EXPECT_EQ(adas_wcet_init(nullptr, &cfg, seeds.data(), 1, nullptr), -1);
+    EXPECT_EQ(adas_wcet_init(w.get(), nullptr, seeds.data(), 1, nullptr), -1);
+    EXPECT_EQ(adas_wcet_init(w.get(), &cfg, nullptr, 1, nullptr), -1);
+    EXPECT_EQ(adas_wcet_init(w.get(), &cfg, seeds.data(), 0, nullptr), -1);
+    bad.Population = 1;                          EXPECT_EQ(adas_wcet_init(w.get(), &bad, seeds.data(), 1, nullptr), -1);
+    bad.Population = ADAS_WCET_MAX_POPULATION + 1; EXPECT_EQ(adas_wcet_init(w.get(), &bad, seeds.data(), 1, nullptr), -1);
+    bad = cfg; bad.Elite = cfg.Population;       EXPECT_EQ(adas_wcet_init(w.get(), &bad, seeds.data(), 1, nullptr), -1);
+    bad = cfg; bad.Repeats = 0;                  EXPECT_EQ(adas_wcet_init(w.get(), &bad, seeds.data(), 1, nullptr), -1);
+
+    AdasPipelineInput_t in = seeds[0];
+    in.Obj_Count = ADAS_PIPELINE_MAX_OBJ + 1;
+    EXPECT_EQ(adas_wcet_init(w.get(), &cfg, &in, 1, nullptr), -1);
+
+    ASSERT_EQ(adas_wcet_init(w.get(), &cfg, seeds.data(), 1, nullptr), 0);
+    EXPECT_EQ(adas_wcet_evaluate(w.get(), &in, nullptr), -1);
+    EXPECT_EQ(adas_wcet_evaluate(nullptr, &seeds[0], nullptr), -1);
+    EXPECT_EQ(adas_wcet_set_target(w.get(), ADAS_PERF_STAGE_COUNT), -1);
+    EXPECT_EQ(adas_wcet_run(w.get(), -1), -1);
+    EXPECT_EQ(adas_wcet_run(nullptr, 1), -1);
+    EXPECT_EQ(w->Evaluations, 0);
+    EXPECT_STREQ(adas_wcet_metric_name(ADAS_WCET_METRIC_INSTRUCTIONS), "instructions");
+    adas_wcet_report(nullptr, stdout);
+    adas_wcet_print_input(nullptr, stdout);
+    adas_wcet_close(nullptr);
+}
+
+}  // namespace
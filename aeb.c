@@ -2,6 +2,11 @@
 #include <stdio.h>
 #include "aeb.h"
 #include "adas_shared.h"
+#include "mode_table.h"
+
+/* mode_table.h 의 표 값 / 열거 사본이 aeb.h 와 일치 */
+MODE_TABLE_STATIC_ASSERT(MODE_TABLE_AEB_TARGET_CUT_OUT == AEB_TARGET_CUT_OUT, aeb_target_cut_out);
+MODE_TABLE_STATIC_ASSERT(AEB_MODE_NORMAL == 0 && AEB_MODE_ALERT == 1 && AEB_MODE_BRAKE == 2, aeb_mode_values);
 
 #define INF_TTC_F  99999.0f     /* 내부 “무한대” 값 */
 #define MIN_DIST_F 0.01f        /* 0 나눗셈 방지용 최소 거리 */
@@ -133,6 +138,20 @@ AEB_Mode_e aeb_mode_selection(const AEB_Target_Data_t *pAebTargetData,
     return AEB_MODE_NORMAL;
 }
 
+AEB_Mode_e aeb_mode_selection_lut(const AEB_Target_Data_t *pAebTargetData,
+                                  const Ego_Data_t        *pEgoData,
+                                  const TTC_Data_t        *pTtcData)
+{
+    if(!pAebTargetData || !pEgoData || !pTtcData)
+        return AEB_MODE_NORMAL;
+
+    uint32_t idx = mode_table_aeb_index(pAebTargetData->AEB_Target_ID,
+                                        (int32_t)pAebTargetData->AEB_Target_Situation,
+                                        pEgoData->Ego_Velocity_X,
+                                        pTtcData->TTC, pTtcData->TTC_Brake, pTtcData->TTC_Alert);
+    return (AEB_Mode_e)g_AebModeTable[idx];
+}
+
 /**
  * @brief 2.2.3.1.3 calculate_decel_for_aeb
  * - AEB_Mode가 Normal/Alert일 땐 0.0
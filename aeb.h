@@ -82,6 +82,13 @@ AEB_Mode_e aeb_mode_selection(const AEB_Target_Data_t *pAebTargetData,
                               const Ego_Data_t        *pEgoData,
                               const TTC_Data_t        *pTtcData);
 
+/**
+ * @brief aeb_mode_selection 의 분기 없는 표 조회판 (mode_table.h, 결과 동일)
+ */
+AEB_Mode_e aeb_mode_selection_lut(const AEB_Target_Data_t *pAebTargetData,
+                                  const Ego_Data_t        *pEgoData,
+                                  const TTC_Data_t        *pTtcData);
+
 /**
  * @brief 2.2.3.1.3 calculate_decel_for_aeb
  * AEB 모드와 충돌 시간(TTC)을 고려하여 최종 감속도(Decel_AEB_X)를 결정.
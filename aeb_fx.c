@@ -0,0 +1,137 @@
+#include "aeb_fx.h"
+#include "adas_shared.h"
+
+#define AEB_FX_MIN_DIST        FX16_C(0.01)         /* 0 나눗셈 방지용 최소 거리 */
+#define AEB_FX_MIN_EGO_SPEED   FX16_C(0.5)          /* AEB 작동 최소 속도 */
+#define AEB_FX_BRAKE_EGO_SPEED FX16_C(0.1)          /* TTC_Brake 계산 최소 속도 */
+#define AEB_FX_MAX_DECEL       FX16_C(AEB_DEFAULT_MAX_DECEL)
+#define AEB_FX_ALERT_BUFFER    FX16_C(AEB_ALERT_BUFFER_TIME)
+#define AEB_FX_BRAKE_MAX       FX16_C(AEB_MAX_BRAKE_DECEL)   /* -10 */
+#define AEB_FX_BRAKE_MIN       FX16_C(AEB_MIN_BRAKE_DECEL)   /* -2 */
+
+/* 0.01 단위 정수 → Q16 */
+static inline fx16_t centi_to_fx(int64_t c)
+{
+    int64_t n = c * FX16_ONE;
+    return fx16_sat((n + (n >= 0 ? 50 : -50)) / 100);
+}
+
+/**
+ * @brief 2.2.3.1.1 calculate_ttc_for_aeb (고정소수점)
+ * - Relative_Speed 는 aeb.c 와 같이 0.01 m/s 단위 반올림
+ * - TTC = Distance × 100 / Relative_Speed[0.01 m/s] (정수 나눗셈 1회)
+ */
+void calculate_ttc_for_aeb_fx(const AEB_Fx_Target_Data_t *pAebTargetData,
+                              const AEB_Fx_Ego_Data_t    *pEgoData,
+                              TTC_Fx_Data_t              *pTtcData)
+{
+    if (!pAebTargetData || !pEgoData || !pTtcData) {
+        return;
+    }
+
+    pTtcData->TTC            = AEB_FX_TTC_INF;
+    pTtcData->TTC_Brake      = 0;
+    pTtcData->TTC_Alert      = 0;
+    pTtcData->Relative_Speed = 0;
+
+    if (pEgoData->Ego_Velocity_X < 0) {
+        return;
+    }
+    if (pAebTargetData->AEB_Target_ID < 0 ||
+        pAebTargetData->AEB_Target_Situation == AEB_TARGET_CUT_OUT) {
+        return;
+    }
+
+    fx16_t relSpd = fx16_sub(pEgoData->Ego_Velocity_X, pAebTargetData->AEB_Target_Velocity_X);
+    if (relSpd <= 0) {
+        return;
+    }
+
+    /* 0.01 m/s 단위 반올림 */
+    int64_t relCenti = ((int64_t)relSpd * 100 + FX16_HALF) >> FX16_FRAC_BITS;
+    if (relCenti <= 0) {
+        return;
+    }
+    pTtcData->Relative_Speed = centi_to_fx(relCenti);
+
+    fx16_t dist = pAebTargetData->AEB_Target_Distance;
+    if (dist >= FX16_MAX) {
+        return;                                     /* 포화(+INF) 거리 → TTC 무한대 */
+    }
+    if (dist < AEB_FX_MIN_DIST) dist = AEB_FX_MIN_DIST;
+
+    pTtcData->TTC = fx16_sat(((int64_t)dist * 100 + relCenti / 2) / relCenti);
+
+    if (pEgoData->Ego_Velocity_X > AEB_FX_BRAKE_EGO_SPEED) {
+        pTtcData->TTC_Brake = fx16_div(pEgoData->Ego_Velocity_X, AEB_FX_MAX_DECEL);
+    }
+    pTtcData->TTC_Alert = fx16_add(pTtcData->TTC_Brake, AEB_FX_ALERT_BUFFER);
+}
+
+/**
+ * @brief 2.2.3.1.2 aeb_mode_selection (고정소수점)
+ */
+AEB_Mode_e aeb_mode_selection_fx(const AEB_Fx_Target_Data_t *pAebTargetData,
+                                 const AEB_Fx_Ego_Data_t    *pEgoData,
+                                 const TTC_Fx_Data_t        *pTtcData)
+{
+    if (!pAebTargetData || !pEgoData || !pTtcData) {
+        return AEB_MODE_NORMAL;
+    }
+
+    fx16_t ttc = pTtcData->TTC;
+
+    if (pAebTargetData->AEB_Target_ID < 0 ||
+        pEgoData->Ego_Velocity_X < AEB_FX_MIN_EGO_SPEED ||
+        ttc <= 0 || ttc >= AEB_FX_TTC_INF) {
+        return AEB_MODE_NORMAL;
+    }
+    if (pAebTargetData->AEB_Target_Situation == AEB_TARGET_CUT_OUT) {
+        return AEB_MODE_NORMAL;
+    }
+
+    if (ttc > pTtcData->TTC_Alert) {
+        return AEB_MODE_NORMAL;
+    }
+    if (ttc > pTtcData->TTC_Brake) {
+        return AEB_MODE_ALERT;
+    }
+    return AEB_MODE_BRAKE;
+}
+
+/**
+ * @brief 2.2.3.1.3 calculate_decel_for_aeb (고정소수점)
+ * - aeb.c 의 ε(1e-6 s) 는 Q16 분해능 미만 → TTC == TTC_Brake 정확 비교
+ */
+fx16_t calculate_decel_for_aeb_fx(AEB_Mode_e mode,
+                                  const TTC_Fx_Data_t *d)
+{
+    if (!d || mode != AEB_MODE_BRAKE) {
+        return 0;
+    }
+
+    fx16_t ttc      = d->TTC;
+    fx16_t ttcBrake = d->TTC_Brake;
+    if (ttcBrake <= 0) {
+        return 0;
+    }
+
+    /* 센서 노이즈 (–5 ms 이내) 는 0 으로 보정, 그 이하 음수는 무효 */
+    if (ttc < 0) {
+        if (ttc >= FX16_C(-0.005) || (ttc < FX16_C(-0.05) && ttc >= FX16_C(-0.20)))
+            ttc = 0;
+        else
+            return 0;
+    }
+
+    if (ttc > ttcBrake)  return AEB_FX_BRAKE_MIN;
+    if (ttc == ttcBrake) return 0;
+
+    fx16_t ratio = fx16_sub(FX16_ONE, fx16_div(ttc, ttcBrake));
+    fx16_t decel = fx16_mul(AEB_FX_BRAKE_MAX, ratio);
+    decel = fx16_clamp(decel, AEB_FX_BRAKE_MAX, AEB_FX_BRAKE_MIN);
+
+    /* 0.1 단위 반올림 */
+    int64_t deci = ((int64_t)decel * 10 + (decel >= 0 ? FX16_HALF : -FX16_HALF)) / FX16_ONE;
+    return fx16_sat((deci * FX16_ONE + (deci >= 0 ? 5 : -5)) / 10);
+}
@@ -0,0 +1,66 @@
+/****************************************************************************
+ * aeb_fx.h
+ *
+ * - AEB 고정소수점(Q15.16) 구성 : aeb.c 와 동일 알고리즘, 정수 연산 전용
+ * - TTC "무한대"(aeb.c 의 99999 s) 는 AEB_FX_TTC_INF (= FX16_MAX ≈ 32768 s) 로 표현
+ * - 고정소수점 입력에는 NaN/INF 가 없으므로 해당 분기는 Host 변환(fx16_from_float)
+ *   단계에서 처리됨 (NaN → 0, ±INF → 포화)
+ *
+ * float 참조(aeb.c) 대비 오차 (aeb_fx_test.cpp 교차검증):
+ *   TTC / TTC_Brake / TTC_Alert : 상대오차 <= 1e-4 (TTC < AEB_FX_TTC_INF)
+ *     단, 상대속도가 0.01 m/s 반올림 경계(±1e-4) 에 있으면 입력 양자화로 반올림
+ *     방향이 갈려 최대 0.01 / Relative_Speed 까지 벌어질 수 있음
+ *   Decel_AEB_X                 : |err| <= 0.1 [m/s²] (0.1 단위 양자화 경계), 그 외 일치
+ ****************************************************************************/
+#ifndef AEB_FX_H
+#define AEB_FX_H
+
+#include "fixed_point.h"
+#include "aeb.h"      /* AEB_Mode_e, AEB_Target_Situation_e */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define AEB_FX_TTC_INF   FX16_MAX
+
+typedef struct
+{
+    int    AEB_Target_ID;                           /* (0, N) */
+    fx16_t AEB_Target_Distance;                     /* Q16 [m] */
+    fx16_t AEB_Target_Velocity_X;                   /* Q16 [m/s] */
+    AEB_Target_Situation_e AEB_Target_Situation;
+} AEB_Fx_Target_Data_t;
+
+typedef struct
+{
+    fx16_t Ego_Velocity_X;                          /* Q16 [m/s] */
+} AEB_Fx_Ego_Data_t;
+
+typedef struct
+{
+    fx16_t TTC;                                     /* Q16 [s] */
+    fx16_t TTC_Brake;                               /* Q16 [s] */
+    fx16_t TTC_Alert;                               /* Q16 [s] */
+    fx16_t Relative_Speed;                          /* Q16 [m/s], 0.01 단위 반올림 */
+} TTC_Fx_Data_t;
+
+void calculate_ttc_for_aeb_fx(const AEB_Fx_Target_Data_t *pAebTargetData,
+                              const AEB_Fx_Ego_Data_t    *pEgoData,
+                              TTC_Fx_Data_t              *pTtcData);
+
+AEB_Mode_e aeb_mode_selection_fx(const AEB_Fx_Target_Data_t *pAebTargetData,
+                                 const AEB_Fx_Ego_Data_t    *pEgoData,
+                                 const TTC_Fx_Data_t        *pTtcData);
+
+/**
+ * @return Decel_AEB_X : Q16 (-10 ~ 0) [m/s²], 0.1 단위 반올림
+ */
+fx16_t calculate_decel_for_aeb_fx(AEB_Mode_e aebMode,
+                                  const TTC_Fx_Data_t *pTtcData);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AEB_FX_H */
@@ -0,0 +1,151 @@
+/*********************************************************************
+ * aeb_fx_test.cpp  ―  AEB / Arbitration 고정소수점 구성 교차검증
+ * DUT : calculate_ttc_for_aeb_fx / aeb_mode_selection_fx
+ *       calculate_decel_for_aeb_fx / Arbitration_fx
+ * REF : aeb.c / arbitration.c (float)
+ *********************************************************************/
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdint>
+
+#include "aeb_fx.h"
+#include "arbitration.h"
+#include "arbitration_fx.h"
+#include "test_rng.hpp"
+
+static constexpr double TTC_REL_ERR   = 1e-4;    /* aeb_fx.h 문서화 오차 */
+static constexpr float  DECEL_MAX_ERR = 0.1f;
+static constexpr float  ARB_MAX_ERR   = 2.0f / 65536.0f;
+
+class AebFxTest : public ::testing::Test
+{
+protected:
+    TestRng  rng{11u};
+    static AEB_Fx_Target_Data_t toFx(const AEB_Target_Data_t &t) {
+        return { t.AEB_Target_ID, fx16_from_float(t.AEB_Target_Distance),
+                 fx16_from_float(t.AEB_Target_Velocity_X), t.AEB_Target_Situation };
+    }
+};
+
+/* TTC / 모드 / 감속 : 임의 입력 2×10⁴ 건 */
+TEST_F(AebFxTest, TC_AEB_FX_EQ_01_CrossCheckRandom)
+{
+    int modeMismatch = 0, compared = 0, roundingEdge = 0;
+    double ttcErr = 0.0;
+    float  decErr = 0.0f;
+
+    for (int i = 0; i < 20000; i++) {
+        AEB_Target_Data_t t{ (i % 23 == 0) ? -1 : 1, rng.uni(0.0f, 120.0f), rng.uni(0.0f, 30.0f),
+                             (AEB_Target_Situation_e)(i % 3) };
+        Ego_Data_t e{ rng.uni(0.0f, 40.0f) };
+        AEB_Fx_Target_Data_t tf = toFx(t);
+        AEB_Fx_Ego_Data_t    ef{ fx16_from_float(e.Ego_Velocity_X) };
+
+        TTC_Data_t    d;
+        TTC_Fx_Data_t df;
+        calculate_ttc_for_aeb(&t, &e, &d);
+        calculate_ttc_for_aeb_fx(&tf, &ef, &df);
+
+        /* 상대속도 0.01 반올림 경계(±1e-4 m/s) : 입력 양자화로 반올림 방향이 갈림 → 비교 제외 */
+        float relC = (e.Ego_Velocity_X - t.AEB_Target_Velocity_X) * 100.0f;
+        bool  onRoundingEdge = std::fabs(relC - std::floor(relC) - 0.5f) < 1e-2f;
+        if (onRoundingEdge) {
+            roundingEdge++;
+        } else if (d.TTC < 30000.0f) {
+            ttcErr = std::fmax(ttcErr, std::fabs(fx16_to_float(df.TTC) - d.TTC) / std::fmax(d.TTC, 1.0f));
+            ttcErr = std::fmax(ttcErr, std::fabs(fx16_to_float(df.TTC_Alert) - d.TTC_Alert) / std::fmax(d.TTC_Alert, 1.0f));
+        } else {
+            EXPECT_EQ(df.TTC, AEB_FX_TTC_INF) << i;
+        }
+
+        AEB_Mode_e m  = aeb_mode_selection(&t, &e, &d);
+        AEB_Mode_e mf = aeb_mode_selection_fx(&tf, &ef, &df);
+        if (m != mf) {
+            /* 허용 : TTC 가 경계와 1e-4 s 이내 */
+            EXPECT_TRUE(std::fabs(d.TTC - d.TTC_Brake) < 1e-4f ||
+                        std::fabs(d.TTC - d.TTC_Alert) < 1e-4f) << i;
+            modeMismatch++;
+            continue;
+        }
+        compared++;
+        float dec  = calculate_decel_for_aeb(m, &d);
+        float decf = fx16_to_float(calculate_decel_for_aeb_fx(mf, &df));
+        decErr = std::fmax(decErr, std::fabs(decf - dec));
+    }
+    EXPECT_LE(ttcErr, TTC_REL_ERR);
+    EXPECT_LE(decErr, DECEL_MAX_ERR + 1e-4f);
+    EXPECT_LE(modeMismatch, 2);
+    EXPECT_LT(roundingEdge, 800);
+    EXPECT_GT(compared, 19000);
+}
+
+/* 접근 시나리오 : Normal → Alert → Brake 전이 시각 일치 */
+TEST_F(AebFxTest, TC_AEB_FX_EQ_02_ApproachSequence)
+{
+    AEB_Target_Data_t t{ 1, 80.0f, 0.0f, AEB_TARGET_NORMAL };
+    Ego_Data_t e{ 20.0f };
+    for (int k = 0; k < 390; k++) {
+        AEB_Fx_Target_Data_t tf = toFx(t);
+        AEB_Fx_Ego_Data_t    ef{ fx16_from_float(e.Ego_Velocity_X) };
+        TTC_Data_t d;  TTC_Fx_Data_t df;
+        calculate_ttc_for_aeb(&t, &e, &d);
+        calculate_ttc_for_aeb_fx(&tf, &ef, &df);
+        AEB_Mode_e m  = aeb_mode_selection(&t, &e, &d);
+        ASSERT_EQ(aeb_mode_selection_fx(&tf, &ef, &df), m) << k;
+        EXPECT_NEAR(fx16_to_float(calculate_decel_for_aeb_fx(m, &df)),
+                    calculate_decel_for_aeb(m, &d), DECEL_MAX_ERR + 1e-4f) << k;
+        t.AEB_Target_Distance -= 0.2f;
+    }
+}
+
+/* 0.1 단위 감속 양자화 / 경계 */
+TEST_F(AebFxTest, TC_AEB_FX_BV_01_DecelBoundaries)
+{
+    TTC_Fx_Data_t d{ FX16_C(0.5), FX16_C(2.0), FX16_C(3.2), FX16_C(10.0) };
+    EXPECT_EQ(calculate_decel_for_aeb_fx(AEB_MODE_BRAKE, &d), FX16_C(-7.5));
+    d.TTC = d.TTC_Brake;
+    EXPECT_EQ(calculate_decel_for_aeb_fx(AEB_MODE_BRAKE, &d), 0);
+    d.TTC = FX16_C(2.5);
+    EXPECT_EQ(calculate_decel_for_aeb_fx(AEB_MODE_BRAKE, &d), FX16_C(-2.0));
+    d.TTC = FX16_C(-0.001);
+    EXPECT_EQ(calculate_decel_for_aeb_fx(AEB_MODE_BRAKE, &d), FX16_C(-10.0));
+    d.TTC = FX16_C(-0.01);
+    EXPECT_EQ(calculate_decel_for_aeb_fx(AEB_MODE_BRAKE, &d), 0);
+    EXPECT_EQ(calculate_decel_for_aeb_fx(AEB_MODE_ALERT, &d), 0);
+}
+
+/* 포화 입력(±INF 변환) → TTC 무한대, Normal */
+TEST_F(AebFxTest, TC_AEB_FX_RA_01_SaturatedInputs)
+{
+    AEB_Fx_Target_Data_t tf{ 1, fx16_from_float(INFINITY), 0, AEB_TARGET_NORMAL };
+    AEB_Fx_Ego_Data_t    ef{ FX16_INT(20) };
+    TTC_Fx_Data_t df;
+    calculate_ttc_for_aeb_fx(&tf, &ef, &df);
+    EXPECT_EQ(df.TTC, AEB_FX_TTC_INF);
+    EXPECT_EQ(aeb_mode_selection_fx(&tf, &ef, &df), AEB_MODE_NORMAL);
+
+    ef.Ego_Velocity_X = fx16_from_float(-1.0f);
+    calculate_ttc_for_aeb_fx(&tf, &ef, &df);
+    EXPECT_EQ(df.TTC, AEB_FX_TTC_INF);
+    EXPECT_EQ(df.TTC_Brake, 0);
+    calculate_ttc_for_aeb_fx(nullptr, &ef, &df);   /* crash 없음 */
+}
+
+/* Arbitration : 임의 입력 throttle/brake/steer 일치 */
+TEST_F(AebFxTest, TC_ARB_FX_EQ_01_CrossCheckRandom)
+{
+    float maxErr = 0.0f;
+    for (int i = 0; i < 20000; i++) {
+        float acc = rng.uni(-12.0f, 12.0f), aeb = rng.uni(-11.0f, 0.0f), steer = rng.uni(-600.0f, 600.0f);
+        AEB_Mode_e mode = (AEB_Mode_e)(i % 3);
+        VehicleControl_t    o;
+        VehicleControl_Fx_t of;
+        Arbitration(acc, aeb, steer, mode, &o);
+        Arbitration_fx(fx16_from_float(acc), fx16_from_float(aeb), fx16_from_float(steer), mode, &of);
+        maxErr = std::fmax(maxErr, std::fabs(fx16_to_float(of.throttle) - o.throttle));
+        maxErr = std::fmax(maxErr, std::fabs(fx16_to_float(of.brake) - o.brake));
+        maxErr = std::fmax(maxErr, std::fabs(fx16_to_float(of.steer) - o.steer));
+    }
+    EXPECT_LE(maxErr, ARB_MAX_ERR);
+    Arbitration_fx(0, 0, 0, AEB_MODE_NORMAL, nullptr);
+}
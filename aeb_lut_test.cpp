@@ -0,0 +1,120 @@
+/*********************************************************************
+ * aeb_lut_test.cpp  ―  AEB 모드 표 조회판 교차검증 (분기판 aeb_mode_selection 대비)
+ * DUT : aeb_mode_selection_lut / aeb_mode_selection_batch (mode_table.c)
+ *********************************************************************/
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "aeb.h"
+#include "mode_table.h"
+
+namespace {
+
+const float kNaN = std::numeric_limits<float>::quiet_NaN();
+const float kInf = std::numeric_limits<float>::infinity();
+
+const int   kIds[]   = { -1, 0, 3 };
+const int   kSit[]   = { 0, 1, 2, 5 };
+const float kEgo[]   = { 0.0f, 0.49f, 0.5f, 20.0f, kNaN };
+const float kTtc[]   = { -1.0f, 0.0f, 0.01f, 1.0f, 1.2f, 1.21f, 2.0f, 2.5f, 2.51f, 10.0f,
+                         99998.0f, 99999.0f, kInf, kNaN };
+const float kBrake[] = { 0.0f, 1.2f, 3.0f, kNaN };
+const float kAlert[] = { 0.0f, 2.5f, 1.0f, kNaN };   /* brake > alert 인 역전 조합 포함 */
+
+struct AebCase { AEB_Target_Data_t t; Ego_Data_t e; TTC_Data_t ttc; };
+
+std::vector<AebCase> allCases()
+{
+    std::vector<AebCase> v;
+    for (int id : kIds) for (int si : kSit) for (float ego : kEgo)
+    for (float ttc : kTtc) for (float br : kBrake) for (float al : kAlert) {
+        AebCase c = {};
+        c.t.AEB_Target_ID        = id;
+        c.t.AEB_Target_Situation = (AEB_Target_Situation_e)si;
+        c.e.Ego_Velocity_X       = ego;
+        c.ttc.TTC       = ttc;
+        c.ttc.TTC_Brake = br;
+        c.ttc.TTC_Alert = al;
+        v.push_back(c);
+    }
+    return v;
+}
+
+}  // namespace
+
+/* TC_AEB_LUT_EQ_01 : 경계값 전수 교차 (TTC 0 / brake / alert / 99999 / inf / NaN) → 분기판과 동일 */
+TEST(AebLutTest, TC_AEB_LUT_EQ_01_ExhaustiveBoundaries)
+{
+    for (const AebCase &c : allCases()) {
+        ASSERT_EQ(aeb_mode_selection_lut(&c.t, &c.e, &c.ttc), aeb_mode_selection(&c.t, &c.e, &c.ttc))
+            << "id " << c.t.AEB_Target_ID << " sit " << c.t.AEB_Target_Situation
+            << " ego " << c.e.Ego_Velocity_X << " ttc " << c.ttc.TTC
+            << " brake " << c.ttc.TTC_Brake << " alert " << c.ttc.TTC_Alert;
+    }
+}
+
+/* TC_AEB_LUT_EQ_02 : 배치(SoA) = 스칼라, 4 의 배수가 아닌 길이 (SIMD 본체 + 꼬리) */
+TEST(AebLutTest, TC_AEB_LUT_EQ_02_BatchMatchesScalar)
+{
+    std::vector<AebCase> cs = allCases();
+    for (int n : { 0, 1, 2, 4, 6, 9, (int)cs.size() }) {
+        std::vector<int32_t> id(n), si(n), mode(n, -1);
+        std::vector<float>   ego(n), ttc(n), br(n), al(n);
+        for (int i = 0; i < n; i++) {
+            id[i]  = cs[i].t.AEB_Target_ID;
+            si[i]  = (int32_t)cs[i].t.AEB_Target_Situation;
+            ego[i] = cs[i].e.Ego_Velocity_X;
+            ttc[i] = cs[i].ttc.TTC;
+            br[i]  = cs[i].ttc.TTC_Brake;
+            al[i]  = cs[i].ttc.TTC_Alert;
+        }
+        ASSERT_EQ(aeb_mode_selection_batch(id.data(), si.data(), ego.data(), ttc.data(), br.data(), al.data(),
+                                           n, mode.data()), 0);
+        for (int i = 0; i < n; i++) {
+            ASSERT_EQ(mode[i], (int32_t)aeb_mode_selection(&cs[i].t, &cs[i].e, &cs[i].ttc)) << "n " << n << " i " << i;
+        }
+    }
+}
+
+/* TC_AEB_LUT_BV_01 : TTC 가 brake / alert 경계를 지나며 Brake → Alert → Normal */
+TEST(AebLutTest, TC_AEB_LUT_BV_01_TtcEdges)
+{
+    AEB_Target_Data_t t = {};
+    Ego_Data_t        e = {};
+    TTC_Data_t        c = {};
+    t.AEB_Target_ID  = 2;
+    e.Ego_Velocity_X = 15.0f;
+    c.TTC_Brake = 1.2f;
+    c.TTC_Alert = 2.5f;
+
+    c.TTC = 1.2f;  EXPECT_EQ(aeb_mode_selection_lut(&t, &e, &c), AEB_MODE_BRAKE);
+    c.TTC = 1.21f; EXPECT_EQ(aeb_mode_selection_lut(&t, &e, &c), AEB_MODE_ALERT);
+    c.TTC = 2.5f;  EXPECT_EQ(aeb_mode_selection_lut(&t, &e, &c), AEB_MODE_ALERT);
+    c.TTC = 2.51f; EXPECT_EQ(aeb_mode_selection_lut(&t, &e, &c), AEB_MODE_NORMAL);
+
+    c.TTC = 1.0f;
+    t.AEB_Target_Situation = AEB_TARGET_CUT_IN;  EXPECT_EQ(aeb_mode_selection_lut(&t, &e, &c), AEB_MODE_BRAKE);
+    t.AEB_Target_Situation = AEB_TARGET_CUT_OUT; EXPECT_EQ(aeb_mode_selection_lut(&t, &e, &c), AEB_MODE_NORMAL);
+}
+
+/* TC_AEB_LUT_RA_01 : NULL 인자 → Normal, 배치 인자 오류 → -1 */
+TEST(AebLutTest, TC_AEB_LUT_RA_01_InvalidArgs)
+{
+    AEB_Target_Data_t t = {};
+    Ego_Data_t        e = {};
+    TTC_Data_t        c = {};
+    EXPECT_EQ(aeb_mode_selection_lut(nullptr, &e, &c), AEB_MODE_NORMAL);
+    EXPECT_EQ(aeb_mode_selection_lut(&t, nullptr, &c), AEB_MODE_NORMAL);
+    EXPECT_EQ(aeb_mode_selection_lut(&t, &e, nullptr), AEB_MODE_NORMAL);
+
+    int32_t id = 0, si = 0, mode = -1;
+    float   ego = 10.0f, ttc = 1.0f, br = 1.2f, al = 2.5f;
+    EXPECT_EQ(aeb_mode_selection_batch(&id, &si, &ego, &ttc, &br, &al, -2, &mode), -1);
+    EXPECT_EQ(aeb_mode_selection_batch(&id, &si, &ego, &ttc, nullptr, &al, 1, &mode), -1);
+    EXPECT_EQ(aeb_mode_selection_batch(&id, &si, &ego, &ttc, &br, &al, 1, nullptr), -1);
+    EXPECT_EQ(aeb_mode_selection_batch(nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, nullptr), 0);
+    EXPECT_EQ(mode, -1);
+}
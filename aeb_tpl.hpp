@@ -0,0 +1,75 @@
+/****************************************************************************
+ * aeb_tpl.hpp
+ *
+ * - calculate_ttc_for_aeb (aeb.c) 의 컴파일 타임 구성 템플릿
+ * - TTC_Alert = TTC_Brake + Cfg::AebAlertBufferTime
+ * - 모드 선택 / 감속 계산은 TTC_Data_t 만 사용하므로 C API 그대로 사용
+ ****************************************************************************/
+#ifndef AEB_TPL_HPP
+#define AEB_TPL_HPP
+
+#include <cmath>
+
+#include "adas_config.hpp"
+#include "aeb.h"
+
+namespace adas {
+
+template <class Cfg = DefaultConfig>
+void calculate_ttc_for_aeb(const AEB_Target_Data_t *pAebTargetData,
+                           const Ego_Data_t        *pEgoData,
+                           TTC_Data_t              *pTtcData)
+{
+    static_assert(config_is_valid<Cfg>(), "");
+
+    constexpr float INF_TTC = 99999.0f;             /* aeb.c INF_TTC_F */
+    constexpr float MIN_DIST = 0.01f;               /* aeb.c MIN_DIST_F */
+
+    if (!pAebTargetData || !pEgoData || !pTtcData) {
+        return;
+    }
+
+    pTtcData->TTC            = INF_TTC;
+    pTtcData->TTC_Brake      = 0.0f;
+    pTtcData->TTC_Alert      = 0.0f;
+    pTtcData->Relative_Speed = 0.0f;
+
+    if (!std::isfinite(pEgoData->Ego_Velocity_X) || pEgoData->Ego_Velocity_X < 0.0f) {
+        return;
+    }
+    if (pAebTargetData->AEB_Target_ID < 0 ||
+        pAebTargetData->AEB_Target_Situation == AEB_TARGET_CUT_OUT) {
+        return;
+    }
+
+    float relSpd = pEgoData->Ego_Velocity_X - pAebTargetData->AEB_Target_Velocity_X;
+    if (!std::isfinite(relSpd)) {
+        pTtcData->TTC = NAN;
+        return;
+    }
+    if (relSpd <= 0.0f) {
+        return;
+    }
+    double relSpdR = std::floor(relSpd * 100.0 + 0.5) / 100.0;     /* 0.01 단위 반올림 */
+    if (relSpdR < 1.0e-6) {
+        return;
+    }
+    pTtcData->Relative_Speed = (float)relSpdR;
+
+    float dist = pAebTargetData->AEB_Target_Distance;
+    if (!std::isfinite(dist)) {
+        return;
+    }
+    if (dist < MIN_DIST) dist = MIN_DIST;
+
+    pTtcData->TTC = (float)((double)dist / relSpdR);
+
+    if (pEgoData->Ego_Velocity_X > 0.1f) {
+        pTtcData->TTC_Brake = pEgoData->Ego_Velocity_X / AEB_DEFAULT_MAX_DECEL;
+    }
+    pTtcData->TTC_Alert = pTtcData->TTC_Brake + Cfg::AebAlertBufferTime;
+}
+
+} /* namespace adas */
+
+#endif /* AEB_TPL_HPP */
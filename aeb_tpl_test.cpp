@@ -0,0 +1,60 @@
+/*********************************************************************
+ * aeb_tpl_test.cpp  ―  AEB TTC 구성 템플릿
+ * DUT : adas::calculate_ttc_for_aeb<Cfg>
+ * REF : calculate_ttc_for_aeb (aeb.c)
+ *********************************************************************/
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#include "aeb_tpl.hpp"
+#include "test_rng.hpp"
+
+struct LongAlertConfig : adas::DefaultConfig {
+    static constexpr float AebAlertBufferTime = 2.0f;
+};
+
+/* 기본 인스턴스 == C API (NaN/INF 포함) */
+TEST(AebTplTest, TC_AEB_TPL_EQ_01_DefaultMatchesCApi)
+{
+    TestRng rng(17u);
+    const float special[] = { NAN, INFINITY, -1.0f, 0.0f };
+    for (int i = 0; i < 20000; i++) {
+        AEB_Target_Data_t t{ (i % 19 == 0) ? -1 : 1, rng.uni(0.0f, 200.0f), rng.uni(0.0f, 40.0f),
+                             (AEB_Target_Situation_e)(i % 3) };
+        Ego_Data_t e{ rng.uni(0.0f, 40.0f) };
+        if (i % 101 == 0) t.AEB_Target_Distance   = special[(i / 101) % 4];
+        if (i % 103 == 0) e.Ego_Velocity_X        = special[(i / 103) % 4];
+        TTC_Data_t c, tp;
+        std::memset(&c, 0x5A, sizeof(c));
+        std::memset(&tp, 0x5A, sizeof(tp));
+        calculate_ttc_for_aeb(&t, &e, &c);
+        adas::calculate_ttc_for_aeb<>(&t, &e, &tp);
+        ASSERT_EQ(std::memcmp(&c, &tp, sizeof(c)), 0) << i;
+    }
+}
+
+/* 경보 버퍼 변경 */
+TEST(AebTplTest, TC_AEB_TPL_BV_01_AlertBuffer)
+{
+    AEB_Target_Data_t t{ 1, 60.0f, 0.0f, AEB_TARGET_NORMAL };
+    Ego_Data_t e{ 18.0f };
+    TTC_Data_t d;
+    adas::calculate_ttc_for_aeb<LongAlertConfig>(&t, &e, &d);      /* TTC 3.33 s */
+    EXPECT_FLOAT_EQ(d.TTC_Brake, 2.0f);
+    EXPECT_FLOAT_EQ(d.TTC_Alert, 4.0f);
+    EXPECT_EQ(aeb_mode_selection(&t, &e, &d), AEB_MODE_ALERT);
+
+    adas::calculate_ttc_for_aeb<adas::DefaultConfig>(&t, &e, &d);
+    EXPECT_FLOAT_EQ(d.TTC_Alert, 2.0f + AEB_ALERT_BUFFER_TIME);
+    EXPECT_EQ(aeb_mode_selection(&t, &e, &d), AEB_MODE_NORMAL);
+}
+
+TEST(AebTplTest, TC_AEB_TPL_RA_01_Invalid)
+{
+    Ego_Data_t e{ 10.0f };
+    TTC_Data_t d{};
+    adas::calculate_ttc_for_aeb<LongAlertConfig>(nullptr, &e, &d);   /* crash 없음 */
+    EXPECT_EQ(d.TTC, 0.0f);
+}
@@ -0,0 +1,41 @@
+#include "arbitration_fx.h"
+
+/* 상수 정의 (arbitration.c 와 동일) */
+static const fx16_t MAX_THROTTLE_ACCEL = FX16_INT(10);    /* +10 m/s^2 일 때 throttle=1.0 */
+static const fx16_t MAX_BRAKE_DECEL    = FX16_INT(10);    /* -10 m/s^2 일 때 brake=1.0 (크기) */
+static const fx16_t MAX_STEER_ANGLE    = FX16_INT(540);   /* ±540도 -> steer ±1.0 */
+
+/* ----------------------------------------------------------------------------
+ * Arbitration (고정소수점)
+ *   - AEB Brake 모드면 AEB 감속 우선, 그 외엔 ACC 가속도
+ *   - throttle/brake/steer 정규화 (Q16)
+ * ---------------------------------------------------------------------------*/
+void Arbitration_fx(fx16_t accelAccX,
+                    fx16_t decelAebX,
+                    fx16_t steerLfa,
+                    AEB_Mode_e aebMode,
+                    VehicleControl_Fx_t *pOutControl)
+{
+    if (!pOutControl)
+        return;
+
+    fx16_t selectedAccel = (aebMode == AEB_MODE_BRAKE) ? decelAebX : accelAccX;
+
+    fx16_t throttleCmd = 0;
+    fx16_t brakeCmd    = 0;
+
+    if (selectedAccel > 0)
+    {
+        throttleCmd = fx16_clamp(fx16_div(selectedAccel, MAX_THROTTLE_ACCEL), 0, FX16_ONE);
+    }
+    else if (selectedAccel < 0)
+    {
+        brakeCmd = fx16_clamp(fx16_div(fx16_neg(selectedAccel), MAX_BRAKE_DECEL), 0, FX16_ONE);
+    }
+
+    fx16_t steerRatio = fx16_clamp(fx16_div(steerLfa, MAX_STEER_ANGLE), -FX16_ONE, FX16_ONE);
+
+    pOutControl->throttle = throttleCmd;
+    pOutControl->brake    = brakeCmd;
+    pOutControl->steer    = steerRatio;
+}
@@ -0,0 +1,40 @@
+/****************************************************************************
+ * arbitration_fx.h
+ *
+ * - Arbitration 고정소수점(Q15.16) 구성 : arbitration.c 와 동일 알고리즘
+ *
+ * float 참조(arbitration.c) 대비 오차 : throttle / brake / steer |err| <= 2 LSB (3.1e-5)
+ ****************************************************************************/
+#ifndef ARBITRATION_FX_H
+#define ARBITRATION_FX_H
+
+#include "fixed_point.h"
+#include "aeb.h"      /* AEB_Mode_e */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct
+{
+    fx16_t throttle; /* Q16 (0.0 ~ 1.0) */
+    fx16_t brake;    /* Q16 (0.0 ~ 1.0) */
+    fx16_t steer;    /* Q16 (-1.0 ~ 1.0) */
+} VehicleControl_Fx_t;
+
+/**
+ * @param accelAccX : Q16 ACC 종방향 가속도 (-10~+10) [m/s²]
+ * @param decelAebX : Q16 AEB 종방향 감속도 (-10~0) [m/s²]
+ * @param steerLfa  : Q16 LFA 조향각 (-540~540) [°]
+ */
+void Arbitration_fx(fx16_t accelAccX,
+                    fx16_t decelAebX,
+                    fx16_t steerLfa,
+                    AEB_Mode_e aebMode,
+                    VehicleControl_Fx_t *pOutControl);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ARBITRATION_FX_H */
@@ -0,0 +1,208 @@
+#include <string.h>
+#include "ego_vehicle_estimation_fx.h"
+
+/* 임계값 / 칼만 필터 파라미터 (ego_vehicle_estimation.c 와 동일) */
+#define GPS_VALID_TIME_MS_FX     50                      /* [ms] */
+#define ACCEL_SPIKE_THRESH_FX    FX16_C(3.0)
+#define YAW_SPIKE_THRESH_FX      FX16_C(30.0)
+#define GPS_VEL_SPIKE_THRESH_FX  FX16_C(10.0)
+#define DEFAULT_DT_FX            FX16_C(0.01)            /* Δt <= 0 보정값 [ms] */
+#define Q_PROCESS_FX             FX16_C(0.01)
+#define R_GPS_FX                 FX16_C(0.1)
+#define P_INIT_FX                FX16_INT(100)
+#define DET_MIN_Q31              ((int64_t)2147)         /* 1e-6 × 2^31 */
+
+/*─────────────────────────────
+  내부 유틸
+─────────────────────────────*/
+static inline bool check_spike_fx(fx16_t newVal, fx16_t oldVal, fx16_t threshold)
+{
+    return fx16_abs(fx16_sub(newVal, oldVal)) > threshold;
+}
+
+/* Q32 누산값 → Q16 (반올림 + 포화) */
+static inline fx16_t q32_to_fx16(int64_t acc)
+{
+    return fx16_sat(fx16w_add(acc, FX16_HALF) >> FX16_FRAC_BITS);
+}
+
+/* C = A(Q16) × B(Q47.16)   (rightA != 0 이면 C = B × A^T) */
+static void mat5_mul_w(const fx16_t *A, const fx16w_t *B, int rightA, fx16w_t *C)
+{
+    for (int i = 0; i < 5; i++) {
+        for (int j = 0; j < 5; j++) {
+            fx16w_t sum = 0;
+            for (int k = 0; k < 5; k++) {
+                sum = rightA ? fx16w_add(sum, fx16w_mul(B[i*5 + k], A[j*5 + k]))
+                             : fx16w_add(sum, fx16w_mul(B[k*5 + j], A[i*5 + k]));
+            }
+            C[i*5 + j] = sum;
+        }
+    }
+}
+
+/* 블록 정규화 지수 : |v| >> s < 2^30 */
+static inline int norm_shift(fx16w_t v, int s)
+{
+    uint64_t u = (v < 0) ? (uint64_t)0 - (uint64_t)v : (uint64_t)v;
+    while ((u >> s) >= ((uint64_t)1 << 30)) s++;
+    return s;
+}
+
+/*─────────────────────────────────────────
+  EgoVehicleEstimation_fx()
+  - ego_vehicle_estimation.c 와 동일 단계 (1 ~ 6)
+─────────────────────────────────────────*/
+void EgoVehicleEstimation_fx(const TimeData_Fx_t    *timeData,
+                             const GPSData_Fx_t     *gpsData,
+                             const IMUData_Fx_t     *imuData,
+                             EgoData_Fx_t           *egoData,
+                             EgoVehicleKFState_Fx_t *kfState)
+{
+    if (!timeData || !gpsData || !imuData || !egoData || !kfState) {
+        return;
+    }
+
+    /* 1) 좌표 기준 고정 */
+    egoData->Ego_Position_X = 0;
+    egoData->Ego_Position_Y = 0;
+    egoData->Ego_Position_Z = 0;
+
+    /* 2) GPS 유효성, Δt [ms] (Q16) */
+    int64_t gps_dt = (int64_t)timeData->Current_Time - gpsData->GPS_Timestamp;
+    if (gps_dt < 0) gps_dt = -gps_dt;
+    bool gps_update_enabled = (gps_dt <= GPS_VALID_TIME_MS_FX);
+
+    int64_t dtMs = (int64_t)timeData->Current_Time - kfState->Previous_Update_Time;
+    fx16_t  delta_t = (dtMs <= 0) ? DEFAULT_DT_FX : fx16_sat(dtMs * FX16_ONE);
+    kfState->Previous_Update_Time = timeData->Current_Time;
+
+    /* 3) 스파이크 제거 */
+    fx16_t raw_accel_x = imuData->Linear_Acceleration_X;
+    fx16_t raw_accel_y = imuData->Linear_Acceleration_Y;
+    fx16_t raw_yawRate = imuData->Yaw_Rate;
+    fx16_t raw_gps_vx  = gpsData->GPS_Velocity_X;
+    fx16_t raw_gps_vy  = gpsData->GPS_Velocity_Y;
+
+    if (check_spike_fx(raw_accel_x, kfState->Prev_Accel_X, ACCEL_SPIKE_THRESH_FX)) {
+        raw_accel_x = kfState->Prev_Accel_X;
+    }
+    if (check_spike_fx(raw_accel_y, kfState->Prev_Accel_Y, ACCEL_SPIKE_THRESH_FX)) {
+        raw_accel_y = kfState->Prev_Accel_Y;
+    }
+    if (check_spike_fx(raw_yawRate, kfState->Prev_Yaw_Rate, YAW_SPIKE_THRESH_FX)) {
+        raw_yawRate = kfState->Prev_Yaw_Rate;
+    }
+    if (check_spike_fx(raw_gps_vx, kfState->Prev_GPS_Vel_X, GPS_VEL_SPIKE_THRESH_FX) ||
+        check_spike_fx(raw_gps_vy, kfState->Prev_GPS_Vel_Y, GPS_VEL_SPIKE_THRESH_FX)) {
+        gps_update_enabled = false;
+    }
+
+    kfState->Prev_Accel_X  = raw_accel_x;
+    kfState->Prev_Accel_Y  = raw_accel_y;
+    kfState->Prev_Yaw_Rate = raw_yawRate;
+    if (gps_update_enabled) {
+        kfState->Prev_GPS_Vel_X = raw_gps_vx;
+        kfState->Prev_GPS_Vel_Y = raw_gps_vy;
+    }
+
+    /* 4) 예측 : X_pred = A X + B u,  P_pred = A P A^T + Q */
+    fx16_t X_pred[5];
+    X_pred[0] = fx16_add(kfState->X[0], fx16w_mul_div(delta_t, kfState->X[2], 1000));
+    X_pred[1] = fx16_add(kfState->X[1], fx16w_mul_div(delta_t, kfState->X[3], 1000));
+    X_pred[2] = fx16_add(kfState->X[2], raw_accel_x);
+    X_pred[3] = fx16_add(kfState->X[3], raw_accel_y);
+    X_pred[4] = fx16_add(kfState->X[4], fx16w_mul_div(delta_t, raw_yawRate, 1000));
+
+    const fx16_t A[25] = {
+        FX16_ONE, 0,        delta_t,  0,        0,
+        0,        FX16_ONE, 0,        delta_t,  0,
+        0,        0,        FX16_ONE, 0,        0,
+        0,        0,        0,        FX16_ONE, 0,
+        0,        0,        0,        0,        FX16_ONE
+    };
+    fx16w_t M[25], P_pred[25];
+    mat5_mul_w(A, kfState->P, 0, M);
+    mat5_mul_w(A, M, 1, P_pred);
+    for (int i = 0; i < 5; i++) {
+        P_pred[i*5 + i] = fx16w_add(P_pred[i*5 + i], Q_PROCESS_FX);
+    }
+
+    /* 5) GPS 관측 보정 : H = [I2 0] */
+    if (gps_update_enabled) {
+        fx16_t y_innov[2] = { fx16_sub(raw_gps_vx, X_pred[0]),
+                              fx16_sub(raw_gps_vy, X_pred[1]) };
+        fx16w_t Sw[4] = { fx16w_add(P_pred[0], R_GPS_FX), P_pred[1],
+                          P_pred[5], fx16w_add(P_pred[6], R_GPS_FX) };
+
+        /* S 와 P 의 0/1 열을 공통 지수 sh 로 축소 → 32bit (K 는 스케일 불변) */
+        int sh = 0;
+        for (int i = 0; i < 4; i++) sh = norm_shift(Sw[i], sh);
+        for (int i = 0; i < 5; i++) {
+            sh = norm_shift(P_pred[i*5 + 0], sh);
+            sh = norm_shift(P_pred[i*5 + 1], sh);
+        }
+        int32_t S[4];
+        for (int i = 0; i < 4; i++) S[i] = (int32_t)(Sw[i] >> sh);
+
+        /* det, 분자는 Q32 곱을 1bit 내려 Q31 로 (차 연산 오버플로 방지) */
+        int64_t det    = (((int64_t)S[0] * S[3]) >> 1) - (((int64_t)S[1] * S[2]) >> 1);
+        int64_t detMin = (2 * sh >= 12) ? 1 : (DET_MIN_Q31 >> (2 * sh));
+        if (det < detMin && det > -detMin) {
+            gps_update_enabled = false;
+        } else {
+            /* K = P_pred H^T S^-1 (2x2 역행렬 전개) */
+            fx16_t K_gain[10];
+            for (int i = 0; i < 5; i++) {
+                int64_t p0 = P_pred[i*5 + 0] >> sh;
+                int64_t p1 = P_pred[i*5 + 1] >> sh;
+                int64_t n0 = ((p0 * S[3]) >> 1) - ((p1 * S[2]) >> 1);
+                int64_t n1 = ((p1 * S[0]) >> 1) - ((p0 * S[1]) >> 1);
+                K_gain[i*2 + 0] = fx16_ratio64(n0, det);
+                K_gain[i*2 + 1] = fx16_ratio64(n1, det);
+            }
+
+            for (int i = 0; i < 5; i++) {
+                int64_t corr = (int64_t)K_gain[i*2 + 0] * y_innov[0] +
+                               (int64_t)K_gain[i*2 + 1] * y_innov[1];
+                X_pred[i] = fx16_add(X_pred[i], q32_to_fx16(corr));
+            }
+
+            fx16_t I_KH[25];
+            memset(I_KH, 0, sizeof(I_KH));
+            for (int i = 0; i < 5; i++) {
+                I_KH[i*5 + i] = FX16_ONE;
+            }
+            for (int i = 0; i < 5; i++) {
+                I_KH[i*5 + 0] = fx16_sub(I_KH[i*5 + 0], K_gain[i*2 + 0]);
+                I_KH[i*5 + 1] = fx16_sub(I_KH[i*5 + 1], K_gain[i*2 + 1]);
+            }
+            mat5_mul_w(I_KH, P_pred, 0, kfState->P);
+        }
+    }
+    if (!gps_update_enabled) {
+        memcpy(kfState->P, P_pred, sizeof(P_pred));
+    }
+    kfState->gps_update_enabled = gps_update_enabled;
+
+    /* 6) 상태 갱신 및 출력 */
+    memcpy(kfState->X, X_pred, sizeof(X_pred));
+
+    egoData->Ego_Velocity_X     = kfState->X[0];
+    egoData->Ego_Velocity_Y     = kfState->X[1];
+    egoData->Ego_Acceleration_X = kfState->X[2];
+    egoData->Ego_Acceleration_Y = kfState->X[3];
+    egoData->Ego_Heading        = kfState->X[4];
+}
+
+/*─────────────────────────────
+  초기화 : X = 0, P = 100·I
+─────────────────────────────*/
+void InitEgoVehicleKFState_fx(EgoVehicleKFState_Fx_t *kfState)
+{
+    if (!kfState) return;
+    memset(kfState, 0, sizeof(*kfState));
+    for (int i = 0; i < 5; i++) {
+        kfState->P[i*5 + i] = P_INIT_FX;
+    }
+}
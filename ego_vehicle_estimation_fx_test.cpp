@@ -0,0 +1,141 @@
+/*********************************************************************
+ * ego_vehicle_estimation_fx_test.cpp  ―  Ego KF 고정소수점 교차검증
+ * DUT : EgoVehicleEstimation_fx (ego_vehicle_estimation_fx.c)
+ * REF : EgoVehicleEstimation    (ego_vehicle_estimation.c, float)
+ *
+ * - 합성 입력 : 가감속 + 선회 + GPS 지연/스파이크, 10 ms 루프 60 s
+ * - 기록 입력 : 환경변수 ADAS_FX_REPLAY_CSV=<경로> 지정 시 추가 검증
+ *               (열: time_ms,gps_vx,gps_vy,gps_ts_ms,ax,ay,yaw_rate, '#' 주석 허용)
+ *********************************************************************/
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "ego_vehicle_estimation.h"
+#include "ego_vehicle_estimation_fx.h"
+
+/* ego_vehicle_estimation_fx.h 문서화 오차 */
+static constexpr float VEL_MAX_ERR  = 2e-3f;
+static constexpr float ACC_MAX_ERR  = 2e-2f;
+static constexpr float HDG_MAX_ERR  = 5e-2f;
+static constexpr float VEL_OUTAGE_MAX_ERR = 5e-3f;
+
+struct KfSample {
+    float t, gvx, gvy, gts, ax, ay, yaw;
+};
+
+struct KfErr {
+    float vel = 0.0f, acc = 0.0f, hdg = 0.0f;
+};
+
+/* float / 고정소수점 KF 동시 구동 → 최대 오차 */
+static KfErr runCrossCheck(const std::vector<KfSample> &in)
+{
+    EgoVehicleKFState_t    s;
+    EgoVehicleKFState_Fx_t sf;
+    InitEgoVehicleKFState(&s);
+    InitEgoVehicleKFState_fx(&sf);
+    KfErr err;
+
+    for (const KfSample &k : in) {
+        TimeData_t td{ k.t };
+        GPSData_t  gd{ k.gvx, k.gvy, k.gts };
+        IMUData_t  id{ k.ax, k.ay, k.yaw };
+        EgoData_t  e{};
+        EgoVehicleEstimation(&td, &gd, &id, &e, &s);
+
+        TimeData_Fx_t tf{ (int32_t)std::lround(k.t) };
+        GPSData_Fx_t  gf{ fx16_from_float(k.gvx), fx16_from_float(k.gvy), (int32_t)std::lround(k.gts) };
+        IMUData_Fx_t  imf{ fx16_from_float(k.ax), fx16_from_float(k.ay), fx16_from_float(k.yaw) };
+        EgoData_Fx_t  ef{};
+        EgoVehicleEstimation_fx(&tf, &gf, &imf, &ef, &sf);
+
+        err.vel = std::fmax(err.vel, std::fabs(fx16_to_float(ef.Ego_Velocity_X) - e.Ego_Velocity_X));
+        err.vel = std::fmax(err.vel, std::fabs(fx16_to_float(ef.Ego_Velocity_Y) - e.Ego_Velocity_Y));
+        err.acc = std::fmax(err.acc, std::fabs(fx16_to_float(ef.Ego_Acceleration_X) - e.Ego_Acceleration_X));
+        err.acc = std::fmax(err.acc, std::fabs(fx16_to_float(ef.Ego_Acceleration_Y) - e.Ego_Acceleration_Y));
+        err.hdg = std::fmax(err.hdg, std::fabs(fx16_to_float(ef.Ego_Heading) - e.Ego_Heading));
+    }
+    return err;
+}
+
+/* 합성 주행 : 0→20 m/s 가속, 정현 속도 변동, 선회, 매 50 틱 GPS 지연 */
+static std::vector<KfSample> syntheticDrive(int ticks)
+{
+    std::vector<KfSample> v;
+    for (int k = 1; k <= ticks; k++) {
+        float t   = 10.0f * k;
+        float vx  = (k < 200) ? 0.1f * k : 20.0f + std::sin(0.01f * k);
+        float vy  = 0.1f * std::cos(0.02f * k);
+        float gts = ((k % 50) == 0) ? t - 60.0f : t;
+        float ax  = 0.2f * std::sin(0.01f * k) + (((k % 397) == 0) ? 5.0f : 0.0f);   /* IMU 스파이크 */
+        v.push_back({ t, vx, vy, gts, ax, 0.05f, 3.0f * std::sin(0.003f * k) });
+    }
+    return v;
+}
+
+TEST(EgoVehicleEstimationFxTest, TC_EGO_FX_EQ_01_SyntheticDrive)
+{
+    KfErr e = runCrossCheck(syntheticDrive(6000));
+    EXPECT_LE(e.vel, VEL_MAX_ERR);
+    EXPECT_LE(e.acc, ACC_MAX_ERR);
+    EXPECT_LE(e.hdg, HDG_MAX_ERR);
+}
+
+/* GPS 두절 1 s 후 복귀 */
+TEST(EgoVehicleEstimationFxTest, TC_EGO_FX_BV_01_GpsOutage)
+{
+    std::vector<KfSample> v = syntheticDrive(2000);
+    for (size_t i = 800; i < 900; i++) v[i].gts = 0.0f;
+    KfErr e = runCrossCheck(v);
+    EXPECT_LE(e.vel, VEL_OUTAGE_MAX_ERR);
+    EXPECT_LE(e.acc, ACC_MAX_ERR);
+    EXPECT_LE(e.hdg, HDG_MAX_ERR);
+}
+
+/* 초기화 / 무효 입력 */
+TEST(EgoVehicleEstimationFxTest, TC_EGO_FX_RA_01_InitAndInvalid)
+{
+    EgoVehicleKFState_Fx_t sf;
+    InitEgoVehicleKFState_fx(&sf);
+    EXPECT_EQ(sf.P[0], FX16_INT(100));
+    EXPECT_EQ(sf.P[1], 0);
+    EXPECT_EQ(sf.X[4], 0);
+
+    EgoData_Fx_t ef{};
+    EgoVehicleEstimation_fx(nullptr, nullptr, nullptr, &ef, &sf);   /* crash 없음 */
+    InitEgoVehicleKFState_fx(nullptr);
+}
+
+/* 기록 입력 재생 (ADAS_FX_REPLAY_CSV) */
+TEST(EgoVehicleEstimationFxTest, TC_EGO_FX_RA_02_RecordedReplay)
+{
+    const char *path = std::getenv("ADAS_FX_REPLAY_CSV");
+    if (!path || !*path) {
+        GTEST_SKIP() << "ADAS_FX_REPLAY_CSV=<csv> 로 기록 입력 재생";
+    }
+    FILE *fp = std::fopen(path, "r");
+    ASSERT_NE(fp, nullptr) << path;
+
+    std::vector<KfSample> v;
+    char line[512];
+    while (std::fgets(line, sizeof(line), fp)) {
+        KfSample k;
+        if (line[0] == '#') continue;
+        if (std::sscanf(line, "%f,%f,%f,%f,%f,%f,%f",
+                        &k.t, &k.gvx, &k.gvy, &k.gts, &k.ax, &k.ay, &k.yaw) == 7) {
+            v.push_back(k);
+        }
+    }
+    std::fclose(fp);
+    ASSERT_FALSE(v.empty());
+
+    KfErr e = runCrossCheck(v);
+    RecordProperty("samples", (int)v.size());
+    EXPECT_LE(e.vel, VEL_MAX_ERR);
+    EXPECT_LE(e.acc, ACC_MAX_ERR);
+    EXPECT_LE(e.hdg, HDG_MAX_ERR);
+}
@@ -0,0 +1,291 @@
+#include <string.h>
+#include <stdint.h>
+#include "fast_math.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define FAST_MATH_SSE2 1
+#include <emmintrin.h>
+#endif
+
+/*─────────────────────────────
+  상수
+─────────────────────────────*/
+#define FM_PIO2        1.57079632679489661923f
+#define FM_2OPI        0.63661977236758134308f
+/* π/2 3분할 (Cody-Waite): k*DP1 는 |k| < 2^13 에서 정확 */
+#define FM_DP1         1.5703125f
+#define FM_DP2         4.837512969970703125e-4f
+#define FM_DP3         7.54978995489188216e-8f
+/* 1.5 * 2^23 : 더한 뒤 빼면 최근접 짝수 정수로 반올림 (|v| < 2^22) */
+#define FM_ROUND_MAGIC 12582912.0f
+/* 2^31 : float → int 변환이 정의되는 |k| 상한 (미만) */
+#define FM_INT_LIMIT   2147483648.0f
+
+/* atan : Abramowitz & Stegun 4.4.49, [0,1] 에서 |ε| <= 2e-8 */
+#define AT_A2   -0.3333314528f
+#define AT_A4    0.1999355085f
+#define AT_A6   -0.1420889944f
+#define AT_A8    0.1065626393f
+#define AT_A10  -0.0752896400f
+#define AT_A12   0.0429096138f
+#define AT_A14  -0.0161657367f
+#define AT_A16   0.0028662257f
+
+/* sin/cos : [-π/4, π/4] 최소최대 다항식 (Cephes sinf/cosf 계수) */
+#define SN_S1   -1.6666654611e-1f
+#define SN_S2    8.3321608736e-3f
+#define SN_S3   -1.9515295891e-4f
+#define CS_C1    4.166664568298827e-2f
+#define CS_C2   -1.388731625493765e-3f
+#define CS_C3    2.443315711809948e-5f
+
+/*─────────────────────────────
+  비트 조작 유틸 (분기 없음)
+─────────────────────────────*/
+static inline uint32_t f2u(float f)    { uint32_t u; memcpy(&u, &f, 4); return u; }
+static inline float    u2f(uint32_t u) { float f; memcpy(&f, &u, 4); return f; }
+static inline float    fsel(uint32_t mask, float a, float b)   /* mask ? a : b */
+{
+    return u2f((f2u(a) & mask) | (f2u(b) & ~mask));
+}
+static inline uint32_t fmask(int cond) { return (uint32_t)0 - (uint32_t)(cond != 0); }
+
+/*─────────────────────────────
+  스칼라 커널
+─────────────────────────────*/
+float adas_fast_atanf(float x)
+{
+    uint32_t sign = f2u(x) & 0x80000000u;
+    float    a    = u2f(f2u(x) & 0x7fffffffu);
+    uint32_t inv  = fmask(a > 1.0f);
+    float    t    = fsel(inv, 1.0f / a, a);
+    float    z    = t * t;
+
+    float p = AT_A16;
+    p = p * z + AT_A14;
+    p = p * z + AT_A12;
+    p = p * z + AT_A10;
+    p = p * z + AT_A8;
+    p = p * z + AT_A6;
+    p = p * z + AT_A4;
+    p = p * z + AT_A2;
+    p = t + t * z * p;
+
+    float r = fsel(inv, FM_PIO2 - p, p);
+    return u2f(f2u(r) | sign);
+}
+
+/* x → (r, q) : x = q*π/2 + r, |r| <= π/4
+   - k 가 int 범위 밖 (NaN / ±inf / |x| > ~3.4e9) 이면 float 단계에서 0 으로 대체 후 변환
+     → 정의된 동작, q 하위 2 bit 는 SSE2 cvttps 의 0x80000000 과 같음 (배열 버전과 비트 일치) */
+static inline float reduce_pio2(float x, int *pQ)
+{
+    float k = (x * FM_2OPI + FM_ROUND_MAGIC) - FM_ROUND_MAGIC;
+    *pQ = (int)fsel(fmask(fabsf(k) < FM_INT_LIMIT), k, 0.0f);
+    float r = x - k * FM_DP1;
+    r = r - k * FM_DP2;
+    r = r - k * FM_DP3;
+    return r;
+}
+
+static inline float poly_sin(float r)
+{
+    float z = r * r;
+    float p = SN_S3;
+    p = p * z + SN_S2;
+    p = p * z + SN_S1;
+    return r + r * z * p;
+}
+
+static inline float poly_cos(float r)
+{
+    float z = r * r;
+    float p = CS_C3;
+    p = p * z + CS_C2;
+    p = p * z + CS_C1;
+    return (1.0f - 0.5f * z) + z * z * p;
+}
+
+/* 사분면 q 의 sin 값: q&1 → cos 다항식, q&2 → 부호 반전 */
+static inline float quadrant_sin(float r, int q)
+{
+    float s = poly_sin(r);
+    float c = poly_cos(r);
+    float v = fsel(fmask(q & 1), c, s);
+    return u2f(f2u(v) ^ ((uint32_t)(q & 2) << 30));
+}
+
+float adas_fast_sinf(float x)
+{
+    int q;
+    float r = reduce_pio2(x, &q);
+    return quadrant_sin(r, q);
+}
+
+float adas_fast_cosf(float x)
+{
+    int q;
+    float r = reduce_pio2(x, &q);
+    return quadrant_sin(r, q + 1);
+}
+
+/* |x| > ADAS_WRAP_MAX_ARG (±inf / NaN 포함) : fmodf 로 (-360, 360) 선 축소 (정확, 부호 유지)
+   → 범위 밖 입력도 결과 [-180, 180], ±inf → NaN, NaN 전파 */
+static inline float wrap_pre_reduce(float deg)
+{
+    return (fabsf(deg) <= ADAS_WRAP_MAX_ARG) ? deg : fmodf(deg, 360.0f);
+}
+
+/*
+ * 각도 정규화 : x - 360*round(x/360)  (k*360 및 뺄셈은 정확 → 오차 0)
+ * - x/360 반올림 오차로 k 가 1 어긋난 경우 ±360 보정
+ * - 기존 while 루프와 같은 경계 규칙 유지 (양수 입력 → +180, 음수 입력 → -180)
+ */
+float adas_wrap_deg180(float deg)
+{
+    deg = wrap_pre_reduce(deg);
+    float k = (deg / 360.0f + FM_ROUND_MAGIC) - FM_ROUND_MAGIC;
+    float r = deg - k * 360.0f;
+    r = r - fsel(fmask(r >  180.0f), 360.0f, 0.0f);
+    r = r - fsel(fmask(r < -180.0f), -360.0f, 0.0f);   /* 뺄셈 사용: -0 부호 유지 */
+    r = fsel(fmask((r == -180.0f) & (deg > 0.0f)),  180.0f, r);
+    r = fsel(fmask((r ==  180.0f) & (deg < 0.0f)), -180.0f, r);
+    return r;
+}
+
+/*─────────────────────────────
+  SSE2 커널 (스칼라와 동일 연산 순서)
+─────────────────────────────*/
+#ifdef FAST_MATH_SSE2
+static inline __m128 v_sel(__m128 mask, __m128 a, __m128 b)
+{
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+static inline __m128 v_atan(__m128 x)
+{
+    const __m128 signMask = _mm_castsi128_ps(_mm_set1_epi32((int)0x80000000u));
+    const __m128 one      = _mm_set1_ps(1.0f);
+    __m128 sign = _mm_and_ps(x, signMask);
+    __m128 a    = _mm_andnot_ps(signMask, x);
+    __m128 inv  = _mm_cmpgt_ps(a, one);
+    __m128 t    = v_sel(inv, _mm_div_ps(one, a), a);
+    __m128 z    = _mm_mul_ps(t, t);
+
+    __m128 p = _mm_set1_ps(AT_A16);
+    p = _mm_add_ps(_mm_mul_ps(p, z), _mm_set1_ps(AT_A14));
+    p = _mm_add_ps(_mm_mul_ps(p, z), _mm_set1_ps(AT_A12));
+    p = _mm_add_ps(_mm_mul_ps(p, z), _mm_set1_ps(AT_A10));
+    p = _mm_add_ps(_mm_mul_ps(p, z), _mm_set1_ps(AT_A8));
+    p = _mm_add_ps(_mm_mul_ps(p, z), _mm_set1_ps(AT_A6));
+    p = _mm_add_ps(_mm_mul_ps(p, z), _mm_set1_ps(AT_A4));
+    p = _mm_add_ps(_mm_mul_ps(p, z), _mm_set1_ps(AT_A2));
+    p = _mm_add_ps(t, _mm_mul_ps(_mm_mul_ps(t, z), p));
+
+    __m128 r = v_sel(inv, _mm_sub_ps(_mm_set1_ps(FM_PIO2), p), p);
+    return _mm_or_ps(r, sign);
+}
+
+static inline __m128 v_quadrant_sin(__m128 x, int qOffset)
+{
+    const __m128 magic = _mm_set1_ps(FM_ROUND_MAGIC);
+    __m128  k = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(FM_2OPI)), magic), magic);
+    __m128i q = _mm_add_epi32(_mm_cvttps_epi32(k), _mm_set1_epi32(qOffset));
+    __m128  r = _mm_sub_ps(x, _mm_mul_ps(k, _mm_set1_ps(FM_DP1)));
+    r = _mm_sub_ps(r, _mm_mul_ps(k, _mm_set1_ps(FM_DP2)));
+    r = _mm_sub_ps(r, _mm_mul_ps(k, _mm_set1_ps(FM_DP3)));
+
+    __m128 z = _mm_mul_ps(r, r);
+    __m128 s = _mm_set1_ps(SN_S3);
+    s = _mm_add_ps(_mm_mul_ps(s, z), _mm_set1_ps(SN_S2));
+    s = _mm_add_ps(_mm_mul_ps(s, z), _mm_set1_ps(SN_S1));
+    s = _mm_add_ps(r, _mm_mul_ps(_mm_mul_ps(r, z), s));
+
+    __m128 c = _mm_set1_ps(CS_C3);
+    c = _mm_add_ps(_mm_mul_ps(c, z), _mm_set1_ps(CS_C2));
+    c = _mm_add_ps(_mm_mul_ps(c, z), _mm_set1_ps(CS_C1));
+    c = _mm_add_ps(_mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(_mm_set1_ps(0.5f), z)),
+                   _mm_mul_ps(_mm_mul_ps(z, z), c));
+
+    __m128 odd = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(q, _mm_set1_epi32(1)),
+                                                  _mm_set1_epi32(1)));
+    __m128 v   = v_sel(odd, c, s);
+    __m128 neg = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(q, _mm_set1_epi32(2)), 30));
+    return _mm_xor_ps(v, neg);
+}
+
+static inline __m128 v_wrap(__m128 d)
+{
+    /* 범위 밖 lane 이 있으면 그 lane 만 스칼라 선 축소 (정상 입력에서는 분기 안 탐) */
+    const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+    if (_mm_movemask_ps(_mm_cmpnle_ps(_mm_and_ps(d, absMask), _mm_set1_ps(ADAS_WRAP_MAX_ARG)))) {
+        float t[4];
+        _mm_storeu_ps(t, d);
+        for (int j = 0; j < 4; j++) t[j] = wrap_pre_reduce(t[j]);
+        d = _mm_loadu_ps(t);
+    }
+    const __m128 magic = _mm_set1_ps(FM_ROUND_MAGIC);
+    const __m128 c360  = _mm_set1_ps(360.0f);
+    const __m128 p180  = _mm_set1_ps(180.0f);
+    const __m128 m180  = _mm_set1_ps(-180.0f);
+    const __m128 zero  = _mm_setzero_ps();
+    __m128 k = _mm_sub_ps(_mm_add_ps(_mm_div_ps(d, c360), magic), magic);
+    __m128 r = _mm_sub_ps(d, _mm_mul_ps(k, c360));
+    r = _mm_sub_ps(r, _mm_and_ps(_mm_cmpgt_ps(r, p180), c360));
+    r = _mm_sub_ps(r, _mm_and_ps(_mm_cmplt_ps(r, m180), _mm_set1_ps(-360.0f)));
+    r = v_sel(_mm_and_ps(_mm_cmpeq_ps(r, m180), _mm_cmpgt_ps(d, zero)), p180, r);
+    r = v_sel(_mm_and_ps(_mm_cmpeq_ps(r, p180), _mm_cmplt_ps(d, zero)), m180, r);
+    return r;
+}
+#endif /* FAST_MATH_SSE2 */
+
+/*─────────────────────────────
+  배열 버전
+─────────────────────────────*/
+void adas_fast_atanf_n(const float *pIn, float *pOut, int n)
+{
+    int i = 0;
+    if (!pIn || !pOut) return;
+#ifdef FAST_MATH_SSE2
+    for (; i + 4 <= n; i += 4) {
+        _mm_storeu_ps(pOut + i, v_atan(_mm_loadu_ps(pIn + i)));
+    }
+#endif
+    for (; i < n; i++) pOut[i] = adas_fast_atanf(pIn[i]);
+}
+
+void adas_fast_sinf_n(const float *pIn, float *pOut, int n)
+{
+    int i = 0;
+    if (!pIn || !pOut) return;
+#ifdef FAST_MATH_SSE2
+    for (; i + 4 <= n; i += 4) {
+        _mm_storeu_ps(pOut + i, v_quadrant_sin(_mm_loadu_ps(pIn + i), 0));
+    }
+#endif
+    for (; i < n; i++) pOut[i] = adas_fast_sinf(pIn[i]);
+}
+
+void adas_fast_cosf_n(const float *pIn, float *pOut, int n)
+{
+    int i = 0;
+    if (!pIn || !pOut) return;
+#ifdef FAST_MATH_SSE2
+    for (; i + 4 <= n; i += 4) {
+        _mm_storeu_ps(pOut + i, v_quadrant_sin(_mm_loadu_ps(pIn + i), 1));
+    }
+#endif
+    for (; i < n; i++) pOut[i] = adas_fast_cosf(pIn[i]);
+}
+
+void adas_wrap_deg180_n(const float *pIn, float *pOut, int n)
+{
+    int i = 0;
+    if (!pIn || !pOut) return;
+#ifdef FAST_MATH_SSE2
+    for (; i + 4 <= n; i += 4) {
+        _mm_storeu_ps(pOut + i, v_wrap(_mm_loadu_ps(pIn + i)));
+    }
+#endif
+    for (; i < n; i++) pOut[i] = adas_wrap_deg180(pIn[i]);
+}
@@ -0,0 +1,57 @@
+/****************************************************************************
+ * fast_math.h
+ *
+ * - 제어 Hot-path 용 다항식 근사 삼각함수 (libm 호출 제거)
+ * - 스칼라 / 배열(SIMD, SSE2) 버전 제공, 두 버전은 동일 다항식 → 결과 비트 일치
+ * - 분기 없는 각도 정규화 (±180°)
+ *
+ * 최대 오차 (fast_math_test.cpp 전수/간격 스윕으로 검증, double 기준):
+ *   adas_fast_atanf : |err| <= 2.0e-7 rad   (전 구간, ±INF → ±π/2)
+ *   adas_fast_sinf  : |err| <= 2.5e-7       (|x| <= ADAS_FAST_TRIG_MAX_ARG)
+ *   adas_fast_cosf  : |err| <= 2.5e-7       (|x| <= ADAS_FAST_TRIG_MAX_ARG)
+ *   adas_wrap_deg180: 오차 0 (정확)         (전 구간), 결과 [-180, 180], ±INF / NaN → NaN
+ *                     |x| > ADAS_WRAP_MAX_ARG 는 fmodf 선 축소 경로 (분기, 정상 입력에서 안 탐)
+ *
+ * 빌드 옵션 ADAS_USE_FAST_MATH 정의 시 ADAS_ATANF / ADAS_SINF / ADAS_COSF 매크로와
+ * Heading 정규화가 본 모듈로 연결됨 (미정의 시 libm / 기존 while 루프 그대로 사용)
+ ****************************************************************************/
+#ifndef FAST_MATH_H
+#define FAST_MATH_H
+
+#include <math.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ADAS_FAST_TRIG_MAX_ARG  8192.0f   /* [rad] sin/cos 정확도 보장 범위 */
+#define ADAS_WRAP_MAX_ARG       1.0e6f    /* [°]   각도 정규화 분기 없는 경로 범위 */
+
+/*=== 스칼라 ===*/
+float adas_fast_atanf(float x);
+float adas_fast_sinf(float x);
+float adas_fast_cosf(float x);
+float adas_wrap_deg180(float deg);
+
+/*=== 배열 (SSE2 가능 시 4-lane, 나머지는 스칼라) ===*/
+void adas_fast_atanf_n(const float *pIn, float *pOut, int n);
+void adas_fast_sinf_n(const float *pIn, float *pOut, int n);
+void adas_fast_cosf_n(const float *pIn, float *pOut, int n);
+void adas_wrap_deg180_n(const float *pIn, float *pOut, int n);
+
+/*=== 제어기 연결 매크로 ===*/
+#ifdef ADAS_USE_FAST_MATH
+#define ADAS_ATANF(x)        adas_fast_atanf(x)
+#define ADAS_SINF(x)         adas_fast_sinf(x)
+#define ADAS_COSF(x)         adas_fast_cosf(x)
+#else
+#define ADAS_ATANF(x)        atanf(x)
+#define ADAS_SINF(x)         sinf(x)
+#define ADAS_COSF(x)         cosf(x)
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FAST_MATH_H */
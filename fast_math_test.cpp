@@ -0,0 +1,223 @@
+/*********************************************************************
+ * fast_math_test.cpp  ―  근사 삼각함수 / 각도 정규화 정확도 UT
+ * DUT : adas_fast_atanf / sinf / cosf / wrap_deg180 (+ 배열 버전)
+ *
+ * - 기본 : float 비트 패턴 간격 스윕 (양/음 전 구간)
+ * - 전수 : 환경변수 ADAS_FAST_MATH_EXHAUSTIVE=1 설정 시 모든 float 검사
+ *          (예: ADAS_FAST_MATH_EXHAUSTIVE=1 ./adas_unit_tests --gtest_filter=FastMath*)
+ *********************************************************************/
+#include <gtest/gtest.h>
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "fast_math.h"
+#include "test_rng.hpp"
+
+/* fast_math.h 에 문서화된 최대 오차 */
+static constexpr double ATAN_MAX_ERR = 2.0e-7;
+static constexpr double TRIG_MAX_ERR = 2.5e-7;
+
+static float    u2f(uint32_t u) { float f; std::memcpy(&f, &u, 4); return f; }
+static uint32_t f2u(float f)    { uint32_t u; std::memcpy(&u, &f, 4); return u; }
+
+static bool exhaustive()
+{
+    const char *e = std::getenv("ADAS_FAST_MATH_EXHAUSTIVE");
+    return e && e[0] == '1';
+}
+
+/* [0, maxBits] 양수 비트 패턴과 그 음수를 stride 간격으로 검사 → 최대 절대 오차 */
+template <class Fast, class Ref>
+static double sweep(uint32_t maxBits, uint32_t stride, Fast fast, Ref ref)
+{
+    double maxErr = 0.0;
+    for (uint64_t b = 0; b <= maxBits; b += stride) {
+        for (uint32_t sign = 0; sign <= 1; sign++) {
+            float  x = u2f((uint32_t)b | (sign << 31));
+            double e = std::fabs((double)fast(x) - ref((double)x));
+            if (e > maxErr) maxErr = e;
+        }
+    }
+    return maxErr;
+}
+
+/* 기존 while 루프 (target_selection / lane_selection) */
+static float wrapLoop(float h)
+{
+    while (h >  180.0f) h -= 360.0f;
+    while (h < -180.0f) h += 360.0f;
+    return h;
+}
+
+/* 정확한 기준값: double 로 계산 후 경계 규칙 적용 */
+static double wrapRef(double x)
+{
+    double r = std::fmod(x, 360.0);
+    if (r >  180.0) r -= 360.0;
+    if (r < -180.0) r += 360.0;
+    if (r == -180.0 && x > 0.0) r =  180.0;
+    if (r ==  180.0 && x < 0.0) r = -180.0;
+    return r;
+}
+
+/*******************************************************************
+ * EQ : 대표값
+ ******************************************************************/
+TEST(FastMathTest, TC_FMATH_EQ_01_AtanSpecialValues)
+{
+    EXPECT_EQ(adas_fast_atanf(0.0f), 0.0f);
+    EXPECT_TRUE(std::signbit(adas_fast_atanf(-0.0f)));
+    EXPECT_NEAR(adas_fast_atanf(1.0f),  (float)M_PI / 4.0f, 2e-7f);
+    EXPECT_NEAR(adas_fast_atanf(-1.0f), -(float)M_PI / 4.0f, 2e-7f);
+    EXPECT_NEAR(adas_fast_atanf(INFINITY),  (float)M_PI / 2.0f, 2e-7f);
+    EXPECT_NEAR(adas_fast_atanf(-INFINITY), -(float)M_PI / 2.0f, 2e-7f);
+    EXPECT_TRUE(std::isnan(adas_fast_atanf(NAN)));
+}
+
+TEST(FastMathTest, TC_FMATH_EQ_02_SinCosSpecialValues)
+{
+    EXPECT_EQ(adas_fast_sinf(0.0f), 0.0f);
+    EXPECT_EQ(adas_fast_cosf(0.0f), 1.0f);
+    EXPECT_NEAR(adas_fast_sinf((float)M_PI / 2.0f), 1.0f, 2e-7f);
+    EXPECT_NEAR(adas_fast_cosf((float)M_PI),      -1.0f, 2e-7f);
+    EXPECT_NEAR(adas_fast_sinf(-(float)M_PI / 6.0f), -0.5f, 2e-7f);
+    EXPECT_TRUE(std::isnan(adas_fast_cosf(NAN)));
+    EXPECT_TRUE(std::isnan(adas_fast_sinf(NAN)));
+    EXPECT_TRUE(std::isnan(adas_fast_sinf(INFINITY)));
+    EXPECT_TRUE(std::isnan(adas_fast_cosf(-INFINITY)));
+}
+
+TEST(FastMathTest, TC_FMATH_EQ_03_WrapBoundaryMatchesLoop)
+{
+    const float v[] = { 0.0f, 179.9f, 180.0f, -180.0f, 180.5f, -180.5f, 359.0f,
+                        360.0f, -360.0f, 540.0f, -540.0f, 719.0f, 1234.5f, -987.25f };
+    for (float x : v) {
+        EXPECT_EQ(adas_wrap_deg180(x), wrapLoop(x)) << "x=" << x;
+    }
+    EXPECT_TRUE(std::isnan(adas_wrap_deg180(NAN)));
+}
+
+/*******************************************************************
+ * BV : 간격 스윕 정확도
+ ******************************************************************/
+TEST(FastMathTest, TC_FMATH_BV_01_AtanSweep)
+{
+    double err = sweep(0x7f800000u, 4099u, adas_fast_atanf,
+                       [](double x) { return std::atan(x); });
+    EXPECT_LE(err, ATAN_MAX_ERR);
+}
+
+TEST(FastMathTest, TC_FMATH_BV_02_SinCosSweep)
+{
+    const uint32_t maxBits = f2u(ADAS_FAST_TRIG_MAX_ARG);
+    EXPECT_LE(sweep(maxBits, 4099u, adas_fast_sinf, [](double x) { return std::sin(x); }),
+              TRIG_MAX_ERR);
+    EXPECT_LE(sweep(maxBits, 4099u, adas_fast_cosf, [](double x) { return std::cos(x); }),
+              TRIG_MAX_ERR);
+}
+
+TEST(FastMathTest, TC_FMATH_BV_03_WrapExactSweep)
+{
+    const uint32_t maxBits = f2u(ADAS_WRAP_MAX_ARG);
+    uint64_t bad = 0;
+    for (uint64_t b = 0; b <= maxBits; b += 1021u) {
+        for (uint32_t sign = 0; sign <= 1; sign++) {
+            float x = u2f((uint32_t)b | (sign << 31));
+            float r = adas_wrap_deg180(x);
+            if (r != (float)wrapRef((double)x) || r > 180.0f || r < -180.0f) bad++;
+        }
+    }
+    EXPECT_EQ(bad, 0u);
+}
+
+/* |x| <= 720 에서는 기존 while 루프와 비트 단위 동일 */
+TEST(FastMathTest, TC_FMATH_BV_04_WrapEqualsLoopNearRange)
+{
+    const uint32_t maxBits = f2u(720.0f);
+    uint64_t bad = 0;
+    for (uint64_t b = 0; b <= maxBits; b += 1021u) {
+        for (uint32_t sign = 0; sign <= 1; sign++) {
+            float x = u2f((uint32_t)b | (sign << 31));
+            if (f2u(adas_wrap_deg180(x)) != f2u(wrapLoop(x))) bad++;
+        }
+    }
+    EXPECT_EQ(bad, 0u);
+}
+
+/* |x| > ADAS_WRAP_MAX_ARG : fmodf 선 축소 경로도 정확 + 범위 유지, ±inf → NaN */
+TEST(FastMathTest, TC_FMATH_BV_05_WrapBeyondRange)
+{
+    EXPECT_TRUE(std::isnan(adas_wrap_deg180(INFINITY)));
+    EXPECT_TRUE(std::isnan(adas_wrap_deg180(-INFINITY)));
+    const float v[] = { FLT_MAX, -FLT_MAX, 1.0e7f, -1.0e7f, -3.0e38f, 16777217.0f * 360.0f };
+    for (float x : v) {
+        float r = adas_wrap_deg180(x);
+        EXPECT_EQ(r, (float)wrapRef((double)x)) << "x=" << x;
+        EXPECT_LE(std::fabs(r), 180.0f) << "x=" << x;
+    }
+
+    uint64_t bad = 0;
+    for (uint64_t b = f2u(ADAS_WRAP_MAX_ARG); b < 0x7f800000u; b += 4099u) {
+        for (uint32_t sign = 0; sign <= 1; sign++) {
+            float x = u2f((uint32_t)b | (sign << 31));
+            float r = adas_wrap_deg180(x);
+            if (r != (float)wrapRef((double)x) || r > 180.0f || r < -180.0f) bad++;
+        }
+    }
+    EXPECT_EQ(bad, 0u);
+}
+
+/*******************************************************************
+ * RA : 배열(SIMD) == 스칼라, 전수 검사
+ ******************************************************************/
+TEST(FastMathTest, TC_FMATH_RA_01_BatchMatchesScalarBitwise)
+{
+    std::vector<float> in;
+    TestRng rng(12345u);
+    for (int i = 0; i < 1027; i++) {
+        in.push_back(rng.uni(-1000.0f, 1000.0f));
+    }
+    in.push_back(NAN); in.push_back(INFINITY); in.push_back(-0.0f);
+    in.push_back(180.0f); in.push_back(-180.0f); in.push_back(540.0f);
+    in.push_back(-INFINITY); in.push_back(FLT_MAX); in.push_back(-FLT_MAX);
+    in.push_back(1.0e7f); in.push_back(-3.0e38f); in.push_back(2.5e6f);
+    in.push_back(3.0e9f); in.push_back(-3.5e9f); in.push_back(1.0e12f);   /* k 가 int 범위 경계 / 밖 */
+
+    std::vector<float> out(in.size());
+    const int n = (int)in.size();
+
+    adas_fast_atanf_n(in.data(), out.data(), n);
+    for (int i = 0; i < n; i++) EXPECT_EQ(f2u(out[i]), f2u(adas_fast_atanf(in[i]))) << i;
+    adas_fast_sinf_n(in.data(), out.data(), n);
+    for (int i = 0; i < n; i++) EXPECT_EQ(f2u(out[i]), f2u(adas_fast_sinf(in[i]))) << i;
+    adas_fast_cosf_n(in.data(), out.data(), n);
+    for (int i = 0; i < n; i++) EXPECT_EQ(f2u(out[i]), f2u(adas_fast_cosf(in[i]))) << i;
+    adas_wrap_deg180_n(in.data(), out.data(), n);
+    for (int i = 0; i < n; i++) EXPECT_EQ(f2u(out[i]), f2u(adas_wrap_deg180(in[i]))) << i;
+}
+
+TEST(FastMathTest, TC_FMATH_RA_02_Exhaustive)
+{
+    if (!exhaustive()) {
+        GTEST_SKIP() << "ADAS_FAST_MATH_EXHAUSTIVE=1 로 전수 검사 실행";
+    }
+    EXPECT_LE(sweep(0x7f800000u, 1u, adas_fast_atanf,
+                    [](double x) { return std::atan(x); }), ATAN_MAX_ERR);
+    const uint32_t trigBits = f2u(ADAS_FAST_TRIG_MAX_ARG);
+    EXPECT_LE(sweep(trigBits, 1u, adas_fast_sinf, [](double x) { return std::sin(x); }),
+              TRIG_MAX_ERR);
+    EXPECT_LE(sweep(trigBits, 1u, adas_fast_cosf, [](double x) { return std::cos(x); }),
+              TRIG_MAX_ERR);
+    const uint32_t wrapBits = f2u(ADAS_WRAP_MAX_ARG);
+    uint64_t bad = 0;
+    for (uint64_t b = 0; b <= wrapBits; b++) {
+        float x = u2f((uint32_t)b);
+        if (adas_wrap_deg180(x)  != (float)wrapRef(x))  bad++;
+        if (adas_wrap_deg180(-x) != (float)wrapRef(-x)) bad++;
+    }
+    EXPECT_EQ(bad, 0u);
+}
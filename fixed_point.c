@@ -0,0 +1,98 @@
+#include "fixed_point.h"
+
+/*─────────────────────────────
+  상수 (Q30 내부 연산)
+─────────────────────────────*/
+#define FX_Q30_ONE        ((int64_t)1 << 30)
+#define FX_Q30_PIO2       ((int64_t)1686629713)     /* π/2 × 2^30 */
+#define FX_RAD2DEG_Q16    ((int64_t)3754936)        /* 180/π × 2^16 */
+
+/* atan : Abramowitz & Stegun 4.4.49 계수 (fast_math.c 와 동일), Q30 */
+static const int64_t AT_Q30[8] = {
+    -357911922,     /* -0.3333314528 */
+     214679118,     /*  0.1999355085 */
+    -152566896,     /* -0.1420889944 */
+     114420763,     /*  0.1065626393 */
+     -80841635,     /* -0.0752896400 */
+      46073847,     /*  0.0429096138 */
+     -17357828,     /* -0.0161657367 */
+       3077586      /*  0.0028662257 */
+};
+
+static inline int64_t q30_mul(int64_t a, int64_t b)
+{
+    return (a * b + (FX_Q30_ONE >> 1)) >> 30;
+}
+
+/*─────────────────────────────
+  fx16_atan_deg : atan(x) [°]
+  - |x| > 1 : atan(x) = π/2 - atan(1/x)
+  - 내부 Q30, 결과 Q16 반올림
+─────────────────────────────*/
+fx16_t fx16_atan_deg(fx16_t x)
+{
+    int     neg = (x < 0);
+    int64_t a   = neg ? -(int64_t)x : (int64_t)x;      /* Q16, INT32_MIN 안전 */
+    int     inv = (a > FX16_ONE);
+
+    /* t ∈ [0, 1] (Q30) */
+    int64_t t = inv ? ((((int64_t)1 << 46) + a / 2) / a) : (a << 14);
+    int64_t z = q30_mul(t, t);
+
+    int64_t p = AT_Q30[7];
+    for (int i = 6; i >= 0; i--) {
+        p = q30_mul(p, z) + AT_Q30[i];
+    }
+    int64_t r = t + q30_mul(q30_mul(t, z), p);          /* rad, Q30 */
+    if (inv) r = FX_Q30_PIO2 - r;
+
+    int64_t deg = (r * FX_RAD2DEG_Q16 + (FX_Q30_ONE >> 1)) >> 30;
+    return (fx16_t)(neg ? -deg : deg);
+}
+
+/*─────────────────────────────
+  fx16_ratio64 : num / den → Q16
+  - |num| 을 2^46 이하로 정규화 (num·2^16 이 int64 범위 안)
+  - den 도 같은 양만큼 축소 → 비율 유지
+─────────────────────────────*/
+fx16_t fx16_ratio64(int64_t num, int64_t den)
+{
+    int      neg = ((num < 0) != (den < 0));
+    uint64_t n   = (num < 0) ? (uint64_t)0 - (uint64_t)num : (uint64_t)num;
+    uint64_t d   = (den < 0) ? (uint64_t)0 - (uint64_t)den : (uint64_t)den;
+
+    while (n > ((uint64_t)1 << 46)) {
+        n >>= 1;
+        d >>= 1;
+    }
+    if (d == 0) {
+        return neg ? FX16_MIN : FX16_MAX;
+    }
+
+    uint64_t q = ((n << FX16_FRAC_BITS) + d / 2) / d;
+    if (q > (uint64_t)FX16_MAX) {
+        return neg ? FX16_MIN : FX16_MAX;
+    }
+    return neg ? -(fx16_t)q : (fx16_t)q;
+}
+
+#ifndef ADAS_FX_NO_FLOAT
+/*─────────────────────────────
+  Host 경계 변환
+─────────────────────────────*/
+fx16_t fx16_from_float(float f)
+{
+    if (f != f) {
+        return 0;                               /* NaN */
+    }
+    float s = f * 65536.0f;
+    if (s >=  2147483647.0f) return FX16_MAX;
+    if (s <= -2147483647.0f) return FX16_MIN;
+    return (fx16_t)(s >= 0.0f ? s + 0.5f : s - 0.5f);
+}
+
+float fx16_to_float(fx16_t a)
+{
+    return (float)a * (1.0f / 65536.0f);
+}
+#endif
@@ -0,0 +1,165 @@
+/****************************************************************************
+ * fixed_point.h
+ *
+ * - FPU 없는 ECU 용 고정소수점(Q-format) 기본 연산
+ * - 모든 연산은 정수 전용, 오버플로 시 포화(saturation) — wrap-around 없음
+ *
+ * Q 포맷:
+ *   fx16_t  : Q15.16 (int32)  범위 ±32767.99998, 분해능 1/65536 ≈ 1.53e-5
+ *             거리[m], 속도[m/s], 가속도[m/s²], 시간[s], 각도[°], 무차원 비율
+ *   fx16w_t : Q47.16 (int64)  PID 적분 누산기, KF 공분산 (GPS 두절 시 1e5 이상으로 성장)
+ *   시간    : int32 [ms] (제어루프 시각, 정수)
+ *
+ * fx16_from_float / fx16_to_float 는 Host 경계(시뮬레이터·교차검증) 전용이며,
+ * ADAS_FX_NO_FLOAT 정의 시 제외된다 (ECU 빌드에서 float 유입 방지).
+ ****************************************************************************/
+#ifndef FIXED_POINT_H
+#define FIXED_POINT_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef int32_t fx16_t;    /* Q15.16 */
+typedef int64_t fx16w_t;   /* Q47.16 */
+
+#define FX16_FRAC_BITS  16
+#define FX16_ONE        ((fx16_t)0x00010000)
+#define FX16_HALF       ((fx16_t)0x00008000)
+#define FX16_MAX        ((fx16_t)INT32_MAX)
+#define FX16_MIN        ((fx16_t)(-INT32_MAX))   /* 대칭 범위: 부호 반전 시 오버플로 없음 */
+#define FX16_EPS        ((fx16_t)1)              /* 1 LSB */
+
+/* 컴파일 타임 상수 변환 (상수 폴딩, 런타임 float 연산 없음) */
+#define FX16_C(x)       ((fx16_t)((x) >= 0 ? (x) * 65536.0 + 0.5 : (x) * 65536.0 - 0.5))
+#define FX16_INT(n)     ((fx16_t)((n) * 65536))
+
+/*=== 포화 / 기본 산술 ===*/
+static inline fx16_t fx16_sat(int64_t v)
+{
+    if (v > (int64_t)FX16_MAX) return FX16_MAX;
+    if (v < (int64_t)FX16_MIN) return FX16_MIN;
+    return (fx16_t)v;
+}
+
+static inline fx16_t fx16_add(fx16_t a, fx16_t b) { return fx16_sat((int64_t)a + b); }
+static inline fx16_t fx16_sub(fx16_t a, fx16_t b) { return fx16_sat((int64_t)a - b); }
+static inline fx16_t fx16_neg(fx16_t a)           { return (a == INT32_MIN) ? FX16_MAX : -a; }
+static inline fx16_t fx16_abs(fx16_t a)           { return (a < 0) ? fx16_neg(a) : a; }
+
+static inline fx16_t fx16_clamp(fx16_t v, fx16_t lo, fx16_t hi)
+{
+    if (v > hi) return hi;
+    if (v < lo) return lo;
+    return v;
+}
+
+/* 곱셈 : Q16×Q16 → Q32 → 반올림 후 Q16 */
+static inline fx16_t fx16_mul(fx16_t a, fx16_t b)
+{
+    int64_t p = (int64_t)a * b;
+    return fx16_sat((p + FX16_HALF) >> FX16_FRAC_BITS);
+}
+
+/* 정수 배 (dt[ms] × 값 등) */
+static inline fx16_t fx16_mul_int(fx16_t a, int32_t n)
+{
+    return fx16_sat((int64_t)a * n);
+}
+
+/* 나눗셈 : 반올림(0 에서 먼 쪽), b == 0 → 부호에 따라 포화 */
+static inline fx16_t fx16_div(fx16_t a, fx16_t b)
+{
+    if (b == 0) {
+        return (a >= 0) ? FX16_MAX : FX16_MIN;
+    }
+    int64_t n = (int64_t)a * FX16_ONE;
+    int64_t h = (b > 0 ? (int64_t)b : -(int64_t)b) / 2;
+    n += (n >= 0) ? h : -h;                     /* |n| 쪽으로 반 LSB */
+    return fx16_sat(n / b);
+}
+
+/* 정수로 나눔 (÷1000 [ms→s] 등), 반올림 */
+static inline fx16_t fx16_div_int(fx16_t a, int32_t n)
+{
+    if (n == 0) {
+        return (a >= 0) ? FX16_MAX : FX16_MIN;
+    }
+    int64_t h = (n > 0 ? (int64_t)n : -(int64_t)n) / 2;
+    int64_t v = (int64_t)a + ((a >= 0) ? h : -h);
+    return fx16_sat(v / n);
+}
+
+/* 반올림 정수 변환 */
+static inline int32_t fx16_round_int(fx16_t a)
+{
+    return (a >= 0) ? (int32_t)(((int64_t)a + FX16_HALF) >> FX16_FRAC_BITS)
+                    : -(int32_t)(((int64_t)-a + FX16_HALF) >> FX16_FRAC_BITS);
+}
+
+/* 누산기 → Q16 (포화) */
+static inline fx16_t fx16w_to_fx16(fx16w_t a) { return fx16_sat(a); }
+
+/* 누산기 가산 (int64 범위 포화) */
+static inline fx16w_t fx16w_add(fx16w_t a, int64_t b)
+{
+    if (b > 0 && a > INT64_MAX - b) return INT64_MAX;
+    if (b < 0 && a < INT64_MIN - b) return INT64_MIN;
+    return a + b;
+}
+
+/* 누산기 × 게인 / n → Q16 (n : 단위 환산, 예 [ms]→[s] 는 1000), 반올림 + 포화 */
+static inline fx16_t fx16w_mul_div(fx16w_t a, fx16_t k, int32_t n)
+{
+    int64_t d  = (int64_t)n << FX16_FRAC_BITS;
+    int64_t ak = (k < 0) ? -(int64_t)k : (int64_t)k;
+    if (d <= 0) {
+        return 0;
+    }
+    if (ak != 0 && (a > (INT64_MAX / 2) / ak || a < -((INT64_MAX / 2) / ak))) {
+        return ((a > 0) == (k > 0)) ? FX16_MAX : FX16_MIN;   /* a·k 오버플로 → 포화 */
+    }
+    int64_t p = a * k;                              /* Q32 */
+    p += (p >= 0) ? d / 2 : -(d / 2);
+    return fx16_sat(p / d);
+}
+
+/* 누산기 × Q16 → Q47.16 (64bit 분할 곱, 반올림 + int64 포화) */
+static inline fx16w_t fx16w_mul(fx16w_t a, fx16_t k)
+{
+    int      neg = ((a < 0) != (k < 0));
+    uint64_t ua  = (a < 0) ? (uint64_t)0 - (uint64_t)a : (uint64_t)a;
+    uint64_t uk  = (k < 0) ? (uint64_t)0 - (uint64_t)(int64_t)k : (uint64_t)k;
+    uint64_t hi  = (ua >> 32) * uk;                 /* < 2^63 */
+    uint64_t lo  = (ua & 0xFFFFFFFFu) * uk;         /* < 2^63 */
+    if (hi > ((uint64_t)INT64_MAX >> FX16_FRAC_BITS)) {
+        return neg ? -INT64_MAX : INT64_MAX;
+    }
+    uint64_t r = (hi << FX16_FRAC_BITS) + ((lo + FX16_HALF) >> FX16_FRAC_BITS);
+    if (r > (uint64_t)INT64_MAX) {
+        return neg ? -INT64_MAX : INT64_MAX;
+    }
+    return neg ? -(int64_t)r : (int64_t)r;
+}
+
+/*=== 비선형 (fixed_point.c) ===*/
+
+/* atan(x) [°] : A&S 4.4.49 다항식, |err| <= 2e-3° (전 구간) */
+fx16_t fx16_atan_deg(fx16_t x);
+
+/* 64bit 분자/분모 비율 → Q16 (분자 정규화로 오버플로 방지), den == 0 → 포화 */
+fx16_t fx16_ratio64(int64_t num, int64_t den);
+
+/*=== Host 경계 변환 ===*/
+#ifndef ADAS_FX_NO_FLOAT
+fx16_t fx16_from_float(float f);    /* NaN → 0, ±INF/범위 초과 → 포화 */
+float  fx16_to_float(fx16_t a);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FIXED_POINT_H */
@@ -0,0 +1,114 @@
+/*********************************************************************
+ * fixed_point_test.cpp  ―  Q15.16 기본 연산 UT
+ * DUT : fixed_point.h / fixed_point.c
+ *********************************************************************/
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdint>
+
+#include "fixed_point.h"
+#include "test_rng.hpp"
+
+static constexpr double LSB = 1.0 / 65536.0;
+
+static double toD(fx16_t a) { return (double)a * LSB; }
+
+/*******************************************************************
+ * EQ : 기본 산술 / 반올림
+ ******************************************************************/
+TEST(FixedPointTest, TC_FXP_EQ_01_Constants)
+{
+    EXPECT_EQ(FX16_C(1.0), FX16_ONE);
+    EXPECT_EQ(FX16_C(-2.5), -163840);
+    EXPECT_EQ(FX16_INT(540), 540 * 65536);
+    EXPECT_EQ(FX16_C(0.1), 6554);        /* 6553.6 → 반올림 */
+    EXPECT_EQ(FX16_C(-0.1), -6554);
+}
+
+TEST(FixedPointTest, TC_FXP_EQ_02_MulDivRounding)
+{
+    EXPECT_EQ(fx16_mul(FX16_C(1.5), FX16_C(-2.0)), FX16_C(-3.0));
+    EXPECT_EQ(fx16_div(FX16_INT(1), FX16_INT(3)), 21845);      /* 21845.33 */
+    EXPECT_EQ(fx16_div(FX16_INT(2), FX16_INT(3)), 43691);      /* 43690.67 */
+    EXPECT_EQ(fx16_div(FX16_INT(-2), FX16_INT(3)), -43691);
+    EXPECT_EQ(fx16_div_int(FX16_INT(10), 1000), 655);          /* 655.36 */
+    EXPECT_EQ(fx16_div_int(-FX16_INT(10), 1000), -655);
+    EXPECT_EQ(fx16_round_int(FX16_C(2.5)), 3);
+    EXPECT_EQ(fx16_round_int(FX16_C(-2.5)), -3);
+}
+
+TEST(FixedPointTest, TC_FXP_EQ_03_FloatBoundary)
+{
+    EXPECT_EQ(fx16_from_float(1.25f), FX16_C(1.25));
+    EXPECT_EQ(fx16_from_float(NAN), 0);
+    EXPECT_EQ(fx16_from_float(INFINITY), FX16_MAX);
+    EXPECT_EQ(fx16_from_float(-INFINITY), FX16_MIN);
+    EXPECT_FLOAT_EQ(fx16_to_float(FX16_C(-3.75)), -3.75f);
+}
+
+/*******************************************************************
+ * BV : 포화
+ ******************************************************************/
+TEST(FixedPointTest, TC_FXP_BV_01_Saturation)
+{
+    EXPECT_EQ(fx16_add(FX16_MAX, FX16_ONE), FX16_MAX);
+    EXPECT_EQ(fx16_sub(FX16_MIN, FX16_ONE), FX16_MIN);
+    EXPECT_EQ(fx16_mul(FX16_INT(30000), FX16_INT(2)), FX16_MAX);
+    EXPECT_EQ(fx16_mul(FX16_INT(30000), FX16_INT(-2)), FX16_MIN);
+    EXPECT_EQ(fx16_div(FX16_ONE, 0), FX16_MAX);
+    EXPECT_EQ(fx16_div(-FX16_ONE, 0), FX16_MIN);
+    EXPECT_EQ(fx16_div(FX16_INT(1000), FX16_C(0.001)), FX16_MAX);
+    EXPECT_EQ(fx16_neg(INT32_MIN), FX16_MAX);
+    EXPECT_EQ(fx16w_add(INT64_MAX - 1, 10), INT64_MAX);
+    EXPECT_EQ(fx16w_mul_div(INT64_MAX / 4, FX16_ONE, 1), FX16_MAX);
+}
+
+/* 64bit 비율 : 큰 분자에서도 정규화 후 정확 */
+TEST(FixedPointTest, TC_FXP_BV_02_Ratio64)
+{
+    EXPECT_EQ(fx16_ratio64(1, 3), 21845);
+    EXPECT_EQ(fx16_ratio64(-1, 3), -21845);
+    EXPECT_EQ(fx16_ratio64(5, 0), FX16_MAX);
+    int64_t big = (int64_t)1 << 60;
+    EXPECT_NEAR(toD(fx16_ratio64(big, big / 7 * 2)), 3.5, 1e-4);
+    EXPECT_NEAR(toD(fx16_ratio64(-big, big)), -1.0, LSB);
+}
+
+/* atan [°] : ±10⁴ 스윕, 문서화 오차 이내 */
+TEST(FixedPointTest, TC_FXP_BV_03_AtanDegSweep)
+{
+    double maxErr = 0.0;
+    for (int64_t raw = -((int64_t)10000 << 16); raw <= ((int64_t)10000 << 16); raw += 9973) {
+        fx16_t x   = (fx16_t)raw;
+        double ref = std::atan(toD(x)) * 180.0 / M_PI;
+        double err = std::fabs(toD(fx16_atan_deg(x)) - ref);
+        if (err > maxErr) maxErr = err;
+    }
+    EXPECT_LE(maxErr, 2e-3);
+    EXPECT_EQ(fx16_atan_deg(0), 0);
+    EXPECT_NEAR(toD(fx16_atan_deg(FX16_ONE)), 45.0, 2 * LSB);
+    EXPECT_NEAR(toD(fx16_atan_deg(FX16_MAX)), 90.0, 2e-3);
+    EXPECT_NEAR(toD(fx16_atan_deg(INT32_MIN)), -90.0, 2e-3);
+}
+
+/*******************************************************************
+ * RA : 임의 입력 곱/나눗셈 오차 ≤ 0.5 LSB (정확 반올림)
+ ******************************************************************/
+TEST(FixedPointTest, TC_FXP_RA_01_RandomMulDiv)
+{
+    TestRng rng(2024u);
+    auto rnd = [&rng]() { return (int32_t)(rng.next() >> 8) - (1 << 23); };
+    for (int i = 0; i < 20000; i++) {
+        fx16_t a = rnd() * 16, b = rnd();
+        double m = toD(a) * toD(b);
+        if (std::fabs(m) < 32000.0) {
+            EXPECT_LE(std::fabs(toD(fx16_mul(a, b)) - m), 0.5 * LSB + 1e-12);
+        }
+        if (b != 0) {
+            double q = toD(a) / toD(b);
+            if (std::fabs(q) < 32000.0) {
+                EXPECT_LE(std::fabs(toD(fx16_div(a, b)) - q), 0.5 * LSB + 1e-12);
+            }
+        }
+    }
+}
@@ -0,0 +1,463 @@
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "golden_trace.h"
+
+#define GOLDEN_HASH_PRIME   0x100000001b3ull        /* FNV-1a 64 */
+#define GOLDEN_READ_CHUNK   256                     /* 기록 파일 읽기 단위 [레코드] */
+
+/* 기록 파일 헤더 */
+typedef struct {
+    uint32_t Magic;
+    uint32_t Version;
+    uint32_t Record_Size;                           /* sizeof(AdasPipelineInput_t) */
+    uint32_t Reserved;
+    uint64_t Count;
+} GoldenInputHeader_t;
+
+enum {
+    SCENE_LEAD = 0,         /* 동일 차로 선행차 */
+    SCENE_LEAD2,
+    SCENE_CUTIN,            /* 옆 차로 → 끼어들기 */
+    SCENE_STOPPED,          /* 정지 차량 */
+    SCENE_PEDESTRIAN,       /* 횡단 보행자 */
+    SCENE_ONCOMING,         /* 반대 차로 */
+    SCENE_KIND_COUNT
+};
+
+/*─────────────────────────────
+  난수 / 해시 유틸
+─────────────────────────────*/
+static uint32_t rng_next(uint32_t *s)
+{
+    *s = *s * 1664525u + 1013904223u;
+    return *s;
+}
+
+static float uni(GoldenScene_t *sc, float lo, float hi)
+{
+    return lo + (hi - lo) * (float)(rng_next(&sc->Rng) >> 8) / 16777216.0f;
+}
+
+static uint64_t mix_word(uint64_t h, uint64_t w)
+{
+    return (h ^ w) * GOLDEN_HASH_PRIME;
+}
+
+static uint64_t mix_float(uint64_t h, float x, float tol)
+{
+    if (tol > 0.0f) {
+        if (!isfinite(x)) {
+            return mix_word(h, isnan(x) ? 0x7FF8000000000001ull
+                                        : (x > 0.0f ? 0x7FF0000000000001ull : 0xFFF0000000000001ull));
+        }
+        return mix_word(h, (uint64_t)llround((double)x / (double)tol));
+    }
+
+    uint32_t bits;
+    if (isnan(x)) {
+        bits = 0x7FC00000u;                 /* NaN 페이로드 정규화 */
+    } else {
+        memcpy(&bits, &x, sizeof(bits));
+    }
+    return mix_word(h, (uint64_t)bits);
+}
+
+/*─────────────────────────────
+  샤드 구간
+─────────────────────────────*/
+int golden_trace_shard_range(const GoldenTraceConfig_t *pCfg, int shard,
+                             int64_t *pBegin, int64_t *pEnd)
+{
+    if (!pCfg || !pBegin || !pEnd) return -1;
+    if (pCfg->Ticks <= 0 || pCfg->Shards <= 0 || pCfg->Shards > GOLDEN_TRACE_MAX_SHARDS) return -1;
+    if (shard < 0 || shard >= pCfg->Shards) return -1;
+
+    *pBegin = pCfg->Ticks * (int64_t)shard / pCfg->Shards;
+    *pEnd   = pCfg->Ticks * (int64_t)(shard + 1) / pCfg->Shards;
+    return 0;
+}
+
+/*─────────────────────────────
+  합성 시나리오
+─────────────────────────────*/
+static void spawn_object(GoldenScene_t *sc, int i)
+{
+    ObjectData_t *o = &sc->Obj[i];
+    int kind = (int)(rng_next(&sc->Rng) >> 16) % SCENE_KIND_COUNT;
+    float side = ((rng_next(&sc->Rng) >> 16) & 1u) ? 1.0f : -1.0f;
+
+    memset(o, 0, sizeof(*o));
+    o->Object_ID     = sc->Next_Id++;
+    o->Object_Type   = OBJTYPE_CAR;
+    o->Object_Status = OBJSTAT_MOVING;
+
+    switch (kind) {
+    case SCENE_LEAD:
+    case SCENE_LEAD2:
+        o->Position_X = uni(sc, 20.0f, 180.0f);
+        o->Position_Y = uni(sc, -0.5f, 0.5f);
+        o->Velocity_X = sc->Ego_Velocity * uni(sc, 0.6f, 1.1f);
+        o->Heading    = uni(sc, -3.0f, 3.0f);
+        if (kind == SCENE_LEAD2) o->Object_Type = OBJTYPE_MOTORCYCLE;
+        break;
+    case SCENE_CUTIN:
+        o->Position_X = uni(sc, 15.0f, 80.0f);
+        o->Position_Y = side * uni(sc, 2.5f, 4.0f);
+        o->Velocity_X = sc->Ego_Velocity * uni(sc, 0.8f, 1.0f);
+        o->Velocity_Y = -side * uni(sc, 0.3f, 1.2f);
+        o->Heading    = -side * uni(sc, 2.0f, 8.0f);
+        break;
+    case SCENE_STOPPED:
+        o->Position_X    = uni(sc, 60.0f, 200.0f);
+        o->Position_Y    = uni(sc, -0.3f, 0.3f);
+        o->Object_Status = OBJSTAT_STOPPED;
+        break;
+    case SCENE_PEDESTRIAN:
+        o->Object_Type = OBJTYPE_PEDESTRIAN;
+        o->Position_X  = uni(sc, 10.0f, 60.0f);
+        o->Position_Y  = side * uni(sc, 3.0f, 6.0f);
+        o->Velocity_Y  = -side * uni(sc, 0.8f, 1.6f);
+        o->Heading     = -side * 90.0f;
+        break;
+    default: /* SCENE_ONCOMING */
+        o->Position_X    = uni(sc, 100.0f, 200.0f);
+        o->Position_Y    = -3.5f + uni(sc, -0.3f, 0.3f);
+        o->Velocity_X    = -uni(sc, 10.0f, 25.0f);
+        o->Heading       = 180.0f;
+        o->Object_Status = OBJSTAT_ONCOMING;
+        break;
+    }
+    o->Distance  = sqrtf(o->Position_X * o->Position_X + o->Position_Y * o->Position_Y);
+    sc->Obj_Kind[i] = (uint8_t)kind;
+}
+
+static void next_lane_segment(GoldenScene_t *sc)
+{
+    sc->Lane_Curvature = sc->Next_Lane_Curvature;
+    sc->Lane_Type      = (sc->Lane_Curvature > 0.0f) ? LANE_TYPE_CURVE : LANE_TYPE_STRAIGHT;
+    sc->Next_Lane_Curvature = ((rng_next(&sc->Rng) >> 16) % 3u == 0u) ? 0.0f : uni(sc, 150.0f, 1500.0f);
+    sc->Lane_Segment_Left   = (int32_t)uni(sc, 300.0f, 1500.0f);
+}
+
+void golden_scene_init(GoldenScene_t *pScene, uint64_t seed, int shard)
+{
+    if (!pScene) return;
+
+    memset(pScene, 0, sizeof(*pScene));
+    uint64_t s = (seed ^ ((uint64_t)(uint32_t)shard * 0x9E3779B97F4A7C15ull)) * GOLDEN_HASH_PRIME;
+    pScene->Rng             = (uint32_t)(s ^ (s >> 32)) | 1u;
+    pScene->Ego_Velocity    = 0.0f;                 /* 정지 출발 (GPS 스파이크 필터 기준값 0) */
+    pScene->Target_Velocity = uni(pScene, 5.0f, 30.0f);
+    pScene->Gps_Velocity    = pScene->Ego_Velocity;
+    pScene->Lane_Phase      = uni(pScene, 0.0f, 6.2831853f);
+    pScene->Next_Id         = 1;
+    next_lane_segment(pScene);
+    next_lane_segment(pScene);
+    for (int i = 0; i < GOLDEN_SCENE_OBJECTS; i++) {
+        spawn_object(pScene, i);
+    }
+}
+
+void golden_scene_next(GoldenScene_t *pScene, AdasPipelineInput_t *pIn)
+{
+    if (!pScene || !pIn) return;
+
+    GoldenScene_t *sc = pScene;
+    const float dt    = ADAS_PIPELINE_DT;
+    const float nowMs = 10.0f * (float)sc->Tick++;     /* 샤드 시작 기준 (float 정밀도) */
+
+    /* Ego 속도 프로파일 (가끔 정지 목표) */
+    if ((rng_next(&sc->Rng) >> 16) % 500u == 0u) {
+        sc->Target_Velocity = ((rng_next(&sc->Rng) >> 16) % 8u == 0u) ? 0.0f : uni(sc, 3.0f, 32.0f);
+    }
+    float accel = (sc->Target_Velocity - sc->Ego_Velocity) * 0.5f;
+    if (accel >  2.0f) accel =  2.0f;
+    if (accel < -3.0f) accel = -3.0f;
+    sc->Ego_Velocity += accel * dt;
+    if (sc->Ego_Velocity < 0.0f) sc->Ego_Velocity = 0.0f;
+
+    /* 차선 */
+    if (--sc->Lane_Segment_Left <= 0) {
+        next_lane_segment(sc);
+    }
+    sc->Lane_Phase += 0.002f;
+    if (sc->Lane_Phase > 6.2831853f) sc->Lane_Phase -= 6.2831853f;
+    sc->Lane_Offset = 0.4f * sinf(sc->Lane_Phase) + uni(sc, -0.02f, 0.02f);
+
+    float yawRate = 0.0f;
+    if (sc->Lane_Type == LANE_TYPE_CURVE && sc->Lane_Curvature > 1.0f) {
+        yawRate = sc->Ego_Velocity / sc->Lane_Curvature * 57.29578f;
+    }
+
+    memset(pIn, 0, sizeof(*pIn));
+    pIn->Time.Current_Time = nowMs;
+
+    /* GPS (가끔 20 틱 미갱신) */
+    if (sc->Gps_Outage_Left > 0) {
+        sc->Gps_Outage_Left--;
+    } else {
+        if ((rng_next(&sc->Rng) >> 16) % 2000u == 0u) {
+            sc->Gps_Outage_Left = 20;
+        }
+        sc->Gps_Velocity  = sc->Ego_Velocity + uni(sc, -0.05f, 0.05f);
+        sc->Gps_Timestamp = nowMs;
+    }
+    pIn->Gps.GPS_Velocity_X = sc->Gps_Velocity;
+    pIn->Gps.GPS_Velocity_Y = 0.0f;
+    pIn->Gps.GPS_Timestamp  = sc->Gps_Timestamp;
+
+    /* 추정기 예측식 X[ax] += u (가속도 증분 입력) 에 맞춰 틱 간 가속도 변화량으로 생성 */
+    pIn->Imu.Linear_Acceleration_X = (accel - sc->Prev_Accel) + uni(sc, -0.01f, 0.01f);
+    pIn->Imu.Linear_Acceleration_Y = uni(sc, -0.01f, 0.01f);
+    sc->Prev_Accel = accel;
+    pIn->Imu.Yaw_Rate              = yawRate + uni(sc, -0.2f, 0.2f);
+
+    pIn->Lane.Lane_Type           = sc->Lane_Type;
+    pIn->Lane.Lane_Curvature      = sc->Lane_Curvature;
+    pIn->Lane.Next_Lane_Curvature = sc->Next_Lane_Curvature;
+    pIn->Lane.Lane_Offset         = sc->Lane_Offset;
+    pIn->Lane.Lane_Heading        = 2.0f * cosf(sc->Lane_Phase);
+    pIn->Lane.Lane_Width          = 3.5f;
+    pIn->Lane.Lane_Change_Status  = (fabsf(sc->Lane_Offset) > 0.38f) ? LANE_CHANGE_CHANGING
+                                                                      : LANE_CHANGE_KEEP;
+
+    /* 객체 이동 / 재생성 */
+    for (int i = 0; i < GOLDEN_SCENE_OBJECTS; i++) {
+        ObjectData_t *o = &sc->Obj[i];
+        o->Position_X += (o->Velocity_X - sc->Ego_Velocity) * dt;
+        o->Position_Y += o->Velocity_Y * dt;
+        if (sc->Obj_Kind[i] == SCENE_CUTIN && fabsf(o->Position_Y) < 0.3f) {
+            o->Velocity_Y = 0.0f;
+            o->Heading    = 0.0f;
+        }
+        if (o->Position_X < -5.0f || o->Position_X > 220.0f || fabsf(o->Position_Y) > 8.0f) {
+            spawn_object(sc, i);
+        }
+        o->Distance = sqrtf(o->Position_X * o->Position_X + o->Position_Y * o->Position_Y);
+    }
+    pIn->Obj_Count = GOLDEN_SCENE_OBJECTS;
+    memcpy(pIn->Obj, sc->Obj, sizeof(sc->Obj));
+}
+
+/*─────────────────────────────
+  해시
+─────────────────────────────*/
+uint64_t golden_trace_hash_output(uint64_t hash, const AdasPipelineOutput_t *pOut, float tolerance)
+{
+    if (!pOut) return hash;
+
+    uint64_t h = hash;
+    h = mix_word(h, ((uint64_t)(uint32_t)pOut->Acc_Target_ID << 32) | (uint32_t)pOut->Aeb_Target_ID);
+    h = mix_word(h, ((uint64_t)(uint32_t)pOut->Filtered_Count << 32) |
+                    ((uint64_t)(uint8_t)pOut->Acc_Mode << 16) |
+                    ((uint64_t)(uint8_t)pOut->Aeb_Mode << 8) | (uint8_t)pOut->Lfa_Mode);
+    h = mix_word(h, ((uint64_t)pOut->Ls.LS_Lane_Type << 8) |
+                    ((uint64_t)pOut->Ls.LS_Is_Curved_Lane << 4) |
+                    ((uint64_t)pOut->Ls.LS_Curve_Transition_Flag << 3) |
+                    ((uint64_t)pOut->Ls.LS_Is_Within_Lane << 2) |
+                    ((uint64_t)pOut->Ls.LS_Is_Changing_Lane << 1));
+
+    h = mix_float(h, pOut->Ego.Ego_Velocity_X,     tolerance);
+    h = mix_float(h, pOut->Ego.Ego_Velocity_Y,     tolerance);
+    h = mix_float(h, pOut->Ego.Ego_Acceleration_X, tolerance);
+    h = mix_float(h, pOut->Ego.Ego_Heading,        tolerance);
+    h = mix_float(h, pOut->Ego.Ego_Yaw_Rate,       tolerance);
+    h = mix_float(h, pOut->Ls.LS_Heading_Error,    tolerance);
+    h = mix_float(h, pOut->Ls.LS_Lane_Offset,      tolerance);
+    h = mix_float(h, pOut->Accel_Acc,              tolerance);
+    h = mix_float(h, pOut->Ttc,                    tolerance);
+    h = mix_float(h, pOut->Decel_Aeb,              tolerance);
+    h = mix_float(h, pOut->Steer_Lfa,              tolerance);
+    h = mix_float(h, pOut->Throttle,               tolerance);
+    h = mix_float(h, pOut->Brake,                  tolerance);
+    h = mix_float(h, pOut->Steer,                  tolerance);
+    return h;
+}
+
+uint64_t golden_trace_combine(const uint64_t *pShardHashes, int count)
+{
+    uint64_t h = GOLDEN_TRACE_HASH_INIT;
+    if (!pShardHashes) return h;
+    for (int i = 0; i < count; i++) {
+        h = mix_word(h, pShardHashes[i]);
+    }
+    return h;
+}
+
+/*─────────────────────────────
+  샤드 실행
+─────────────────────────────*/
+static FILE *open_input(const char *path, const GoldenTraceConfig_t *pCfg)
+{
+    FILE *fp = fopen(path, "rb");
+    if (!fp) return NULL;
+
+    GoldenInputHeader_t hdr;
+    if (fread(&hdr, sizeof(hdr), 1, fp) != 1 ||
+        hdr.Magic != GOLDEN_TRACE_INPUT_MAGIC || hdr.Version != GOLDEN_TRACE_INPUT_VERSION ||
+        hdr.Record_Size != (uint32_t)sizeof(AdasPipelineInput_t) ||
+        hdr.Count < (uint64_t)pCfg->Ticks) {
+        fclose(fp);
+        return NULL;
+    }
+    return fp;
+}
+
+int golden_trace_run_shard(const GoldenTraceConfig_t *pCfg, int shard,
+                           uint64_t *pHash, uint64_t *pTickHashes)
+{
+    int64_t begin, end;
+    if (!pHash || golden_trace_shard_range(pCfg, shard, &begin, &end) != 0) return -1;
+
+    FILE *fp = NULL;
+    static AdasPipelineInput_t chunk[GOLDEN_READ_CHUNK];   /* 프로세스당 샤드 1 개씩 실행 */
+    GoldenScene_t scene;
+
+    if (pCfg->Input_Path) {
+        fp = open_input(pCfg->Input_Path, pCfg);
+        if (!fp) return -1;
+        if (fseek(fp, (long)(sizeof(GoldenInputHeader_t) + (size_t)begin * sizeof(AdasPipelineInput_t)),
+                  SEEK_SET) != 0) {
+            fclose(fp);
+            return -1;
+        }
+    } else {
+        golden_scene_init(&scene, pCfg->Seed, shard);
+    }
+
+    AdasPipelineState_t  state;
+    AdasPipelineOutput_t out;
+    adas_pipeline_init(&state);
+
+    uint64_t h = GOLDEN_TRACE_HASH_INIT;
+    int rc = 0;
+    for (int64_t t = begin; t < end && rc == 0; ) {
+        int n = 1;
+        const AdasPipelineInput_t *in = &chunk[0];
+        if (fp) {
+            int64_t left = end - t;
+            n = (left < GOLDEN_READ_CHUNK) ? (int)left : GOLDEN_READ_CHUNK;
+            if (fread(chunk, sizeof(AdasPipelineInput_t), (size_t)n, fp) != (size_t)n) {
+                rc = -1;
+                break;
+            }
+        } else {
+            golden_scene_next(&scene, &chunk[0]);
+        }
+        for (int k = 0; k < n; k++, t++) {
+            if (adas_pipeline_step(&state, &in[k], &out) != 0) {
+                rc = -1;
+                break;
+            }
+            h = golden_trace_hash_output(h, &out, pCfg->Tolerance);
+            if (pTickHashes) pTickHashes[t - begin] = h;
+        }
+    }
+
+    if (fp) fclose(fp);
+    *pHash = h;
+    return rc;
+}
+
+int golden_trace_record_input(const GoldenTraceConfig_t *pCfg, const char *path)
+{
+    if (!pCfg || !path || pCfg->Input_Path) return -1;
+
+    int64_t begin, end;
+    if (golden_trace_shard_range(pCfg, 0, &begin, &end) != 0) return -1;
+
+    FILE *fp = fopen(path, "wb");
+    if (!fp) return -1;
+
+    GoldenInputHeader_t hdr;
+    memset(&hdr, 0, sizeof(hdr));
+    hdr.Magic       = GOLDEN_TRACE_INPUT_MAGIC;
+    hdr.Version     = GOLDEN_TRACE_INPUT_VERSION;
+    hdr.Record_Size = (uint32_t)sizeof(AdasPipelineInput_t);
+    hdr.Count       = (uint64_t)pCfg->Ticks;
+    int rc = (fwrite(&hdr, sizeof(hdr), 1, fp) == 1) ? 0 : -1;
+
+    AdasPipelineInput_t in;
+    GoldenScene_t scene;
+    for (int s = 0; s < pCfg->Shards && rc == 0; s++) {
+        golden_trace_shard_range(pCfg, s, &begin, &end);
+        golden_scene_init(&scene, pCfg->Seed, s);
+        for (int64_t t = begin; t < end; t++) {
+            golden_scene_next(&scene, &in);
+            if (fwrite(&in, sizeof(in), 1, fp) != 1) {
+                rc = -1;
+                break;
+            }
+        }
+    }
+    if (fclose(fp) != 0) rc = -1;
+    return rc;
+}
+
+/*─────────────────────────────
+  골든 파일
+─────────────────────────────*/
+int golden_trace_save(const char *path, const GoldenTraceConfig_t *pCfg, const uint64_t *pShardHashes)
+{
+    if (!path || !pCfg || !pShardHashes || pCfg->Shards <= 0) return -1;
+
+    FILE *fp = fopen(path, "w");
+    if (!fp) return -1;
+
+    fprintf(fp, "golden v1 flavor %d seed %llu ticks %lld shards %d tol %g\n",
+            golden_trace_build_flavor(), (unsigned long long)pCfg->Seed,
+            (long long)pCfg->Ticks, (int)pCfg->Shards, (double)pCfg->Tolerance);
+    for (int s = 0; s < pCfg->Shards; s++) {
+        fprintf(fp, "shard %d %016llx\n", s, (unsigned long long)pShardHashes[s]);
+    }
+    fprintf(fp, "total %016llx\n",
+            (unsigned long long)golden_trace_combine(pShardHashes, pCfg->Shards));
+    return (fclose(fp) == 0) ? 0 : -1;
+}
+
+int golden_trace_load(const char *path, GoldenTraceConfig_t *pCfg, int *pFlavor,
+                      uint64_t *pShardHashes, int maxShards)
+{
+    if (!path || !pCfg || !pFlavor || !pShardHashes) return -1;
+
+    FILE *fp = fopen(path, "r");
+    if (!fp) return -1;
+
+    unsigned long long seed = 0;
+    long long ticks = 0;
+    int shards = 0;
+    float tol = 0.0f;
+    int rc = (fscanf(fp, " golden v1 flavor %d seed %llu ticks %lld shards %d tol %f",
+                     pFlavor, &seed, &ticks, &shards, &tol) == 5) ? 0 : -1;
+    if (rc == 0 && (shards <= 0 || shards > maxShards)) rc = -1;
+
+    for (int s = 0; s < shards && rc == 0; s++) {
+        int idx = -1;
+        unsigned long long h = 0;
+        if (fscanf(fp, " shard %d %llx", &idx, &h) != 2 || idx != s) {
+            rc = -1;
+        } else {
+            pShardHashes[s] = (uint64_t)h;
+        }
+    }
+    fclose(fp);
+
+    if (rc == 0) {
+        pCfg->Seed       = (uint64_t)seed;
+        pCfg->Ticks      = (int64_t)ticks;
+        pCfg->Shards     = shards;
+        pCfg->Tolerance  = tol;
+    }
+    return rc;
+}
+
+int golden_trace_build_flavor(void)
+{
+#ifdef ADAS_USE_FAST_MATH
+    return 1;
+#else
+    return 0;
+#endif
+}
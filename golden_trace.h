@@ -0,0 +1,120 @@
+/****************************************************************************
+ * golden_trace.h
+ *
+ * - 전체 파이프라인(adas_pipeline) 골든 트레이스 회귀 검증
+ * - 입력 : 합성 시나리오(시드 + 샤드 번호로 결정) 또는 기록 파일(AdasPipelineInput_t 레코드)
+ * - 틱마다 출력(모드, 가감속, 조향, 타겟 ID, Ego/LS 중간값)을 64-bit 해시에 누적
+ *     . Tolerance == 0 : 실수 비트 그대로 (NaN 은 한 값으로 정규화) → 비트 일치 검증
+ *     . Tolerance  > 0 : round(x / Tolerance) 정수로 해시 → 허용오차 검증
+ *       (격자 경계에 걸친 값은 오차가 작아도 달라질 수 있음 : 불일치 시 비트 덤프로 확인)
+ * - 샤드 : 전체 틱을 Shards 개 연속 구간으로 나누고, 구간마다 파이프라인을 새로 초기화
+ *          → 샤드 해시는 실행 순서/작업자 수와 무관 (골든 파일에 Shards 고정)
+ * - 파이프라인 전역 상태(ACC/LFA PID) 때문에 병렬 실행은 프로세스 단위 (golden_trace 도구)
+ ****************************************************************************/
+#ifndef GOLDEN_TRACE_H
+#define GOLDEN_TRACE_H
+
+#include <stdint.h>
+#include "adas_pipeline.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define GOLDEN_TRACE_MAX_SHARDS     4096
+#define GOLDEN_TRACE_HASH_INIT      0xcbf29ce484222325ull   /* FNV-1a offset basis */
+#define GOLDEN_TRACE_INPUT_MAGIC    0x43525441u             /* 'ATRC' */
+#define GOLDEN_TRACE_INPUT_VERSION  1u
+
+typedef struct {
+    uint64_t    Seed;
+    int64_t     Ticks;              /* 전체 틱 수 */
+    int32_t     Shards;
+    float       Tolerance;          /* 0 : 비트 일치 */
+    const char *Input_Path;         /* NULL : 합성 시나리오 */
+} GoldenTraceConfig_t;
+
+/* 합성 시나리오 상태 (샤드별) */
+#define GOLDEN_SCENE_OBJECTS    12
+typedef struct {
+    uint32_t Rng;
+    int64_t  Tick;                  /* 샤드 내 틱 번호 */
+    float    Prev_Accel;            /* [m/s^2] */
+    float    Ego_Velocity;          /* [m/s] 실제 속도 */
+    float    Target_Velocity;       /* [m/s] 속도 프로파일 목표 */
+    float    Lane_Offset;
+    float    Lane_Phase;
+    int32_t  Lane_Segment_Left;     /* 현재 차선 구간 남은 틱 */
+    LaneType_e Lane_Type;
+    float    Lane_Curvature;
+    float    Next_Lane_Curvature;
+    int32_t  Gps_Outage_Left;       /* GPS 미갱신 남은 틱 */
+    float    Gps_Timestamp;
+    float    Gps_Velocity;
+    int32_t  Next_Id;
+    uint8_t  Obj_Kind[GOLDEN_SCENE_OBJECTS];
+    ObjectData_t Obj[GOLDEN_SCENE_OBJECTS];
+} GoldenScene_t;
+
+/**
+ * @brief 샤드의 틱 구간 [begin, end)
+ * @return 0 on success, -1 on invalid config/shard
+ */
+int golden_trace_shard_range(const GoldenTraceConfig_t *pCfg, int shard,
+                             int64_t *pBegin, int64_t *pEnd);
+
+/** @brief 합성 시나리오 초기화 (seed, shard 로 결정) */
+void golden_scene_init(GoldenScene_t *pScene, uint64_t seed, int shard);
+
+/**
+ * @brief 다음 틱 입력 생성
+ *        Current_Time = 10 ms × 샤드 내 틱 번호 (float 로 정확한 범위 : 샤드당 1.6 M 틱)
+ */
+void golden_scene_next(GoldenScene_t *pScene, AdasPipelineInput_t *pIn);
+
+/** @brief 1 틱 출력을 해시에 누적 */
+uint64_t golden_trace_hash_output(uint64_t hash, const AdasPipelineOutput_t *pOut, float tolerance);
+
+/** @brief 샤드 해시들을 샤드 순서대로 결합 (골든 전체 해시) */
+uint64_t golden_trace_combine(const uint64_t *pShardHashes, int count);
+
+/**
+ * @brief 샤드 1 개 실행 (파이프라인 새로 초기화)
+ * @param[out] pTickHashes : NULL 이 아니면 틱별 누적 해시 기록 (구간 길이만큼, 불일치 위치 탐색용)
+ * @return 0 on success, -1 : 인자 오류 / 입력 파일 오류
+ */
+int golden_trace_run_shard(const GoldenTraceConfig_t *pCfg, int shard,
+                           uint64_t *pHash, uint64_t *pTickHashes);
+
+/**
+ * @brief 합성 시나리오 입력을 기록 파일로 저장 (샤드 순서대로 연결)
+ *        같은 Shards 로 재생하면 합성 실행과 해시 동일
+ * @return 0 on success, -1 on error
+ */
+int golden_trace_record_input(const GoldenTraceConfig_t *pCfg, const char *path);
+
+/**
+ * @brief 골든 파일 저장 (텍스트)
+ *          golden v1 flavor F seed X ticks N shards S tol T
+ *          shard K HASH   (S 줄)
+ *          total HASH
+ * @return 0 on success, -1 on error
+ */
+int golden_trace_save(const char *path, const GoldenTraceConfig_t *pCfg, const uint64_t *pShardHashes);
+
+/**
+ * @brief 골든 파일 읽기 → pCfg (Seed/Ticks/Shards/Tolerance), 구성, 샤드 해시
+ * @param maxShards : pShardHashes 용량
+ * @return 0 on success, -1 : 파일/형식 오류 또는 용량 부족
+ */
+int golden_trace_load(const char *path, GoldenTraceConfig_t *pCfg, int *pFlavor,
+                      uint64_t *pShardHashes, int maxShards);
+
+/** @brief 빌드 구성 (0 : libm, 1 : ADAS_USE_FAST_MATH) ― 골든은 구성별로 다름 */
+int golden_trace_build_flavor(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GOLDEN_TRACE_H */
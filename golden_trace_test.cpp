@@ -0,0 +1,210 @@
+/*********************************************************************
+ * golden_trace_test.cpp  ―  전체 파이프라인 골든 트레이스 회귀
+ * DUT : adas_pipeline.c (+ 전 모듈), golden_trace.c
+ * 골든 : golden_trace_ci.f<flavor>.golden (200 k 틱, 16 샤드, 비트 일치)
+ *        전체 10^7 틱 골든은 ctest golden_trace_full (golden_trace 도구, 프로세스 병렬)
+ *********************************************************************/
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+#include "golden_trace.h"
+
+#ifndef ADAS_SOURCE_DIR
+#define ADAS_SOURCE_DIR "."
+#endif
+
+namespace {
+
+std::string ci_golden_path()
+{
+    return std::string(ADAS_SOURCE_DIR) + "/golden_trace_ci.f" +
+           std::to_string(golden_trace_build_flavor()) + ".golden";
+}
+
+GoldenTraceConfig_t small_cfg()
+{
+    GoldenTraceConfig_t cfg{ 7u, 6000, 3, 0.0f, nullptr };
+    return cfg;
+}
+
+} /* namespace */
+
+/* CI 골든 : 전 샤드 비트 일치 */
+TEST(GoldenTraceTest, TC_GOLD_EQ_01_CiGolden)
+{
+    GoldenTraceConfig_t cfg;
+    int flavor = -1;
+    std::vector<uint64_t> golden(GOLDEN_TRACE_MAX_SHARDS);
+    ASSERT_EQ(golden_trace_load(ci_golden_path().c_str(), &cfg, &flavor, golden.data(),
+                                GOLDEN_TRACE_MAX_SHARDS), 0) << ci_golden_path();
+    ASSERT_EQ(flavor, golden_trace_build_flavor());
+    cfg.Input_Path = nullptr;
+
+    for (int s = 0; s < cfg.Shards; s++) {
+        uint64_t h = 0;
+        ASSERT_EQ(golden_trace_run_shard(&cfg, s, &h, nullptr), 0);
+        EXPECT_EQ(h, golden[(size_t)s]) << "shard " << s;
+    }
+}
+
+/* 재실행 결정성 : 샤드 실행 순서와 무관 (전역 PID 상태 초기화 확인) */
+TEST(GoldenTraceTest, TC_GOLD_EQ_02_OrderIndependent)
+{
+    GoldenTraceConfig_t cfg = small_cfg();
+    uint64_t fwd[3], rev[3];
+    for (int s = 0; s < 3; s++)  ASSERT_EQ(golden_trace_run_shard(&cfg, s, &fwd[s], nullptr), 0);
+    for (int s = 2; s >= 0; s--) ASSERT_EQ(golden_trace_run_shard(&cfg, s, &rev[s], nullptr), 0);
+    for (int s = 0; s < 3; s++)  EXPECT_EQ(fwd[s], rev[s]);
+    EXPECT_NE(fwd[0], fwd[1]);
+
+    /* 틱별 누적 해시 : 마지막 값 == 샤드 해시 */
+    int64_t b, e;
+    ASSERT_EQ(golden_trace_shard_range(&cfg, 1, &b, &e), 0);
+    std::vector<uint64_t> ticks((size_t)(e - b));
+    uint64_t h;
+    ASSERT_EQ(golden_trace_run_shard(&cfg, 1, &h, ticks.data()), 0);
+    EXPECT_EQ(ticks.back(), fwd[1]);
+}
+
+/* 기록 입력 재생 == 합성 실행 */
+TEST(GoldenTraceTest, TC_GOLD_EQ_03_RecordedInputReplay)
+{
+    GoldenTraceConfig_t cfg = small_cfg();
+    std::string path = "/tmp/adas_golden_input_" + std::to_string((long)getpid()) + ".bin";
+    ASSERT_EQ(golden_trace_record_input(&cfg, path.c_str()), 0);
+
+    GoldenTraceConfig_t replay = cfg;
+    replay.Input_Path = path.c_str();
+    for (int s = 0; s < cfg.Shards; s++) {
+        uint64_t hs = 0, hr = 1;
+        ASSERT_EQ(golden_trace_run_shard(&cfg, s, &hs, nullptr), 0);
+        ASSERT_EQ(golden_trace_run_shard(&replay, s, &hr, nullptr), 0);
+        EXPECT_EQ(hs, hr) << "shard " << s;
+    }
+
+    /* 기록보다 긴 Ticks 요구 → 실패 */
+    replay.Ticks = cfg.Ticks + 1;
+    uint64_t h;
+    EXPECT_EQ(golden_trace_run_shard(&replay, 0, &h, nullptr), -1);
+    std::remove(path.c_str());
+}
+
+/* 해시 민감도 : 비트 모드는 1 ulp 차이 검출, 허용오차 모드는 격자 안 차이 무시 */
+TEST(GoldenTraceTest, TC_GOLD_BV_01_HashTolerance)
+{
+    AdasPipelineOutput_t a;
+    std::memset(&a, 0, sizeof(a));
+    a.Accel_Acc = 1.0f;
+    a.Steer     = 0.25f;
+    AdasPipelineOutput_t b = a;
+    b.Accel_Acc = std::nextafter(1.0f, 2.0f);
+
+    const uint64_t h0 = GOLDEN_TRACE_HASH_INIT;
+    EXPECT_NE(golden_trace_hash_output(h0, &a, 0.0f), golden_trace_hash_output(h0, &b, 0.0f));
+    EXPECT_EQ(golden_trace_hash_output(h0, &a, 1e-3f), golden_trace_hash_output(h0, &b, 1e-3f));
+
+    b.Accel_Acc = 1.002f;
+    EXPECT_NE(golden_trace_hash_output(h0, &a, 1e-3f), golden_trace_hash_output(h0, &b, 1e-3f));
+
+    /* 타겟 ID / 모드 변화는 허용오차와 무관하게 검출 */
+    b = a;
+    b.Aeb_Target_ID = 3;
+    EXPECT_NE(golden_trace_hash_output(h0, &a, 1.0f), golden_trace_hash_output(h0, &b, 1.0f));
+    b = a;
+    b.Lfa_Mode = 1;
+    EXPECT_NE(golden_trace_hash_output(h0, &a, 1.0f), golden_trace_hash_output(h0, &b, 1.0f));
+
+    /* NaN 페이로드 정규화 */
+    uint32_t q1 = 0x7FC00001u, q2 = 0x7FC00002u;
+    std::memcpy(&a.Ttc, &q1, 4);
+    b = a;
+    std::memcpy(&b.Ttc, &q2, 4);
+    EXPECT_EQ(golden_trace_hash_output(h0, &a, 0.0f), golden_trace_hash_output(h0, &b, 0.0f));
+}
+
+/* 샤드 구간 분할 : 빈틈/중복 없음 */
+TEST(GoldenTraceTest, TC_GOLD_BV_02_ShardRange)
+{
+    GoldenTraceConfig_t cfg{ 1u, 1000003, 64, 0.0f, nullptr };
+    int64_t prevEnd = 0;
+    for (int s = 0; s < cfg.Shards; s++) {
+        int64_t b, e;
+        ASSERT_EQ(golden_trace_shard_range(&cfg, s, &b, &e), 0);
+        EXPECT_EQ(b, prevEnd);
+        EXPECT_GE(e - b, 15625);
+        prevEnd = e;
+    }
+    EXPECT_EQ(prevEnd, cfg.Ticks);
+}
+
+/* 무효 입력 */
+TEST(GoldenTraceTest, TC_GOLD_RA_01_Invalid)
+{
+    GoldenTraceConfig_t cfg = small_cfg();
+    int64_t b, e;
+    uint64_t h;
+    EXPECT_EQ(golden_trace_shard_range(&cfg, 3, &b, &e), -1);
+    EXPECT_EQ(golden_trace_shard_range(&cfg, -1, &b, &e), -1);
+    EXPECT_EQ(golden_trace_run_shard(&cfg, 0, nullptr, nullptr), -1);
+
+    GoldenTraceConfig_t bad = cfg;
+    bad.Shards = 0;
+    EXPECT_EQ(golden_trace_run_shard(&bad, 0, &h, nullptr), -1);
+    bad = cfg;
+    bad.Input_Path = "/nonexistent/adas_trace.bin";
+    EXPECT_EQ(golden_trace_run_shard(&bad, 0, &h, nullptr), -1);
+
+    AdasPipelineState_t  st;
+    AdasPipelineInput_t  in;
+    AdasPipelineOutput_t out;
+    std::memset(&in, 0, sizeof(in));
+    adas_pipeline_init(&st);
+    in.Obj_Count = ADAS_PIPELINE_MAX_OBJ + 1;
+    EXPECT_EQ(adas_pipeline_step(&st, &in, &out), -1);
+    EXPECT_EQ(adas_pipeline_step(nullptr, &in, &out), -1);
+
+    int flavor;
+    std::vector<uint64_t> hs(4);
+    EXPECT_EQ(golden_trace_load("/nonexistent/x.golden", &cfg, &flavor, hs.data(), 4), -1);
+}
+
+/* 증분 평가 켬 : 출력 비트 동일, 차선 입력 고정 구간에서 적중 */
+TEST(GoldenTraceTest, TC_GOLD_EQ_04_Incremental)
+{
+    GoldenScene_t        sa, sb;
+    AdasPipelineState_t  a, b;
+    AdasPipelineInput_t  ia, ib;
+    AdasPipelineOutput_t oa, ob;
+
+    /* 직렬 기준 (전역 PID 상태 때문에 두 파이프라인을 번갈아 돌리지 않고 차례로 실행) */
+    adas_pipeline_init(&a);
+    golden_scene_init(&sa, 13u, 0);
+    std::vector<AdasPipelineOutput_t> ref;
+    for (int t = 0; t < 4000; t++) {
+        golden_scene_next(&sa, &ia);
+        if ((t / 500) % 2) ia.Lane = LaneData_t{ LANE_TYPE_STRAIGHT, 0.0f, 0.0f, 0.1f, 0.0f, 3.5f, LANE_CHANGE_KEEP };
+        adas_pipeline_step(&a, &ia, &oa);
+        ref.push_back(oa);
+    }
+
+    /* 같은 시나리오를 증분 평가로 다시 실행 */
+    golden_scene_init(&sb, 13u, 0);
+    adas_pipeline_init(&b);
+    adas_pipeline_set_incremental(&b, 1);
+    for (int t = 0; t < 4000; t++) {
+        golden_scene_next(&sb, &ib);
+        if ((t / 500) % 2) ib.Lane = LaneData_t{ LANE_TYPE_STRAIGHT, 0.0f, 0.0f, 0.1f, 0.0f, 3.5f, LANE_CHANGE_KEEP };
+        ASSERT_EQ(adas_pipeline_step(&b, &ib, &ob), 0);
+        ASSERT_EQ(std::memcmp(&ob, &ref[(size_t)t], sizeof(ob)), 0) << "tick " << t;
+    }
+    EXPECT_EQ(b.Memo.Lane.Calls, 4000u);
+    EXPECT_GE(b.Memo.Lane.Hits, 4u * 499u);             /* 고정 구간 4 개 */
+    EXPECT_EQ(b.Memo.Curve.Calls, 4000u);
+    EXPECT_GE(b.Memo.Curve.Hits, 4u * 499u);
+}
@@ -0,0 +1,196 @@
+/*********************************************************************
+ * golden_trace_tool.cpp  ―  골든 트레이스 기록 / 검증 (golden_trace 실행 파일)
+ *
+ * 사용 :
+ *   golden_trace --write FILE [--ticks N] [--shards S] [--seed X] [--tol T] [--input TRACE]
+ *   golden_trace --check FILE [--jobs J] [--input TRACE]
+ *   golden_trace --record-input TRACE [--ticks N] [--shards S] [--seed X]
+ *   golden_trace --dump-shard K [--ticks N] [--shards S] [--seed X] [--tol T]   (틱별 누적 해시)
+ *
+ *   - 샤드를 J 개 작업자 프로세스(fork)에 나눠 실행 (기본 : 온라인 코어 수)
+ *     파이프라인 전역 상태(ACC/LFA PID) 때문에 스레드가 아닌 프로세스 단위
+ *   - --check 는 골든 파일의 ticks/shards/seed/tol 을 그대로 사용, 샤드별 비교 후
+ *     불일치 샤드 출력 (exit 1) → --dump-shard 로 첫 불일치 틱 탐색
+ *   - 골든 파일 형식 : golden_trace_save (golden_trace.h)
+ *********************************************************************/
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "golden_trace.h"
+
+namespace {
+
+struct Options {
+    std::string write, check, recordInput, input;
+    int  jobs      = 0;
+    int  dumpShard = -1;
+    GoldenTraceConfig_t cfg{ 1u, 10000000, 64, 0.0f, nullptr };
+};
+
+void usage()
+{
+    std::fprintf(stderr,
+        "golden_trace (--write F | --check F | --record-input F | --dump-shard K)\n"
+        "             [--ticks N] [--shards S] [--seed X] [--tol T] [--jobs J] [--input TRACE]\n");
+}
+
+bool parse(int argc, char **argv, Options &o)
+{
+    for (int i = 1; i < argc; i++) {
+        std::string a = argv[i];
+        if (i + 1 >= argc) return false;
+        const char *v = argv[++i];
+        if      (a == "--write")        o.write       = v;
+        else if (a == "--check")        o.check       = v;
+        else if (a == "--record-input") o.recordInput = v;
+        else if (a == "--input")        o.input       = v;
+        else if (a == "--dump-shard")   o.dumpShard   = std::atoi(v);
+        else if (a == "--jobs")         o.jobs        = std::atoi(v);
+        else if (a == "--ticks")        o.cfg.Ticks   = std::atoll(v);
+        else if (a == "--shards")       o.cfg.Shards  = std::atoi(v);
+        else if (a == "--seed")         o.cfg.Seed    = std::strtoull(v, nullptr, 0);
+        else if (a == "--tol")          o.cfg.Tolerance = std::strtof(v, nullptr);
+        else return false;
+    }
+    return true;
+}
+
+/* 샤드를 jobs 개 프로세스에 분배 (s ≡ j mod jobs), 결과는 파이프로 (shard, hash, rc) */
+bool run_all(const GoldenTraceConfig_t &cfg, int jobs, std::vector<uint64_t> &hashes)
+{
+    struct Msg { int32_t shard; int32_t rc; uint64_t hash; };
+
+    hashes.assign((size_t)cfg.Shards, 0);
+    if (jobs > cfg.Shards) jobs = cfg.Shards;
+
+    int fds[2];
+    if (pipe(fds) != 0) return false;
+
+    std::vector<pid_t> kids;
+    for (int j = 0; j < jobs; j++) {
+        pid_t pid = fork();
+        if (pid < 0) return false;
+        if (pid == 0) {
+            close(fds[0]);
+            for (int s = j; s < cfg.Shards; s += jobs) {
+                Msg m{ s, 0, 0 };
+                m.rc = golden_trace_run_shard(&cfg, s, &m.hash, nullptr);
+                if (write(fds[1], &m, sizeof(m)) != (ssize_t)sizeof(m)) _exit(2);
+            }
+            _exit(0);
+        }
+        kids.push_back(pid);
+    }
+    close(fds[1]);
+
+    bool ok = true;
+    int  got = 0;
+    Msg  m;
+    while (read(fds[0], &m, sizeof(m)) == (ssize_t)sizeof(m)) {
+        if (m.rc != 0 || m.shard < 0 || m.shard >= cfg.Shards) ok = false;
+        else hashes[(size_t)m.shard] = m.hash;
+        got++;
+    }
+    close(fds[0]);
+    for (pid_t pid : kids) {
+        int st = 0;
+        waitpid(pid, &st, 0);
+        if (!WIFEXITED(st) || WEXITSTATUS(st) != 0) ok = false;
+    }
+    return ok && got == cfg.Shards;
+}
+
+} /* namespace */
+
+int main(int argc, char **argv)
+{
+    Options o;
+    if (!parse(argc, argv, o) ||
+        (o.write.empty() && o.check.empty() && o.recordInput.empty() && o.dumpShard < 0)) {
+        usage();
+        return 2;
+    }
+    if (o.jobs <= 0) {
+        long n = sysconf(_SC_NPROCESSORS_ONLN);
+        o.jobs = (n > 0) ? (int)n : 1;
+    }
+
+    std::vector<uint64_t> golden(GOLDEN_TRACE_MAX_SHARDS);
+    int goldenFlavor = -1;
+    if (!o.check.empty()) {
+        if (golden_trace_load(o.check.c_str(), &o.cfg, &goldenFlavor, golden.data(),
+                              GOLDEN_TRACE_MAX_SHARDS) != 0) {
+            std::fprintf(stderr, "골든 파일 읽기 실패 : %s\n", o.check.c_str());
+            return 2;
+        }
+        if (goldenFlavor != golden_trace_build_flavor() && o.cfg.Tolerance == 0.0f) {
+            std::fprintf(stderr, "골든 빌드 구성(flavor %d) 과 현재 빌드(flavor %d) 다름 : 비트 일치 검증 불가\n",
+                         goldenFlavor, golden_trace_build_flavor());
+            return 2;
+        }
+    }
+    o.cfg.Input_Path = o.input.empty() ? nullptr : o.input.c_str();
+
+    if (!o.recordInput.empty()) {
+        o.cfg.Input_Path = nullptr;
+        if (golden_trace_record_input(&o.cfg, o.recordInput.c_str()) != 0) {
+            std::fprintf(stderr, "입력 기록 실패 : %s\n", o.recordInput.c_str());
+            return 1;
+        }
+        std::printf("recorded %lld ticks → %s\n", (long long)o.cfg.Ticks, o.recordInput.c_str());
+        return 0;
+    }
+
+    if (o.dumpShard >= 0) {
+        int64_t b, e;
+        if (golden_trace_shard_range(&o.cfg, o.dumpShard, &b, &e) != 0) return 2;
+        std::vector<uint64_t> ticks((size_t)(e - b));
+        uint64_t h;
+        if (golden_trace_run_shard(&o.cfg, o.dumpShard, &h, ticks.data()) != 0) return 1;
+        for (int64_t t = b; t < e; t++) {
+            std::printf("%lld %016" PRIx64 "\n", (long long)t, ticks[(size_t)(t - b)]);
+        }
+        return 0;
+    }
+
+    std::vector<uint64_t> hashes;
+    auto t0 = std::chrono::steady_clock::now();
+    bool ok = run_all(o.cfg, o.jobs, hashes);
+    double sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    if (!ok) {
+        std::fprintf(stderr, "샤드 실행 실패\n");
+        return 1;
+    }
+    uint64_t total = golden_trace_combine(hashes.data(), (int)hashes.size());
+    std::printf("ticks %lld, shards %d, jobs %d : %.2f s (%.0f ticks/s), total %016" PRIx64 "\n",
+                (long long)o.cfg.Ticks, o.cfg.Shards, o.jobs, sec, (double)o.cfg.Ticks / sec, total);
+
+    if (!o.write.empty()) {
+        if (golden_trace_save(o.write.c_str(), &o.cfg, hashes.data()) != 0) {
+            std::fprintf(stderr, "골든 파일 저장 실패 : %s\n", o.write.c_str());
+            return 1;
+        }
+        return 0;
+    }
+
+    int bad = 0;
+    for (int s = 0; s < o.cfg.Shards; s++) {
+        if (hashes[(size_t)s] != golden[(size_t)s]) {
+            int64_t b, e;
+            golden_trace_shard_range(&o.cfg, s, &b, &e);
+            std::printf("  MISMATCH shard %d (ticks %lld..%lld) : %016" PRIx64 " != golden %016" PRIx64 "\n",
+                        s, (long long)b, (long long)e - 1, hashes[(size_t)s], golden[(size_t)s]);
+            bad++;
+        }
+    }
+    std::printf("%s : %d / %d shards mismatch\n", bad ? "FAIL" : "PASS", bad, o.cfg.Shards);
+    return bad ? 1 : 0;
+}
@@ -0,0 +1,248 @@
+#include <math.h>
+#include <string.h>
+#include "lane_geometry.h"
+
+#define DEG2RAD(d) ((d) * (float)M_PI / 180.0f)
+#define RAD2DEG(r) ((r) * 180.0f / (float)M_PI)
+
+/* 곡률 반경 [m] → 곡률 [1/m] (0 또는 비정상 → 직선) */
+/* 곡률 반경 유효 (비유한 / |R| < 1 → 직선 처리) */
+static int radius_is_valid(float radius)
+{
+    return isfinite(radius) && fabsf(radius) >= 1.0f;
+}
+
+static float radius_to_curvature(float radius)
+{
+    return radius_is_valid(radius) ? 1.0f / radius : 0.0f;
+}
+
+float lane_geometry_half_curvature(float radius)
+{
+    return radius_is_valid(radius) ? 0.5f / radius : 0.0f;
+}
+
+/* 구간 선택: x 가 속한 마지막 구간 */
+static int find_segment(const LaneGeometry_t *g, float x)
+{
+    int idx = 0;
+    for (int i = 1; i < g->Num_Segments; i++) {
+        if (x >= g->Segment[i].X_Start) idx = i;
+    }
+    return idx;
+}
+
+static float seg_y(const LaneGeomSegment_t *s, float u)
+{
+    return s->C0 + u * (s->C1 + u * (s->C2 + u * s->C3));
+}
+
+static float seg_dy(const LaneGeomSegment_t *s, float u)
+{
+    return s->C1 + u * (2.0f * s->C2 + u * 3.0f * s->C3);
+}
+
+static float seg_ddy(const LaneGeomSegment_t *s, float u)
+{
+    return 2.0f * s->C2 + 6.0f * s->C3 * u;
+}
+
+/* 곡률은 클로소이드 설계값(소각 근사 y'' = κ)을 그대로 사용 */
+static void fill_sample(float x, float y, float dy, float ddy, LaneGeomSample_t *pOut)
+{
+    pOut->X         = x;
+    pOut->Offset    = y;
+    pOut->Heading   = RAD2DEG(atanf(dy));
+    pOut->Curvature = ddy;
+}
+
+/*---------------------------------------------------------
+ * lane_geometry_build
+ * - 구간0 : 클로소이드(곡률 선형 변화) 3차 근사, [0, 전이 길이]
+ * - 구간1 : 다음 곡률로 일정, 구간0 끝점에서 C1 연속
+ *---------------------------------------------------------*/
+int lane_geometry_build(const LaneData_t *pLaneData,
+                        float             headingErrDeg,
+                        LaneGeometry_t   *pGeom)
+{
+    if (!pLaneData || !pGeom) {
+        return -1;
+    }
+    if (!isfinite(pLaneData->Lane_Offset) || !isfinite(headingErrDeg)) {
+        return -1;
+    }
+
+    memset(pGeom, 0, sizeof(LaneGeometry_t));
+
+    float k0 = radius_to_curvature(pLaneData->Lane_Curvature);
+    float k1 = k0;
+    /* 다음 곡률 0 = 정보 없음 → 현재 곡률 유지 */
+    if (pLaneData->Next_Lane_Curvature != 0.0f) {
+        k1 = radius_to_curvature(pLaneData->Next_Lane_Curvature);
+    }
+
+    /* 차선 헤딩(Ego 기준) = -(Ego_Heading - Lane_Heading), 직각 근처는 제한 */
+    float laneHdg = -headingErrDeg;
+    if (laneHdg >  89.0f) laneHdg =  89.0f;
+    if (laneHdg < -89.0f) laneHdg = -89.0f;
+
+    const float LT = LANE_GEOM_TRANSITION_LENGTH;
+
+    LaneGeomSegment_t *s0 = &pGeom->Segment[0];
+    s0->X_Start = 0.0f;
+    s0->Length  = LT;
+    s0->C0      = pLaneData->Lane_Offset;
+    s0->C1      = tanf(DEG2RAD(laneHdg));
+    s0->C2      = 0.5f * k0;
+    s0->C3      = (k1 - k0) / (6.0f * LT);
+
+    LaneGeomSegment_t *s1 = &pGeom->Segment[1];
+    s1->X_Start = LT;
+    s1->Length  = LANE_GEOM_MAX_RANGE - LT;
+    s1->C0      = seg_y(s0, LT);
+    s1->C1      = seg_dy(s0, LT);
+    s1->C2      = 0.5f * k1;
+    s1->C3      = 0.0f;
+
+    pGeom->Num_Segments = LANE_GEOM_MAX_SEGMENTS;
+    pGeom->Lane_Width   = pLaneData->Lane_Width;
+    return 0;
+}
+
+/*---------------------------------------------------------
+ * lane_geometry_eval
+ *---------------------------------------------------------*/
+void lane_geometry_eval(const LaneGeometry_t *pGeom,
+                        float                 x,
+                        LaneGeomSample_t     *pOut)
+{
+    if (!pGeom || !pOut) {
+        return;
+    }
+    if (pGeom->Num_Segments <= 0) {
+        memset(pOut, 0, sizeof(LaneGeomSample_t));
+        pOut->X = x;
+        return;
+    }
+    if (!(x > 0.0f)) x = 0.0f;   /* NaN 포함 */
+
+    const LaneGeomSegment_t *s = &pGeom->Segment[find_segment(pGeom, x)];
+    float u = x - s->X_Start;
+    fill_sample(x, seg_y(s, u), seg_dy(s, u), seg_ddy(s, u), pOut);
+}
+
+/*---------------------------------------------------------
+ * 커서 : 현재 구간 기준 전진 차분 재계산
+ *---------------------------------------------------------*/
+static void cursor_load(LaneGeomCursor_t *c)
+{
+    const LaneGeomSegment_t *s = &c->pGeom->Segment[c->Segment_Index];
+    float h  = c->Step;
+    float u0 = c->X - s->X_Start;
+
+    float y0 = seg_y(s, u0);
+    float y1 = seg_y(s, u0 + h);
+    float y2 = seg_y(s, u0 + 2.0f * h);
+    c->D0 = y0;
+    c->D1 = y1 - y0;
+    c->D2 = y2 - 2.0f * y1 + y0;
+    c->D3 = 6.0f * s->C3 * h * h * h;
+
+    float d0 = seg_dy(s, u0);
+    c->S0 = d0;
+    c->S1 = seg_dy(s, u0 + h) - d0;
+    c->S2 = 6.0f * s->C3 * h * h;
+
+    c->K0 = seg_ddy(s, u0);
+    c->K1 = 6.0f * s->C3 * h;
+}
+
+void lane_geometry_cursor_init(LaneGeomCursor_t     *pCur,
+                               const LaneGeometry_t *pGeom,
+                               float                 x0,
+                               float                 step)
+{
+    if (!pCur) {
+        return;
+    }
+    memset(pCur, 0, sizeof(LaneGeomCursor_t));
+    if (!pGeom || pGeom->Num_Segments <= 0) {
+        return;
+    }
+    if (!(x0 > 0.0f)) x0 = 0.0f;
+    if (!(step > 0.0f)) step = 1.0f;
+
+    pCur->pGeom         = pGeom;
+    pCur->X             = x0;
+    pCur->Step          = step;
+    pCur->Segment_Index = find_segment(pGeom, x0);
+    cursor_load(pCur);
+}
+
+void lane_geometry_cursor_next(LaneGeomCursor_t *pCur,
+                               LaneGeomSample_t *pOut)
+{
+    if (!pCur || !pOut) {
+        return;
+    }
+    if (!pCur->pGeom) {
+        memset(pOut, 0, sizeof(LaneGeomSample_t));
+        return;
+    }
+
+    /* 구간 경계 통과 시에만 재평가 */
+    int next = pCur->Segment_Index + 1;
+    if (next < pCur->pGeom->Num_Segments &&
+        pCur->X >= pCur->pGeom->Segment[next].X_Start) {
+        pCur->Segment_Index = next;
+        cursor_load(pCur);
+    }
+
+    fill_sample(pCur->X, pCur->D0, pCur->S0, pCur->K0, pOut);
+
+    pCur->X  += pCur->Step;
+    pCur->D0 += pCur->D1;
+    pCur->D1 += pCur->D2;
+    pCur->D2 += pCur->D3;
+    pCur->S0 += pCur->S1;
+    pCur->S1 += pCur->S2;
+    pCur->K0 += pCur->K1;
+}
+
+/*---------------------------------------------------------
+ * 캐시
+ *---------------------------------------------------------*/
+void lane_geometry_cache_reset(LaneGeometryCache_t *pCache)
+{
+    if (!pCache) {
+        return;
+    }
+    memset(pCache, 0, sizeof(LaneGeometryCache_t));
+}
+
+const LaneGeometry_t *lane_geometry_update(LaneGeometryCache_t *pCache,
+                                           const LaneData_t    *pLaneData,
+                                           float                headingErrDeg)
+{
+    if (!pCache || !pLaneData) {
+        return NULL;
+    }
+
+    if (pCache->Valid &&
+        memcmp(&pCache->Last_Lane, pLaneData, sizeof(LaneData_t)) == 0 &&
+        memcmp(&pCache->Last_Heading_Error, &headingErrDeg, sizeof(float)) == 0)
+    {
+        pCache->Hit_Count++;
+        return &pCache->Geometry;
+    }
+
+    pCache->Miss_Count++;
+    if (lane_geometry_build(pLaneData, headingErrDeg, &pCache->Geometry) != 0) {
+        pCache->Valid = false;
+        return NULL;
+    }
+    memcpy(&pCache->Last_Lane, pLaneData, sizeof(LaneData_t));
+    pCache->Last_Heading_Error = headingErrDeg;
+    pCache->Valid = true;
+    return &pCache->Geometry;
+}
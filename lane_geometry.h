@@ -0,0 +1,146 @@
+/****************************************************************************
+ * lane_geometry.h
+ *
+ * - LaneData_t(곡률 반경, 오프셋, 헤딩)로부터 Ego 좌표계 기준 차선 중심선 모델 생성
+ * - 구간별 3차 다항식(클로소이드 근사) : y(u) = c0 + c1*u + c2*u^2 + c3*u^3
+ * - 임의 전방 거리(Look-ahead)에서 횡오프셋 / 헤딩 / 곡률 평가
+ * - 등간격 샘플링용 전진 차분(Forward Difference) 커서 → 샘플당 덧셈 3회
+ * - 입력 LaneData_t 가 이전 프레임과 동일하면 계수 재계산 생략(캐시)
+ ****************************************************************************/
+#ifndef LANE_GEOMETRY_H
+#define LANE_GEOMETRY_H
+
+#include <stdint.h>
+#include "adas_shared.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 구간 수: [0, 전이 길이] 클로소이드 구간 + 이후 일정 곡률 구간 */
+#define LANE_GEOM_MAX_SEGMENTS      2
+/* 현재 곡률 → 다음 곡률 전이 길이 [m] */
+#define LANE_GEOM_TRANSITION_LENGTH 50.0f
+/* 모델 유효 거리 [m] (MAX_OBJECT_DISTANCE 와 동일) */
+#define LANE_GEOM_MAX_RANGE         MAX_OBJECT_DISTANCE
+
+/**
+ * @brief 3차 다항식 구간 (u = x - X_Start)
+ */
+typedef struct {
+    float X_Start;   /* 구간 시작 종방향 거리 [m] */
+    float Length;    /* 구간 길이 [m] */
+    float C0;        /* 횡오프셋 [m] */
+    float C1;        /* 기울기 dy/dx [-] */
+    float C2;        /* 0.5 * 곡률 [1/m] */
+    float C3;        /* 곡률 변화율 / 6 [1/m^2] */
+} LaneGeomSegment_t;
+
+/**
+ * @brief 차선 중심선 모델 (Ego 좌표계, 좌측 +)
+ */
+typedef struct {
+    LaneGeomSegment_t Segment[LANE_GEOM_MAX_SEGMENTS];
+    int   Num_Segments;
+    float Lane_Width;    /* [m] */
+} LaneGeometry_t;
+
+/**
+ * @brief Look-ahead 평가 결과
+ */
+typedef struct {
+    float X;             /* 평가 지점 종방향 거리 [m] */
+    float Offset;        /* 차선 중심 횡오프셋 [m] */
+    float Heading;       /* 차선 헤딩 (Ego 기준) [°] */
+    float Curvature;     /* 곡률 [1/m], 좌회전 + (소각 근사 y'') */
+} LaneGeomSample_t;
+
+/**
+ * @brief 등간격 샘플 커서 (전진 차분)
+ *        - D0..D3 : y 와 1~3차 전진 차분
+ *        - S0..S2 : y' 와 1~2차 전진 차분 (헤딩용)
+ */
+typedef struct {
+    const LaneGeometry_t *pGeom;
+    int   Segment_Index;
+    float X;
+    float Step;
+    float D0, D1, D2, D3;
+    float S0, S1, S2;
+    float K0, K1;        /* y'' 와 1차 전진 차분 */
+} LaneGeomCursor_t;
+
+/**
+ * @brief 프레임 간 계수 캐시
+ */
+typedef struct {
+    bool           Valid;
+    LaneData_t     Last_Lane;
+    float          Last_Heading_Error;
+    LaneGeometry_t Geometry;
+    uint32_t       Hit_Count;
+    uint32_t       Miss_Count;
+} LaneGeometryCache_t;
+
+/**
+ * @brief LaneData_t → 차선 중심선 모델 변환
+ *
+ * @param[in]  pLaneData     : 차선 정보
+ *                             Lane_Curvature / Next_Lane_Curvature 는 곡률 반경 [m]
+ *                             (0 = 직선, 부호: + 좌회전 / - 우회전)
+ * @param[in]  headingErrDeg : LS_Heading_Error (Ego_Heading - Lane_Heading) [°]
+ * @param[out] pGeom         : 생성된 모델
+ * @return 0 on success, negative on error
+ */
+int lane_geometry_build(const LaneData_t *pLaneData,
+                        float             headingErrDeg,
+                        LaneGeometry_t   *pGeom);
+
+/**
+ * @brief 2차 근사 차선 중심 y ≈ ofs + c1·x + c2·x² 의 c2 = 0.5 / R
+ *        (lane_geometry_build 와 같은 반경 검사 : 비유한 / |R| < 1 / 0 → 0 = 직선)
+ * @param[in] radius : 부호 있는 곡률 반경 [m] (Lane_Curvature)
+ */
+float lane_geometry_half_curvature(float radius);
+
+/**
+ * @brief 임의 종방향 거리 x 에서 오프셋/헤딩/곡률 평가
+ *        (x < 0 은 0, 유효거리 초과는 마지막 구간으로 외삽)
+ */
+void lane_geometry_eval(const LaneGeometry_t *pGeom,
+                        float                 x,
+                        LaneGeomSample_t     *pOut);
+
+/**
+ * @brief 등간격 커서 초기화 (x0 부터 step 간격)
+ */
+void lane_geometry_cursor_init(LaneGeomCursor_t     *pCur,
+                               const LaneGeometry_t *pGeom,
+                               float                 x0,
+                               float                 step);
+
+/**
+ * @brief 현재 커서 위치 값을 출력하고 한 step 전진
+ *        - 구간 경계 통과 시에만 다항식 재평가, 그 외에는 덧셈만 수행
+ */
+void lane_geometry_cursor_next(LaneGeomCursor_t *pCur,
+                               LaneGeomSample_t *pOut);
+
+/**
+ * @brief 캐시 초기화
+ */
+void lane_geometry_cache_reset(LaneGeometryCache_t *pCache);
+
+/**
+ * @brief 캐시 갱신: 입력이 이전 프레임과 비트 단위로 같으면 재계산 생략
+ * @return 현재 프레임에 유효한 모델 (입력 오류 시 NULL)
+ */
+const LaneGeometry_t *lane_geometry_update(LaneGeometryCache_t *pCache,
+                                           const LaneData_t    *pLaneData,
+                                           float                headingErrDeg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LANE_GEOMETRY_H */
@@ -0,0 +1,183 @@
+/*********************************************************************
+ * lane_geometry_test.cpp  ―  차선 중심선 모델 UT
+ * DUT : lane_geometry_build / eval / cursor / update  (lane_geometry.c)
+ *********************************************************************/
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstring>
+
+#include "lane_geometry.h"
+
+static constexpr float TOL = 1e-3f;
+
+static LaneData_t makeLane(float radius, float nextRadius, float offset)
+{
+    LaneData_t l{}; std::memset(&l, 0, sizeof(l));
+    l.Lane_Type           = (radius != 0.0f) ? LANE_TYPE_CURVE : LANE_TYPE_STRAIGHT;
+    l.Lane_Curvature      = radius;
+    l.Next_Lane_Curvature = nextRadius;
+    l.Lane_Offset         = offset;
+    l.Lane_Width          = 3.5f;
+    l.Lane_Change_Status  = LANE_CHANGE_KEEP;
+    return l;
+}
+
+class LaneGeometryTest : public ::testing::Test
+{
+protected:
+    LaneData_t     lane;
+    LaneGeometry_t geom;
+    void SetUp() override {
+        lane = makeLane(0.0f, 0.0f, 0.0f);
+        std::memset(&geom, 0, sizeof(geom));
+    }
+};
+
+/* 직선 : 오프셋 유지, 헤딩/곡률 0 */
+TEST_F(LaneGeometryTest, TC_LGEO_EQ_01)
+{
+    lane = makeLane(0.0f, 0.0f, 0.5f);
+    ASSERT_EQ(lane_geometry_build(&lane, 0.0f, &geom), 0);
+    LaneGeomSample_t s;
+    lane_geometry_eval(&geom, 30.0f, &s);
+    EXPECT_NEAR(s.Offset,    0.5f, TOL);
+    EXPECT_NEAR(s.Heading,   0.0f, TOL);
+    EXPECT_NEAR(s.Curvature, 0.0f, 1e-6f);
+}
+
+/* 일정 곡률 (R=500, 좌) : y ≈ x^2/(2R) */
+TEST_F(LaneGeometryTest, TC_LGEO_EQ_02)
+{
+    lane = makeLane(500.0f, 500.0f, 0.0f);
+    ASSERT_EQ(lane_geometry_build(&lane, 0.0f, &geom), 0);
+    LaneGeomSample_t s;
+    lane_geometry_eval(&geom, 40.0f, &s);
+    EXPECT_NEAR(s.Offset, 40.0f * 40.0f / 1000.0f, 1e-2f);
+    EXPECT_NEAR(s.Curvature, 1.0f / 500.0f, 1e-5f);
+    EXPECT_GT(s.Heading, 0.0f);
+}
+
+/* 우회전 (음수 반경) → 오프셋/곡률 음수 */
+TEST_F(LaneGeometryTest, TC_LGEO_EQ_03)
+{
+    lane = makeLane(-400.0f, -400.0f, 0.0f);
+    ASSERT_EQ(lane_geometry_build(&lane, 0.0f, &geom), 0);
+    LaneGeomSample_t s;
+    lane_geometry_eval(&geom, 30.0f, &s);
+    EXPECT_LT(s.Offset, 0.0f);
+    EXPECT_LT(s.Curvature, 0.0f);
+}
+
+/* 헤딩 오차 : Ego 가 좌측(+)으로 5° 틀어짐 → 차선은 Ego 기준 -5° */
+TEST_F(LaneGeometryTest, TC_LGEO_EQ_04)
+{
+    ASSERT_EQ(lane_geometry_build(&lane, 5.0f, &geom), 0);
+    LaneGeomSample_t s;
+    lane_geometry_eval(&geom, 0.0f, &s);
+    EXPECT_NEAR(s.Heading, -5.0f, TOL);
+    lane_geometry_eval(&geom, 20.0f, &s);
+    EXPECT_NEAR(s.Offset, -20.0f * std::tan(5.0f * (float)M_PI / 180.0f), TOL);
+}
+
+/* 클로소이드 전이 : 곡률이 0 → 1/300 으로 선형 증가 후 유지 */
+TEST_F(LaneGeometryTest, TC_LGEO_EQ_05)
+{
+    lane = makeLane(100000.0f, 300.0f, 0.0f);
+    ASSERT_EQ(lane_geometry_build(&lane, 0.0f, &geom), 0);
+    LaneGeomSample_t mid, end, far;
+    lane_geometry_eval(&geom, LANE_GEOM_TRANSITION_LENGTH * 0.5f, &mid);
+    lane_geometry_eval(&geom, LANE_GEOM_TRANSITION_LENGTH,        &end);
+    lane_geometry_eval(&geom, 150.0f,                             &far);
+    EXPECT_NEAR(mid.Curvature, 0.5f / 300.0f, 1e-4f);
+    EXPECT_NEAR(end.Curvature, 1.0f / 300.0f, 1e-4f);
+    EXPECT_NEAR(far.Curvature, 1.0f / 300.0f, 1e-4f);
+}
+
+/* 구간 경계 연속성 (C1) */
+TEST_F(LaneGeometryTest, TC_LGEO_BV_01)
+{
+    lane = makeLane(600.0f, 250.0f, 0.3f);
+    ASSERT_EQ(lane_geometry_build(&lane, -2.0f, &geom), 0);
+    LaneGeomSample_t a, b;
+    lane_geometry_eval(&geom, LANE_GEOM_TRANSITION_LENGTH - 1e-3f, &a);
+    lane_geometry_eval(&geom, LANE_GEOM_TRANSITION_LENGTH,         &b);
+    EXPECT_NEAR(a.Offset,  b.Offset,  1e-3f);
+    EXPECT_NEAR(a.Heading, b.Heading, 1e-2f);
+}
+
+/* 음수/NaN 거리 → 0 지점 평가 */
+TEST_F(LaneGeometryTest, TC_LGEO_BV_02)
+{
+    lane = makeLane(500.0f, 500.0f, 1.0f);
+    ASSERT_EQ(lane_geometry_build(&lane, 0.0f, &geom), 0);
+    LaneGeomSample_t s;
+    lane_geometry_eval(&geom, -10.0f, &s);
+    EXPECT_NEAR(s.Offset, 1.0f, TOL);
+    lane_geometry_eval(&geom, NAN, &s);
+    EXPECT_NEAR(s.Offset, 1.0f, TOL);
+}
+
+/* 무효 입력 */
+TEST_F(LaneGeometryTest, TC_LGEO_RA_01)
+{
+    EXPECT_LT(lane_geometry_build(nullptr, 0.0f, &geom), 0);
+    EXPECT_LT(lane_geometry_build(&lane, 0.0f, nullptr), 0);
+    EXPECT_LT(lane_geometry_build(&lane, NAN, &geom), 0);
+    lane.Lane_Offset = INFINITY;
+    EXPECT_LT(lane_geometry_build(&lane, 0.0f, &geom), 0);
+}
+
+/* 전진 차분 커서 == 직접 평가 (경계 통과 포함) */
+TEST_F(LaneGeometryTest, TC_LGEO_RA_02)
+{
+    lane = makeLane(800.0f, 200.0f, -0.4f);
+    ASSERT_EQ(lane_geometry_build(&lane, 3.0f, &geom), 0);
+
+    LaneGeomCursor_t cur;
+    lane_geometry_cursor_init(&cur, &geom, 2.0f, 2.5f);
+    for (int i = 0; i < 60; i++) {
+        LaneGeomSample_t inc, ref;
+        lane_geometry_cursor_next(&cur, &inc);
+        lane_geometry_eval(&geom, inc.X, &ref);
+        EXPECT_NEAR(inc.X,         2.0f + 2.5f * i, 1e-3f);
+        EXPECT_NEAR(inc.Offset,    ref.Offset,      5e-3f) << "i=" << i;
+        EXPECT_NEAR(inc.Heading,   ref.Heading,     1e-2f) << "i=" << i;
+        EXPECT_NEAR(inc.Curvature, ref.Curvature,   1e-5f) << "i=" << i;
+    }
+}
+
+/* 캐시 : 동일 입력 → Hit, 변경 → Miss */
+TEST_F(LaneGeometryTest, TC_LGEO_RA_03)
+{
+    LaneGeometryCache_t cache;
+    lane_geometry_cache_reset(&cache);
+    lane = makeLane(500.0f, 500.0f, 0.2f);
+
+    const LaneGeometry_t *g1 = lane_geometry_update(&cache, &lane, 1.0f);
+    const LaneGeometry_t *g2 = lane_geometry_update(&cache, &lane, 1.0f);
+    ASSERT_NE(g1, nullptr);
+    EXPECT_EQ(g1, g2);
+    EXPECT_EQ(cache.Hit_Count,  1u);
+    EXPECT_EQ(cache.Miss_Count, 1u);
+
+    lane.Lane_Offset = 0.25f;
+    lane_geometry_update(&cache, &lane, 1.0f);
+    lane_geometry_update(&cache, &lane, 1.5f);
+    EXPECT_EQ(cache.Hit_Count,  1u);
+    EXPECT_EQ(cache.Miss_Count, 3u);
+
+    LaneGeomSample_t s;
+    lane_geometry_eval(&cache.Geometry, 0.0f, &s);
+    EXPECT_NEAR(s.Offset, 0.25f, TOL);
+}
+
+/* 캐시 : 무효 입력 후 다음 유효 입력은 반드시 재계산 */
+TEST_F(LaneGeometryTest, TC_LGEO_RA_04)
+{
+    LaneGeometryCache_t cache;
+    lane_geometry_cache_reset(&cache);
+    EXPECT_EQ(lane_geometry_update(&cache, &lane, NAN), nullptr);
+    EXPECT_FALSE(cache.Valid);
+    EXPECT_NE(lane_geometry_update(&cache, &lane, 0.0f), nullptr);
+    EXPECT_EQ(cache.Miss_Count, 2u);
+}
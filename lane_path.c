@@ -0,0 +1,243 @@
+#include <math.h>
+#include <string.h>
+#include "lane_path.h"
+
+#define PATH_MIN_SPACING 1e-4f
+#define COARSE_STRIDE    8
+
+/* 점 (px,py) 를 구간 i 에 투영 → 거리^2, 구간 내 비율 t */
+static float project_segment(const LanePath_t *p, int i, float px, float py, float *pT)
+{
+    float ax = p->X[i],     ay = p->Y[i];
+    float dx = p->X[i + 1] - ax;
+    float dy = p->Y[i + 1] - ay;
+    float len2 = dx * dx + dy * dy;
+    float t = ((px - ax) * dx + (py - ay) * dy) / len2;
+    if (t < 0.0f) t = 0.0f;
+    if (t > 1.0f) t = 1.0f;
+    float ex = ax + t * dx - px;
+    float ey = ay + t * dy - py;
+    *pT = t;
+    return ex * ex + ey * ey;
+}
+
+/* 구간 [lo, hi] 범위에서 최근접 구간 */
+static int nearest_in_range(const LanePath_t *p, int lo, int hi, float px, float py, float *pD2)
+{
+    int   best  = lo;
+    float bestD = INFINITY;
+    float t;
+    for (int i = lo; i <= hi; i++) {
+        float d = project_segment(p, i, px, py, &t);
+        if (d < bestD) { bestD = d; best = i; }
+    }
+    *pD2 = bestD;
+    return best;
+}
+
+static int clamp_segment(const LanePath_t *p, int i)
+{
+    if (i < 0) return 0;
+    if (i > p->Num_Points - 2) return p->Num_Points - 2;
+    return i;
+}
+
+/*---------------------------------------------------------
+ * lane_path_set
+ *---------------------------------------------------------*/
+int lane_path_set(LanePath_t *pPath, const float *pX, const float *pY, int count)
+{
+    if (!pPath || !pX || !pY || count < 2 || count > LANE_PATH_MAX_POINTS) {
+        return -1;
+    }
+
+    /* 1) 검증 : 전 점 유한 + 중복 제거 후 2점 이상 (실패 시 기존 경로 보존) */
+    int n = 0, last = 0;
+    for (int i = 0; i < count; i++) {
+        if (!isfinite(pX[i]) || !isfinite(pY[i])) {
+            return -1;
+        }
+        if (n > 0) {
+            float dx = pX[i] - pX[last];
+            float dy = pY[i] - pY[last];
+            if (sqrtf(dx * dx + dy * dy) < PATH_MIN_SPACING) continue;
+        }
+        last = i;
+        n++;
+    }
+    if (n < 2) {
+        return -1;
+    }
+
+    /* 2) 기록 */
+    n = 0;
+    for (int i = 0; i < count; i++) {
+        if (n > 0) {
+            float dx = pX[i] - pPath->X[n - 1];
+            float dy = pY[i] - pPath->Y[n - 1];
+            float ds = sqrtf(dx * dx + dy * dy);
+            if (ds < PATH_MIN_SPACING) continue;   /* 중복 점 제거 */
+            pPath->S[n] = pPath->S[n - 1] + ds;
+        } else {
+            pPath->S[0] = 0.0f;
+        }
+        pPath->X[n] = pX[i];
+        pPath->Y[n] = pY[i];
+        n++;
+    }
+    pPath->Num_Points = n;
+    return n;
+}
+
+void lane_path_tracker_reset(LanePathTracker_t *pTrk)
+{
+    if (!pTrk) {
+        return;
+    }
+    memset(pTrk, 0, sizeof(LanePathTracker_t));
+}
+
+/*---------------------------------------------------------
+ * lane_path_find_segment : S[i] <= s < S[i+1]
+ *---------------------------------------------------------*/
+int lane_path_find_segment(const LanePath_t *pPath, float s)
+{
+    if (!pPath || pPath->Num_Points < 2) {
+        return -1;
+    }
+    int lo = 0, hi = pPath->Num_Points - 2;
+    if (!(s > pPath->S[0])) return 0;   /* NaN 포함 */
+    while (lo < hi) {
+        int mid = (lo + hi + 1) >> 1;
+        if (pPath->S[mid] <= s) lo = mid;
+        else                    hi = mid - 1;
+    }
+    return lo;
+}
+
+/*---------------------------------------------------------
+ * lane_path_localize
+ *---------------------------------------------------------*/
+int lane_path_localize(const LanePath_t       *pPath,
+                       LanePathTracker_t      *pTrk,
+                       const LanePathPose_t   *pPose,
+                       LanePathProjection_t   *pProj)
+{
+    if (!pPath || !pTrk || !pPose || !pProj || pPath->Num_Points < 2) {
+        return -1;
+    }
+    float px = pPose->X, py = pPose->Y;
+    if (!isfinite(px) || !isfinite(py)) {
+        return -1;
+    }
+
+    const int   lastSeg  = pPath->Num_Points - 2;
+    const float relocD2  = LANE_PATH_RELOC_DISTANCE * LANE_PATH_RELOC_DISTANCE;
+    int   seg   = -1;
+    float bestD = INFINITY;
+    float t;
+
+    /* 1) 전방 국소 탐색 : 거리가 증가하기 시작하면 중단 */
+    if (pTrk->Valid) {
+        int i = clamp_segment(pPath, pTrk->Segment);
+        bestD = project_segment(pPath, i, px, py, &t);
+        int end = i + LANE_PATH_LOCAL_WINDOW;
+        if (end > lastSeg) end = lastSeg;
+        bool exhausted = true;
+        for (int j = i + 1; j <= end; j++) {
+            float d = project_segment(pPath, j, px, py, &t);
+            if (d > bestD) { exhausted = false; break; }
+            bestD = d;
+            i = j;
+        }
+        if (i == lastSeg) exhausted = false;
+        if (!exhausted && bestD <= relocD2) {
+            seg = i;
+            pTrk->Local_Count++;
+        }
+    }
+
+    /* 2) 재위치 추정 */
+    if (seg < 0) {
+        pTrk->Reloc_Count++;
+        if (pTrk->Valid) {
+            /* 이동거리로 S 추정 → 이분 탐색 → 양방향 국소 보정 */
+            float mx = px - pTrk->Last_X;
+            float my = py - pTrk->Last_Y;
+            float sHint = pTrk->Last_S + sqrtf(mx * mx + my * my);
+            int c = lane_path_find_segment(pPath, sHint);
+            seg = nearest_in_range(pPath,
+                                   clamp_segment(pPath, c - LANE_PATH_LOCAL_WINDOW),
+                                   clamp_segment(pPath, c + LANE_PATH_LOCAL_WINDOW),
+                                   px, py, &bestD);
+        }
+        if (seg < 0 || bestD > relocD2) {
+            /* 전역 : 성긴 간격 스캔 후 주변 보정 */
+            int c = 0;
+            float cd = INFINITY;
+            for (int i = 0; i <= lastSeg; i += COARSE_STRIDE) {
+                float d = project_segment(pPath, i, px, py, &t);
+                if (d < cd) { cd = d; c = i; }
+            }
+            seg = nearest_in_range(pPath,
+                                   clamp_segment(pPath, c - COARSE_STRIDE),
+                                   clamp_segment(pPath, c + COARSE_STRIDE),
+                                   px, py, &bestD);
+        }
+    }
+
+    /* 3) 투영 결과 */
+    project_segment(pPath, seg, px, py, &t);
+    float ax = pPath->X[seg],     ay = pPath->Y[seg];
+    float dx = pPath->X[seg + 1] - ax;
+    float dy = pPath->Y[seg + 1] - ay;
+    float len = pPath->S[seg + 1] - pPath->S[seg];
+
+    pProj->Segment       = seg;
+    pProj->X             = ax + t * dx;
+    pProj->Y             = ay + t * dy;
+    pProj->S             = pPath->S[seg] + t * len;
+    pProj->Lateral_Error = (dx * (py - ay) - dy * (px - ax)) / len;
+
+    if (!pTrk->Valid || pTrk->Lookahead_Segment < seg) {
+        pTrk->Lookahead_Segment = seg;
+    }
+    pTrk->Valid   = true;
+    pTrk->Segment = seg;
+    pTrk->Last_S  = pProj->S;
+    pTrk->Last_X  = px;
+    pTrk->Last_Y  = py;
+    return 0;
+}
+
+/*---------------------------------------------------------
+ * lane_path_point_at
+ *---------------------------------------------------------*/
+int lane_path_point_at(const LanePath_t  *pPath,
+                       LanePathTracker_t *pTrk,
+                       float              s,
+                       float             *pX,
+                       float             *pY)
+{
+    if (!pPath || !pTrk || !pX || !pY || pPath->Num_Points < 2 || isnan(s)) {
+        return -1;
+    }
+    const int lastSeg = pPath->Num_Points - 2;
+    if (s < 0.0f)                   s = 0.0f;
+    if (s > pPath->S[lastSeg + 1])  s = pPath->S[lastSeg + 1];
+
+    int i = clamp_segment(pPath, pTrk->Lookahead_Segment);
+    if (!pTrk->Valid || pPath->S[i] > s) {
+        i = lane_path_find_segment(pPath, s);      /* 후진 / 최초 */
+    } else {
+        while (i < lastSeg && pPath->S[i + 1] <= s) i++;   /* 전방 진행 */
+    }
+    pTrk->Lookahead_Segment = i;
+
+    float len = pPath->S[i + 1] - pPath->S[i];
+    float t   = (s - pPath->S[i]) / len;
+    if (t > 1.0f) t = 1.0f;
+    *pX = pPath->X[i] + t * (pPath->X[i + 1] - pPath->X[i]);
+    *pY = pPath->Y[i] + t * (pPath->Y[i + 1] - pPath->Y[i]);
+    return 0;
+}
@@ -0,0 +1,114 @@
+/****************************************************************************
+ * lane_path.h
+ *
+ * - 차선 중심 Waypoint Polyline (최대 LANE_PATH_MAX_POINTS 점)
+ * - X/Y/S(누적 거리) 평면 배열, 캐시 라인 정렬 → 탐색 루프가 캐시에 상주
+ * - 추적기(Tracker)가 직전 구간 인덱스를 보관, 다음 틱은 전방 국소 탐색(상각 O(1))
+ * - 국소 탐색 실패(재위치 추정) 시 누적 거리 S 에 대한 이분 탐색으로 복귀
+ ****************************************************************************/
+#ifndef LANE_PATH_H
+#define LANE_PATH_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define LANE_PATH_MAX_POINTS       4096
+#define LANE_PATH_LOCAL_WINDOW     16     /* 전방 국소 탐색 최대 구간 수 */
+#define LANE_PATH_RELOC_DISTANCE   5.0f   /* [m] 이 거리 이상 벗어나면 재위치 추정 */
+
+#if defined(_MSC_VER)
+#define LANE_PATH_ALIGN __declspec(align(64))
+#else
+#define LANE_PATH_ALIGN __attribute__((aligned(64)))
+#endif
+
+/**
+ * @brief Waypoint Polyline (월드 좌표계)
+ */
+typedef struct {
+    LANE_PATH_ALIGN float X[LANE_PATH_MAX_POINTS];   /* [m] */
+    LANE_PATH_ALIGN float Y[LANE_PATH_MAX_POINTS];   /* [m] */
+    LANE_PATH_ALIGN float S[LANE_PATH_MAX_POINTS];   /* 누적 거리 [m], 단조 증가 */
+    int Num_Points;
+} LanePath_t;
+
+/**
+ * @brief 차량 자세 (월드 좌표계)
+ */
+typedef struct {
+    float X;        /* [m] */
+    float Y;        /* [m] */
+    float Heading;  /* [°], X축 기준 반시계 + */
+} LanePathPose_t;
+
+/**
+ * @brief 틱 간 탐색 상태
+ */
+typedef struct {
+    bool     Valid;
+    int      Segment;           /* 최근 최근접 구간 (점 i → i+1) */
+    int      Lookahead_Segment; /* 최근 Look-ahead 구간 */
+    float    Last_S;            /* 최근 투영점 누적 거리 [m] */
+    float    Last_X, Last_Y;    /* 최근 자세 */
+    uint32_t Local_Count;       /* 국소 탐색 성공 횟수 */
+    uint32_t Reloc_Count;       /* 재위치 추정 횟수 */
+} LanePathTracker_t;
+
+/**
+ * @brief 최근접 투영 결과
+ */
+typedef struct {
+    int   Segment;
+    float S;               /* 투영점 누적 거리 [m] */
+    float X, Y;            /* 투영점 */
+    float Lateral_Error;   /* [m], 진행 방향 좌측 + */
+} LanePathProjection_t;
+
+/**
+ * @brief Polyline 설정 (S 계산 포함)
+ *        - 중복 점(간격 < 1e-4 m)은 제거
+ *        - 전 점을 먼저 검증 → 오류 시 기존 경로 그대로 유지
+ * @return 저장된 점 개수, 오류 시 음수
+ */
+int lane_path_set(LanePath_t *pPath, const float *pX, const float *pY, int count);
+
+/**
+ * @brief 추적기 초기화 (다음 localize 는 전역 재위치 추정)
+ */
+void lane_path_tracker_reset(LanePathTracker_t *pTrk);
+
+/**
+ * @brief 최근접 구간 찾기
+ *        1) 유효 추적기 → 직전 구간부터 전방 국소 탐색
+ *        2) 실패 시 S 이분 탐색(이동거리 기반 추정) + 양방향 국소 보정
+ * @return 0 on success, negative on error
+ */
+int lane_path_localize(const LanePath_t       *pPath,
+                       LanePathTracker_t      *pTrk,
+                       const LanePathPose_t   *pPose,
+                       LanePathProjection_t   *pProj);
+
+/**
+ * @brief 누적 거리 s 위치의 점 (추적기의 Look-ahead 구간부터 전방 탐색)
+ * @return 0 on success, negative on error
+ */
+int lane_path_point_at(const LanePath_t  *pPath,
+                       LanePathTracker_t *pTrk,
+                       float              s,
+                       float             *pX,
+                       float             *pY);
+
+/**
+ * @brief 누적 거리 S 이분 탐색: S[i] <= s < S[i+1] 인 i
+ */
+int lane_path_find_segment(const LanePath_t *pPath, float s);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LANE_PATH_H */
@@ -0,0 +1,174 @@
+/*********************************************************************
+ * lane_path_test.cpp  ―  차선 중심 Polyline 탐색 UT
+ * DUT : lane_path_set / localize / point_at / find_segment (lane_path.c)
+ *********************************************************************/
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "lane_path.h"
+
+static constexpr float TOL = 1e-3f;
+
+class LanePathTest : public ::testing::Test
+{
+protected:
+    static LanePath_t path;     /* 48KB+ → static */
+    LanePathTracker_t trk;
+
+    void SetUp() override {
+        lane_path_tracker_reset(&trk);
+    }
+    /* x 축 방향 직선, 간격 1m */
+    void makeStraight(int n) {
+        std::vector<float> x(n), y(n, 0.0f);
+        for (int i = 0; i < n; i++) x[i] = (float)i;
+        ASSERT_EQ(lane_path_set(&path, x.data(), y.data(), n), n);
+    }
+    /* 원호 (반경 R, 좌회전), 간격 ds */
+    void makeArc(int n, float R, float ds) {
+        std::vector<float> x(n), y(n);
+        for (int i = 0; i < n; i++) {
+            float th = ds * i / R;
+            x[i] = R * std::sin(th);
+            y[i] = R * (1.0f - std::cos(th));
+        }
+        ASSERT_EQ(lane_path_set(&path, x.data(), y.data(), n), n);
+    }
+    LanePathProjection_t loc(float x, float y) {
+        LanePathProjection_t p{};
+        LanePathPose_t pose{ x, y, 0.0f };
+        EXPECT_EQ(lane_path_localize(&path, &trk, &pose, &p), 0);
+        return p;
+    }
+};
+LanePath_t LanePathTest::path;
+
+/* 정렬 : 평면 배열 64B 정렬 */
+TEST_F(LanePathTest, TC_LPATH_EQ_01)
+{
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(path.X) % 64u, 0u);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(path.Y) % 64u, 0u);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(path.S) % 64u, 0u);
+}
+
+/* 누적 거리 / 중복 점 제거 */
+TEST_F(LanePathTest, TC_LPATH_EQ_02)
+{
+    float x[] = { 0.0f, 3.0f, 3.0f, 3.0f };
+    float y[] = { 0.0f, 4.0f, 4.0f, 8.0f };
+    ASSERT_EQ(lane_path_set(&path, x, y, 4), 3);
+    EXPECT_NEAR(path.S[1], 5.0f, TOL);
+    EXPECT_NEAR(path.S[2], 9.0f, TOL);
+}
+
+/* 이분 탐색 */
+TEST_F(LanePathTest, TC_LPATH_EQ_03)
+{
+    makeStraight(100);
+    EXPECT_EQ(lane_path_find_segment(&path, -1.0f), 0);
+    EXPECT_EQ(lane_path_find_segment(&path, 0.0f), 0);
+    EXPECT_EQ(lane_path_find_segment(&path, 41.5f), 41);
+    EXPECT_EQ(lane_path_find_segment(&path, 42.0f), 42);
+    EXPECT_EQ(lane_path_find_segment(&path, 500.0f), 98);
+}
+
+/* 투영 / 횡오차 부호 (좌측 +) */
+TEST_F(LanePathTest, TC_LPATH_EQ_04)
+{
+    makeStraight(100);
+    LanePathProjection_t p = loc(10.5f, 1.2f);
+    EXPECT_EQ(p.Segment, 10);
+    EXPECT_NEAR(p.S, 10.5f, TOL);
+    EXPECT_NEAR(p.Lateral_Error, 1.2f, TOL);
+    p = loc(11.0f, -0.7f);
+    EXPECT_NEAR(p.Lateral_Error, -0.7f, TOL);
+}
+
+/* 연속 주행 : 첫 틱만 재위치 추정, 이후 국소 탐색 */
+TEST_F(LanePathTest, TC_LPATH_EQ_05)
+{
+    makeArc(4000, 300.0f, 0.5f);
+    for (int k = 0; k < 1500; k++) {
+        float s = 0.7f * k;
+        float th = s / 300.0f;
+        LanePathProjection_t p = loc(300.0f * std::sin(th), 300.0f * (1.0f - std::cos(th)));
+        ASSERT_NEAR(p.S, s, 0.05f) << "k=" << k;
+    }
+    EXPECT_EQ(trk.Reloc_Count, 1u);
+    EXPECT_EQ(trk.Local_Count, 1499u);
+}
+
+/* 순간이동(국소 창 초과) → 이분 탐색 재위치 추정 */
+TEST_F(LanePathTest, TC_LPATH_BV_01)
+{
+    makeStraight(4000);
+    loc(10.0f, 0.0f);
+    LanePathProjection_t p = loc(2500.3f, 0.5f);
+    EXPECT_EQ(p.Segment, 2500);
+    EXPECT_EQ(trk.Reloc_Count, 2u);
+    p = loc(2501.0f, 0.5f);
+    EXPECT_EQ(trk.Reloc_Count, 2u);
+    EXPECT_NEAR(p.S, 2501.0f, TOL);
+}
+
+/* 후진 → 재위치 추정 후에도 정확한 투영 */
+TEST_F(LanePathTest, TC_LPATH_BV_02)
+{
+    makeStraight(1000);
+    loc(500.0f, 0.0f);
+    LanePathProjection_t p = loc(100.0f, 0.0f);
+    EXPECT_NEAR(p.S, 100.0f, TOL);
+}
+
+/* Look-ahead 점 : 경로 끝 클램프 */
+TEST_F(LanePathTest, TC_LPATH_BV_03)
+{
+    makeStraight(50);
+    loc(0.0f, 0.0f);
+    float x, y;
+    ASSERT_EQ(lane_path_point_at(&path, &trk, 12.25f, &x, &y), 0);
+    EXPECT_NEAR(x, 12.25f, TOL);
+    ASSERT_EQ(lane_path_point_at(&path, &trk, 1000.0f, &x, &y), 0);
+    EXPECT_NEAR(x, 49.0f, TOL);
+    ASSERT_EQ(lane_path_point_at(&path, &trk, 3.0f, &x, &y), 0);   /* 후방 */
+    EXPECT_NEAR(x, 3.0f, TOL);
+}
+
+/* 무효 입력 */
+TEST_F(LanePathTest, TC_LPATH_RA_01)
+{
+    float x[] = { 0.0f, NAN };
+    float y[] = { 0.0f, 1.0f };
+    EXPECT_LT(lane_path_set(&path, x, y, 2), 0);
+    EXPECT_LT(lane_path_set(&path, x, y, 1), 0);
+    EXPECT_LT(lane_path_set(&path, x, y, LANE_PATH_MAX_POINTS + 1), 0);
+
+    makeStraight(10);
+    LanePathPose_t pose{ NAN, 0.0f, 0.0f };
+    LanePathProjection_t p;
+    EXPECT_LT(lane_path_localize(&path, &trk, &pose, &p), 0);
+    float px, py;
+    EXPECT_LT(lane_path_point_at(&path, &trk, NAN, &px, &py), 0);
+}
+
+/* 설정 실패 (중간 NaN / 중복 제거 후 1점) → 기존 경로 유지 */
+TEST_F(LanePathTest, TC_LPATH_RA_02)
+{
+    makeStraight(10);
+    static LanePath_t before;
+    before = path;
+
+    float x[] = { 0.0f, 5.0f, NAN, 7.0f };
+    float y[] = { 0.0f, 1.0f, 2.0f, 3.0f };
+    EXPECT_LT(lane_path_set(&path, x, y, 4), 0);
+    float dupX[] = { 3.0f, 3.0f, 3.0f };
+    float dupY[] = { 1.0f, 1.0f, 1.0f };
+    EXPECT_LT(lane_path_set(&path, dupX, dupY, 3), 0);
+
+    EXPECT_EQ(std::memcmp(&path, &before, sizeof(LanePath_t)), 0);
+    LanePathProjection_t p = loc(4.5f, 0.5f);
+    EXPECT_NEAR(p.S, 4.5f, 1e-5f);
+}
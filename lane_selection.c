@@ -1,37 +1,30 @@
 #include <math.h>
 #include <string.h>
 #include "lane_selection.h"
+#include "fast_math.h"
 
 /*---------------------------------------------------------
- * LaneSelection
- * - 설계서 2.2.3 "Lane Selection" 기능
+ * 차선 입력만으로 정해지는 출력 (유형 / 곡선 / 전이 / 오프셋 / 폭 / 차로 내 / 차로 변경)
  *---------------------------------------------------------*/
-int LaneSelection(const LaneData_t *pLaneData,
-                         const EgoData_t  *pEgoData,
-                         LaneSelectOutput_t *pLaneOut)
+static void lane_part(const LaneData_t *pLaneData, LaneSelectOutput_t *pLaneOut)
 {
-    if(!pLaneData || !pEgoData || !pLaneOut) {
-        return -1; /* invalid argument */
-    }
-
-    /* 초기화 (출력 구조체) */
-    memset(pLaneOut, 0, sizeof(LaneSelectOutput_t));
-
     /*------------------------------------------------------
      1) 차선 유형 판단 (직선 / 곡선) 및 곡률 전이
     ------------------------------------------------------*/
     /* Lane_Type 은 enum (직선, 곡선) */
     pLaneOut->LS_Lane_Type = pLaneData->Lane_Type; 
-    /* 곡선 여부: 곡률 반경 < 800 => 곡선 */
-    if(pLaneData->Lane_Curvature > 0.0f && pLaneData->Lane_Curvature < LANE_CURVE_THRESHOLD) {
+    /* 곡선 여부: |곡률 반경| < 800 => 곡선 (부호 = 좌/우, 0 = 데이터 없음) */
+    float radius     = fabsf(pLaneData->Lane_Curvature);
+    float nextRadius = fabsf(pLaneData->Next_Lane_Curvature);
+    if(radius > 0.0f && radius < LANE_CURVE_THRESHOLD) {
         pLaneOut->LS_Is_Curved_Lane = true;
     } else {
         pLaneOut->LS_Is_Curved_Lane = false;
     }
 
     /* 곡률 전이 */
-    if(pLaneData->Lane_Curvature > 0.0f && pLaneData->Next_Lane_Curvature > 0.0f) {
-        float curvature_diff = fabsf(pLaneData->Next_Lane_Curvature - pLaneData->Lane_Curvature);
+    if(radius > 0.0f && nextRadius > 0.0f) {
+        float curvature_diff = fabsf(nextRadius - radius);
         if(curvature_diff > LANE_CURVE_DIFF_THRESHOLD) {
             pLaneOut->LS_Curve_Transition_Flag = true;
         } else {
@@ -42,17 +35,6 @@ int LaneSelection(const LaneData_t *pLaneData,
         pLaneOut->LS_Curve_Transition_Flag = false;
     }
 
-    /*------------------------------------------------------
-     2) 진행 방향 오차, 차선 중심 오차
-    ------------------------------------------------------*/
-    /* heading_diff_raw = Ego_Heading - Lane_Heading */
-    float heading_diff_raw = pEgoData->Ego_Heading - pLaneData->Lane_Heading;
-    /* 정규화(±180) */
-    while(heading_diff_raw >  180.0f) heading_diff_raw -= 360.0f;
-    while(heading_diff_raw < -180.0f) heading_diff_raw += 360.0f;
-
-    pLaneOut->LS_Heading_Error = heading_diff_raw;
-
     /* Lane Offset / Width */
     pLaneOut->LS_Lane_Offset = pLaneData->Lane_Offset; 
     pLaneOut->LS_Lane_Width  = pLaneData->Lane_Width;
@@ -74,6 +56,81 @@ int LaneSelection(const LaneData_t *pLaneData,
     } else {
         pLaneOut->LS_Is_Changing_Lane = true;
     }
+}
+
+/*------------------------------------------------------
+ 2) 진행 방향 오차 (Ego Heading 의존 → 매 틱 계산)
+------------------------------------------------------*/
+static void heading_part(const LaneData_t *pLaneData, const EgoData_t *pEgoData,
+                         LaneSelectOutput_t *pLaneOut)
+{
+    /* heading_diff_raw = Ego_Heading - Lane_Heading */
+    float heading_diff_raw = pEgoData->Ego_Heading - pLaneData->Lane_Heading;
+    /* 정규화(±180) */
+#ifdef ADAS_USE_FAST_MATH
+    heading_diff_raw = adas_wrap_deg180(heading_diff_raw);
+#else
+    /* 큰 값 / ±inf : 반복 상한 (target_selection.c normalize_heading 과 같은 처리) */
+    if (!(fabsf(heading_diff_raw) <= 540.0f)) heading_diff_raw = fmodf(heading_diff_raw, 360.0f);
+    while(heading_diff_raw >  180.0f) heading_diff_raw -= 360.0f;
+    while(heading_diff_raw < -180.0f) heading_diff_raw += 360.0f;
+#endif
 
+    pLaneOut->LS_Heading_Error = heading_diff_raw;
+}
+
+/*---------------------------------------------------------
+ * LaneSelection
+ * - 설계서 2.2.3 "Lane Selection" 기능
+ *---------------------------------------------------------*/
+int LaneSelection(const LaneData_t *pLaneData,
+                         const EgoData_t  *pEgoData,
+                         LaneSelectOutput_t *pLaneOut)
+{
+    if(!pLaneData || !pEgoData || !pLaneOut) {
+        return -1; /* invalid argument */
+    }
+
+    /* 초기화 (출력 구조체) */
+    memset(pLaneOut, 0, sizeof(LaneSelectOutput_t));
+
+    lane_part(pLaneData, pLaneOut);
+    heading_part(pLaneData, pEgoData, pLaneOut);
+    return 0;
+}
+
+/*---------------------------------------------------------
+ * LaneSelectionIncremental
+ * - LaneData_t 가 직전 계산과 비트 동일하면 차선 부분 재사용
+ *---------------------------------------------------------*/
+void LaneSelectionMemoReset(LaneSelectionMemo_t *pMemo)
+{
+    if(!pMemo) return;
+    memset(pMemo, 0, sizeof(*pMemo));
+}
+
+int LaneSelectionIncremental(const LaneData_t *pLaneData,
+                             const EgoData_t  *pEgoData,
+                             LaneSelectOutput_t *pLaneOut,
+                             LaneSelectionMemo_t *pMemo)
+{
+    if(!pMemo) {
+        return LaneSelection(pLaneData, pEgoData, pLaneOut);
+    }
+    if(!pLaneData || !pEgoData || !pLaneOut) {
+        return -1; /* invalid argument */
+    }
+
+    pMemo->Calls++;
+    if(pMemo->Valid && memcmp(&pMemo->Key, pLaneData, sizeof(LaneData_t)) == 0) {
+        pMemo->Hits++;
+    } else {
+        memset(&pMemo->Lane_Part, 0, sizeof(LaneSelectOutput_t));
+        lane_part(pLaneData, &pMemo->Lane_Part);
+        memcpy(&pMemo->Key, pLaneData, sizeof(LaneData_t));
+        pMemo->Valid = 1;
+    }
+    *pLaneOut = pMemo->Lane_Part;
+    heading_part(pLaneData, pEgoData, pLaneOut);
     return 0;
 }
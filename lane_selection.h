@@ -1,6 +1,7 @@
 #ifndef LANE_SELECTION_H
 #define LANE_SELECTION_H
 
+#include <stdint.h>
 #include "adas_shared.h"  /* LaneData_t, EgoData_t, LaneSelectOutput_t, etc. */
 
 #ifdef __cplusplus
@@ -31,6 +32,29 @@ int LaneSelection(const LaneData_t *pLaneData,
                          const EgoData_t  *pEgoData,
                          LaneSelectOutput_t *pLaneOut);
 
+/* 증분 평가 상태 : 직전 LaneData_t 와 차선 부분 출력 */
+typedef struct {
+    LaneData_t         Key;
+    LaneSelectOutput_t Lane_Part;       /* LS_Heading_Error 제외 */
+    int32_t            Valid;
+    uint64_t           Calls;
+    uint64_t           Hits;            /* 차선 부분 재사용 횟수 */
+} LaneSelectionMemo_t;
+
+void LaneSelectionMemoReset(LaneSelectionMemo_t *pMemo);
+
+/**
+ * @brief LaneSelection 증분 평가판 (결과는 LaneSelection 과 비트 동일)
+ *        LaneData_t 가 직전 호출과 비트 동일하면 차선 부분(유형/곡선/전이/오프셋/폭/
+ *        차로 내/차로 변경)을 재사용하고 Ego Heading 의존 항(Heading Error)만 계산
+ * @param[in,out] pMemo : NULL 이면 LaneSelection 과 같음
+ * @return 0 on success, negative on error
+ */
+int LaneSelectionIncremental(const LaneData_t *pLaneData,
+                             const EgoData_t  *pEgoData,
+                             LaneSelectOutput_t *pLaneOut,
+                             LaneSelectionMemo_t *pMemo);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,118 @@
+/*********************************************************************
+ * lane_selection_incremental_test.cpp  ―  LaneSelection 증분 평가 (차선 입력 memo) + 부호 있는 곡률
+ * DUT : LaneSelectionIncremental / LaneSelectionMemoReset / LaneSelection (lane_selection.c)
+ *
+ * - lane_selection_test.cpp 는 빌드에서 빠져 있어 빌드되는 LaneSelection 시험은 이 파일에 둠
+ *********************************************************************/
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <cstring>
+
+#include "lane_selection.h"
+#include "test_rng.hpp"
+
+namespace {
+
+class LaneSelectionIncrementalTest : public ::testing::Test {
+protected:
+    LaneData_t         laneData;
+    EgoData_t          egoData;
+    LaneSelectOutput_t lsOutput;
+
+    void SetUp() override
+    {
+        std::memset(&laneData, 0, sizeof(laneData));
+        std::memset(&egoData,  0, sizeof(egoData));
+        std::memset(&lsOutput, 0, sizeof(lsOutput));
+        laneData.Lane_Curvature      = 1000.0f;
+        laneData.Next_Lane_Curvature = 1000.0f;
+        laneData.Lane_Width          = 3.5f;
+        laneData.Lane_Change_Status  = LANE_CHANGE_KEEP;
+        laneData.Lane_Type           = LANE_TYPE_STRAIGHT;
+    }
+};
+
+/* TC_LS_INC_01 : 증분 평가 = LaneSelection (같은 차선 입력 반복 + 변화 섞인 무작위 열)
+   기대: 모든 호출에서 출력 비트 동일, 차선 입력이 같으면 적중 */
+TEST_F(LaneSelectionIncrementalTest, TC_LS_INC_01)
+{
+    LaneSelectionMemo_t memo;
+    LaneSelectionMemoReset(&memo);
+    TestRng rng(44u);
+
+    uint64_t expectHits = 0;
+    for (int i = 0; i < 2000; i++) {
+        if (i > 0 && rng.uni(0.0f, 1.0f) < 0.7f) {
+            expectHits++;                                   /* 차선 입력 유지 */
+        } else {
+            laneData.Lane_Type           = (rng.uni(0.0f, 1.0f) < 0.5f) ? LANE_TYPE_STRAIGHT : LANE_TYPE_CURVE;
+            laneData.Lane_Curvature      = rng.uni(0.0f, 1500.0f);
+            laneData.Next_Lane_Curvature = rng.uni(0.0f, 1500.0f);
+            laneData.Lane_Offset         = rng.uni(-2.5f, 2.5f);
+            laneData.Lane_Heading        = rng.uni(-190.0f, 190.0f);
+            laneData.Lane_Width          = rng.uni(2.5f, 4.0f);
+            laneData.Lane_Change_Status  = (LaneChangeStatus_e)((int)rng.uni(0.0f, 2.99f));
+        }
+        egoData.Ego_Heading = rng.uni(-200.0f, 200.0f);         /* 매 틱 변화 */
+
+        LaneSelectOutput_t ref, inc;
+        std::memset(&inc, 0xA5, sizeof(inc));
+        ASSERT_EQ(LaneSelection(&laneData, &egoData, &ref), 0);
+        ASSERT_EQ(LaneSelectionIncremental(&laneData, &egoData, &inc, &memo), 0);
+        ASSERT_EQ(std::memcmp(&ref, &inc, sizeof(ref)), 0) << "call " << i;
+    }
+    EXPECT_EQ(memo.Calls, 2000u);
+    EXPECT_EQ(memo.Hits, expectHits);
+}
+
+/* TC_LS_INC_02 : 증분 평가 인자 오류 / memo 없음 */
+TEST_F(LaneSelectionIncrementalTest, TC_LS_INC_02)
+{
+    LaneSelectionMemo_t memo;
+    LaneSelectionMemoReset(&memo);
+    EXPECT_EQ(LaneSelectionIncremental(nullptr, &egoData, &lsOutput, &memo), -1);
+    EXPECT_EQ(LaneSelectionIncremental(&laneData, nullptr, &lsOutput, &memo), -1);
+    EXPECT_EQ(LaneSelectionIncremental(&laneData, &egoData, nullptr, &memo), -1);
+    EXPECT_EQ(memo.Calls, 0u);
+    EXPECT_EQ(LaneSelectionIncremental(&laneData, &egoData, &lsOutput, nullptr), 0);
+    EXPECT_TRUE(lsOutput.LS_Is_Within_Lane);
+}
+
+/* TC_LS_INC_03 : 우곡선(음수 반경) = 같은 크기의 좌곡선 (곡선 / 전이 판정), 0 = 데이터 없음
+   기대: |R| < 800 이면 곡선, 두 반경 모두 있고 ||Rn| - |R|| > 400 이면 전이 (증분 평가도 같음) */
+TEST_F(LaneSelectionIncrementalTest, TC_LS_INC_03)
+{
+    struct Case { float r, next; bool curved, transition; };
+    const Case cases[] = {
+        { -500.0f,     0.0f, true,  false },
+        { -500.0f, -1000.0f, true,  true  },
+        { -500.0f,  1000.0f, true,  true  },                /* 우 → 좌 */
+        {  500.0f,  -600.0f, true,  false },                /* S 자 : 크기 차 100 */
+        { -799.0f,  -799.0f, true,  false },
+        { -800.0f, -1300.0f, false, true  },
+        { -1500.0f,   -0.0f, false, false },
+        {   -0.0f,  -300.0f, false, false },                /* -0 = 데이터 없음 */
+    };
+    LaneSelectionMemo_t memo;
+    LaneSelectionMemoReset(&memo);
+    for (const Case &c : cases) {
+        laneData.Lane_Curvature      = c.r;
+        laneData.Next_Lane_Curvature = c.next;
+        LaneSelectOutput_t inc;
+        ASSERT_EQ(LaneSelection(&laneData, &egoData, &lsOutput), 0);
+        ASSERT_EQ(LaneSelectionIncremental(&laneData, &egoData, &inc, &memo), 0);
+        EXPECT_EQ(lsOutput.LS_Is_Curved_Lane, c.curved) << c.r << "," << c.next;
+        EXPECT_EQ(lsOutput.LS_Curve_Transition_Flag, c.transition) << c.r << "," << c.next;
+        EXPECT_EQ(std::memcmp(&lsOutput, &inc, sizeof(inc)), 0);
+
+        /* 좌우 대칭 */
+        LaneSelectOutput_t mirror;
+        laneData.Lane_Curvature      = -c.r;
+        laneData.Next_Lane_Curvature = -c.next;
+        ASSERT_EQ(LaneSelection(&laneData, &egoData, &mirror), 0);
+        EXPECT_EQ(mirror.LS_Is_Curved_Lane, c.curved);
+        EXPECT_EQ(mirror.LS_Curve_Transition_Flag, c.transition);
+    }
+}
+
+}  // namespace
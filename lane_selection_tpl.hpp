@@ -0,0 +1,69 @@
+/****************************************************************************
+ * lane_selection_tpl.hpp
+ *
+ * - LaneSelection (lane_selection.c) 의 컴파일 타임 구성 템플릿
+ * - adas::LaneSelection<adas::DefaultConfig> == ::LaneSelection
+ * - Cfg::CurveHandling == false : 곡선 / 곡률 전이 판정 제거 (항상 false)
+ ****************************************************************************/
+#ifndef LANE_SELECTION_TPL_HPP
+#define LANE_SELECTION_TPL_HPP
+
+#include <cmath>
+#include <cstring>
+
+#include "adas_config.hpp"
+#include "lane_selection.h"
+#include "fast_math.h"
+
+namespace adas {
+
+template <class Cfg = DefaultConfig>
+int LaneSelection(const LaneData_t  *pLaneData,
+                  const EgoData_t   *pEgoData,
+                  LaneSelectOutput_t *pLaneOut)
+{
+    static_assert(config_is_valid<Cfg>(), "");
+
+    if (!pLaneData || !pEgoData || !pLaneOut) {
+        return -1;
+    }
+    std::memset(pLaneOut, 0, sizeof(LaneSelectOutput_t));
+
+    /* 1) 차선 유형 / 곡률 전이 */
+    pLaneOut->LS_Lane_Type = pLaneData->Lane_Type;
+    if constexpr (Cfg::CurveHandling) {
+        /* 부호 있는 반경 (+ 좌, - 우) → |반경| 으로 판정, 0 = 데이터 없음 */
+        float radius     = fabsf(pLaneData->Lane_Curvature);
+        float nextRadius = fabsf(pLaneData->Next_Lane_Curvature);
+        pLaneOut->LS_Is_Curved_Lane = (radius > 0.0f && radius < Cfg::LaneCurveThreshold);
+        if (radius > 0.0f && nextRadius > 0.0f) {
+            float curvature_diff = fabsf(nextRadius - radius);
+            pLaneOut->LS_Curve_Transition_Flag = (curvature_diff > Cfg::LaneCurveDiffThreshold);
+        }
+    }
+
+    /* 2) 진행 방향 오차 (±180), 차선 중심 오차 */
+    float heading_diff_raw = pEgoData->Ego_Heading - pLaneData->Lane_Heading;
+#ifdef ADAS_USE_FAST_MATH
+    heading_diff_raw = adas_wrap_deg180(heading_diff_raw);
+#else
+    /* lane_selection.c heading_part 과 같은 선 축소 (반복 상한 1 회, ±inf → NaN) */
+    if (!(fabsf(heading_diff_raw) <= 540.0f)) heading_diff_raw = fmodf(heading_diff_raw, 360.0f);
+    while (heading_diff_raw >  180.0f) heading_diff_raw -= 360.0f;
+    while (heading_diff_raw < -180.0f) heading_diff_raw += 360.0f;
+#endif
+    pLaneOut->LS_Heading_Error = heading_diff_raw;
+
+    pLaneOut->LS_Lane_Offset = pLaneData->Lane_Offset;
+    pLaneOut->LS_Lane_Width  = pLaneData->Lane_Width;
+    pLaneOut->LS_Is_Within_Lane = (fabsf(pLaneData->Lane_Offset) < (pLaneData->Lane_Width * 0.5f));
+
+    /* 3) 차로 변경 상태 */
+    pLaneOut->LS_Is_Changing_Lane = (pLaneData->Lane_Change_Status != LANE_CHANGE_KEEP);
+
+    return 0;
+}
+
+} /* namespace adas */
+
+#endif /* LANE_SELECTION_TPL_HPP */
@@ -3,12 +3,24 @@
  *──────────────────────────────────────────────────────────*/
 #include <math.h>
 #include "lfa.h"
+#include "fast_math.h"
 
 /* ───── 상수 ───────────────────────────────────────────────*/
 #define LFA_SPEED_THRESHOLD       (16.67f)     /* 60 km/h */
-static const float LFA_MAX_STEERING_ANGLE = 540.0f;   /* ±540° */
+/* LFA_MAX_STEERING_ANGLE (±540°) 는 adas_shared.h 정의 사용 */
 static const float MIN_VEL                = 0.1f;      /* 분모 보호 최소 속도 */
 
+/* ───── Feed-forward (Preview) 파라미터 ──────────────────────*/
+static const float LFA_WHEELBASE          = 2.875f;    /* [m] */
+static const float LFA_PREVIEW_TIME       = 0.8f;      /* [s] */
+static const float LFA_PREVIEW_MIN_DIST   = 5.0f;      /* [m] */
+static const float LFA_PREVIEW_MAX_DIST   = 60.0f;     /* [m] */
+
+/* ───── Pure Pursuit 파라미터 ───────────────────────────────*/
+static const float PP_LOOKAHEAD_BASE      = 4.0f;      /* Ld0 [m] */
+static const float PP_LOOKAHEAD_GAIN      = 0.6f;      /* k   [s] */
+static const float PP_LOOKAHEAD_MAX       = 40.0f;     /* [m] */
+
 /* ───── 내부 PID 상태 ─────────────────────────────────────*/
 #ifdef UNIT_TEST
 float g_pidIntegral  = 0.0f;   /* 단위시험에서 extern 접근 */
@@ -168,7 +180,7 @@ float calculate_steer_in_high_speed_stanley(const Ego_Data_t    *ego,
     if (vx < MIN_VEL) vx = MIN_VEL;
 
     /* Stanley 계산 */
-    float offsetRad = atanf((g_stanleyGain * cte) / vx);
+    float offsetRad = ADAS_ATANF((g_stanleyGain * cte) / vx);
     float offsetDeg = offsetRad * 180.0f / (float)M_PI;
     float steer     = hdgErr + offsetDeg;
 
@@ -176,28 +188,92 @@ float calculate_steer_in_high_speed_stanley(const Ego_Data_t    *ego,
     return clamp540(steer);
 }
 
-/* ───── 최종 출력 선택 ─────────────────────────────────────*/
-float lfa_output_selection(LFA_Mode_e lfaMode,
-                           float steeringAnglePID,
-                           float steeringAngleStanley,
-                           const Lane_Data_LS_t *pLaneData,
-                           const Ego_Data_t     *pEgoData)
+/* ───── 곡률 Feed-forward ───────────────────────────────*/
+float calculate_steer_feedforward_curvature(const Ego_Data_t     *ego,
+                                            const LaneGeometry_t *geom)
 {
-    if(!pLaneData || !pEgoData)
-    {
+    if (!ego || !geom || geom->Num_Segments <= 0) {
         return 0.0f;
     }
 
-    float steerOut = 0.0f;
-    if(lfaMode == LFA_MODE_LOW_SPEED)
-    {
-        steerOut = steeringAnglePID;
+    float vx = ego->Ego_Velocity_X;
+    if (isnan(vx) || vx < 0.0f) {
+        return 0.0f;
     }
-    else
-    {
-        steerOut = steeringAngleStanley;
+
+    /* Look-ahead 거리 */
+    float la = vx * LFA_PREVIEW_TIME;
+    if (la < LFA_PREVIEW_MIN_DIST) la = LFA_PREVIEW_MIN_DIST;
+    if (la > LFA_PREVIEW_MAX_DIST) la = LFA_PREVIEW_MAX_DIST;
+
+    LaneGeomSample_t smp;
+    lane_geometry_eval(geom, la, &smp);
+    if (!isfinite(smp.Curvature)) {
+        return 0.0f;
     }
 
+    float ffDeg = ADAS_ATANF(LFA_WHEELBASE * smp.Curvature) * 180.0f / (float)M_PI;
+    return clamp540(ffDeg);
+}
+
+float calculate_steer_in_high_speed_stanley_ff(const Ego_Data_t     *ego,
+                                               const Lane_Data_LS_t *lane,
+                                               const LaneGeometry_t *geom)
+{
+    float fb = calculate_steer_in_high_speed_stanley(ego, lane);
+    float ff = calculate_steer_feedforward_curvature(ego, geom);
+    return clamp540(fb + ff);
+}
+
+/* ───── Pure Pursuit ─────────────────────────────────────*/
+float calculate_steer_pure_pursuit(const Ego_Data_t     *ego,
+                                   const LanePath_t     *path,
+                                   LanePathTracker_t    *trk,
+                                   const LanePathPose_t *pose)
+{
+    if (!ego || !path || !trk || !pose) {
+        return 0.0f;
+    }
+    float vx = ego->Ego_Velocity_X;
+    if (isnan(vx) || !isfinite(pose->Heading)) {
+        return 0.0f;
+    }
+    if (vx < 0.0f) vx = 0.0f;
+
+    LanePathProjection_t proj;
+    if (lane_path_localize(path, trk, pose, &proj) != 0) {
+        return 0.0f;
+    }
+
+    float ld = PP_LOOKAHEAD_BASE + PP_LOOKAHEAD_GAIN * vx;
+    if (ld > PP_LOOKAHEAD_MAX) ld = PP_LOOKAHEAD_MAX;
+
+    float tx, ty;
+    if (lane_path_point_at(path, trk, proj.S + ld, &tx, &ty) != 0) {
+        return 0.0f;
+    }
+
+    /* 목표점 → 차량 좌표계 */
+    float yaw = pose->Heading * (float)M_PI / 180.0f;
+    float c = ADAS_COSF(yaw), s = ADAS_SINF(yaw);
+    float dx = tx - pose->X, dy = ty - pose->Y;
+    float lx =  c * dx + s * dy;
+    float ly = -s * dx + c * dy;
+    float dist = sqrtf(lx * lx + ly * ly);
+    if (dist < MIN_VEL) {
+        return 0.0f;   /* 경로 끝 도달 */
+    }
+
+    /* sin(α) = ly / dist, 실제 목표점 거리 사용 */
+    float steerRad = ADAS_ATANF(2.0f * LFA_WHEELBASE * (ly / dist) / dist);
+    return clamp540(steerRad * 180.0f / (float)M_PI);
+}
+
+/* ───── 출력 감쇠/증폭 (공통) ─────────────────────────────*/
+static float lfa_output_shaping(float steerOut,
+                                const Lane_Data_LS_t *pLaneData,
+                                const Ego_Data_t     *pEgoData)
+{
     /* 1) 차선 변경 중이면 자동조향 억제(감쇠) */
     if(pLaneData->LS_Is_Changing_Lane)
     {
@@ -234,4 +310,40 @@ float lfa_output_selection(LFA_Mode_e lfaMode,
     if(steerOut < -LFA_MAX_STEERING_ANGLE) steerOut = -LFA_MAX_STEERING_ANGLE;
 
     return steerOut;
+}
+
+/* ───── 최종 출력 선택 ─────────────────────────────────────*/
+float lfa_output_selection(LFA_Mode_e lfaMode,
+                           float steeringAnglePID,
+                           float steeringAngleStanley,
+                           const Lane_Data_LS_t *pLaneData,
+                           const Ego_Data_t     *pEgoData)
+{
+    if(!pLaneData || !pEgoData)
+    {
+        return 0.0f;
+    }
+
+    float steerOut = 0.0f;
+    if(lfaMode == LFA_MODE_LOW_SPEED)
+    {
+        steerOut = steeringAnglePID;
+    }
+    else
+    {
+        steerOut = steeringAngleStanley;
+    }
+
+    return lfa_output_shaping(steerOut, pLaneData, pEgoData);
+}
+
+float lfa_output_selection_pure_pursuit(float steeringAnglePP,
+                                        const Lane_Data_LS_t *pLaneData,
+                                        const Ego_Data_t     *pEgoData)
+{
+    if(!pLaneData || !pEgoData)
+    {
+        return 0.0f;
+    }
+    return lfa_output_shaping(steeringAnglePP, pLaneData, pEgoData);
 }
\ No newline at end of file
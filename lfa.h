@@ -4,6 +4,9 @@
 #ifndef LFA_H
 #define LFA_H
 
+#include "lane_geometry.h"   /* LaneGeometry_t (Preview / Feed-forward) */
+#include "lane_path.h"       /* LanePath_t (Pure Pursuit) */
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -59,6 +62,40 @@ float calculate_steer_in_low_speed_pid(const Lane_Data_LS_t *pLaneData,
 float calculate_steer_in_high_speed_stanley(const Ego_Data_t    *pEgoData,
                                             const Lane_Data_LS_t *pLaneData);
 
+/**
+ * @brief 곡률 Feed-forward 조향각 계산
+ *        - Look-ahead 거리 = Ego 속도 × Preview 시간 (최소/최대 제한)
+ *        - 해당 지점 차선 곡률 κ 에 대해 atan(Wheelbase × κ) [°]
+ * @param pEgoData Ego 차량 상태 (Ego_Velocity_X)
+ * @param pGeom    차선 중심선 모델 (lane_geometry_update 결과)
+ * @return Steering_Angle_FF (-540 ~ 540) [°], 입력 무효 시 0
+ */
+float calculate_steer_feedforward_curvature(const Ego_Data_t     *pEgoData,
+                                            const LaneGeometry_t *pGeom);
+
+/**
+ * @brief 고속 모드 Stanley + 곡률 Feed-forward
+ *        - 곡선 진입 시 오차가 생기기 전에 조향을 선반영하여 진동 억제
+ */
+float calculate_steer_in_high_speed_stanley_ff(const Ego_Data_t     *pEgoData,
+                                               const Lane_Data_LS_t *pLaneData,
+                                               const LaneGeometry_t *pGeom);
+
+/**
+ * @brief Pure Pursuit 기반 조향각 계산 (차선 중심 Polyline 추종)
+ *        - Look-ahead 거리 Ld = Ld0 + k × Ego_Velocity_X (최소/최대 제한)
+ *        - δ = atan(2 × Wheelbase × sin(α) / Ld) [°]
+ * @param pEgoData 차량 속도
+ * @param pPath    차선 중심 Polyline
+ * @param pTracker 틱 간 구간 탐색 상태 (갱신됨)
+ * @param pPose    차량 자세 (Polyline 과 동일 좌표계)
+ * @return Steering_Angle_PP (-540 ~ 540) [°], 입력 무효 시 0
+ */
+float calculate_steer_pure_pursuit(const Ego_Data_t     *pEgoData,
+                                   const LanePath_t     *pPath,
+                                   LanePathTracker_t    *pTracker,
+                                   const LanePathPose_t *pPose);
+
 /**
  * @brief 최종 LFA 출력 선택 (PID vs Stanley + 감쇠/증폭)
  */
@@ -68,6 +105,14 @@ float lfa_output_selection(LFA_Mode_e lfaMode,
                            const Lane_Data_LS_t *pLaneData,
                            const Ego_Data_t     *pEgoData);
 
+/**
+ * @brief Pure Pursuit 최종 출력 (lfa_output_selection 과 동일한 감쇠/증폭)
+ *        - 모드 선택과 무관한 별도 진입점 : Polyline 이 있는 호출자가 직접 선택
+ */
+float lfa_output_selection_pure_pursuit(float steeringAnglePP,
+                                        const Lane_Data_LS_t *pLaneData,
+                                        const Ego_Data_t     *pEgoData);
+
 /**
  * @brief 테스트용: PID 내부 상태 초기화
  */
@@ -0,0 +1,103 @@
+/*********************************************************************
+ * lfa_feedforward_test.cpp  ―  곡률 Feed-forward 조향 UT
+ * DUT : calculate_steer_feedforward_curvature
+ *       calculate_steer_in_high_speed_stanley_ff   (lfa.c / lfa.h)
+ *********************************************************************/
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstring>
+
+#include "lfa.h"
+#include "lane_geometry.h"
+
+#ifdef UNIT_TEST
+extern float g_stanleyGain;
+#endif
+
+static constexpr float TOL = 1e-3f;
+static constexpr float WHEELBASE = 2.875f;
+
+class LfaFeedForwardTest : public ::testing::Test
+{
+protected:
+    Ego_Data_t     ego;
+    Lane_Data_LS_t lane;
+    LaneData_t     laneRaw;
+    LaneGeometry_t geom;
+
+    void SetUp() override {
+        std::memset(&ego,     0, sizeof(ego));
+        std::memset(&lane,    0, sizeof(lane));
+        std::memset(&laneRaw, 0, sizeof(laneRaw));
+        ego.Ego_Velocity_X   = 25.0f;
+        laneRaw.Lane_Width   = 3.5f;
+#ifdef UNIT_TEST
+        g_stanleyGain = 1.0f;
+#endif
+    }
+    void build(float radius, float nextRadius) {
+        laneRaw.Lane_Curvature      = radius;
+        laneRaw.Next_Lane_Curvature = nextRadius;
+        ASSERT_EQ(lane_geometry_build(&laneRaw, 0.0f, &geom), 0);
+    }
+};
+
+/* 직선 → FF 0 */
+TEST_F(LfaFeedForwardTest, TC_LFA_FF_EQ_01)
+{
+    build(0.0f, 0.0f);
+    EXPECT_NEAR(calculate_steer_feedforward_curvature(&ego, &geom), 0.0f, TOL);
+}
+
+/* 일정 곡률 R=250 좌 → atan(L/R) */
+TEST_F(LfaFeedForwardTest, TC_LFA_FF_EQ_02)
+{
+    build(250.0f, 250.0f);
+    float expect = std::atan(WHEELBASE / 250.0f) * 180.0f / (float)M_PI;
+    EXPECT_NEAR(calculate_steer_feedforward_curvature(&ego, &geom), expect, 1e-2f);
+}
+
+/* 우회전 → 음수 */
+TEST_F(LfaFeedForwardTest, TC_LFA_FF_EQ_03)
+{
+    build(-250.0f, -250.0f);
+    EXPECT_LT(calculate_steer_feedforward_curvature(&ego, &geom), 0.0f);
+}
+
+/* 전방 곡선 진입(직선→R200) : 고속일수록 Preview 가 멀어 FF 가 커짐 */
+TEST_F(LfaFeedForwardTest, TC_LFA_FF_BV_01)
+{
+    build(100000.0f, 200.0f);
+    ego.Ego_Velocity_X = 10.0f;
+    float slow = calculate_steer_feedforward_curvature(&ego, &geom);
+    ego.Ego_Velocity_X = 30.0f;
+    float fast = calculate_steer_feedforward_curvature(&ego, &geom);
+    EXPECT_GT(fast, slow);
+    EXPECT_GT(slow, 0.0f);
+}
+
+/* 무효 입력 → 0 */
+TEST_F(LfaFeedForwardTest, TC_LFA_FF_RA_01)
+{
+    build(250.0f, 250.0f);
+    EXPECT_EQ(calculate_steer_feedforward_curvature(nullptr, &geom), 0.0f);
+    EXPECT_EQ(calculate_steer_feedforward_curvature(&ego, nullptr), 0.0f);
+    ego.Ego_Velocity_X = NAN;
+    EXPECT_EQ(calculate_steer_feedforward_curvature(&ego, &geom), 0.0f);
+}
+
+/* Stanley+FF = Stanley + FF, 곡률 0 이면 Stanley 와 동일 */
+TEST_F(LfaFeedForwardTest, TC_LFA_FF_RA_02)
+{
+    lane.LS_Heading_Error = 2.0f;
+    lane.LS_Lane_Offset   = 0.3f;
+
+    build(0.0f, 0.0f);
+    EXPECT_NEAR(calculate_steer_in_high_speed_stanley_ff(&ego, &lane, &geom),
+                calculate_steer_in_high_speed_stanley(&ego, &lane), TOL);
+
+    build(300.0f, 300.0f);
+    float sum = calculate_steer_in_high_speed_stanley(&ego, &lane)
+              + calculate_steer_feedforward_curvature(&ego, &geom);
+    EXPECT_NEAR(calculate_steer_in_high_speed_stanley_ff(&ego, &lane, &geom), sum, TOL);
+}
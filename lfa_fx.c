@@ -0,0 +1,173 @@
+/*───────────────────────────────────────────────────────────
+ *  lfa_fx.c  ―  LFA PID / Stanley 고정소수점(Q15.16) 구현
+ *──────────────────────────────────────────────────────────*/
+#include <string.h>
+#include "lfa_fx.h"
+#include "adas_shared.h"
+
+/* ───── 상수 ───────────────────────────────────────────────*/
+#define LFA_FX_SPEED_THRESHOLD   FX16_C(16.67)            /* 60 km/h */
+#define LFA_FX_MAX_STEER         FX16_C(LFA_MAX_STEERING_ANGLE)
+#define LFA_FX_HDG_LIMIT         FX16_INT(180)
+#define LFA_FX_OFF_LIMIT         FX16_INT(2)
+#define LFA_FX_INTEGRAL_LIMIT    ((fx16w_t)100000 << FX16_FRAC_BITS)   /* 1e5 */
+#define LFA_FX_MIN_VEL           FX16_C(0.1)
+
+static inline int is_sat(fx16_t v)
+{
+    return (v >= FX16_MAX) || (v <= FX16_MIN);
+}
+
+static inline fx16_t sign540(fx16_t v)
+{
+    return (v >= 0) ? LFA_FX_MAX_STEER : -LFA_FX_MAX_STEER;
+}
+
+/* ───── 초기화 ─────────────────────────────────────────────*/
+void lfa_fx_pid_reset(LFA_Fx_State_t *s)
+{
+    if (!s) return;
+    s->PID_Integral   = 0;
+    s->PID_Prev_Error = 0;
+}
+
+void lfa_fx_init(LFA_Fx_State_t *s)
+{
+    if (!s) return;
+    memset(s, 0, sizeof(*s));
+    s->Kp           = FX16_C(0.1);
+    s->Ki           = FX16_C(0.01);
+    s->Kd           = FX16_C(0.005);
+    s->Stanley_Gain = FX16_ONE;
+}
+
+/* ───── 모드 선택 ─────────────────────────────────────────*/
+LFA_Mode_e lfa_mode_selection_fx(const LFA_Fx_Ego_Data_t *ego)
+{
+    if (!ego) {
+        return LFA_MODE_LOW_SPEED;
+    }
+    return (ego->Ego_Velocity_X < LFA_FX_SPEED_THRESHOLD)
+         ? LFA_MODE_LOW_SPEED
+         : LFA_MODE_HIGH_SPEED;
+}
+
+/* ───── 저속-PID ─────────────────────────────────────────*/
+fx16_t calculate_steer_in_low_speed_pid_fx(LFA_Fx_State_t           *s,
+                                           const LFA_Fx_Lane_Data_t *lane,
+                                           fx16_t                    dt)
+{
+    if (!s || !lane || dt <= 0) {
+        return 0;
+    }
+
+    fx16_t hdgErr = lane->LS_Heading_Error;
+    fx16_t offErr = lane->LS_Lane_Offset;
+    fx16_t err    = fx16_add(hdgErr, offErr);
+
+    /* 포화(±INF) 오차 → 리셋 후 ±540° */
+    if (is_sat(hdgErr) || is_sat(offErr)) {
+        lfa_fx_pid_reset(s);
+        return sign540(err);
+    }
+
+    /* 물리 범위 초과 또는 정확히 극한값 → ±540° */
+    if (fx16_abs(hdgErr) > LFA_FX_HDG_LIMIT || fx16_abs(offErr) > LFA_FX_OFF_LIMIT ||
+        (fx16_abs(hdgErr) == LFA_FX_HDG_LIMIT && fx16_abs(offErr) == LFA_FX_OFF_LIMIT)) {
+        return sign540(err);
+    }
+
+    /* PID 적분 */
+    s->PID_Integral = fx16w_add(s->PID_Integral,
+                                ((int64_t)err * dt + FX16_HALF) >> FX16_FRAC_BITS);
+
+    /* 적분 포화 → 리셋 후 ±540° */
+    if (s->PID_Integral > LFA_FX_INTEGRAL_LIMIT || s->PID_Integral < -LFA_FX_INTEGRAL_LIMIT) {
+        fx16_t sign = (s->PID_Integral >= 0) ? LFA_FX_MAX_STEER : -LFA_FX_MAX_STEER;
+        lfa_fx_pid_reset(s);
+        return (err == 0) ? 0 : sign;
+    }
+
+    /* 미분 (err=0 이면 억제, lfa.c 의 +1e-6 s 는 Q16 분해능 미만) */
+    fx16_t dErr = 0;
+    if (err != 0) {
+        dErr = fx16_div(fx16_sub(err, s->PID_Prev_Error), dt);
+    }
+    s->PID_Prev_Error = err;
+
+    fx16_t out = fx16_mul(s->Kp, err);
+    out = fx16_add(out, fx16w_mul_div(s->PID_Integral, s->Ki, 1));
+    out = fx16_add(out, fx16_mul(s->Kd, dErr));
+
+    /* P 단독 게인 시 최소 출력 (lfa.c 의 ±1e-6 → 1 LSB) */
+    if (s->Ki == 0 && s->Kd == 0 && err != 0) {
+        out = fx16_add(out, (err > 0) ? FX16_EPS : -FX16_EPS);
+    }
+
+    return fx16_clamp(out, -LFA_FX_MAX_STEER, LFA_FX_MAX_STEER);
+}
+
+/* ───── 고속-Stanley ──────────────────────────────────────*/
+fx16_t calculate_steer_in_high_speed_stanley_fx(const LFA_Fx_State_t     *s,
+                                                const LFA_Fx_Ego_Data_t  *ego,
+                                                const LFA_Fx_Lane_Data_t *lane)
+{
+    if (!s || !ego || !lane) {
+        return 0;
+    }
+
+    fx16_t vx     = ego->Ego_Velocity_X;
+    fx16_t hdgErr = lane->LS_Heading_Error;
+    fx16_t cte    = lane->LS_Lane_Offset;
+
+    if (is_sat(hdgErr)) {
+        return (hdgErr > 0) ? LFA_FX_MAX_STEER : -LFA_FX_MAX_STEER;
+    }
+
+    /* 극한 조합(±180°, ±2m) → ±540° 클램프 */
+    if (fx16_abs(hdgErr) >= LFA_FX_HDG_LIMIT && fx16_abs(cte) >= LFA_FX_OFF_LIMIT) {
+        return sign540(fx16_add(hdgErr, cte));
+    }
+
+    if (vx < LFA_FX_MIN_VEL) vx = LFA_FX_MIN_VEL;
+
+    fx16_t offsetDeg = fx16_atan_deg(fx16_div(fx16_mul(s->Stanley_Gain, cte), vx));
+    fx16_t steer     = fx16_add(hdgErr, offsetDeg);
+
+    return fx16_clamp(steer, -LFA_FX_MAX_STEER, LFA_FX_MAX_STEER);
+}
+
+/* ───── 최종 출력 선택 ─────────────────────────────────────*/
+fx16_t lfa_output_selection_fx(LFA_Mode_e lfaMode,
+                               fx16_t steeringAnglePID,
+                               fx16_t steeringAngleStanley,
+                               const LFA_Fx_Lane_Data_t *pLaneData,
+                               const LFA_Fx_Ego_Data_t  *pEgoData)
+{
+    if (!pLaneData || !pEgoData) {
+        return 0;
+    }
+
+    fx16_t steerOut = (lfaMode == LFA_MODE_LOW_SPEED) ? steeringAnglePID
+                                                      : steeringAngleStanley;
+
+    /* 1) 차선 변경 중 감쇠 */
+    if (pLaneData->LS_Is_Changing_Lane) {
+        steerOut = fx16_mul(steerOut, FX16_C(0.2));
+    }
+    /* 2) 차선 이탈 시 복귀 강화 */
+    if (!pLaneData->LS_Is_Within_Lane) {
+        steerOut = fx16_mul(steerOut, FX16_C(1.5));
+    }
+    /* 3) 곡선 도로 민감도 (급조향 중이면 축소) */
+    if (pLaneData->LS_Is_Curved_Lane) {
+        if (pEgoData->Ego_Yaw_Rate >= FX16_INT(30) ||
+            fx16_abs(pEgoData->Ego_Steering_Angle) >= FX16_INT(200)) {
+            steerOut = fx16_mul(steerOut, FX16_C(0.8));
+        } else {
+            steerOut = fx16_mul(steerOut, FX16_C(1.2));
+        }
+    }
+
+    return fx16_clamp(steerOut, -LFA_FX_MAX_STEER, LFA_FX_MAX_STEER);
+}
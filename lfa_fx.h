@@ -0,0 +1,81 @@
+/****************************************************************************
+ * lfa_fx.h
+ *
+ * - LFA 고정소수점(Q15.16) 구성 : lfa.c 의 PID / Stanley / 출력 선택과 동일 알고리즘
+ * - PID 상태·게인, Stanley 게인은 전역 대신 LFA_Fx_State_t 로 분리 (호출측 소유)
+ * - atan 은 fx16_atan_deg (정수 다항식)
+ * - 포화값(FX16_MAX / FX16_MIN) 입력은 float 경로의 ±INF 와 동일하게 처리
+ *
+ * float 참조(lfa.c) 대비 오차 (lfa_fx_test.cpp 교차검증):
+ *   Stanley 조향각 : |err| <= 5e-3 [°]
+ *   PID 조향각     : |err| <= 5e-3 [°]  (1000 틱 누적 포함)
+ *   출력 선택      : |err| <= 5e-3 [°]
+ ****************************************************************************/
+#ifndef LFA_FX_H
+#define LFA_FX_H
+
+#include "fixed_point.h"
+#include "lfa.h"      /* LFA_Mode_e */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    fx16_t LS_Heading_Error;    /* Q16 (-180 ~ 180) [°] */
+    fx16_t LS_Lane_Offset;      /* Q16 (-2.0 ~ 2.0) [m] */
+    int    LS_Is_Changing_Lane; /* (True=1, False=0) */
+    int    LS_Is_Within_Lane;   /* (True=1, False=0) */
+    int    LS_Is_Curved_Lane;   /* (True=1, False=0) */
+} LFA_Fx_Lane_Data_t;
+
+typedef struct {
+    fx16_t Ego_Velocity_X;      /* Q16 (0 ~ 100)   [m/s] */
+    fx16_t Ego_Yaw_Rate;        /* Q16 (-180~180)  [°/s] */
+    fx16_t Ego_Steering_Angle;  /* Q16 (-540~540)  [°]   */
+} LFA_Fx_Ego_Data_t;
+
+/**
+ * @brief PID 상태 + 게인 (lfa.c 의 pidIntegral / KP,KI,KD / g_stanleyGain 대응)
+ */
+typedef struct {
+    fx16w_t PID_Integral;       /* Q47.16 [°·s] */
+    fx16_t  PID_Prev_Error;     /* Q16 */
+    fx16_t  Kp, Ki, Kd;         /* Q16 */
+    fx16_t  Stanley_Gain;       /* Q16 */
+} LFA_Fx_State_t;
+
+/** @brief 기본 게인 (lfa.c 와 동일) + PID 상태 초기화 */
+void lfa_fx_init(LFA_Fx_State_t *pState);
+
+/** @brief PID 내부 상태만 초기화 (게인 유지) */
+void lfa_fx_pid_reset(LFA_Fx_State_t *pState);
+
+LFA_Mode_e lfa_mode_selection_fx(const LFA_Fx_Ego_Data_t *pEgoData);
+
+/**
+ * @param deltaTime Q16 [s]
+ * @return Q16 (-540 ~ 540) [°]
+ */
+fx16_t calculate_steer_in_low_speed_pid_fx(LFA_Fx_State_t           *pState,
+                                           const LFA_Fx_Lane_Data_t *pLaneData,
+                                           fx16_t                    deltaTime);
+
+/**
+ * @return Q16 (-540 ~ 540) [°]
+ */
+fx16_t calculate_steer_in_high_speed_stanley_fx(const LFA_Fx_State_t     *pState,
+                                                const LFA_Fx_Ego_Data_t  *pEgoData,
+                                                const LFA_Fx_Lane_Data_t *pLaneData);
+
+fx16_t lfa_output_selection_fx(LFA_Mode_e lfaMode,
+                               fx16_t steeringAnglePID,
+                               fx16_t steeringAngleStanley,
+                               const LFA_Fx_Lane_Data_t *pLaneData,
+                               const LFA_Fx_Ego_Data_t  *pEgoData);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LFA_FX_H */
@@ -0,0 +1,123 @@
+/*********************************************************************
+ * lfa_fx_test.cpp  ―  LFA 고정소수점 구성 교차검증 (float 참조 lfa.c 대비)
+ * DUT : lfa_mode_selection_fx / calculate_steer_in_low_speed_pid_fx
+ *       calculate_steer_in_high_speed_stanley_fx / lfa_output_selection_fx
+ *********************************************************************/
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdint>
+
+#include "lfa_fx.h"
+#include "test_rng.hpp"
+
+#ifdef UNIT_TEST
+extern float g_stanleyGain;
+#endif
+
+static constexpr float STEER_MAX_ERR = 5e-3f;    /* lfa_fx.h 문서화 오차 [°] */
+
+class LfaFxTest : public ::testing::Test
+{
+protected:
+    LFA_Fx_State_t fx;
+    TestRng        rng{3u};
+
+    void SetUp() override {
+        pid_set_gains(0.1f, 0.01f, 0.005f);     /* lfa.c 기본 게인 + 리셋 */
+#ifdef UNIT_TEST
+        g_stanleyGain = 1.0f;
+#endif
+        lfa_fx_init(&fx);
+    }
+    static LFA_Fx_Lane_Data_t toFx(const Lane_Data_LS_t &l) {
+        return { fx16_from_float(l.LS_Heading_Error), fx16_from_float(l.LS_Lane_Offset),
+                 l.LS_Is_Changing_Lane, l.LS_Is_Within_Lane, l.LS_Is_Curved_Lane };
+    }
+    static LFA_Fx_Ego_Data_t toFx(const Ego_Data_t &e) {
+        return { fx16_from_float(e.Ego_Velocity_X), fx16_from_float(e.Ego_Yaw_Rate),
+                 fx16_from_float(e.Ego_Steering_Angle) };
+    }
+};
+
+/* Stanley : 임의 입력 2×10⁴ 건 */
+TEST_F(LfaFxTest, TC_LFA_FX_EQ_01_StanleyRandom)
+{
+    float maxErr = 0.0f;
+    for (int i = 0; i < 20000; i++) {
+        Lane_Data_LS_t l{ rng.uni(-30.0f, 30.0f), rng.uni(-2.0f, 2.0f), 0, 1, 0 };
+        Ego_Data_t     e{ rng.uni(0.0f, 40.0f), 0.0f, 0.0f };
+        LFA_Fx_Lane_Data_t lf = toFx(l);
+        LFA_Fx_Ego_Data_t  ef = toFx(e);
+        float ref = calculate_steer_in_high_speed_stanley(&e, &l);
+        float fxv = fx16_to_float(calculate_steer_in_high_speed_stanley_fx(&fx, &ef, &lf));
+        maxErr = std::fmax(maxErr, std::fabs(fxv - ref));
+    }
+    EXPECT_LE(maxErr, STEER_MAX_ERR);
+}
+
+/* PID : 10 ms 루프 1000 틱 (차선 오차 정현 변동) 누적 오차 */
+TEST_F(LfaFxTest, TC_LFA_FX_EQ_02_PidTrajectory)
+{
+    float maxErr = 0.0f;
+    for (int k = 0; k < 1000; k++) {
+        Lane_Data_LS_t l{ 5.0f * std::sin(0.01f * k), 0.5f * std::cos(0.013f * k), 0, 1, 0 };
+        LFA_Fx_Lane_Data_t lf = toFx(l);
+        float ref = calculate_steer_in_low_speed_pid(&l, 0.01f);
+        float fxv = fx16_to_float(calculate_steer_in_low_speed_pid_fx(&fx, &lf, fx16_from_float(0.01f)));
+        maxErr = std::fmax(maxErr, std::fabs(fxv - ref));
+    }
+    EXPECT_LE(maxErr, STEER_MAX_ERR);
+}
+
+/* 출력 선택 / 모드 : 플래그 조합 전체 */
+TEST_F(LfaFxTest, TC_LFA_FX_EQ_03_OutputSelection)
+{
+    float maxErr = 0.0f;
+    for (int i = 0; i < 4000; i++) {
+        Lane_Data_LS_t l{ 0.0f, 0.0f, i & 1, (i >> 1) & 1, (i >> 2) & 1 };
+        Ego_Data_t     e{ rng.uni(0.0f, 30.0f), rng.uni(0.0f, 40.0f), rng.uni(-300.0f, 300.0f) };
+        float pid = rng.uni(-540.0f, 540.0f), stn = rng.uni(-540.0f, 540.0f);
+        LFA_Mode_e m = lfa_mode_selection(&e);
+        LFA_Fx_Lane_Data_t lf = toFx(l);
+        LFA_Fx_Ego_Data_t  ef = toFx(e);
+        ASSERT_EQ(lfa_mode_selection_fx(&ef), m) << i;
+        float ref = lfa_output_selection(m, pid, stn, &l, &e);
+        float fxv = fx16_to_float(lfa_output_selection_fx(m, fx16_from_float(pid),
+                                                          fx16_from_float(stn), &lf, &ef));
+        maxErr = std::fmax(maxErr, std::fabs(fxv - ref));
+    }
+    EXPECT_LE(maxErr, STEER_MAX_ERR);
+}
+
+/* 극한 / 포화 입력 : float 경로와 같은 ±540° */
+TEST_F(LfaFxTest, TC_LFA_FX_BV_01_Extremes)
+{
+    LFA_Fx_Lane_Data_t lf{ FX16_INT(180), FX16_INT(2), 0, 1, 0 };
+    LFA_Fx_Ego_Data_t  ef{ FX16_INT(20), 0, 0 };
+    EXPECT_EQ(calculate_steer_in_high_speed_stanley_fx(&fx, &ef, &lf), FX16_INT(540));
+    EXPECT_EQ(calculate_steer_in_low_speed_pid_fx(&fx, &lf, FX16_C(0.01)), FX16_INT(540));
+
+    lf.LS_Heading_Error = fx16_from_float(-INFINITY);
+    lf.LS_Lane_Offset   = 0;
+    EXPECT_EQ(calculate_steer_in_high_speed_stanley_fx(&fx, &ef, &lf), -FX16_INT(540));
+    EXPECT_EQ(calculate_steer_in_low_speed_pid_fx(&fx, &lf, FX16_C(0.01)), -FX16_INT(540));
+    EXPECT_EQ(fx.PID_Integral, 0);
+
+    /* 정지 차량 : 분모 보호 (0.1 m/s) */
+    lf.LS_Heading_Error = 0;
+    lf.LS_Lane_Offset   = FX16_C(1.0);
+    ef.Ego_Velocity_X   = 0;
+    EXPECT_NEAR(fx16_to_float(calculate_steer_in_high_speed_stanley_fx(&fx, &ef, &lf)),
+                std::atan(10.0) * 180.0 / M_PI, STEER_MAX_ERR);
+}
+
+/* 무효 입력 */
+TEST_F(LfaFxTest, TC_LFA_FX_RA_01_Invalid)
+{
+    LFA_Fx_Lane_Data_t lf{ FX16_INT(1), 0, 0, 1, 0 };
+    EXPECT_EQ(calculate_steer_in_low_speed_pid_fx(&fx, &lf, 0), 0);
+    EXPECT_EQ(calculate_steer_in_low_speed_pid_fx(nullptr, &lf, FX16_C(0.01)), 0);
+    EXPECT_EQ(calculate_steer_in_high_speed_stanley_fx(&fx, nullptr, &lf), 0);
+    EXPECT_EQ(lfa_output_selection_fx(LFA_MODE_LOW_SPEED, 1, 1, nullptr, nullptr), 0);
+    EXPECT_EQ(lfa_mode_selection_fx(nullptr), LFA_MODE_LOW_SPEED);
+}
@@ -0,0 +1,105 @@
+/*********************************************************************
+ * lfa_pure_pursuit_test.cpp  ―  Pure Pursuit 조향 UT
+ * DUT : calculate_steer_pure_pursuit
+ *       lfa_output_selection_pure_pursuit   (lfa.c / lfa.h)
+ *********************************************************************/
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#include "lfa.h"
+
+static constexpr float WHEELBASE = 2.875f;
+
+class LfaPurePursuitTest : public ::testing::Test
+{
+protected:
+    static LanePath_t path;
+    LanePathTracker_t trk;
+    Ego_Data_t        ego;
+    LanePathPose_t    pose;
+
+    void SetUp() override {
+        lane_path_tracker_reset(&trk);
+        std::memset(&ego, 0, sizeof(ego));
+        ego.Ego_Velocity_X = 20.0f;
+        pose = LanePathPose_t{ 0.0f, 0.0f, 0.0f };
+        std::vector<float> x(500), y(500, 0.0f);
+        for (int i = 0; i < 500; i++) x[i] = (float)i;
+        lane_path_set(&path, x.data(), y.data(), 500);
+    }
+    float call() { return calculate_steer_pure_pursuit(&ego, &path, &trk, &pose); }
+};
+LanePath_t LfaPurePursuitTest::path;
+
+/* 경로 위 정렬 → 0 */
+TEST_F(LfaPurePursuitTest, TC_LFA_PP_EQ_01)
+{
+    pose.X = 10.0f;
+    EXPECT_NEAR(call(), 0.0f, 1e-4f);
+}
+
+/* 경로가 좌측(차량이 우측으로 벗어남) → 좌조향(+) */
+TEST_F(LfaPurePursuitTest, TC_LFA_PP_EQ_02)
+{
+    pose.X = 10.0f; pose.Y = -1.0f;
+    EXPECT_GT(call(), 0.0f);
+    pose.Y = 1.0f;
+    EXPECT_LT(call(), 0.0f);
+}
+
+/* 헤딩 오차만 존재 : 좌측으로 틀어짐 → 우조향(-) */
+TEST_F(LfaPurePursuitTest, TC_LFA_PP_EQ_03)
+{
+    pose.X = 10.0f; pose.Heading = 10.0f;
+    EXPECT_LT(call(), 0.0f);
+}
+
+/* 원호 추종 : 정상상태 조향 ≈ atan(L/R) */
+TEST_F(LfaPurePursuitTest, TC_LFA_PP_BV_01)
+{
+    const float R = 150.0f;
+    std::vector<float> x(2000), y(2000);
+    for (int i = 0; i < 2000; i++) {
+        float th = 0.25f * i / R;
+        x[i] = R * std::sin(th);
+        y[i] = R * (1.0f - std::cos(th));
+    }
+    ASSERT_EQ(lane_path_set(&path, x.data(), y.data(), 2000), 2000);
+
+    float th = 60.0f / R;
+    pose = LanePathPose_t{ R * std::sin(th), R * (1.0f - std::cos(th)),
+                           th * 180.0f / (float)M_PI };
+    float expect = std::atan(WHEELBASE / R) * 180.0f / (float)M_PI;
+    EXPECT_NEAR(call(), expect, 0.05f);
+}
+
+/* 경로 끝 도달 → 0 */
+TEST_F(LfaPurePursuitTest, TC_LFA_PP_BV_02)
+{
+    pose.X = 499.0f;
+    EXPECT_EQ(call(), 0.0f);
+}
+
+/* 무효 입력 → 0 */
+TEST_F(LfaPurePursuitTest, TC_LFA_PP_RA_01)
+{
+    EXPECT_EQ(calculate_steer_pure_pursuit(nullptr, &path, &trk, &pose), 0.0f);
+    EXPECT_EQ(calculate_steer_pure_pursuit(&ego, nullptr, &trk, &pose), 0.0f);
+    ego.Ego_Velocity_X = NAN;
+    EXPECT_EQ(call(), 0.0f);
+    ego.Ego_Velocity_X = 10.0f;
+    pose.Heading = INFINITY;
+    EXPECT_EQ(call(), 0.0f);
+}
+
+/* 출력 감쇠 : 차선 변경 중 0.2배 */
+TEST_F(LfaPurePursuitTest, TC_LFA_PP_RA_02)
+{
+    Lane_Data_LS_t lane{};
+    lane.LS_Is_Within_Lane   = 1;
+    lane.LS_Is_Changing_Lane = 1;
+    EXPECT_NEAR(lfa_output_selection_pure_pursuit(10.0f, &lane, &ego), 2.0f, 1e-4f);
+    EXPECT_EQ(lfa_output_selection_pure_pursuit(10.0f, nullptr, &ego), 0.0f);
+}
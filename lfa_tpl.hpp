@@ -0,0 +1,31 @@
+/****************************************************************************
+ * lfa_tpl.hpp
+ *
+ * - lfa_mode_selection (lfa.c) 의 컴파일 타임 구성 템플릿
+ * - 저속/고속 경계 : Cfg::LfaSpeedThreshold
+ ****************************************************************************/
+#ifndef LFA_TPL_HPP
+#define LFA_TPL_HPP
+
+#include <cmath>
+
+#include "adas_config.hpp"
+#include "lfa.h"
+
+namespace adas {
+
+template <class Cfg = DefaultConfig>
+LFA_Mode_e lfa_mode_selection(const Ego_Data_t *ego)
+{
+    static_assert(config_is_valid<Cfg>(), "");
+
+    if (!ego || std::isnan(ego->Ego_Velocity_X)) {
+        return LFA_MODE_LOW_SPEED;
+    }
+    return (ego->Ego_Velocity_X < Cfg::LfaSpeedThreshold) ? LFA_MODE_LOW_SPEED
+                                                          : LFA_MODE_HIGH_SPEED;
+}
+
+} /* namespace adas */
+
+#endif /* LFA_TPL_HPP */
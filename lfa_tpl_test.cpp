@@ -0,0 +1,33 @@
+/*********************************************************************
+ * lfa_tpl_test.cpp  ―  LFA 모드 선택 구성 템플릿
+ * DUT : adas::lfa_mode_selection<Cfg>
+ * REF : lfa_mode_selection (lfa.c)
+ *********************************************************************/
+#include <gtest/gtest.h>
+#include <cmath>
+
+#include "lfa_tpl.hpp"
+
+struct CityLfaConfig : adas::DefaultConfig {
+    static constexpr float LfaSpeedThreshold = 13.89f;     /* 50 km/h */
+};
+
+TEST(LfaTplTest, TC_LFA_TPL_EQ_01_DefaultMatchesCApi)
+{
+    for (int i = -100; i <= 4000; i++) {
+        Ego_Data_t e{ 0.01f * i, 0.0f, 0.0f };
+        ASSERT_EQ(adas::lfa_mode_selection<>(&e), lfa_mode_selection(&e)) << i;
+    }
+    Ego_Data_t e{ NAN, 0.0f, 0.0f };
+    EXPECT_EQ(adas::lfa_mode_selection<>(&e), lfa_mode_selection(&e));
+}
+
+TEST(LfaTplTest, TC_LFA_TPL_BV_01_CustomThreshold)
+{
+    Ego_Data_t e{ 15.0f, 0.0f, 0.0f };
+    EXPECT_EQ(adas::lfa_mode_selection<adas::DefaultConfig>(&e), LFA_MODE_LOW_SPEED);
+    EXPECT_EQ(adas::lfa_mode_selection<CityLfaConfig>(&e), LFA_MODE_HIGH_SPEED);
+    e.Ego_Velocity_X = 13.89f;
+    EXPECT_EQ(adas::lfa_mode_selection<CityLfaConfig>(&e), LFA_MODE_HIGH_SPEED);
+    EXPECT_EQ(adas::lfa_mode_selection<CityLfaConfig>(nullptr), LFA_MODE_LOW_SPEED);
+}
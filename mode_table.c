@@ -0,0 +1,126 @@
+#include "mode_table.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define MODE_TABLE_SSE2 1
+#endif
+
+/*─────────────────────────────
+  표 (색인 비트 배치는 mode_table.h 참고)
+─────────────────────────────*/
+const uint8_t g_AccModeTable[MODE_TABLE_ACC_SIZE] = {
+    /* valid 0 : 타겟 없음 → Speed */
+    0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,
+    /* band 0 (< 45 m)   : stopped ? Stop : Distance */
+    1, 1, 2, 2,
+    /* band 1 (45~55 m)  : stopped ? Stop : (cut-in ? Distance : Speed) */
+    0, 1, 2, 2,
+    /* band 2 (> 55 m)   : Speed, band 3 : 없음 */
+    0, 0, 0, 0,  0, 0, 0, 0
+};
+
+const uint8_t g_AebModeTable[MODE_TABLE_AEB_SIZE] = {
+    /* inhibit 0 : 0 없음 → Normal, 1 (0, brake] → Brake, 2·3 (brake, alert] → Alert, 4~7 > alert → Normal */
+    0, 2, 1, 1,  0, 0, 0, 0,
+    /* inhibit 1 : Normal */
+    0, 0, 0, 0,  0, 0, 0, 0
+};
+
+int acc_mode_selection_batch(const int32_t *pTargetId, const float *pDistance,
+                             const int32_t *pStatus, const int32_t *pSituation,
+                             const float *pEgoVelX, int n, int32_t *pMode)
+{
+    if (n < 0) return -1;
+    if (n > 0 && (!pTargetId || !pDistance || !pStatus || !pSituation || !pEgoVelX || !pMode)) return -1;
+
+    int i = 0;
+#ifdef MODE_TABLE_SSE2
+    const __m128i w16   = _mm_set1_epi32(16);
+    const __m128i w4    = _mm_set1_epi32(4);
+    const __m128i w2    = _mm_set1_epi32(2);
+    const __m128i one   = _mm_set1_epi32(1);
+    const __m128i minus = _mm_set1_epi32(-1);
+    const __m128i stopV = _mm_set1_epi32(MODE_TABLE_ACC_TARGET_STOPPED);
+    const __m128i cutV  = _mm_set1_epi32(MODE_TABLE_ACC_TARGET_CUT_IN);
+    for (; i + 4 <= n; i += 4) {
+        __m128i id   = _mm_loadu_si128((const __m128i *)(pTargetId + i));
+        __m128  d    = _mm_loadu_ps(pDistance + i);
+        __m128i st   = _mm_loadu_si128((const __m128i *)(pStatus + i));
+        __m128i sit  = _mm_loadu_si128((const __m128i *)(pSituation + i));
+        __m128  ego  = _mm_loadu_ps(pEgoVelX + i);
+
+        __m128i valid   = _mm_and_si128(_mm_cmpgt_epi32(id, minus), w16);
+        __m128i lt45    = _mm_castps_si128(_mm_cmplt_ps(d, _mm_set1_ps(ACC_DIST_MODE_DIST)));
+        __m128i gt55    = _mm_castps_si128(_mm_cmpgt_ps(d, _mm_set1_ps(ACC_SPEED_MODE_DIST)));
+        __m128i band    = _mm_add_epi32(_mm_andnot_si128(lt45, w4), _mm_and_si128(gt55, w4));
+        __m128i stopped = _mm_and_si128(_mm_and_si128(_mm_cmpeq_epi32(st, stopV),
+                                                      _mm_castps_si128(_mm_cmplt_ps(ego, _mm_set1_ps(0.5f)))), w2);
+        __m128i cutIn   = _mm_and_si128(_mm_cmpeq_epi32(sit, cutV), one);
+        __m128i idx     = _mm_or_si128(_mm_or_si128(valid, band), _mm_or_si128(stopped, cutIn));
+
+        int32_t k[4];
+        _mm_storeu_si128((__m128i *)k, idx);
+        pMode[i + 0] = g_AccModeTable[k[0]];
+        pMode[i + 1] = g_AccModeTable[k[1]];
+        pMode[i + 2] = g_AccModeTable[k[2]];
+        pMode[i + 3] = g_AccModeTable[k[3]];
+    }
+#endif
+    for (; i < n; i++) {
+        pMode[i] = g_AccModeTable[mode_table_acc_index(pTargetId[i], pDistance[i], pStatus[i],
+                                                       pSituation[i], pEgoVelX[i])];
+    }
+    return 0;
+}
+
+int aeb_mode_selection_batch(const int32_t *pTargetId, const int32_t *pSituation,
+                             const float *pEgoVelX, const float *pTtc,
+                             const float *pTtcBrake, const float *pTtcAlert,
+                             int n, int32_t *pMode)
+{
+    if (n < 0) return -1;
+    if (n > 0 && (!pTargetId || !pSituation || !pEgoVelX || !pTtc || !pTtcBrake || !pTtcAlert || !pMode)) {
+        return -1;
+    }
+
+    int i = 0;
+#ifdef MODE_TABLE_SSE2
+    const __m128i w8   = _mm_set1_epi32(8);
+    const __m128i w4   = _mm_set1_epi32(4);
+    const __m128i w2   = _mm_set1_epi32(2);
+    const __m128i one  = _mm_set1_epi32(1);
+    const __m128  zero = _mm_setzero_ps();
+    const __m128i cutV = _mm_set1_epi32(MODE_TABLE_AEB_TARGET_CUT_OUT);
+    for (; i + 4 <= n; i += 4) {
+        __m128i id    = _mm_loadu_si128((const __m128i *)(pTargetId + i));
+        __m128i sit   = _mm_loadu_si128((const __m128i *)(pSituation + i));
+        __m128  ego   = _mm_loadu_ps(pEgoVelX + i);
+        __m128  ttc   = _mm_loadu_ps(pTtc + i);
+        __m128  brk   = _mm_loadu_ps(pTtcBrake + i);
+        __m128  alr   = _mm_loadu_ps(pTtcAlert + i);
+
+        __m128  inhF  = _mm_or_ps(_mm_or_ps(_mm_cmplt_ps(ego, _mm_set1_ps(0.5f)), _mm_cmple_ps(ttc, zero)),
+                                  _mm_cmpge_ps(ttc, _mm_set1_ps(99999.0f)));
+        __m128i inh   = _mm_or_si128(_mm_or_si128(_mm_cmplt_epi32(id, _mm_setzero_si128()),
+                                                  _mm_cmpeq_epi32(sit, cutV)),
+                                     _mm_castps_si128(inhF));
+        __m128i above = _mm_castps_si128(_mm_cmpgt_ps(ttc, alr));
+        __m128i alert = _mm_castps_si128(_mm_and_ps(_mm_cmpgt_ps(ttc, brk), _mm_cmple_ps(ttc, alr)));
+        __m128i brake = _mm_castps_si128(_mm_and_ps(_mm_cmpgt_ps(ttc, zero), _mm_cmple_ps(ttc, brk)));
+        __m128i idx   = _mm_or_si128(_mm_or_si128(_mm_and_si128(inh, w8), _mm_and_si128(above, w4)),
+                                     _mm_or_si128(_mm_and_si128(alert, w2), _mm_and_si128(brake, one)));
+
+        int32_t k[4];
+        _mm_storeu_si128((__m128i *)k, idx);
+        pMode[i + 0] = g_AebModeTable[k[0]];
+        pMode[i + 1] = g_AebModeTable[k[1]];
+        pMode[i + 2] = g_AebModeTable[k[2]];
+        pMode[i + 3] = g_AebModeTable[k[3]];
+    }
+#endif
+    for (; i < n; i++) {
+        pMode[i] = g_AebModeTable[mode_table_aeb_index(pTargetId[i], pSituation[i], pEgoVelX[i],
+                                                       pTtc[i], pTtcBrake[i], pTtcAlert[i])];
+    }
+    return 0;
+}
@@ -0,0 +1,85 @@
+/****************************************************************************
+ * mode_table.h
+ *
+ * - ACC / AEB 모드 선택의 분기 없는 표 조회판
+ *     . 입력을 비교 결과 비트로 양자화 → 작은 색인 → 상수 표에서 모드 조회
+ *     . 비교식은 acc_mode_selection / aeb_mode_selection 과 같은 식 그대로
+ *       (NaN 포함 모든 입력에서 결과 동일, NULL 인자 처리만 분기)
+ * - ACC 색인 (5 bit) : valid << 4 | band << 2 | stopped << 1 | cutIn
+ *     . band = !(dist < ACC_DIST_MODE_DIST) + (dist > ACC_SPEED_MODE_DIST)  (0 : 근거리, 1 : 중간, 2 : 원거리)
+ *     . stopped = 정지 타겟 && Ego < 0.5 m/s
+ * - AEB 색인 (4 bit) : inhibit << 3 | ttc > alert << 2 | (brake, alert] << 1 | (0, brake]
+ *     . inhibit = ID < 0 | Ego < 0.5 | TTC <= 0 | TTC >= 99999 | Cut-out
+ * - 배치(SoA) : 색인 산출은 SSE2 4-lane 비교 마스크 (미지원 시 스칼라), 조회는 lane 별 표 읽기
+ * - 구조체판 : acc_mode_selection_lut (acc.h), aeb_mode_selection_lut (aeb.h)
+ ****************************************************************************/
+#ifndef MODE_TABLE_H
+#define MODE_TABLE_H
+
+#include <stdint.h>
+#include "adas_shared.h"      /* ACC_DIST_MODE_DIST / ACC_SPEED_MODE_DIST */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MODE_TABLE_ACC_SIZE     32
+#define MODE_TABLE_AEB_SIZE     16
+
+/* 색인 → 모드 (ACC_Mode_e / AEB_Mode_e 값) */
+extern const uint8_t g_AccModeTable[MODE_TABLE_ACC_SIZE];
+extern const uint8_t g_AebModeTable[MODE_TABLE_AEB_SIZE];
+
+/* acc.h / aeb.h 의 열거 값 (두 헤더의 Ego_Data_t 가 충돌해 여기서 포함하지 않음)
+   → acc.c / aeb.c 에서 MODE_TABLE_STATIC_ASSERT 로 실제 열거 값과 일치 확인 */
+#define MODE_TABLE_ACC_TARGET_STOPPED   1   /* ACC_TARGET_STOPPED */
+#define MODE_TABLE_ACC_TARGET_CUT_IN    1   /* ACC_TARGET_CUT_IN */
+#define MODE_TABLE_AEB_TARGET_CUT_OUT   2   /* AEB_TARGET_CUT_OUT */
+
+/* C99 컴파일 시점 검사 : 조건이 거짓이면 배열 크기 -1 → 컴파일 오류 */
+#define MODE_TABLE_STATIC_ASSERT(cond, name)   typedef char mode_table_assert_##name[(cond) ? 1 : -1]
+
+static inline uint32_t mode_table_acc_index(int32_t targetId, float dist, int32_t status,
+                                            int32_t situation, float egoVelX)
+{
+    uint32_t valid   = (uint32_t)(targetId >= 0);
+    uint32_t band    = (uint32_t)!(dist < ACC_DIST_MODE_DIST) + (uint32_t)(dist > ACC_SPEED_MODE_DIST);
+    uint32_t stopped = (uint32_t)(status == MODE_TABLE_ACC_TARGET_STOPPED) & (uint32_t)(egoVelX < 0.5f);
+    uint32_t cutIn   = (uint32_t)(situation == MODE_TABLE_ACC_TARGET_CUT_IN);
+    return (valid << 4) | (band << 2) | (stopped << 1) | cutIn;
+}
+
+static inline uint32_t mode_table_aeb_index(int32_t targetId, int32_t situation, float egoVelX,
+                                            float ttc, float ttcBrake, float ttcAlert)
+{
+    uint32_t inhibit = (uint32_t)(targetId < 0) | (uint32_t)(egoVelX < 0.5f)
+                     | (uint32_t)(ttc <= 0.0f) | (uint32_t)(ttc >= 99999.0f)
+                     | (uint32_t)(situation == MODE_TABLE_AEB_TARGET_CUT_OUT);
+    uint32_t above   = (uint32_t)(ttc > ttcAlert);
+    uint32_t alert   = (uint32_t)(ttc > ttcBrake) & (uint32_t)(ttc <= ttcAlert);
+    uint32_t brake   = (uint32_t)(ttc > 0.0f) & (uint32_t)(ttc <= ttcBrake);
+    return (inhibit << 3) | (above << 2) | (alert << 1) | brake;
+}
+
+/**
+ * @brief ACC 모드 배치 선택 (SoA), pMode[i] = acc_mode_selection 결과 (ACC_Mode_e)
+ * @return 0 on success, -1 on invalid argument
+ */
+int acc_mode_selection_batch(const int32_t *pTargetId, const float *pDistance,
+                             const int32_t *pStatus, const int32_t *pSituation,
+                             const float *pEgoVelX, int n, int32_t *pMode);
+
+/**
+ * @brief AEB 모드 배치 선택 (SoA), pMode[i] = aeb_mode_selection 결과 (AEB_Mode_e)
+ * @return 0 on success, -1 on invalid argument
+ */
+int aeb_mode_selection_batch(const int32_t *pTargetId, const int32_t *pSituation,
+                             const float *pEgoVelX, const float *pTtc,
+                             const float *pTtcBrake, const float *pTtcAlert,
+                             int n, int32_t *pMode);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MODE_TABLE_H */
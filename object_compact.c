@@ -0,0 +1,300 @@
+#include <string.h>
+
+#include "object_compact.h"
+
+/* 레코드 크기 고정 (C99 : 음수 배열 크기로 컴파일 오류) */
+typedef char obj_compact_hot_size_check[(sizeof(ObjCompact_t) == 32) ? 1 : -1];
+typedef char obj_compact_cold_size_check[(sizeof(ObjCompactCold_t) == 12) ? 1 : -1];
+typedef char obj_compact_hist_size_check[(sizeof(ObjCompactHistory_t) == 32) ? 1 : -1];
+
+/*─────────────────────────────
+  공통 : 정수 / 열거 필드 검사 + 압축
+─────────────────────────────*/
+static int pack_ids(int id, int type, int status, int cutIn, int cutOut, ObjCompact_t *pHot)
+{
+    if (id < 0 || id > OBJ_COMPACT_MAX_ID || type < 0 || type > 0xFF
+        || status < 0 || (unsigned)status > OBJ_COMPACT_STATUS_MASK)
+    {
+        return -1;
+    }
+    pHot->Object_ID   = (uint16_t)id;
+    pHot->Object_Type = (uint8_t)type;
+    pHot->Flags       = (uint8_t)((unsigned)status
+                                  | (cutIn  ? OBJ_COMPACT_FLAG_CUTIN  : 0u)
+                                  | (cutOut ? OBJ_COMPACT_FLAG_CUTOUT : 0u));
+    return 0;
+}
+
+static int args_valid(const void *pSrc, int n, const void *pDst)
+{
+    return n >= 0 && (n == 0 || (pSrc && pDst));
+}
+
+/*─────────────────────────────
+  ObjectData_t
+─────────────────────────────*/
+int obj_compact_from_objects(const ObjectData_t *pSrc, int n, ObjCompact_t *pHot, ObjCompactCold_t *pCold)
+{
+    if (!args_valid(pSrc, n, pHot)) return -1;
+
+    for (int i = 0; i < n; i++) {
+        const ObjectData_t *s = &pSrc[i];
+        ObjCompact_t *h = &pHot[i];
+        if (pack_ids(s->Object_ID, (int)s->Object_Type, (int)s->Object_Status, 0, 0, h) != 0) return -1;
+        h->Position_X = s->Position_X;
+        h->Position_Y = s->Position_Y;
+        h->Velocity_X = s->Velocity_X;
+        h->Velocity_Y = s->Velocity_Y;
+        h->Accel_X    = s->Accel_X;
+        h->Heading    = s->Heading;
+        h->Distance   = s->Distance;
+        if (pCold) {
+            pCold[i].Position_Z = s->Position_Z;
+            pCold[i].Accel_Y    = s->Accel_Y;
+            pCold[i].Cell_ID    = s->Object_Cell_ID;
+        }
+    }
+    return 0;
+}
+
+int obj_compact_to_objects(const ObjCompact_t *pHot, const ObjCompactCold_t *pCold, int n, ObjectData_t *pDst)
+{
+    if (!args_valid(pHot, n, pDst)) return -1;
+
+    for (int i = 0; i < n; i++) {
+        const ObjCompact_t *h = &pHot[i];
+        ObjectData_t *d = &pDst[i];
+        memset(d, 0, sizeof(*d));
+        d->Object_ID     = h->Object_ID;
+        d->Object_Type   = (ObjectType_e)h->Object_Type;
+        d->Object_Status = obj_compact_status(h);
+        d->Position_X    = h->Position_X;
+        d->Position_Y    = h->Position_Y;
+        d->Velocity_X    = h->Velocity_X;
+        d->Velocity_Y    = h->Velocity_Y;
+        d->Accel_X       = h->Accel_X;
+        d->Heading       = h->Heading;
+        d->Distance      = h->Distance;
+        if (pCold) {
+            d->Position_Z     = pCold[i].Position_Z;
+            d->Accel_Y        = pCold[i].Accel_Y;
+            d->Object_Cell_ID = pCold[i].Cell_ID;
+        }
+    }
+    return 0;
+}
+
+/*─────────────────────────────
+  FilteredObject_t
+─────────────────────────────*/
+int obj_compact_from_filtered(const FilteredObject_t *pSrc, int n, ObjCompact_t *pHot, ObjCompactCold_t *pCold)
+{
+    if (!args_valid(pSrc, n, pHot)) return -1;
+
+    for (int i = 0; i < n; i++) {
+        const FilteredObject_t *s = &pSrc[i];
+        ObjCompact_t *h = &pHot[i];
+        if (pack_ids(s->Filtered_Object_ID, (int)s->Filtered_Object_Type,
+                     (int)s->Filtered_Object_Status, 0, 0, h) != 0) {
+            return -1;
+        }
+        h->Position_X = s->Filtered_Position_X;
+        h->Position_Y = s->Filtered_Position_Y;
+        h->Velocity_X = s->Filtered_Velocity_X;
+        h->Velocity_Y = s->Filtered_Velocity_Y;
+        h->Accel_X    = s->Filtered_Accel_X;
+        h->Heading    = s->Filtered_Heading;
+        h->Distance   = s->Filtered_Distance;
+        if (pCold) {
+            pCold[i].Position_Z = s->Filtered_Position_Z;
+            pCold[i].Accel_Y    = s->Filtered_Accel_Y;
+            pCold[i].Cell_ID    = s->Filtered_Object_Cell_ID;
+        }
+    }
+    return 0;
+}
+
+int obj_compact_to_filtered(const ObjCompact_t *pHot, const ObjCompactCold_t *pCold, int n, FilteredObject_t *pDst)
+{
+    if (!args_valid(pHot, n, pDst)) return -1;
+
+    for (int i = 0; i < n; i++) {
+        const ObjCompact_t *h = &pHot[i];
+        FilteredObject_t *d = &pDst[i];
+        memset(d, 0, sizeof(*d));
+        d->Filtered_Object_ID     = h->Object_ID;
+        d->Filtered_Object_Type   = (ObjectType_e)h->Object_Type;
+        d->Filtered_Object_Status = obj_compact_status(h);
+        d->Filtered_Position_X    = h->Position_X;
+        d->Filtered_Position_Y    = h->Position_Y;
+        d->Filtered_Velocity_X    = h->Velocity_X;
+        d->Filtered_Velocity_Y    = h->Velocity_Y;
+        d->Filtered_Accel_X       = h->Accel_X;
+        d->Filtered_Heading       = h->Heading;
+        d->Filtered_Distance      = h->Distance;
+        if (pCold) {
+            d->Filtered_Position_Z     = pCold[i].Position_Z;
+            d->Filtered_Accel_Y        = pCold[i].Accel_Y;
+            d->Filtered_Object_Cell_ID = pCold[i].Cell_ID;
+        }
+    }
+    return 0;
+}
+
+/*─────────────────────────────
+  PredictedObject_t
+─────────────────────────────*/
+int obj_compact_from_predicted(const PredictedObject_t *pSrc, int n, ObjCompact_t *pHot, ObjCompactCold_t *pCold)
+{
+    if (!args_valid(pSrc, n, pHot)) return -1;
+
+    for (int i = 0; i < n; i++) {
+        const PredictedObject_t *s = &pSrc[i];
+        ObjCompact_t *h = &pHot[i];
+        if (pack_ids(s->Predicted_Object_ID, (int)s->Predicted_Object_Type,
+                     (int)s->Predicted_Object_Status, s->CutIn_Flag, s->CutOut_Flag, h) != 0) {
+            return -1;
+        }
+        h->Position_X = s->Predicted_Position_X;
+        h->Position_Y = s->Predicted_Position_Y;
+        h->Velocity_X = s->Predicted_Velocity_X;
+        h->Velocity_Y = s->Predicted_Velocity_Y;
+        h->Accel_X    = s->Predicted_Accel_X;
+        h->Heading    = s->Predicted_Heading;
+        h->Distance   = s->Predicted_Distance;
+        if (pCold) {
+            pCold[i].Position_Z = s->Predicted_Position_Z;
+            pCold[i].Accel_Y    = s->Predicted_Accel_Y;
+            pCold[i].Cell_ID    = s->Predicted_Object_Cell_ID;
+        }
+    }
+    return 0;
+}
+
+int obj_compact_to_predicted(const ObjCompact_t *pHot, const ObjCompactCold_t *pCold, int n, PredictedObject_t *pDst)
+{
+    if (!args_valid(pHot, n, pDst)) return -1;
+
+    for (int i = 0; i < n; i++) {
+        const ObjCompact_t *h = &pHot[i];
+        PredictedObject_t *d = &pDst[i];
+        memset(d, 0, sizeof(*d));
+        d->Predicted_Object_ID     = h->Object_ID;
+        d->Predicted_Object_Type   = (ObjectType_e)h->Object_Type;
+        d->Predicted_Object_Status = obj_compact_status(h);
+        d->Predicted_Position_X    = h->Position_X;
+        d->Predicted_Position_Y    = h->Position_Y;
+        d->Predicted_Velocity_X    = h->Velocity_X;
+        d->Predicted_Velocity_Y    = h->Velocity_Y;
+        d->Predicted_Accel_X       = h->Accel_X;
+        d->Predicted_Heading       = h->Heading;
+        d->Predicted_Distance      = h->Distance;
+        d->CutIn_Flag              = (h->Flags & OBJ_COMPACT_FLAG_CUTIN) != 0;
+        d->CutOut_Flag             = (h->Flags & OBJ_COMPACT_FLAG_CUTOUT) != 0;
+        if (pCold) {
+            d->Predicted_Position_Z     = pCold[i].Position_Z;
+            d->Predicted_Accel_Y        = pCold[i].Accel_Y;
+            d->Predicted_Object_Cell_ID = pCold[i].Cell_ID;
+        }
+    }
+    return 0;
+}
+
+/*─────────────────────────────
+  반정밀도 (binary16)
+─────────────────────────────*/
+uint16_t obj_half_from_float(float f)
+{
+    uint32_t x;
+    memcpy(&x, &f, sizeof(x));
+
+    uint32_t sign = (x >> 16) & 0x8000u;
+    uint32_t exp  = (x >> 23) & 0xFFu;
+    uint32_t man  = x & 0x7FFFFFu;
+
+    if (exp == 0xFFu) {                                 /* Inf / NaN (NaN 은 quiet 비트 유지) */
+        return (uint16_t)(sign | 0x7C00u | (man ? 0x200u | (man >> 13) : 0u));
+    }
+
+    int32_t e = (int32_t)exp - 127 + 15;
+    if (e >= 31) return (uint16_t)(sign | 0x7C00u);     /* 범위 초과 → Inf */
+
+    uint32_t h, rem, halfway;
+    if (e <= 0) {                                       /* 비정규 (또는 0) */
+        if (e < -10) return (uint16_t)sign;
+        man |= 0x800000u;
+        uint32_t shift = (uint32_t)(14 - e);
+        h       = man >> shift;
+        rem     = man & ((1u << shift) - 1u);
+        halfway = 1u << (shift - 1u);
+    } else {
+        h       = ((uint32_t)e << 10) | (man >> 13);
+        rem     = man & 0x1FFFu;
+        halfway = 0x1000u;
+    }
+    if (rem > halfway || (rem == halfway && (h & 1u))) h++;    /* 가수 올림은 지수로 전파 (최대 → Inf) */
+    return (uint16_t)(sign | h);
+}
+
+float obj_half_to_float(uint16_t h)
+{
+    uint32_t sign = ((uint32_t)h & 0x8000u) << 16;
+    uint32_t exp  = ((uint32_t)h >> 10) & 0x1Fu;
+    uint32_t man  = (uint32_t)h & 0x3FFu;
+    uint32_t x;
+
+    if (exp == 0) {
+        if (man == 0) {
+            x = sign;
+        } else {                                        /* 비정규 → 정규화 */
+            int32_t e = -14;
+            while (!(man & 0x400u)) {
+                man <<= 1;
+                e--;
+            }
+            x = sign | ((uint32_t)(e + 127) << 23) | ((man & 0x3FFu) << 13);
+        }
+    } else if (exp == 0x1Fu) {
+        x = sign | 0x7F800000u | (man << 13);
+    } else {
+        x = sign | ((exp - 15u + 127u) << 23) | (man << 13);
+    }
+
+    float f;
+    memcpy(&f, &x, sizeof(f));
+    return f;
+}
+
+/*─────────────────────────────
+  위치 이력 링
+─────────────────────────────*/
+void obj_compact_history_reset(ObjCompactHistory_t *pHist)
+{
+    if (!pHist) return;
+
+    memset(pHist, 0, sizeof(*pHist));
+}
+
+void obj_compact_history_push(ObjCompactHistory_t *pHist, float x, float y)
+{
+    if (!pHist || pHist->Head >= OBJ_COMPACT_HIST_DEPTH) return;
+
+    pHist->X[pHist->Head] = obj_half_from_float(x);
+    pHist->Y[pHist->Head] = obj_half_from_float(y);
+    pHist->Head = (uint8_t)((pHist->Head + 1) % OBJ_COMPACT_HIST_DEPTH);
+    if (pHist->Count < OBJ_COMPACT_HIST_DEPTH) pHist->Count++;
+}
+
+int obj_compact_history_get(const ObjCompactHistory_t *pHist, int age, float *pX, float *pY)
+{
+    if (!pHist || !pX || !pY || age < 0 || age >= pHist->Count
+        || pHist->Head >= OBJ_COMPACT_HIST_DEPTH)
+    {
+        return -1;
+    }
+
+    int k = (pHist->Head - 1 - age + 2 * OBJ_COMPACT_HIST_DEPTH) % OBJ_COMPACT_HIST_DEPTH;
+    *pX = obj_half_to_float(pHist->X[k]);
+    *pY = obj_half_to_float(pHist->Y[k]);
+    return 0;
+}
@@ -0,0 +1,105 @@
+/****************************************************************************
+ * object_compact.h
+ *
+ * - 객체 파이프라인용 압축 레코드 (메모리 내 처리 형식, object_wire 와 달리 무손실)
+ *     . Hot 32 B  : 위치 X/Y, 속도 X/Y, 가속도 X, Heading, 거리 (float 그대로)
+ *                   + ID uint16 + Type uint8 + Flags uint8 (Status 4 bit, Cut-in / Cut-out)
+ *                   → 캐시 라인(64 B) 당 2 개, ObjectData_t 52 B / PredictedObject_t 56 B 대비
+ *     . Cold 12 B : 위치 Z, 가속도 Y, Cell ID (필터 통과 객체만 읽음)
+ *   ObjectData_t / FilteredObject_t / PredictedObject_t 모두 같은 Hot / Cold 로 표현
+ *   (ObjectData_t, FilteredObject_t 의 Cut 플래그는 0)
+ * - 변환 : ID 0 .. 65535, Type < 256, Status < 16 이면 왕복 비트 동일, 아니면 -1
+ * - 이력(선택) : 객체별 위치 X/Y 반정밀도(IEEE 754 binary16) 링 OBJ_COMPACT_HIST_DEPTH 개 = 32 B
+ *     . 변환은 소프트웨어 (round-to-nearest-even, 범위 초과는 ±Inf), |x| < 2048 m 에서 오차 <= 0.5 ulp
+ * - select_target_from_object_compact (target_selection.h) 가 Hot 배열을 바로 스캔
+ ****************************************************************************/
+#ifndef OBJECT_COMPACT_H
+#define OBJECT_COMPACT_H
+
+#include <stdint.h>
+#include "adas_shared.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define OBJ_COMPACT_MAX_ID          0xFFFF
+#define OBJ_COMPACT_STATUS_MASK     0x0Fu
+#define OBJ_COMPACT_FLAG_CUTIN      0x10u
+#define OBJ_COMPACT_FLAG_CUTOUT     0x20u
+#define OBJ_COMPACT_HIST_DEPTH      7
+
+/* Hot 레코드 (32 B, 패딩 없음) */
+typedef struct {
+    float    Position_X;
+    float    Position_Y;
+    float    Velocity_X;
+    float    Velocity_Y;
+    float    Accel_X;
+    float    Heading;
+    float    Distance;
+    uint16_t Object_ID;
+    uint8_t  Object_Type;               /* ObjectType_e */
+    uint8_t  Flags;                     /* Status | CUTIN | CUTOUT */
+} ObjCompact_t;
+
+/* Cold 레코드 (12 B) */
+typedef struct {
+    float    Position_Z;
+    float    Accel_Y;
+    int32_t  Cell_ID;
+} ObjCompactCold_t;
+
+/* 위치 이력 링 (32 B) : X[k], Y[k] 반정밀도 */
+typedef struct {
+    uint16_t X[OBJ_COMPACT_HIST_DEPTH];
+    uint16_t Y[OBJ_COMPACT_HIST_DEPTH];
+    uint8_t  Head;                      /* 다음 기록 위치 */
+    uint8_t  Count;                     /* 유효 샘플 수 (<= DEPTH) */
+    uint8_t  Reserved[2];
+} ObjCompactHistory_t;
+
+static inline ObjectStatus_e obj_compact_status(const ObjCompact_t *p)
+{
+    return (ObjectStatus_e)(p->Flags & OBJ_COMPACT_STATUS_MASK);
+}
+
+/**
+ * @brief ObjectData_t[n] → Hot / Cold
+ * @param[out] pCold : NULL 허용 (Cold 버림)
+ * @return 0 on success, -1 on invalid argument / 범위 밖 필드 (앞선 레코드는 기록됨)
+ */
+int obj_compact_from_objects(const ObjectData_t *pSrc, int n, ObjCompact_t *pHot, ObjCompactCold_t *pCold);
+
+/** @param[in] pCold : NULL 이면 Cold 필드 0 @return 0 / -1 */
+int obj_compact_to_objects(const ObjCompact_t *pHot, const ObjCompactCold_t *pCold, int n, ObjectData_t *pDst);
+
+int obj_compact_from_filtered(const FilteredObject_t *pSrc, int n, ObjCompact_t *pHot, ObjCompactCold_t *pCold);
+int obj_compact_to_filtered(const ObjCompact_t *pHot, const ObjCompactCold_t *pCold, int n, FilteredObject_t *pDst);
+
+int obj_compact_from_predicted(const PredictedObject_t *pSrc, int n, ObjCompact_t *pHot, ObjCompactCold_t *pCold);
+int obj_compact_to_predicted(const ObjCompact_t *pHot, const ObjCompactCold_t *pCold, int n, PredictedObject_t *pDst);
+
+/** @brief float → binary16 (round-to-nearest-even, NaN 유지) */
+uint16_t obj_half_from_float(float f);
+
+/** @brief binary16 → float (정확) */
+float obj_half_to_float(uint16_t h);
+
+/** @brief 이력 비우기 */
+void obj_compact_history_reset(ObjCompactHistory_t *pHist);
+
+/** @brief 위치 샘플 추가 (가득 차면 가장 오래된 샘플 덮어씀) */
+void obj_compact_history_push(ObjCompactHistory_t *pHist, float x, float y);
+
+/**
+ * @brief age 번째 이전 샘플 (0 = 최신)
+ * @return 0 on success, -1 on invalid argument / age >= Count
+ */
+int obj_compact_history_get(const ObjCompactHistory_t *pHist, int age, float *pX, float *pY);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* OBJECT_COMPACT_H */
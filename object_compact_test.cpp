@@ -0,0 +1,293 @@
+/*********************************************************************
+ * object_compact_test.cpp  ―  압축 객체 레코드 (Hot 32 B / Cold 12 B / 반정밀도 이력)
+ * DUT : object_compact.c, target_selection.c (select_target_from_object_compact)
+ *********************************************************************/
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include "object_compact.h"
+#include "target_selection.h"
+#include "test_rng.hpp"
+
+namespace {
+
+class ObjectCompactTest : public ::testing::Test {
+protected:
+    TestRng  rng{46u};
+
+    void random_objects(std::vector<ObjectData_t> &v)
+    {
+        for (size_t i = 0; i < v.size(); i++) {
+            ObjectData_t &o = v[i];
+            std::memset(&o, 0, sizeof(o));
+            o.Object_ID      = (int)(i * 61u % 65536u);
+            o.Object_Type    = (ObjectType_e)(i % 5);
+            o.Position_X     = rng.uni(-30.0f, 220.0f);
+            o.Position_Y     = rng.uni(-8.0f, 8.0f);
+            o.Position_Z     = rng.uni(-1.0f, 1.0f);
+            o.Velocity_X     = rng.uni(-5.0f, 35.0f);
+            o.Velocity_Y     = rng.uni(-2.0f, 2.0f);
+            o.Accel_X        = rng.uni(-3.0f, 3.0f);
+            o.Accel_Y        = rng.uni(-1.0f, 1.0f);
+            o.Heading        = rng.uni(-400.0f, 400.0f);
+            o.Distance       = std::sqrt(o.Position_X * o.Position_X + o.Position_Y * o.Position_Y);
+            o.Object_Status  = (ObjectStatus_e)(i % 4);
+            o.Object_Cell_ID = (int)(i % 13) - 3;
+        }
+    }
+};
+
+/* TC_OCMP_EQ_01 : ObjectData_t / FilteredObject_t / PredictedObject_t 왕복 비트 동일 */
+TEST_F(ObjectCompactTest, TC_OCMP_EQ_01)
+{
+    const int n = 300;
+    std::vector<ObjectData_t> obj(n), objBack(n);
+    random_objects(obj);
+    std::vector<ObjCompact_t>     hot(n);
+    std::vector<ObjCompactCold_t> cold(n);
+    ASSERT_EQ(obj_compact_from_objects(obj.data(), n, hot.data(), cold.data()), 0);
+    ASSERT_EQ(obj_compact_to_objects(hot.data(), cold.data(), n, objBack.data()), 0);
+    EXPECT_EQ(std::memcmp(obj.data(), objBack.data(), sizeof(ObjectData_t) * n), 0);
+
+    std::vector<FilteredObject_t> f(n), fBack(n);
+    std::vector<PredictedObject_t> p(n), pBack(n);
+    std::memset(f.data(), 0, sizeof(FilteredObject_t) * n);
+    std::memset(p.data(), 0, sizeof(PredictedObject_t) * n);
+    for (int i = 0; i < n; i++) {
+        const ObjectData_t &o = obj[(size_t)i];
+        f[(size_t)i].Filtered_Object_ID      = o.Object_ID;
+        f[(size_t)i].Filtered_Object_Type    = o.Object_Type;
+        f[(size_t)i].Filtered_Position_X     = o.Position_X;
+        f[(size_t)i].Filtered_Position_Y     = o.Position_Y;
+        f[(size_t)i].Filtered_Position_Z     = o.Position_Z;
+        f[(size_t)i].Filtered_Velocity_X     = o.Velocity_X;
+        f[(size_t)i].Filtered_Velocity_Y     = o.Velocity_Y;
+        f[(size_t)i].Filtered_Accel_X        = o.Accel_X;
+        f[(size_t)i].Filtered_Accel_Y        = o.Accel_Y;
+        f[(size_t)i].Filtered_Heading        = o.Heading;
+        f[(size_t)i].Filtered_Distance       = o.Distance;
+        f[(size_t)i].Filtered_Object_Status  = o.Object_Status;
+        f[(size_t)i].Filtered_Object_Cell_ID = o.Object_Cell_ID;
+
+        PredictedObject_t &q = p[(size_t)i];
+        q.Predicted_Object_ID      = o.Object_ID;
+        q.Predicted_Object_Type    = o.Object_Type;
+        q.Predicted_Position_X     = o.Position_X;
+        q.Predicted_Position_Y     = o.Position_Y;
+        q.Predicted_Position_Z     = o.Position_Z;
+        q.Predicted_Velocity_X     = o.Velocity_X;
+        q.Predicted_Velocity_Y     = o.Velocity_Y;
+        q.Predicted_Accel_X        = o.Accel_X;
+        q.Predicted_Accel_Y        = o.Accel_Y;
+        q.Predicted_Heading        = o.Heading;
+        q.Predicted_Distance       = o.Distance;
+        q.Predicted_Object_Status  = o.Object_Status;
+        q.Predicted_Object_Cell_ID = o.Object_Cell_ID;
+        q.CutIn_Flag               = (i % 3) == 1;
+        q.CutOut_Flag              = (i % 5) == 2;
+    }
+    ASSERT_EQ(obj_compact_from_filtered(f.data(), n, hot.data(), cold.data()), 0);
+    ASSERT_EQ(obj_compact_to_filtered(hot.data(), cold.data(), n, fBack.data()), 0);
+    EXPECT_EQ(std::memcmp(f.data(), fBack.data(), sizeof(FilteredObject_t) * n), 0);
+
+    ASSERT_EQ(obj_compact_from_predicted(p.data(), n, hot.data(), cold.data()), 0);
+    EXPECT_EQ(hot[1].Flags & OBJ_COMPACT_FLAG_CUTIN, OBJ_COMPACT_FLAG_CUTIN);
+    EXPECT_EQ(hot[2].Flags & OBJ_COMPACT_FLAG_CUTOUT, OBJ_COMPACT_FLAG_CUTOUT);
+    ASSERT_EQ(obj_compact_to_predicted(hot.data(), cold.data(), n, pBack.data()), 0);
+    EXPECT_EQ(std::memcmp(p.data(), pBack.data(), sizeof(PredictedObject_t) * n), 0);
+}
+
+/* TC_OCMP_EQ_02 : Hot / Cold 스캔 = ObjectData_t 스캔 (직선 / 곡선, 1000 객체) */
+TEST_F(ObjectCompactTest, TC_OCMP_EQ_02)
+{
+    const int n = 1000;
+    std::vector<ObjectData_t> obj(n);
+    std::vector<ObjCompact_t>     hot(n);
+    std::vector<ObjCompactCold_t> cold(n);
+    std::vector<FilteredObject_t> ref(n), cmp(n);
+
+    EgoData_t ego;
+    std::memset(&ego, 0, sizeof(ego));
+    ego.Ego_Velocity_X = 22.0f;
+    LaneSelectOutput_t ls;
+    std::memset(&ls, 0, sizeof(ls));
+    ls.LS_Lane_Width = 3.5f;
+
+    for (int round = 0; round < 4; round++) {
+        random_objects(obj);
+        ls.LS_Is_Curved_Lane = (round % 2) == 1;
+        ls.LS_Heading_Error  = rng.uni(-10.0f, 10.0f);
+        ASSERT_EQ(obj_compact_from_objects(obj.data(), n, hot.data(), cold.data()), 0);
+
+        std::memset(ref.data(), 0, sizeof(FilteredObject_t) * n);
+        std::memset(cmp.data(), 0, sizeof(FilteredObject_t) * n);
+        int nRef = select_target_from_object_list(obj.data(), n, &ego, &ls, ref.data(), n);
+        int nCmp = select_target_from_object_compact(hot.data(), cold.data(), n, &ego, &ls, cmp.data(), n);
+        ASSERT_GT(nRef, 0);
+        ASSERT_EQ(nCmp, nRef);
+        EXPECT_EQ(std::memcmp(ref.data(), cmp.data(), sizeof(FilteredObject_t) * (size_t)nRef), 0)
+            << "round " << round;
+
+        /* 용량 제한도 같은 지점에서 끊김 */
+        EXPECT_EQ(select_target_from_object_compact(hot.data(), cold.data(), n, &ego, &ls, cmp.data(), 3), 3);
+        EXPECT_EQ(std::memcmp(ref.data(), cmp.data(), sizeof(FilteredObject_t) * 3), 0);
+    }
+
+    /* Cold 없음 : Position_Z / Accel_Y 만 0 */
+    int nRef = select_target_from_object_list(obj.data(), n, &ego, &ls, ref.data(), n);
+    ASSERT_EQ(select_target_from_object_compact(hot.data(), nullptr, n, &ego, &ls, cmp.data(), n), nRef);
+    for (int i = 0; i < nRef; i++) {
+        EXPECT_EQ(cmp[(size_t)i].Filtered_Position_Z, 0.0f);
+        EXPECT_EQ(cmp[(size_t)i].Filtered_Accel_Y, 0.0f);
+        EXPECT_EQ(cmp[(size_t)i].Filtered_Object_Cell_ID, ref[(size_t)i].Filtered_Object_Cell_ID);
+        EXPECT_EQ(cmp[(size_t)i].Filtered_Distance, ref[(size_t)i].Filtered_Distance);
+    }
+}
+
+/* TC_OCMP_EQ_03 : 반정밀도 변환 (모든 binary16 왕복, 대표값, 최근접 반올림) */
+TEST_F(ObjectCompactTest, TC_OCMP_EQ_03)
+{
+    for (uint32_t h = 0; h < 0x10000u; h++) {
+        float f = obj_half_to_float((uint16_t)h);
+        if (std::isnan(f)) {
+            EXPECT_TRUE(std::isnan(obj_half_to_float(obj_half_from_float(f))));
+            continue;
+        }
+        ASSERT_EQ(obj_half_from_float(f), (uint16_t)h) << std::hex << h;
+    }
+
+    EXPECT_EQ(obj_half_from_float(1.0f), 0x3C00u);
+    EXPECT_EQ(obj_half_from_float(-2.0f), 0xC000u);
+    EXPECT_EQ(obj_half_from_float(65504.0f), 0x7BFFu);
+    EXPECT_EQ(obj_half_from_float(65520.0f), 0x7C00u);                 /* 올림 → Inf */
+    EXPECT_EQ(obj_half_from_float(1e10f), 0x7C00u);
+    EXPECT_EQ(obj_half_from_float(std::ldexp(1.0f, -24)), 0x0001u);     /* 최소 비정규 */
+    EXPECT_EQ(obj_half_from_float(std::ldexp(1.0f, -25)), 0x0000u);     /* 동률 → 짝수(0) */
+    EXPECT_EQ(obj_half_from_float(std::ldexp(1.5f, -25)), 0x0001u);
+    EXPECT_EQ(obj_half_from_float(2049.0f), obj_half_from_float(2048.0f));  /* 동률 → 짝수 */
+    EXPECT_EQ(obj_half_from_float(2051.0f), obj_half_from_float(2052.0f));
+    EXPECT_EQ(obj_half_from_float(-0.0f), 0x8000u);
+
+    /* 무작위 : 이웃 값보다 멀지 않음 (최근접) */
+    for (int k = 0; k < 20000; k++) {
+        float f = rng.uni(-60000.0f, 60000.0f) * std::ldexp(1.0f, -(k % 30));
+        uint16_t h = obj_half_from_float(f);
+        float e = std::fabs(obj_half_to_float(h) - f);
+        EXPECT_LE(e, std::fabs(obj_half_to_float((uint16_t)(h + 1)) - f));
+        if ((h & 0x7FFFu) != 0) {
+            EXPECT_LE(e, std::fabs(obj_half_to_float((uint16_t)(h - 1)) - f));
+        }
+    }
+}
+
+/* TC_OCMP_EQ_04 : 위치 이력 링 (최신 순 조회, 덮어쓰기, 정밀도) */
+TEST_F(ObjectCompactTest, TC_OCMP_EQ_04)
+{
+    ObjCompactHistory_t hist;
+    obj_compact_history_reset(&hist);
+    float x, y;
+    EXPECT_EQ(obj_compact_history_get(&hist, 0, &x, &y), -1);
+
+    for (int t = 0; t < 20; t++) {
+        obj_compact_history_push(&hist, 10.0f * (float)t + 0.3f, -1.5f + 0.01f * (float)t);
+        int cnt = std::min(t + 1, OBJ_COMPACT_HIST_DEPTH);
+        EXPECT_EQ(hist.Count, cnt);
+        for (int age = 0; age < cnt; age++) {
+            ASSERT_EQ(obj_compact_history_get(&hist, age, &x, &y), 0);
+            float ex = 10.0f * (float)(t - age) + 0.3f;
+            float ey = -1.5f + 0.01f * (float)(t - age);
+            EXPECT_NEAR(x, ex, std::fabs(ex) * (1.0f / 2048.0f));   /* 0.5 ulp (11 bit 가수) */
+            EXPECT_NEAR(y, ey, std::fabs(ey) * (1.0f / 2048.0f));
+        }
+        EXPECT_EQ(obj_compact_history_get(&hist, cnt, &x, &y), -1);
+    }
+}
+
+/* TC_OCMP_BV_01 : 레코드 크기, 정수 필드 경계 */
+TEST_F(ObjectCompactTest, TC_OCMP_BV_01)
+{
+    EXPECT_EQ(sizeof(ObjCompact_t), 32u);
+    EXPECT_EQ(sizeof(ObjCompactCold_t), 12u);
+    EXPECT_EQ(sizeof(ObjCompactHistory_t), 32u);
+
+    ObjectData_t o;
+    std::memset(&o, 0, sizeof(o));
+    ObjCompact_t h;
+    o.Object_ID = OBJ_COMPACT_MAX_ID;
+    o.Object_Status = (ObjectStatus_e)15;
+    EXPECT_EQ(obj_compact_from_objects(&o, 1, &h, nullptr), 0);
+    EXPECT_EQ(h.Object_ID, 0xFFFFu);
+    EXPECT_EQ(h.Flags, 15u);
+    o.Object_ID = OBJ_COMPACT_MAX_ID + 1;
+    EXPECT_EQ(obj_compact_from_objects(&o, 1, &h, nullptr), -1);
+    o.Object_ID = -1;
+    EXPECT_EQ(obj_compact_from_objects(&o, 1, &h, nullptr), -1);
+    o.Object_ID = 0;
+    o.Object_Status = (ObjectStatus_e)16;
+    EXPECT_EQ(obj_compact_from_objects(&o, 1, &h, nullptr), -1);
+    o.Object_Status = OBJSTAT_MOVING;
+    o.Object_Type = (ObjectType_e)256;
+    EXPECT_EQ(obj_compact_from_objects(&o, 1, &h, nullptr), -1);
+
+    /* Cold 없이 풀기 → Cold 필드 0, 0 개는 성공 */
+    o.Object_Type    = OBJTYPE_CAR;
+    o.Position_Z     = 1.0f;
+    o.Object_Cell_ID = 7;
+    ASSERT_EQ(obj_compact_from_objects(&o, 1, &h, nullptr), 0);
+    ObjectData_t back;
+    ASSERT_EQ(obj_compact_to_objects(&h, nullptr, 1, &back), 0);
+    EXPECT_EQ(back.Position_Z, 0.0f);
+    EXPECT_EQ(back.Object_Cell_ID, 0);
+    EXPECT_EQ(obj_compact_from_objects(nullptr, 0, nullptr, nullptr), 0);
+    EXPECT_EQ(select_target_from_object_compact(&h, nullptr, 0, nullptr, nullptr, nullptr, 1), 0);
+}
+
+/* TC_OCMP_RA_01 : 인자 오류 */
+TEST_F(ObjectCompactTest, TC_OCMP_RA_01)
+{
+    ObjectData_t      o;
+    FilteredObject_t  f;
+    PredictedObject_t p;
+    ObjCompact_t      h;
+    std::memset(&o, 0, sizeof(o));
+    std::memset(&f, 0, sizeof(f));
+    std::memset(&p, 0, sizeof(p));
+    std::memset(&h, 0, sizeof(h));
+
+    EXPECT_EQ(obj_compact_from_objects(nullptr, 1, &h, nullptr), -1);
+    EXPECT_EQ(obj_compact_from_objects(&o, 1, nullptr, nullptr), -1);
+    EXPECT_EQ(obj_compact_from_objects(&o, -1, &h, nullptr), -1);
+    EXPECT_EQ(obj_compact_to_objects(nullptr, nullptr, 1, &o), -1);
+    EXPECT_EQ(obj_compact_to_objects(&h, nullptr, 1, nullptr), -1);
+    EXPECT_EQ(obj_compact_from_filtered(nullptr, 1, &h, nullptr), -1);
+    EXPECT_EQ(obj_compact_to_filtered(&h, nullptr, 1, nullptr), -1);
+    EXPECT_EQ(obj_compact_from_predicted(&p, 1, nullptr, nullptr), -1);
+    EXPECT_EQ(obj_compact_to_predicted(nullptr, nullptr, 1, &p), -1);
+
+    EgoData_t ego;
+    LaneSelectOutput_t ls;
+    std::memset(&ego, 0, sizeof(ego));
+    std::memset(&ls, 0, sizeof(ls));
+    EXPECT_EQ(select_target_from_object_compact(nullptr, nullptr, 1, &ego, &ls, &f, 1), 0);
+    EXPECT_EQ(select_target_from_object_compact(&h, nullptr, 1, nullptr, &ls, &f, 1), 0);
+    EXPECT_EQ(select_target_from_object_compact(&h, nullptr, 1, &ego, &ls, &f, 0), 0);
+
+    float x, y;
+    obj_compact_history_reset(nullptr);
+    obj_compact_history_push(nullptr, 1.0f, 1.0f);
+    EXPECT_EQ(obj_compact_history_get(nullptr, 0, &x, &y), -1);
+    ObjCompactHistory_t hist;
+    obj_compact_history_reset(&hist);
+    obj_compact_history_push(&hist, 1.0f, 2.0f);
+    EXPECT_EQ(obj_compact_history_get(&hist, -1, &x, &y), -1);
+    EXPECT_EQ(obj_compact_history_get(&hist, 0, nullptr, &y), -1);
+    hist.Head = OBJ_COMPACT_HIST_DEPTH;                                 /* 손상된 링 */
+    EXPECT_EQ(obj_compact_history_get(&hist, 0, &x, &y), -1);
+}
+
+}  // namespace
@@ -0,0 +1,196 @@
+#include <math.h>
+#include <string.h>
+
+#include "object_status.h"
+
+#define ST_SHIFT        6
+#define ST_COUNT_MASK   0x3Fu
+#define MISSED_EMPTY    0xFFu
+
+/*─────────────────────────────
+  ID 해시 (개방 주소법)
+─────────────────────────────*/
+static uint32_t hash_of(int id)
+{
+    return ((uint32_t)id * 2654435761u) >> 7 & (OBJ_STATUS_HASH_SIZE - 1);
+}
+
+static void hash_insert(ObjectStatusTable_t *t, int slot)
+{
+    uint32_t h = hash_of(t->Id[slot]);
+    while (t->Hash[h] >= 0) {
+        h = (h + 1u) & (OBJ_STATUS_HASH_SIZE - 1);
+    }
+    t->Hash[h] = (int16_t)slot;
+}
+
+static int hash_find(const ObjectStatusTable_t *t, int id)
+{
+    uint32_t h = hash_of(id);
+    for (int probe = 0; probe < OBJ_STATUS_HASH_SIZE; probe++) {
+        int s = t->Hash[h];
+        if (s < 0) return -1;
+        if (t->Id[s] == id) return s;
+        h = (h + 1u) & (OBJ_STATUS_HASH_SIZE - 1);
+    }
+    return -1;
+}
+
+static void hash_rebuild(ObjectStatusTable_t *t)
+{
+    for (int h = 0; h < OBJ_STATUS_HASH_SIZE; h++) t->Hash[h] = -1;
+    for (int s = 0; s < t->High_Water; s++) {
+        if (t->Missed[s] != MISSED_EMPTY) hash_insert(t, s);
+    }
+}
+
+/*─────────────────────────────
+  새 객체 슬롯 (이력 없음 → 초기 상태)
+─────────────────────────────*/
+static int alloc_slot(ObjectStatusTable_t *t, int id, float speed, ObjectStatus_e inStatus)
+{
+    int s = t->Free_Hint;
+    while (s < OBJ_STATUS_MAX && t->Missed[s] != MISSED_EMPTY) s++;
+    if (s == OBJ_STATUS_MAX) {
+        t->Free_Hint = OBJ_STATUS_MAX;
+        return -1;
+    }
+    t->Free_Hint = s + 1;
+
+    ObjectStatus_e init;
+    if (speed > t->Cfg.Move_Speed)          init = OBJSTAT_MOVING;
+    else if (inStatus == OBJSTAT_STOPPED)   init = OBJSTAT_STOPPED;
+    else                                    init = OBJSTAT_STATIONARY;
+
+    t->Id[s]     = id;
+    t->Packed[s] = (uint8_t)((unsigned)init << ST_SHIFT);
+    t->Missed[s] = 0;
+    t->Active_Count++;
+    if (s + 1 > t->High_Water) t->High_Water = s + 1;
+    hash_insert(t, s);
+    return s;
+}
+
+/*─────────────────────────────
+  공개 함수
+─────────────────────────────*/
+void object_status_default_config(ObjStatusConfig_t *pCfg)
+{
+    if (!pCfg) return;
+    pCfg->Stop_Speed       = 0.3f;
+    pCfg->Move_Speed       = 0.8f;
+    pCfg->Stop_Debounce    = 30;
+    pCfg->Move_Debounce    = 10;
+    pCfg->Max_Missed       = 20;
+    pCfg->Oncoming_Heading = 150.0f;
+}
+
+int object_status_init(ObjectStatusTable_t *pTable, const ObjStatusConfig_t *pCfg)
+{
+    if (!pTable || !pCfg) return -1;
+    if (!(pCfg->Stop_Speed >= 0.0f) || !(pCfg->Move_Speed > pCfg->Stop_Speed) ||
+        pCfg->Stop_Debounce < 1 || pCfg->Stop_Debounce > OBJ_STATUS_COUNTER_MAX ||
+        pCfg->Move_Debounce < 1 || pCfg->Move_Debounce > OBJ_STATUS_COUNTER_MAX ||
+        pCfg->Max_Missed < 1 || pCfg->Max_Missed > 254 ||
+        !(pCfg->Oncoming_Heading > 0.0f) || !(pCfg->Oncoming_Heading <= 180.0f)) {
+        return -1;
+    }
+    memset(pTable, 0, sizeof(*pTable));
+    pTable->Cfg = *pCfg;
+    memset(pTable->Missed, MISSED_EMPTY, sizeof(pTable->Missed));
+    for (int h = 0; h < OBJ_STATUS_HASH_SIZE; h++) pTable->Hash[h] = -1;
+    return 0;
+}
+
+int object_status_update(ObjectStatusTable_t *pTable, const EgoData_t *pEgo,
+                         FilteredObject_t *pFilteredList, int count)
+{
+    if (!pTable || !pEgo || count < 0 || count > OBJ_STATUS_MAX ||
+        (count > 0 && !pFilteredList)) {
+        return -1;
+    }
+    ObjectStatusTable_t *t = pTable;
+    const ObjStatusConfig_t *c = &t->Cfg;
+
+    /* 1) 미관측 카운터 증가 (관측된 객체는 2 에서 0 으로) */
+    for (int s = 0; s < t->High_Water; s++) {
+        unsigned m = t->Missed[s];
+        t->Missed[s] = (uint8_t)(m + (m < MISSED_EMPTY - 1u));
+    }
+
+    /* 2) 슬롯 조회 / 생성, 입력 모으기 */
+    for (int i = 0; i < count; i++) {
+        const FilteredObject_t *fo = &pFilteredList[i];
+        float vx = fo->Filtered_Velocity_X, vy = fo->Filtered_Velocity_Y;
+        float speed = sqrtf(vx * vx + vy * vy);
+        float hd = fabsf(fo->Filtered_Heading - pEgo->Ego_Heading);
+        if (hd > 180.0f) hd = 360.0f - hd;
+
+        int s = hash_find(t, fo->Filtered_Object_ID);
+        if (s < 0) {
+            s = alloc_slot(t, fo->Filtered_Object_ID, speed, fo->Filtered_Object_Status);
+            if (s < 0) t->Dropped++;
+        }
+        if (s >= 0) t->Missed[s] = 0;
+        t->Frame_Slot[i]     = (int16_t)s;
+        t->Frame_Speed[i]    = speed;
+        t->Frame_Oncoming[i] = (uint8_t)(hd >= c->Oncoming_Heading);
+    }
+
+    /* 3) 상태 전이 (분기 없음 : 비교 마스크 + 상태별 표)
+     *    pending = Moving 이면 느림, 그 외 빠름 → 카운터 증가, 아니면 0
+     *    카운터 >= 디바운스 → 다음 상태, 카운터 0 */
+    const uint8_t deb[3]  = { (uint8_t)c->Stop_Debounce, (uint8_t)c->Move_Debounce,
+                              (uint8_t)c->Move_Debounce };
+    const uint8_t next[3] = { OBJSTAT_STOPPED, OBJSTAT_MOVING, OBJSTAT_MOVING };
+    int transitions = 0;
+    for (int i = 0; i < count; i++) {
+        int      s      = t->Frame_Slot[i];
+        unsigned valid  = (unsigned)(s >= 0);
+        int      ss     = s & ~(s >> 31);                      /* s < 0 → 0 (결과 미사용) */
+        unsigned p      = t->Packed[ss];
+        unsigned st     = p >> ST_SHIFT;
+        unsigned cnt    = p & ST_COUNT_MASK;
+        unsigned slow   = (unsigned)(t->Frame_Speed[i] < c->Stop_Speed);
+        unsigned fast   = (unsigned)(t->Frame_Speed[i] > c->Move_Speed);
+        unsigned moving = (unsigned)(st == OBJSTAT_MOVING);
+        unsigned pend   = (moving & slow) | ((moving ^ 1u) & fast);
+        unsigned cnt1   = (cnt + (cnt < OBJ_STATUS_COUNTER_MAX)) * pend;
+        unsigned sw     = (unsigned)(cnt1 >= deb[st]);
+        unsigned nst    = st + sw * (next[st] - st);
+        unsigned np     = (nst << ST_SHIFT) | (cnt1 * (sw ^ 1u));
+
+        t->Packed[ss] = (uint8_t)(valid ? np : p);
+        transitions  += (int)(sw & valid);
+
+        unsigned onc = t->Frame_Oncoming[i];
+        unsigned out = onc * (unsigned)OBJSTAT_ONCOMING + (onc ^ 1u) * nst;
+        pFilteredList[i].Filtered_Object_Status =
+            valid ? (ObjectStatus_e)out : pFilteredList[i].Filtered_Object_Status;
+    }
+    t->Transitions += transitions;
+
+    /* 4) 오래 미관측 슬롯 해제 */
+    bool removed = false;
+    for (int s = 0; s < t->High_Water; s++) {
+        if (t->Missed[s] != MISSED_EMPTY && t->Missed[s] > (unsigned)c->Max_Missed) {
+            t->Missed[s] = MISSED_EMPTY;
+            t->Active_Count--;
+            if (s < t->Free_Hint) t->Free_Hint = s;
+            removed = true;
+        }
+    }
+    if (removed) {
+        while (t->High_Water > 0 && t->Missed[t->High_Water - 1] == MISSED_EMPTY) t->High_Water--;
+        hash_rebuild(t);
+    }
+    return t->Active_Count;
+}
+
+int object_status_get(const ObjectStatusTable_t *pTable, int objectId)
+{
+    if (!pTable) return -1;
+    int s = hash_find(pTable, objectId);
+    if (s < 0) return -1;
+    return (int)(pTable->Packed[s] >> ST_SHIFT);
+}
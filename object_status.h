@@ -0,0 +1,86 @@
+/****************************************************************************
+ * object_status.h
+ *
+ * - 객체별 Moving / Stopped / Stationary 상태 머신 (히스테리시스 + 디바운스)
+ *     . select_target_from_object_list 는 |상대속도| < 0.5 m/s 를 모두 Stationary 로
+ *       처리 (이력 없음) → 정지한 선행차가 ACC 후보(Moving/Stopped)에서 빠짐
+ *     . 여기서는 대지 속도 |v| 와 이력으로 구분
+ *         Moving     --(|v| < Stop_Speed 가 Stop_Debounce 프레임 연속)--> Stopped
+ *         Stopped    --(|v| > Move_Speed 가 Move_Debounce 프레임 연속)--> Moving
+ *         Stationary --(|v| > Move_Speed 가 Move_Debounce 프레임 연속)--> Moving
+ *       처음 본 객체 : 빠르면 Moving, 느리면 입력 상태가 Stopped 일 때만 Stopped,
+ *       아니면 Stationary (움직인 이력 없음)
+ *     . Oncoming 은 기존과 같이 진행 방향 차이 >= Oncoming_Heading 이면 즉시 출력
+ *       (내부 상태 머신은 계속 진행)
+ * - 사용 : select_target_from_object_list 직후 object_status_update 로
+ *          Filtered_Object_Status 를 제자리 갱신
+ *          (파이프라인은 adas_pipeline_set_object_status 로 연결하면 target 단계에서 호출)
+ * - 저장 : 객체당 ID 4 B + 상태/카운터 1 B (상위 2 bit 상태, 하위 6 bit 디바운스 카운터)
+ *          + 미관측 1 B, ID → 슬롯 해시 (개방 주소법)
+ * - 갱신 : 슬롯 조회 후 배치 커널이 분기 없이(비교 결과 마스크 + 전이 표) 상태 전이
+ * - ObjectStatusTable_t 는 크다 (~70 KB) → static 또는 힙에 둘 것
+ ****************************************************************************/
+#ifndef OBJECT_STATUS_H
+#define OBJECT_STATUS_H
+
+#include <stdint.h>
+#include "adas_shared.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define OBJ_STATUS_MAX          4096
+#define OBJ_STATUS_HASH_SIZE    8192    /* 2 의 거듭제곱, >= 2 × OBJ_STATUS_MAX */
+#define OBJ_STATUS_COUNTER_MAX  63      /* 6 bit 디바운스 카운터 */
+
+typedef struct {
+    float   Stop_Speed;         /* [m/s] 이하 = 정지 후보 */
+    float   Move_Speed;         /* [m/s] 이상 = 이동 후보 (> Stop_Speed) */
+    int32_t Stop_Debounce;      /* [frame] Moving → Stopped (1 .. OBJ_STATUS_COUNTER_MAX) */
+    int32_t Move_Debounce;      /* [frame] Stopped/Stationary → Moving */
+    int32_t Max_Missed;         /* [frame] 연속 미관측 초과 시 슬롯 해제 (1 .. 254) */
+    float   Oncoming_Heading;   /* [°] Ego 진행 방향과 차이 이상 = Oncoming */
+} ObjStatusConfig_t;
+
+typedef struct {
+    ObjStatusConfig_t Cfg;
+    int32_t  High_Water;                    /* 사용한 최대 슬롯 + 1 */
+    int32_t  Active_Count;
+    int32_t  Dropped;                       /* 테이블 가득 차 분류 못 한 객체 누계 */
+    int32_t  Transitions;                   /* 상태 전이 누계 (Oncoming 제외) */
+    int32_t  Free_Hint;                     /* 이 슬롯 미만은 모두 사용 중 */
+
+    int32_t  Id[OBJ_STATUS_MAX];
+    uint8_t  Packed[OBJ_STATUS_MAX];        /* [7:6] 상태, [5:0] 디바운스 카운터 */
+    uint8_t  Missed[OBJ_STATUS_MAX];        /* 0xFF = 빈 슬롯 */
+    int16_t  Hash[OBJ_STATUS_HASH_SIZE];    /* ID → 슬롯 (-1 = 빈칸) */
+
+    /* 프레임 작업 영역 (입력 순서) */
+    int16_t  Frame_Slot[OBJ_STATUS_MAX];
+    float    Frame_Speed[OBJ_STATUS_MAX];
+    uint8_t  Frame_Oncoming[OBJ_STATUS_MAX];
+} ObjectStatusTable_t;
+
+/** @brief 기본 구성 (정지 0.3 / 이동 0.8 m/s, 디바운스 30 / 10 프레임 @10 ms, 미관측 20) */
+void object_status_default_config(ObjStatusConfig_t *pCfg);
+
+/** @return 0 on success, -1 on invalid argument/config */
+int object_status_init(ObjectStatusTable_t *pTable, const ObjStatusConfig_t *pCfg);
+
+/**
+ * @brief 1 프레임 갱신 : 상태 전이 후 pFilteredList[i].Filtered_Object_Status 를 제자리 갱신
+ *        (테이블이 가득 차 슬롯을 못 받은 객체는 입력 상태 유지)
+ * @return 활성 객체 수, -1 on invalid argument
+ */
+int object_status_update(ObjectStatusTable_t *pTable, const EgoData_t *pEgo,
+                         FilteredObject_t *pFilteredList, int count);
+
+/** @return ID 의 현재 상태 (Oncoming 판정 제외), 없으면 -1 */
+int object_status_get(const ObjectStatusTable_t *pTable, int objectId);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* OBJECT_STATUS_H */
@@ -0,0 +1,311 @@
+/*********************************************************************
+ * object_status_test.cpp  ―  객체 Moving / Stopped / Stationary 상태 머신
+ * DUT : object_status.c (+ target_selection.c / adas_pipeline.c 연동)
+ *********************************************************************/
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "acc.h"
+#include "adas_pipeline.h"
+#include "object_status.h"
+#include "target_selection.h"
+#include "test_rng.hpp"
+
+namespace {
+
+class ObjectStatusTest : public ::testing::Test {
+protected:
+    std::unique_ptr<ObjectStatusTable_t> tbl{ new ObjectStatusTable_t };
+    ObjStatusConfig_t cfg;
+    EgoData_t ego;
+    TestRng  rng{3u};
+
+    void SetUp() override
+    {
+        object_status_default_config(&cfg);
+        ASSERT_EQ(object_status_init(tbl.get(), &cfg), 0);
+        std::memset(&ego, 0, sizeof(ego));
+    }
+
+    static FilteredObject_t fobj(int id, float x, float vx, float heading = 0.0f,
+                                 ObjectStatus_e st = OBJSTAT_STATIONARY)
+    {
+        FilteredObject_t f;
+        std::memset(&f, 0, sizeof(f));
+        f.Filtered_Object_ID     = id;
+        f.Filtered_Object_Type   = OBJTYPE_CAR;
+        f.Filtered_Position_X    = x;
+        f.Filtered_Velocity_X    = vx;
+        f.Filtered_Heading       = heading;
+        f.Filtered_Distance      = x;
+        f.Filtered_Object_Status = st;
+        f.Filtered_Object_Cell_ID = 3;
+        return f;
+    }
+
+    /* 1 프레임 단일 객체 갱신 → 출력 상태 */
+    ObjectStatus_e step(FilteredObject_t f)
+    {
+        EXPECT_GE(object_status_update(tbl.get(), &ego, &f, 1), 0);
+        return f.Filtered_Object_Status;
+    }
+};
+
+} /* namespace */
+
+/* 선행차와 함께 정차 : 기존 분류는 Stationary → ACC 타겟 상실, 상태 머신은 Stopped 유지 */
+TEST_F(ObjectStatusTest, TC_OSTAT_EQ_01)
+{
+    ObjectData_t obj;
+    std::memset(&obj, 0, sizeof(obj));
+    obj.Object_ID     = 42;
+    obj.Object_Type   = OBJTYPE_CAR;
+    obj.Position_X    = 20.0f;
+    obj.Distance      = 20.0f;
+    obj.Object_Status = OBJSTAT_MOVING;
+    LaneSelectOutput_t ls;
+    std::memset(&ls, 0, sizeof(ls));
+    ls.LS_Lane_Width = 3.5f;
+    LaneData_t lane;
+    std::memset(&lane, 0, sizeof(lane));
+
+    int rawHits = 0, hystHits = 0, frames = 0;
+    ACC_Target_t acc;
+    AEB_Target_t aeb;
+    for (int k = 0; k < 300; k++) {
+        float v = std::fmax(0.0f, 10.0f - 0.05f * (float)k);   /* 2 s 동안 10 → 0 m/s */
+        ego.Ego_Velocity_X = v;
+        obj.Velocity_X     = v;
+
+        FilteredObject_t filt[1];
+        PredictedObject_t pred[1];
+        ASSERT_EQ(select_target_from_object_list(&obj, 1, &ego, &ls, filt, 1), 1);
+
+        FilteredObject_t raw = filt[0];
+        ASSERT_EQ(predict_object_future_path(&raw, 1, &lane, &ls, pred, 1), 1);
+        select_targets_for_acc_aeb(&ego, pred, 1, &ls, &acc, &aeb);
+        rawHits += (acc.ACC_Target_ID == 42);
+
+        ASSERT_EQ(object_status_update(tbl.get(), &ego, filt, 1), 1);
+        ASSERT_EQ(predict_object_future_path(filt, 1, &lane, &ls, pred, 1), 1);
+        select_targets_for_acc_aeb(&ego, pred, 1, &ls, &acc, &aeb);
+        hystHits += (acc.ACC_Target_ID == 42);
+        frames++;
+    }
+    EXPECT_EQ(rawHits, 0);
+    EXPECT_EQ(hystHits, frames);
+    EXPECT_EQ(acc.ACC_Target_Status, OBJSTAT_STOPPED);
+    EXPECT_EQ(object_status_get(tbl.get(), 42), OBJSTAT_STOPPED);
+    EXPECT_EQ(tbl->Transitions, 1);
+}
+
+/* 임계 근처 속도 잡음 : 히스테리시스 대역 안이면 전이 없음 */
+TEST_F(ObjectStatusTest, TC_OSTAT_EQ_02)
+{
+    ASSERT_EQ(step(fobj(1, 30.0f, 5.0f)), OBJSTAT_MOVING);
+    for (int k = 0; k < 1000; k++) {
+        EXPECT_EQ(step(fobj(1, 30.0f, 0.55f + rng.uni(-0.2f, 0.2f))), OBJSTAT_MOVING);
+    }
+    EXPECT_EQ(tbl->Transitions, 0);
+
+    /* 정지 후보 구간에 짧은 튐(1 프레임 빠름) → 카운터 초기화 */
+    for (int k = 0; k < cfg.Stop_Debounce - 1; k++) step(fobj(1, 30.0f, 0.1f));
+    EXPECT_EQ(step(fobj(1, 30.0f, 1.0f)), OBJSTAT_MOVING);
+    for (int k = 0; k < cfg.Stop_Debounce - 1; k++) {
+        EXPECT_EQ(step(fobj(1, 30.0f, 0.1f)), OBJSTAT_MOVING);
+    }
+    EXPECT_EQ(step(fobj(1, 30.0f, 0.1f)), OBJSTAT_STOPPED);
+}
+
+/* Stationary(이동 이력 없음) → Moving → Stopped */
+TEST_F(ObjectStatusTest, TC_OSTAT_EQ_03)
+{
+    EXPECT_EQ(step(fobj(7, 50.0f, 0.0f)), OBJSTAT_STATIONARY);
+    for (int k = 0; k < 100; k++) EXPECT_EQ(step(fobj(7, 50.0f, 0.1f)), OBJSTAT_STATIONARY);
+    for (int k = 0; k < cfg.Move_Debounce - 1; k++) {
+        EXPECT_EQ(step(fobj(7, 50.0f, 2.0f)), OBJSTAT_STATIONARY);
+    }
+    EXPECT_EQ(step(fobj(7, 50.0f, 2.0f)), OBJSTAT_MOVING);
+    for (int k = 0; k < cfg.Stop_Debounce - 1; k++) step(fobj(7, 50.0f, 0.0f));
+    EXPECT_EQ(step(fobj(7, 50.0f, 0.0f)), OBJSTAT_STOPPED);
+    for (int k = 0; k < cfg.Move_Debounce; k++) step(fobj(7, 50.0f, 3.0f));
+    EXPECT_EQ(object_status_get(tbl.get(), 7), OBJSTAT_MOVING);
+    EXPECT_EQ(tbl->Transitions, 3);
+}
+
+/* 초기 상태 (입력 Stopped 유지), Oncoming 즉시 출력 + 내부 상태 유지 */
+TEST_F(ObjectStatusTest, TC_OSTAT_EQ_04)
+{
+    EXPECT_EQ(step(fobj(3, 20.0f, 0.0f, 0.0f, OBJSTAT_STOPPED)), OBJSTAT_STOPPED);
+    EXPECT_EQ(step(fobj(4, 20.0f, 0.0f, 0.0f, OBJSTAT_MOVING)), OBJSTAT_STATIONARY);
+
+    ego.Ego_Heading = 170.0f;
+    EXPECT_EQ(step(fobj(5, 80.0f, -15.0f, -20.0f)), OBJSTAT_ONCOMING);   /* 차이 170° */
+    EXPECT_EQ(object_status_get(tbl.get(), 5), OBJSTAT_MOVING);
+    ego.Ego_Heading = 0.0f;
+    EXPECT_EQ(step(fobj(5, 80.0f, -15.0f, 100.0f)), OBJSTAT_MOVING);
+}
+
+/* 여러 객체 일괄 : 입력 순서와 무관하게 객체별 상태 */
+TEST_F(ObjectStatusTest, TC_OSTAT_EQ_05)
+{
+    std::vector<FilteredObject_t> f;
+    for (int i = 0; i < 1000; i++) f.push_back(fobj(i * 7 + 1, (float)i, (i % 2) ? 10.0f : 0.0f));
+    ASSERT_EQ(object_status_update(tbl.get(), &ego, f.data(), (int)f.size()), 1000);
+    for (int k = 0; k < cfg.Stop_Debounce; k++) {
+        std::vector<FilteredObject_t> g;
+        for (int i = 999; i >= 0; i--) g.push_back(fobj(i * 7 + 1, (float)i, 0.0f));
+        ASSERT_EQ(object_status_update(tbl.get(), &ego, g.data(), (int)g.size()), 1000);
+        if (k == cfg.Stop_Debounce - 1) {
+            for (int j = 0; j < 1000; j++) {
+                int i = 999 - j;
+                EXPECT_EQ(g[(size_t)j].Filtered_Object_Status,
+                          (i % 2) ? OBJSTAT_STOPPED : OBJSTAT_STATIONARY);
+            }
+        }
+    }
+    EXPECT_EQ(tbl->Transitions, 500);
+}
+
+/* 파이프라인 연결 : 20 m 앞 선행차와 함께 출발 → 주행 → 정차, 정차 후 ACC 는 그 선행차로 Stop / Distance */
+TEST_F(ObjectStatusTest, TC_OSTAT_EQ_06)
+{
+    std::vector<AdasPipelineInput_t> ins;
+    float v = 0.0f, prevAccel = 0.0f;
+    for (int k = 0; k < 1700; k++) {                  /* 0~6 s 가속, 6~8 s 등속, 8~14 s 감속, 14~17 s 정차 */
+        float accel = (k < 600) ? 2.0f : (k < 800) ? 0.0f : (k < 1400) ? -2.0f : 0.0f;
+        v = std::fmax(0.0f, v + accel * ADAS_PIPELINE_DT);
+
+        AdasPipelineInput_t in;
+        std::memset(&in, 0, sizeof(in));
+        in.Time.Current_Time           = 10.0f * (float)k;
+        in.Gps.GPS_Velocity_X          = v;
+        in.Gps.GPS_Timestamp           = in.Time.Current_Time;
+        in.Imu.Linear_Acceleration_X   = accel - prevAccel;
+        prevAccel                      = accel;
+        in.Lane.Lane_Type              = LANE_TYPE_STRAIGHT;
+        in.Lane.Lane_Width             = 3.5f;
+        in.Obj_Count                   = 1;
+        in.Obj[0].Object_ID            = 7;
+        in.Obj[0].Object_Type          = OBJTYPE_CAR;
+        in.Obj[0].Position_X           = 20.0f;
+        in.Obj[0].Distance             = 20.0f;
+        in.Obj[0].Velocity_X           = v;
+        in.Obj[0].Object_Status        = OBJSTAT_MOVING;
+        ins.push_back(in);
+    }
+
+    AdasPipelineState_t  st;
+    AdasPipelineOutput_t out;
+
+    /* 끔 : 상대속도만 보는 분류는 같이 가는 선행차를 Stationary 로 보아 ACC 대상 없음 (기존 동작) */
+    adas_pipeline_init(&st);
+    for (const AdasPipelineInput_t &in : ins) ASSERT_EQ(adas_pipeline_step(&st, &in, &out), 0);
+    EXPECT_EQ(out.Acc_Target_ID, -1);
+    EXPECT_EQ(out.Acc_Mode, (int32_t)ACC_MODE_SPEED);
+
+    /* 켬 : Stationary → Moving → Stopped, 정차 구간 내내 같은 대상으로 Stop / Distance */
+    adas_pipeline_init(&st);
+    adas_pipeline_set_object_status(&st, tbl.get());
+    for (size_t k = 0; k < ins.size(); k++) {
+        ASSERT_EQ(adas_pipeline_step(&st, &ins[k], &out), 0);
+        if (k >= 1500) {
+            EXPECT_EQ(out.Acc_Target_ID, 7);
+            EXPECT_TRUE(out.Acc_Mode == (int32_t)ACC_MODE_STOP || out.Acc_Mode == (int32_t)ACC_MODE_DISTANCE);
+        }
+    }
+    EXPECT_EQ(object_status_get(tbl.get(), 7), OBJSTAT_STOPPED);
+    EXPECT_EQ(tbl->Transitions, 2);
+    EXPECT_EQ(out.Acc_Mode, (int32_t)ACC_MODE_STOP);
+
+    /* 해제하면 기존 동작 */
+    adas_pipeline_init(&st);
+    EXPECT_EQ(st.Obj_Status, nullptr);
+}
+
+/* 미관측 해제 (Max_Missed 초과) → 재등장 시 이력 없음 */
+TEST_F(ObjectStatusTest, TC_OSTAT_BV_01)
+{
+    FilteredObject_t f[2] = { fobj(1, 10.0f, 10.0f), fobj(2, 20.0f, 10.0f) };
+    ASSERT_EQ(object_status_update(tbl.get(), &ego, f, 2), 2);
+    for (int k = 0; k < cfg.Max_Missed; k++) {
+        ASSERT_EQ(object_status_update(tbl.get(), &ego, f, 1), 2);
+    }
+    EXPECT_EQ(object_status_update(tbl.get(), &ego, f, 1), 1);
+    EXPECT_EQ(object_status_get(tbl.get(), 2), -1);
+    EXPECT_EQ(object_status_get(tbl.get(), 1), OBJSTAT_MOVING);
+    EXPECT_EQ(tbl->High_Water, 1);
+
+    EXPECT_EQ(step(fobj(2, 20.0f, 0.0f)), OBJSTAT_STATIONARY);
+    EXPECT_EQ(object_status_update(tbl.get(), &ego, nullptr, 0), 2);
+}
+
+/* 용량 : OBJ_STATUS_MAX 초과분은 Dropped, 입력 상태 유지 */
+TEST_F(ObjectStatusTest, TC_OSTAT_BV_02)
+{
+    std::vector<FilteredObject_t> f;
+    for (int i = 0; i < OBJ_STATUS_MAX; i++) f.push_back(fobj(i, 1.0f, 10.0f));
+    ASSERT_EQ(object_status_update(tbl.get(), &ego, f.data(), (int)f.size()), OBJ_STATUS_MAX);
+
+    std::vector<FilteredObject_t> g(f.begin(), f.begin() + 100);
+    for (int i = 0; i < 10; i++) g.push_back(fobj(100000 + i, 1.0f, 0.0f, 0.0f, OBJSTAT_ONCOMING));
+    ASSERT_EQ(object_status_update(tbl.get(), &ego, g.data(), (int)g.size()), OBJ_STATUS_MAX);
+    EXPECT_EQ(tbl->Dropped, 10);
+    EXPECT_EQ(g.back().Filtered_Object_Status, OBJSTAT_ONCOMING);
+    EXPECT_EQ(g.front().Filtered_Object_Status, OBJSTAT_MOVING);
+
+    /* 미관측 슬롯 해제 후 빈 슬롯 재사용 */
+    for (int k = 0; k < cfg.Max_Missed; k++) object_status_update(tbl.get(), &ego, g.data(), 100);
+    EXPECT_EQ(tbl->Active_Count, 100);
+    FilteredObject_t n = fobj(100000, 1.0f, 0.0f);
+    EXPECT_EQ(object_status_update(tbl.get(), &ego, &n, 1), 101);
+    EXPECT_EQ(tbl->Dropped, 10);
+}
+
+/* ID 교체가 잦은 장면 : 조회 = 슬롯 ID, 활성 수 일치 */
+TEST_F(ObjectStatusTest, TC_OSTAT_BV_03)
+{
+    std::vector<FilteredObject_t> f;
+    for (int frame = 0; frame < 300; frame++) {
+        f.clear();
+        int base = frame / 3 * 101;
+        for (int i = 0; i < 500; i++) f.push_back(fobj(base + i * 5, 1.0f, rng.uni(0.0f, 2.0f)));
+        ASSERT_GE(object_status_update(tbl.get(), &ego, f.data(), (int)f.size()), 500);
+    }
+    int active = 0;
+    for (int s = 0; s < tbl->High_Water; s++) {
+        if (tbl->Missed[s] == 0xFF) continue;
+        active++;
+        EXPECT_EQ(object_status_get(tbl.get(), tbl->Id[s]), (int)(tbl->Packed[s] >> 6));
+    }
+    EXPECT_EQ(active, tbl->Active_Count);
+}
+
+/* 잘못된 인자 / 구성 */
+TEST_F(ObjectStatusTest, TC_OSTAT_RA_01)
+{
+    FilteredObject_t f = fobj(1, 10.0f, 1.0f);
+    EXPECT_EQ(object_status_update(nullptr, &ego, &f, 1), -1);
+    EXPECT_EQ(object_status_update(tbl.get(), nullptr, &f, 1), -1);
+    EXPECT_EQ(object_status_update(tbl.get(), &ego, nullptr, 1), -1);
+    EXPECT_EQ(object_status_update(tbl.get(), &ego, &f, -1), -1);
+    EXPECT_EQ(object_status_update(tbl.get(), &ego, &f, OBJ_STATUS_MAX + 1), -1);
+    EXPECT_EQ(object_status_get(nullptr, 1), -1);
+
+    ObjStatusConfig_t bad = cfg;
+    bad.Move_Speed = bad.Stop_Speed;
+    EXPECT_EQ(object_status_init(tbl.get(), &bad), -1);
+    bad = cfg;
+    bad.Stop_Debounce = OBJ_STATUS_COUNTER_MAX + 1;
+    EXPECT_EQ(object_status_init(tbl.get(), &bad), -1);
+    bad = cfg;
+    bad.Max_Missed = 0;
+    EXPECT_EQ(object_status_init(tbl.get(), &bad), -1);
+    EXPECT_EQ(object_status_init(nullptr, &cfg), -1);
+    EXPECT_EQ(object_status_init(tbl.get(), nullptr), -1);
+    object_status_default_config(nullptr);
+}
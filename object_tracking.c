@@ -0,0 +1,489 @@
+#include <math.h>
+#include <string.h>
+
+#include "object_tracking.h"
+#include "fast_math.h"
+
+#define TRK_PI          3.14159265f
+#define TRK_MIN_MU      1.0e-4f
+#define TRK_MIN_SPEED   1.0f        /* [m/s] 이하에서는 진행 방향 측정 생략 */
+
+/* CTRV 5×5 대칭 공분산 상삼각 인덱스 */
+static const int8_t k_sym[5][5] = {
+    { 0,  1,  2,  3,  4 },
+    { 1,  5,  6,  7,  8 },
+    { 2,  6,  9, 10, 11 },
+    { 3,  7, 10, 12, 13 },
+    { 4,  8, 11, 13, 14 },
+};
+
+static float wrap_pi(float a)
+{
+    while (a >  TRK_PI) a -= 2.0f * TRK_PI;
+    while (a < -TRK_PI) a += 2.0f * TRK_PI;
+    return a;
+}
+
+/*─────────────────────────────
+  ID 해시 (개방 주소법)
+─────────────────────────────*/
+static uint32_t hash_of(int id)
+{
+    return ((uint32_t)id * 2654435761u) >> 7 & (OBJ_TRACK_HASH_SIZE - 1);
+}
+
+static void hash_insert(ObjectTrackTable_t *t, int slot)
+{
+    uint32_t h = hash_of(t->Id[slot]);
+    while (t->Hash[h] >= 0) {
+        h = (h + 1u) & (OBJ_TRACK_HASH_SIZE - 1);
+    }
+    t->Hash[h] = (int16_t)slot;
+}
+
+static void hash_rebuild(ObjectTrackTable_t *t)
+{
+    for (int h = 0; h < OBJ_TRACK_HASH_SIZE; h++) t->Hash[h] = -1;
+    for (int i = 0; i < t->High_Water; i++) {
+        if (t->Active[i]) hash_insert(t, i);
+    }
+}
+
+int obj_track_find(const ObjectTrackTable_t *pTable, int objectId)
+{
+    if (!pTable) return -1;
+    uint32_t h = hash_of(objectId);
+    for (int probe = 0; probe < OBJ_TRACK_HASH_SIZE; probe++) {
+        int s = pTable->Hash[h];
+        if (s < 0) return -1;
+        if (pTable->Id[s] == objectId) return s;
+        h = (h + 1u) & (OBJ_TRACK_HASH_SIZE - 1);
+    }
+    return -1;
+}
+
+/*─────────────────────────────
+  배치 커널 : 축별 CV [p, v], 측정 [p, v]
+   - m = 0 (측정 없음) 이면 예측만 (이득 0)
+   - 위치 혁신 주변 로그 우도를 pLogLik 에 누적
+─────────────────────────────*/
+static void cv_axis_batch(ObjTrackCvAxis_t *ax, const float *zp, const float *zv, const float *m,
+                          float egoV, float dt, float q, float rp, float rv,
+                          float *pLogLik, int n)
+{
+    const float dt2 = dt * dt;
+    const float q11 = q * dt2 * dt2 * 0.25f, q12 = q * dt2 * dt * 0.5f, q22 = q * dt2;
+
+    for (int i = 0; i < n; i++) {
+        /* 예측 */
+        float p   = ax->P[i] + (ax->V[i] - egoV) * dt;
+        float v   = ax->V[i];
+        float cpp = ax->Cpp[i] + 2.0f * dt * ax->Cpv[i] + dt2 * ax->Cvv[i] + q11;
+        float cpv = ax->Cpv[i] + dt * ax->Cvv[i] + q12;
+        float cvv = ax->Cvv[i] + q22;
+
+        /* 갱신 (H = I) */
+        float s00 = cpp + rp, s01 = cpv, s11 = cvv + rv;
+        float inv = 1.0f / (s00 * s11 - s01 * s01);
+        float i00 = s11 * inv, i01 = -s01 * inv, i11 = s00 * inv;
+        float k00 = cpp * i00 + cpv * i01, k01 = cpp * i01 + cpv * i11;
+        float k10 = cpv * i00 + cvv * i01, k11 = cpv * i01 + cvv * i11;
+        float yp = zp[i] - p, yv = zv[i] - v;
+        float w  = m[i];
+
+        ax->P[i]   = p + w * (k00 * yp + k01 * yv);
+        ax->V[i]   = v + w * (k10 * yp + k11 * yv);
+        ax->Cpp[i] = cpp - w * (k00 * cpp + k01 * cpv);
+        ax->Cpv[i] = cpv - w * (k00 * cpv + k01 * cvv);
+        ax->Cvv[i] = cvv - w * (k10 * cpv + k11 * cvv);
+
+        pLogLik[i] += -0.5f * (yp * yp / s00 + logf(s00));
+    }
+}
+
+/*─────────────────────────────
+  배치 커널 : 축별 CA [p, v, a], 측정 [p, v]
+─────────────────────────────*/
+static void ca_axis_batch(ObjTrackCaAxis_t *ax, const float *zp, const float *zv, const float *m,
+                          float egoV, float dt, float q, float rp, float rv,
+                          float *pLogLik, int n)
+{
+    const float dt2 = dt * dt, dt3 = dt2 * dt;
+    const float h = 0.5f * dt2;
+    /* 백색 저크 이산 Q */
+    const float q00 = q * dt3 * dt2 / 20.0f, q01 = q * dt2 * dt2 / 8.0f, q02 = q * dt3 / 6.0f;
+    const float q11 = q * dt3 / 3.0f,        q12 = q * dt2 * 0.5f,       q22 = q * dt;
+
+    for (int i = 0; i < n; i++) {
+        float p = ax->P[i] + (ax->V[i] - egoV) * dt + h * ax->A[i];
+        float v = ax->V[i] + dt * ax->A[i];
+        float a = ax->A[i];
+
+        /* P' = F P Fᵀ + Q, F = [[1,dt,h],[0,1,dt],[0,0,1]] */
+        float cpp = ax->Cpp[i], cpv = ax->Cpv[i], cpa = ax->Cpa[i];
+        float cvv = ax->Cvv[i], cva = ax->Cva[i], caa = ax->Caa[i];
+        float r0p = cpp + dt * cpv + h * cpa;      /* (F P) 0 행 */
+        float r0v = cpv + dt * cvv + h * cva;
+        float r0a = cpa + dt * cva + h * caa;
+        float r1v = cvv + dt * cva;                /* (F P) 1 행 */
+        float r1a = cva + dt * caa;
+        float npp = r0p + dt * r0v + h * r0a + q00;
+        float npv = r0v + dt * r0a + q01;
+        float npa = r0a + q02;
+        float nvv = r1v + dt * r1a + q11;
+        float nva = r1a + q12;
+        float naa = caa + q22;
+
+        /* 갱신 H = [[1,0,0],[0,1,0]] */
+        float s00 = npp + rp, s01 = npv, s11 = nvv + rv;
+        float inv = 1.0f / (s00 * s11 - s01 * s01);
+        float i00 = s11 * inv, i01 = -s01 * inv, i11 = s00 * inv;
+        float k00 = npp * i00 + npv * i01, k01 = npp * i01 + npv * i11;
+        float k10 = npv * i00 + nvv * i01, k11 = npv * i01 + nvv * i11;
+        float k20 = npa * i00 + nva * i01, k21 = npa * i01 + nva * i11;
+        float yp = zp[i] - p, yv = zv[i] - v;
+        float w  = m[i];
+
+        ax->P[i] = p + w * (k00 * yp + k01 * yv);
+        ax->V[i] = v + w * (k10 * yp + k11 * yv);
+        ax->A[i] = a + w * (k20 * yp + k21 * yv);
+        /* P = P' - K H P' */
+        ax->Cpp[i] = npp - w * (k00 * npp + k01 * npv);
+        ax->Cpv[i] = npv - w * (k00 * npv + k01 * nvv);
+        ax->Cpa[i] = npa - w * (k00 * npa + k01 * nva);
+        ax->Cvv[i] = nvv - w * (k10 * npv + k11 * nvv);
+        ax->Cva[i] = nva - w * (k10 * npa + k11 * nva);
+        ax->Caa[i] = naa - w * (k20 * npa + k21 * nva);
+
+        pLogLik[i] += -0.5f * (yp * yp / s00 + logf(s00));
+    }
+}
+
+/*─────────────────────────────
+  배치 커널 : CTRV EKF [x, y, v, ψ, ω]
+   - 예측 : dt 가 짧으므로 호 적분 2 차 근사 (추가 삼각함수 없음)
+   - 갱신 : x, y, v, ψ 순차 스칼라 (H 단위 행 → 일괄 갱신과 동일)
+─────────────────────────────*/
+static void ctrv_scalar_update(float X[5], float P[5][5], int j, float z, float r, float w,
+                               bool angle, float *pLogLik)
+{
+    float s     = P[j][j] + r;
+    float innov = z - X[j];
+    if (angle) innov = wrap_pi(innov);
+
+    float k[5], row[5];
+    for (int a = 0; a < 5; a++) {
+        k[a]   = w * P[a][j] / s;
+        row[a] = P[j][a];
+    }
+    for (int a = 0; a < 5; a++) {
+        X[a] += k[a] * innov;
+        for (int b = 0; b < 5; b++) P[a][b] -= k[a] * row[b];
+    }
+    if (pLogLik) *pLogLik += -0.5f * (innov * innov / s + logf(s));
+}
+
+static void ctrv_batch(ObjectTrackTable_t *t, const ObjTrackConfig_t *c,
+                       float egoVx, float egoVy, float dt, int n)
+{
+    const float hd2 = 0.5f * dt * dt;
+    const float qa  = c->Ctrv_Accel_Noise, qw = c->Yaw_Accel_Noise;
+
+    for (int i = 0; i < n; i++) {
+        float X[5] = { t->Tr_X[i], t->Tr_Y[i], t->Tr_V[i], t->Tr_Psi[i], t->Tr_Omega[i] };
+        float P[5][5];
+        for (int a = 0; a < 5; a++)
+            for (int b = 0; b < 5; b++) P[a][b] = t->Tr_C[k_sym[a][b]][i];
+
+        float cs = ADAS_COSF(X[3]), sn = ADAS_SINF(X[3]);
+        float v  = X[2], dpsi = X[4] * dt;
+
+        /* 상태 예측 */
+        X[0] += v * dt * (cs - 0.5f * sn * dpsi) - egoVx * dt;
+        X[1] += v * dt * (sn + 0.5f * cs * dpsi) - egoVy * dt;
+        X[3]  = wrap_pi(X[3] + dpsi);
+
+        /* P' = F P Fᵀ + Q (F = I + 희소 항) : 행 0,1 이 원래 행 3 을 쓰므로 행 3 보다 먼저 */
+        float f02 = cs * dt, f03 = -v * sn * dt, f12 = sn * dt, f13 = v * cs * dt;
+        for (int b = 0; b < 5; b++) {
+            P[0][b] += f02 * P[2][b] + f03 * P[3][b];
+            P[1][b] += f12 * P[2][b] + f13 * P[3][b];
+            P[3][b] += dt * P[4][b];
+        }
+        for (int a = 0; a < 5; a++) {
+            P[a][0] += f02 * P[a][2] + f03 * P[a][3];
+            P[a][1] += f12 * P[a][2] + f13 * P[a][3];
+            P[a][3] += dt * P[a][4];
+        }
+        float g[5] = { hd2 * cs, hd2 * sn, dt, 0.0f, 0.0f };    /* 종가속 */
+        float gw[5] = { 0.0f, 0.0f, 0.0f, hd2, dt };            /* 요 각가속 */
+        for (int a = 0; a < 5; a++)
+            for (int b = 0; b < 5; b++) P[a][b] += qa * g[a] * g[b] + qw * gw[a] * gw[b];
+
+        /* 순차 갱신 */
+        float w   = t->Has_Meas[i];
+        float mvx = t->Meas_Vx[i], mvy = t->Meas_Vy[i];
+        float spd = sqrtf(mvx * mvx + mvy * mvy);
+        float ll  = 0.0f;
+        ctrv_scalar_update(X, P, 0, t->Meas_X[i], c->Pos_Meas_Var, w, false, &ll);
+        ctrv_scalar_update(X, P, 1, t->Meas_Y[i], c->Pos_Meas_Var, w, false, &ll);
+        ctrv_scalar_update(X, P, 2, spd, c->Vel_Meas_Var, w, false, NULL);
+        if (spd > TRK_MIN_SPEED) {
+            ctrv_scalar_update(X, P, 3, atan2f(mvy, mvx), c->Heading_Meas_Var, w, true, NULL);
+        }
+        X[3] = wrap_pi(X[3]);
+        t->Log_Lik[OBJ_MODEL_CTRV][i] = ll;
+
+        t->Tr_X[i] = X[0]; t->Tr_Y[i] = X[1]; t->Tr_V[i] = X[2];
+        t->Tr_Psi[i] = X[3]; t->Tr_Omega[i] = X[4];
+        for (int a = 0; a < 5; a++)
+            for (int b = a; b < 5; b++) t->Tr_C[k_sym[a][b]][i] = P[a][b];
+    }
+}
+
+/*─────────────────────────────
+  트랙 초기화 (측정값)
+─────────────────────────────*/
+static void init_slot(ObjectTrackTable_t *t, int i)
+{
+    const ObjTrackConfig_t *c = &t->Cfg;
+    const float z[2]  = { t->Meas_X[i],  t->Meas_Y[i] };
+    const float zv[2] = { t->Meas_Vx[i], t->Meas_Vy[i] };
+
+    for (int ax = 0; ax < 2; ax++) {
+        ObjTrackCvAxis_t *cv = &t->Cv[ax];
+        cv->P[i] = z[ax]; cv->V[i] = zv[ax];
+        cv->Cpp[i] = c->Pos_Meas_Var; cv->Cpv[i] = 0.0f; cv->Cvv[i] = c->Vel_Meas_Var;
+
+        ObjTrackCaAxis_t *ca = &t->Ca[ax];
+        ca->P[i] = z[ax]; ca->V[i] = zv[ax]; ca->A[i] = 0.0f;
+        ca->Cpp[i] = c->Pos_Meas_Var; ca->Cvv[i] = c->Vel_Meas_Var; ca->Caa[i] = 4.0f;
+        ca->Cpv[i] = ca->Cpa[i] = ca->Cva[i] = 0.0f;
+    }
+
+    float spd = sqrtf(zv[0] * zv[0] + zv[1] * zv[1]);
+    t->Tr_X[i] = z[0]; t->Tr_Y[i] = z[1]; t->Tr_V[i] = spd;
+    t->Tr_Psi[i]   = (spd > TRK_MIN_SPEED) ? atan2f(zv[1], zv[0]) : 0.0f;
+    t->Tr_Omega[i] = 0.0f;
+    for (int k = 0; k < 15; k++) t->Tr_C[k][i] = 0.0f;
+    t->Tr_C[k_sym[0][0]][i] = c->Pos_Meas_Var;
+    t->Tr_C[k_sym[1][1]][i] = c->Pos_Meas_Var;
+    t->Tr_C[k_sym[2][2]][i] = c->Vel_Meas_Var;
+    t->Tr_C[k_sym[3][3]][i] = (spd > TRK_MIN_SPEED) ? c->Heading_Meas_Var : TRK_PI * TRK_PI;
+    t->Tr_C[k_sym[4][4]][i] = 0.25f;
+
+    for (int m = 0; m < OBJ_MODEL_COUNT; m++) t->Mu[m][i] = 1.0f / (float)OBJ_MODEL_COUNT;
+}
+
+/*─────────────────────────────
+  MM 모드 확률 (마르코프 전이 → 우도 → 정규화)
+─────────────────────────────*/
+static void mm_batch(ObjectTrackTable_t *t, int n)
+{
+    const float stay   = t->Cfg.Mode_Stay_Prob;
+    const float switch_ = (1.0f - stay) / (float)(OBJ_MODEL_COUNT - 1);
+
+    for (int i = 0; i < n; i++) {
+        if (!(t->Has_Meas[i] > 0.0f) || t->Age[i] == 0) continue;
+
+        float lmax = t->Log_Lik[0][i];
+        for (int m = 1; m < OBJ_MODEL_COUNT; m++) {
+            if (t->Log_Lik[m][i] > lmax) lmax = t->Log_Lik[m][i];
+        }
+        float w[OBJ_MODEL_COUNT], sum = 0.0f;
+        for (int m = 0; m < OBJ_MODEL_COUNT; m++) {
+            float pred = stay * t->Mu[m][i] + switch_ * (1.0f - t->Mu[m][i]);
+            w[m] = pred * expf(t->Log_Lik[m][i] - lmax);
+            sum += w[m];
+        }
+        float norm = 0.0f;
+        for (int m = 0; m < OBJ_MODEL_COUNT; m++) {
+            w[m] = w[m] / sum;
+            if (w[m] < TRK_MIN_MU) w[m] = TRK_MIN_MU;
+            norm += w[m];
+        }
+        for (int m = 0; m < OBJ_MODEL_COUNT; m++) t->Mu[m][i] = w[m] / norm;
+    }
+}
+
+/*─────────────────────────────
+  공개 함수
+─────────────────────────────*/
+void obj_track_default_config(ObjTrackConfig_t *pCfg)
+{
+    if (!pCfg) return;
+    pCfg->Mode             = OBJ_TRACK_MODE_MM;
+    pCfg->Pos_Meas_Var     = 0.25f;
+    pCfg->Vel_Meas_Var     = 0.5f;
+    pCfg->Heading_Meas_Var = 0.01f;
+    pCfg->Accel_Noise      = 1.0f;
+    pCfg->Jerk_Noise       = 4.0f;
+    pCfg->Ctrv_Accel_Noise = 1.0f;
+    pCfg->Yaw_Accel_Noise  = 0.25f;
+    pCfg->Mode_Stay_Prob   = 0.95f;
+}
+
+int obj_track_init(ObjectTrackTable_t *pTable, const ObjTrackConfig_t *pCfg)
+{
+    if (!pTable || !pCfg) return -1;
+    if (pCfg->Mode < OBJ_TRACK_MODE_CV || pCfg->Mode > OBJ_TRACK_MODE_MM ||
+        !(pCfg->Pos_Meas_Var > 0.0f) || !(pCfg->Vel_Meas_Var > 0.0f) ||
+        !(pCfg->Heading_Meas_Var > 0.0f) || !(pCfg->Accel_Noise >= 0.0f) ||
+        !(pCfg->Jerk_Noise >= 0.0f) || !(pCfg->Ctrv_Accel_Noise >= 0.0f) ||
+        !(pCfg->Yaw_Accel_Noise >= 0.0f) ||
+        !(pCfg->Mode_Stay_Prob > 0.0f) || !(pCfg->Mode_Stay_Prob <= 1.0f)) {
+        return -1;
+    }
+    memset(pTable, 0, sizeof(*pTable));
+    pTable->Cfg = *pCfg;
+    for (int h = 0; h < OBJ_TRACK_HASH_SIZE; h++) pTable->Hash[h] = -1;
+    return 0;
+}
+
+int obj_track_update(ObjectTrackTable_t *pTable,
+                     const FilteredObject_t *pFiltered, int count,
+                     const EgoData_t *pEgo, float dt)
+{
+    if (!pTable || !pEgo || count < 0 || (count > 0 && !pFiltered) || !(dt > 0.0f)) return -1;
+
+    ObjectTrackTable_t *t = pTable;
+    const ObjTrackConfig_t *c = &t->Cfg;
+
+    /* 1) 측정 배정 (새 ID → 빈 슬롯, Age 0) */
+    for (int i = 0; i < t->High_Water; i++) t->Has_Meas[i] = 0.0f;
+    for (int k = 0; k < count; k++) {
+        const FilteredObject_t *fo = &pFiltered[k];
+        int s = obj_track_find(t, fo->Filtered_Object_ID);
+        if (s < 0) {
+            for (s = 0; s < OBJ_TRACK_MAX && t->Active[s]; s++) { }
+            if (s == OBJ_TRACK_MAX) {
+                t->Dropped++;
+                continue;
+            }
+            t->Id[s]     = fo->Filtered_Object_ID;
+            t->Active[s] = 1;
+            t->Age[s]    = 0;
+            t->Active_Count++;
+            if (s + 1 > t->High_Water) t->High_Water = s + 1;
+            hash_insert(t, s);
+        }
+        t->Has_Meas[s] = 1.0f;
+        t->Missed[s]   = 0;
+        t->Meas_X[s]   = fo->Filtered_Position_X;
+        t->Meas_Y[s]   = fo->Filtered_Position_Y;
+        t->Meas_Vx[s]  = fo->Filtered_Velocity_X;
+        t->Meas_Vy[s]  = fo->Filtered_Velocity_Y;
+    }
+
+    /* 2) 모델별 배치 예측/갱신 */
+    const int   n   = t->High_Water;
+    const bool  mm  = (c->Mode == OBJ_TRACK_MODE_MM);
+    const float ex  = pEgo->Ego_Velocity_X, ey = pEgo->Ego_Velocity_Y;
+    for (int m = 0; m < OBJ_MODEL_COUNT; m++) {
+        memset(t->Log_Lik[m], 0, sizeof(float) * (size_t)n);
+    }
+    if (mm || c->Mode == OBJ_TRACK_MODE_CV) {
+        cv_axis_batch(&t->Cv[0], t->Meas_X, t->Meas_Vx, t->Has_Meas, ex, dt, c->Accel_Noise,
+                      c->Pos_Meas_Var, c->Vel_Meas_Var, t->Log_Lik[OBJ_MODEL_CV], n);
+        cv_axis_batch(&t->Cv[1], t->Meas_Y, t->Meas_Vy, t->Has_Meas, ey, dt, c->Accel_Noise,
+                      c->Pos_Meas_Var, c->Vel_Meas_Var, t->Log_Lik[OBJ_MODEL_CV], n);
+    }
+    if (mm || c->Mode == OBJ_TRACK_MODE_CA) {
+        ca_axis_batch(&t->Ca[0], t->Meas_X, t->Meas_Vx, t->Has_Meas, ex, dt, c->Jerk_Noise,
+                      c->Pos_Meas_Var, c->Vel_Meas_Var, t->Log_Lik[OBJ_MODEL_CA], n);
+        ca_axis_batch(&t->Ca[1], t->Meas_Y, t->Meas_Vy, t->Has_Meas, ey, dt, c->Jerk_Noise,
+                      c->Pos_Meas_Var, c->Vel_Meas_Var, t->Log_Lik[OBJ_MODEL_CA], n);
+    }
+    if (mm || c->Mode == OBJ_TRACK_MODE_CTRV) {
+        ctrv_batch(t, c, ex, ey, dt, n);
+    }
+    if (mm) {
+        mm_batch(t, n);
+    }
+
+    /* 3) 새 트랙 초기화, 나이/미관측 관리 */
+    bool removed = false;
+    for (int i = 0; i < n; i++) {
+        if (!t->Active[i]) continue;
+        if (t->Has_Meas[i] > 0.0f) {
+            if (t->Age[i] == 0) init_slot(t, i);
+            if (t->Age[i] < 0xFFFFu) t->Age[i]++;
+        } else if (++t->Missed[i] > OBJ_TRACK_MAX_MISSED) {
+            t->Active[i] = 0;
+            t->Active_Count--;
+            removed = true;
+        }
+    }
+    if (removed) {
+        while (t->High_Water > 0 && !t->Active[t->High_Water - 1]) t->High_Water--;
+        hash_rebuild(t);
+    }
+    return t->Active_Count;
+}
+
+int obj_track_predict(const ObjectTrackTable_t *pTable, int slot, float horizon,
+                      ObjTrackPrediction_t *pOut)
+{
+    if (!pTable || !pOut || slot < 0 || slot >= pTable->High_Water || !pTable->Active[slot]) {
+        return -1;
+    }
+    const ObjectTrackTable_t *t = pTable;
+    const int   i = slot;
+    const float T = horizon;
+    ObjTrackPrediction_t p[OBJ_MODEL_COUNT];
+    float mu[OBJ_MODEL_COUNT] = { 0.0f, 0.0f, 0.0f };
+
+    switch (t->Cfg.Mode) {
+    case OBJ_TRACK_MODE_CV:   mu[OBJ_MODEL_CV]   = 1.0f; break;
+    case OBJ_TRACK_MODE_CA:   mu[OBJ_MODEL_CA]   = 1.0f; break;
+    case OBJ_TRACK_MODE_CTRV: mu[OBJ_MODEL_CTRV] = 1.0f; break;
+    default:
+        for (int m = 0; m < OBJ_MODEL_COUNT; m++) mu[m] = t->Mu[m][i];
+        break;
+    }
+
+    /* CV */
+    p[OBJ_MODEL_CV].Position_X = t->Cv[0].P[i] + t->Cv[0].V[i] * T;
+    p[OBJ_MODEL_CV].Position_Y = t->Cv[1].P[i] + t->Cv[1].V[i] * T;
+    p[OBJ_MODEL_CV].Velocity_X = t->Cv[0].V[i];
+    p[OBJ_MODEL_CV].Velocity_Y = t->Cv[1].V[i];
+    p[OBJ_MODEL_CV].Accel_X    = 0.0f;
+    p[OBJ_MODEL_CV].Accel_Y    = 0.0f;
+
+    /* CA */
+    p[OBJ_MODEL_CA].Position_X = t->Ca[0].P[i] + t->Ca[0].V[i] * T + 0.5f * t->Ca[0].A[i] * T * T;
+    p[OBJ_MODEL_CA].Position_Y = t->Ca[1].P[i] + t->Ca[1].V[i] * T + 0.5f * t->Ca[1].A[i] * T * T;
+    p[OBJ_MODEL_CA].Velocity_X = t->Ca[0].V[i];
+    p[OBJ_MODEL_CA].Velocity_Y = t->Ca[1].V[i];
+    p[OBJ_MODEL_CA].Accel_X    = t->Ca[0].A[i];
+    p[OBJ_MODEL_CA].Accel_Y    = t->Ca[1].A[i];
+
+    /* CTRV (원호) */
+    {
+        float v = t->Tr_V[i], psi = t->Tr_Psi[i], om = t->Tr_Omega[i];
+        float cs = ADAS_COSF(psi), sn = ADAS_SINF(psi);
+        ObjTrackPrediction_t *q = &p[OBJ_MODEL_CTRV];
+        if (fabsf(om) > 1.0e-3f) {
+            q->Position_X = t->Tr_X[i] + v / om * (ADAS_SINF(psi + om * T) - sn);
+            q->Position_Y = t->Tr_Y[i] + v / om * (cs - ADAS_COSF(psi + om * T));
+        } else {
+            q->Position_X = t->Tr_X[i] + v * cs * T;
+            q->Position_Y = t->Tr_Y[i] + v * sn * T;
+        }
+        q->Velocity_X = v * cs;
+        q->Velocity_Y = v * sn;
+        q->Accel_X    = 0.0f;
+        q->Accel_Y    = 0.0f;
+    }
+
+    memset(pOut, 0, sizeof(*pOut));
+    for (int m = 0; m < OBJ_MODEL_COUNT; m++) {
+        pOut->Position_X += mu[m] * p[m].Position_X;
+        pOut->Position_Y += mu[m] * p[m].Position_Y;
+        pOut->Velocity_X += mu[m] * p[m].Velocity_X;
+        pOut->Velocity_Y += mu[m] * p[m].Velocity_Y;
+        pOut->Accel_X    += mu[m] * p[m].Accel_X;
+        pOut->Accel_Y    += mu[m] * p[m].Accel_Y;
+    }
+    return 0;
+}
@@ -0,0 +1,140 @@
+/****************************************************************************
+ * object_tracking.h
+ *
+ * - 객체별 운동 모델 필터 (트랙 테이블, SoA 배치 갱신)
+ *     . CV   : 축별(X/Y) 독립 칼만 [p, v]          측정 [p, v]
+ *     . CA   : 축별(X/Y) 독립 칼만 [p, v, a]       측정 [p, v]
+ *     . CTRV : EKF [x, y, v, ψ, ω]                 측정 [x, y, |v|, atan2(vy,vx)]
+ *              (순차 스칼라 갱신, |v| < 1 m/s 이면 ψ 측정 생략)
+ *     . MM   : 다중 모델 - 세 모델 독립 병렬 실행, 모드 확률 = 마르코프 전이 × 위치 혁신 우도,
+ *              출력 = 확률 가중 결합
+ *              (IMM 아님 : 모델 간 상태 차원이 달라 예측 전 상태 혼합 단계가 없음)
+ * - 좌표 : 위치는 Ego 기준 상대, 속도는 절대 (FilteredObject_t 와 동일)
+ *          예측 단계에서 Ego 병진(속도 × dt) 보상, Ego 회전은 무시
+ * - 트랙 키 = Filtered_Object_ID. 처음 본 ID 는 측정값으로 초기화,
+ *   OBJ_TRACK_MAX_MISSED 프레임 연속 미관측이면 삭제
+ * - 배치 커널은 슬롯 0 .. High_Water-1 전체를 분기 없이(측정 유무 마스크) 처리
+ * - ObjectTrackTable_t 는 크다 (~60 KB) → static 또는 힙에 둘 것
+ ****************************************************************************/
+#ifndef OBJECT_TRACKING_H
+#define OBJECT_TRACKING_H
+
+#include <stdint.h>
+#include "adas_shared.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define OBJ_TRACK_MAX           256
+#define OBJ_TRACK_HASH_SIZE     512     /* 2 의 거듭제곱, >= 2 × OBJ_TRACK_MAX */
+#define OBJ_TRACK_MAX_MISSED    5
+
+typedef enum {
+    OBJ_MODEL_CV = 0,
+    OBJ_MODEL_CA,
+    OBJ_MODEL_CTRV,
+    OBJ_MODEL_COUNT
+} ObjMotionModel_e;
+
+typedef enum {
+    OBJ_TRACK_MODE_CV = 0,
+    OBJ_TRACK_MODE_CA,
+    OBJ_TRACK_MODE_CTRV,
+    OBJ_TRACK_MODE_MM
+} ObjTrackMode_e;
+
+typedef struct {
+    ObjTrackMode_e Mode;
+    float Pos_Meas_Var;         /* [m^2] */
+    float Vel_Meas_Var;         /* [(m/s)^2] */
+    float Heading_Meas_Var;     /* [rad^2] (CTRV) */
+    float Accel_Noise;          /* CV 가속도 과정 잡음 [(m/s^2)^2] */
+    float Jerk_Noise;           /* CA 저크 과정 잡음 [(m/s^3)^2] */
+    float Ctrv_Accel_Noise;     /* CTRV 종방향 가속도 잡음 */
+    float Yaw_Accel_Noise;      /* CTRV 요 각가속도 잡음 [(rad/s^2)^2] */
+    float Mode_Stay_Prob;       /* MM 모드 유지 확률 */
+} ObjTrackConfig_t;
+
+/* 축별 CV 필터 (SoA) */
+typedef struct {
+    float P[OBJ_TRACK_MAX], V[OBJ_TRACK_MAX];
+    float Cpp[OBJ_TRACK_MAX], Cpv[OBJ_TRACK_MAX], Cvv[OBJ_TRACK_MAX];
+} ObjTrackCvAxis_t;
+
+/* 축별 CA 필터 (SoA) */
+typedef struct {
+    float P[OBJ_TRACK_MAX], V[OBJ_TRACK_MAX], A[OBJ_TRACK_MAX];
+    float Cpp[OBJ_TRACK_MAX], Cpv[OBJ_TRACK_MAX], Cpa[OBJ_TRACK_MAX];
+    float Cvv[OBJ_TRACK_MAX], Cva[OBJ_TRACK_MAX], Caa[OBJ_TRACK_MAX];
+} ObjTrackCaAxis_t;
+
+typedef struct {
+    ObjTrackConfig_t Cfg;
+    int32_t  High_Water;                    /* 사용한 최대 슬롯 + 1 */
+    int32_t  Active_Count;
+    int32_t  Dropped;                       /* 테이블 가득 차 추적 못 한 측정 누계 */
+
+    /* 슬롯 관리 */
+    int32_t  Id[OBJ_TRACK_MAX];
+    uint8_t  Active[OBJ_TRACK_MAX];
+    uint8_t  Missed[OBJ_TRACK_MAX];
+    uint16_t Age[OBJ_TRACK_MAX];            /* 갱신 횟수 (0 = 이번 프레임 생성) */
+    int16_t  Hash[OBJ_TRACK_HASH_SIZE];     /* ID → 슬롯 (개방 주소법, -1 = 빈칸) */
+
+    /* 이번 프레임 측정 (Has_Meas : 0/1, 배치 커널 마스크) */
+    float    Has_Meas[OBJ_TRACK_MAX];
+    float    Meas_X[OBJ_TRACK_MAX], Meas_Y[OBJ_TRACK_MAX];
+    float    Meas_Vx[OBJ_TRACK_MAX], Meas_Vy[OBJ_TRACK_MAX];
+
+    /* 모델 상태 */
+    ObjTrackCvAxis_t Cv[2];                 /* [0] = X, [1] = Y */
+    ObjTrackCaAxis_t Ca[2];
+    float    Tr_X[OBJ_TRACK_MAX], Tr_Y[OBJ_TRACK_MAX], Tr_V[OBJ_TRACK_MAX];
+    float    Tr_Psi[OBJ_TRACK_MAX], Tr_Omega[OBJ_TRACK_MAX];
+    float    Tr_C[15][OBJ_TRACK_MAX];       /* 5×5 대칭 공분산 상삼각 (행 우선) */
+
+    /* MM */
+    float    Log_Lik[OBJ_MODEL_COUNT][OBJ_TRACK_MAX];   /* 이번 프레임 위치 혁신 로그 우도 */
+    float    Mu[OBJ_MODEL_COUNT][OBJ_TRACK_MAX];        /* 모드 확률 */
+} ObjectTrackTable_t;
+
+/* 트랙 예측 결과 */
+typedef struct {
+    float Position_X, Position_Y;
+    float Velocity_X, Velocity_Y;
+    float Accel_X, Accel_Y;
+} ObjTrackPrediction_t;
+
+/** @brief 기본 구성 (MM, 위치 0.25 m², 속도 0.5 (m/s)², 모드 유지 0.95) */
+void obj_track_default_config(ObjTrackConfig_t *pCfg);
+
+/** @return 0 on success, -1 on invalid argument/config */
+int obj_track_init(ObjectTrackTable_t *pTable, const ObjTrackConfig_t *pCfg);
+
+/**
+ * @brief 1 프레임 갱신 : 측정 배정 → 전 트랙 예측/갱신 배치 → MM 확률 → 미관측 트랙 삭제
+ * @param[in] pEgo : Ego 속도 (예측 단계 병진 보상)
+ * @param[in] dt   : [s] 직전 갱신 이후 시간 (> 0)
+ * @return 활성 트랙 수, -1 on invalid argument
+ */
+int obj_track_update(ObjectTrackTable_t *pTable,
+                     const FilteredObject_t *pFiltered, int count,
+                     const EgoData_t *pEgo, float dt);
+
+/** @return ID 의 슬롯 번호, 없으면 -1 */
+int obj_track_find(const ObjectTrackTable_t *pTable, int objectId);
+
+/**
+ * @brief 슬롯의 horizon [s] 후 위치 / 현재 속도·가속도 (구성 모드, MM 이면 확률 가중)
+ *        위치는 기존 예측과 같은 규약 (p + v·T [+ ½aT²], Ego 이동 미보상)
+ * @return 0 on success, -1 on invalid slot
+ */
+int obj_track_predict(const ObjectTrackTable_t *pTable, int slot, float horizon,
+                      ObjTrackPrediction_t *pOut);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* OBJECT_TRACKING_H */
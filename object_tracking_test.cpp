@@ -0,0 +1,324 @@
+/*********************************************************************
+ * object_tracking_test.cpp  ―  객체 운동 모델 필터 (CV / CA / CTRV / MM)
+ * DUT : object_tracking.c, target_selection.c (predict_object_future_path_tracked)
+ *********************************************************************/
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "object_tracking.h"
+#include "target_selection.h"
+#include "test_rng.hpp"
+
+namespace {
+
+constexpr float kDt = 0.01f;
+
+class ObjectTrackingTest : public ::testing::Test {
+protected:
+    std::unique_ptr<ObjectTrackTable_t> trk{ new ObjectTrackTable_t };
+    ObjTrackConfig_t cfg;
+    EgoData_t ego;
+    TestRng  rng{11u};
+
+    void SetUp() override
+    {
+        obj_track_default_config(&cfg);
+        std::memset(&ego, 0, sizeof(ego));
+    }
+
+    void init(ObjTrackMode_e mode)
+    {
+        cfg.Mode = mode;
+        ASSERT_EQ(obj_track_init(trk.get(), &cfg), 0);
+    }
+
+    static FilteredObject_t meas(int id, float x, float y, float vx, float vy)
+    {
+        FilteredObject_t f;
+        std::memset(&f, 0, sizeof(f));
+        f.Filtered_Object_ID     = id;
+        f.Filtered_Object_Type   = OBJTYPE_CAR;
+        f.Filtered_Position_X    = x;
+        f.Filtered_Position_Y    = y;
+        f.Filtered_Velocity_X    = vx;
+        f.Filtered_Velocity_Y    = vy;
+        f.Filtered_Distance      = std::sqrt(x * x + y * y);
+        f.Filtered_Object_Status = OBJSTAT_MOVING;
+        return f;
+    }
+
+    ObjTrackPrediction_t now(int id)
+    {
+        ObjTrackPrediction_t p;
+        int s = obj_track_find(trk.get(), id);
+        EXPECT_GE(s, 0);
+        EXPECT_EQ(obj_track_predict(trk.get(), s, 0.0f, &p), 0);
+        return p;
+    }
+};
+
+} /* namespace */
+
+/* 생성 / 조회 / 첫 프레임 초기화 */
+TEST_F(ObjectTrackingTest, TC_TRK_EQ_01)
+{
+    init(OBJ_TRACK_MODE_MM);
+    FilteredObject_t f[3] = { meas(7, 30.0f, 0.0f, 20.0f, 0.0f),
+                              meas(1024, 50.0f, 3.5f, 25.0f, 0.0f),
+                              meas(-3, 10.0f, -3.5f, 15.0f, 0.5f) };
+    ASSERT_EQ(obj_track_update(trk.get(), f, 3, &ego, kDt), 3);
+    EXPECT_EQ(trk->High_Water, 3);
+    EXPECT_EQ(obj_track_find(trk.get(), 99), -1);
+    for (const auto &o : f) {
+        int s = obj_track_find(trk.get(), o.Filtered_Object_ID);
+        ASSERT_GE(s, 0);
+        EXPECT_EQ(trk->Age[s], 1);
+        ObjTrackPrediction_t p = now(o.Filtered_Object_ID);
+        EXPECT_NEAR(p.Position_X, o.Filtered_Position_X, 1e-4f);
+        EXPECT_NEAR(p.Position_Y, o.Filtered_Position_Y, 1e-4f);
+        EXPECT_NEAR(p.Velocity_X, o.Filtered_Velocity_X, 1e-3f);
+        EXPECT_NEAR(p.Velocity_Y, o.Filtered_Velocity_Y, 1e-3f);
+        float sum = 0.0f;
+        for (int m = 0; m < OBJ_MODEL_COUNT; m++) sum += trk->Mu[m][s];
+        EXPECT_NEAR(sum, 1.0f, 1e-5f);
+    }
+}
+
+/* CV : 잡음 측정 → 속도 수렴, 위치 오차가 원시 잡음보다 작음 (Ego 병진 보상 포함) */
+TEST_F(ObjectTrackingTest, TC_TRK_EQ_02)
+{
+    init(OBJ_TRACK_MODE_CV);
+    ego.Ego_Velocity_X = 20.0f;
+    float x = 40.0f, y = 1.0f;
+    double rawErr = 0.0, trkErr = 0.0;
+    int n = 0;
+    for (int k = 0; k < 500; k++) {
+        x += (25.0f - 20.0f) * kDt;
+        FilteredObject_t f = meas(1, x + rng.uni(-0.8f, 0.8f), y + rng.uni(-0.8f, 0.8f),
+                                  25.0f + rng.uni(-1.0f, 1.0f), rng.uni(-1.0f, 1.0f));
+        obj_track_update(trk.get(), &f, 1, &ego, kDt);
+        if (k >= 200) {
+            ObjTrackPrediction_t p = now(1);
+            rawErr += (f.Filtered_Position_X - x) * (f.Filtered_Position_X - x);
+            trkErr += (p.Position_X - x) * (p.Position_X - x);
+            n++;
+        }
+    }
+    ObjTrackPrediction_t p = now(1);
+    EXPECT_NEAR(p.Velocity_X, 25.0f, 0.3f);
+    EXPECT_NEAR(p.Velocity_Y, 0.0f, 0.3f);
+    EXPECT_LT(trkErr, 0.25 * rawErr);
+}
+
+/* CA : 등가속 목표 → 가속도 추정 */
+TEST_F(ObjectTrackingTest, TC_TRK_EQ_03)
+{
+    init(OBJ_TRACK_MODE_CA);
+    float x = 30.0f, v = 10.0f;
+    for (int k = 0; k < 400; k++) {
+        x += v * kDt + 0.5f * 2.0f * kDt * kDt;
+        v += 2.0f * kDt;
+        FilteredObject_t f = meas(5, x + rng.uni(-0.3f, 0.3f), 0.0f, v + rng.uni(-0.5f, 0.5f), 0.0f);
+        obj_track_update(trk.get(), &f, 1, &ego, kDt);
+    }
+    ObjTrackPrediction_t p = now(5);
+    EXPECT_NEAR(p.Accel_X, 2.0f, 0.5f);
+    EXPECT_NEAR(p.Velocity_X, v, 0.3f);
+}
+
+/* CTRV : 원운동 목표 → 요레이트 추정, 1 s 예측이 원 위에 */
+TEST_F(ObjectTrackingTest, TC_TRK_EQ_04)
+{
+    init(OBJ_TRACK_MODE_CTRV);
+    const float V = 15.0f, W = 0.3f, R = V / W;
+    float psi = 0.0f;
+    auto at = [&](float a, float &x, float &y) { x = 20.0f + R * std::sin(a); y = R * (1.0f - std::cos(a)); };
+    for (int k = 0; k < 300; k++) {
+        psi += W * kDt;
+        float x, y;
+        at(psi, x, y);
+        FilteredObject_t f = meas(2, x + rng.uni(-0.2f, 0.2f), y + rng.uni(-0.2f, 0.2f),
+                                  V * std::cos(psi), V * std::sin(psi));
+        obj_track_update(trk.get(), &f, 1, &ego, kDt);
+    }
+    int s = obj_track_find(trk.get(), 2);
+    ASSERT_GE(s, 0);
+    EXPECT_NEAR(trk->Tr_Omega[s], W, 0.05f);
+    EXPECT_NEAR(trk->Tr_V[s], V, 0.3f);
+
+    ObjTrackPrediction_t p;
+    ASSERT_EQ(obj_track_predict(trk.get(), s, 1.0f, &p), 0);
+    float ex, ey;
+    at(psi + W * 1.0f, ex, ey);
+    EXPECT_NEAR(p.Position_X, ex, 0.8f);
+    EXPECT_NEAR(p.Position_Y, ey, 0.8f);
+}
+
+/* MM : 선회 구간에서 CTRV 확률이 CV 보다 큼 */
+TEST_F(ObjectTrackingTest, TC_TRK_EQ_05)
+{
+    init(OBJ_TRACK_MODE_MM);
+    const float V = 12.0f, W = 0.6f, R = V / W;
+    float psi = 0.0f;
+    for (int k = 0; k < 400; k++) {
+        psi += W * kDt;
+        FilteredObject_t f = meas(3, 20.0f + R * std::sin(psi), R * (1.0f - std::cos(psi)),
+                                  V * std::cos(psi), V * std::sin(psi));
+        obj_track_update(trk.get(), &f, 1, &ego, kDt);
+    }
+    int s = obj_track_find(trk.get(), 3);
+    ASSERT_GE(s, 0);
+    EXPECT_GT(trk->Mu[OBJ_MODEL_CTRV][s], trk->Mu[OBJ_MODEL_CV][s]);
+    for (int m = 0; m < OBJ_MODEL_COUNT; m++) {
+        EXPECT_GE(trk->Mu[m][s], 0.0f);
+        EXPECT_LE(trk->Mu[m][s], 1.0f);
+    }
+}
+
+/* 추적 기반 예측 : 잡음 속도에서 3 s 예측 횡위치 흔들림 감소, Cut-in 플래그 깜빡임 감소 */
+TEST_F(ObjectTrackingTest, TC_TRK_EQ_06)
+{
+    init(OBJ_TRACK_MODE_MM);
+    ego.Ego_Velocity_X = 20.0f;
+    LaneData_t lane;
+    std::memset(&lane, 0, sizeof(lane));
+    LaneSelectOutput_t ls;
+    std::memset(&ls, 0, sizeof(ls));
+    ls.LS_Lane_Width = 3.5f;
+
+    /* 옆 차선에서 느리게 끼어드는 차량 (vy = -0.3, 3 s 후 횡위치 ≈ 경계) */
+    float x = 30.0f, y = 1.75f;
+    PredictedObject_t raw, tr;
+    double rawJit = 0.0, trkJit = 0.0;
+    float rawPrev = 0.0f, trkPrev = 0.0f;
+    int rawFlips = 0, trkFlips = 0;
+    bool rawFlag = false, trkFlag = false;
+    for (int k = 0; k < 300; k++) {
+        x += (22.0f - 20.0f) * kDt;
+        y += -0.3f * kDt;
+        FilteredObject_t f = meas(9, x + rng.uni(-0.3f, 0.3f), y + rng.uni(-0.1f, 0.1f),
+                                  22.0f + rng.uni(-0.5f, 0.5f), -0.3f + rng.uni(-0.4f, 0.4f));
+        obj_track_update(trk.get(), &f, 1, &ego, kDt);
+        ASSERT_EQ(predict_object_future_path(&f, 1, &lane, &ls, &raw, 1), 1);
+        ASSERT_EQ(predict_object_future_path_tracked(&f, 1, &lane, &ls, trk.get(), &tr, 1), 1);
+        EXPECT_EQ(tr.Predicted_Object_ID, 9);
+        if (k >= 100) {
+            rawJit += std::fabs(raw.Predicted_Position_Y - rawPrev);
+            trkJit += std::fabs(tr.Predicted_Position_Y - trkPrev);
+            rawFlips += (raw.CutIn_Flag != rawFlag);
+            trkFlips += (tr.CutIn_Flag != trkFlag);
+        }
+        rawPrev = raw.Predicted_Position_Y;
+        trkPrev = tr.Predicted_Position_Y;
+        rawFlag = raw.CutIn_Flag;
+        trkFlag = tr.CutIn_Flag;
+    }
+    EXPECT_LT(trkJit, 0.2 * rawJit);
+    EXPECT_LT(trkFlips, rawFlips);
+    EXPECT_NEAR(tr.Predicted_Distance,
+                std::sqrt(tr.Predicted_Position_X * tr.Predicted_Position_X +
+                          tr.Predicted_Position_Y * tr.Predicted_Position_Y), 1e-3f);
+
+    /* 트랙 없음 → 기본 예측과 동일 */
+    FilteredObject_t g = meas(77, 40.0f, 0.0f, 20.0f, 0.0f);
+    ASSERT_EQ(predict_object_future_path(&g, 1, &lane, &ls, &raw, 1), 1);
+    ASSERT_EQ(predict_object_future_path_tracked(&g, 1, &lane, &ls, trk.get(), &tr, 1), 1);
+    EXPECT_EQ(std::memcmp(&raw, &tr, sizeof(raw)), 0);
+}
+
+/* 미관측 삭제 (MAX_MISSED 초과), High_Water 축소, 남은 트랙 조회 유지 */
+TEST_F(ObjectTrackingTest, TC_TRK_BV_01)
+{
+    init(OBJ_TRACK_MODE_MM);
+    FilteredObject_t f[2] = { meas(1, 20.0f, 0.0f, 10.0f, 0.0f), meas(2, 40.0f, 0.0f, 10.0f, 0.0f) };
+    ASSERT_EQ(obj_track_update(trk.get(), f, 2, &ego, kDt), 2);
+    for (int k = 0; k < OBJ_TRACK_MAX_MISSED; k++) {
+        ASSERT_EQ(obj_track_update(trk.get(), f, 1, &ego, kDt), 2);
+    }
+    EXPECT_EQ(obj_track_update(trk.get(), f, 1, &ego, kDt), 1);
+    EXPECT_EQ(obj_track_find(trk.get(), 2), -1);
+    EXPECT_EQ(obj_track_find(trk.get(), 1), 0);
+    EXPECT_EQ(trk->High_Water, 1);
+
+    /* 측정 0 개 프레임도 유효 */
+    EXPECT_EQ(obj_track_update(trk.get(), nullptr, 0, &ego, kDt), 1);
+}
+
+/* 용량 초과 : OBJ_TRACK_MAX 까지만 추적, 나머지는 Dropped 누계 */
+TEST_F(ObjectTrackingTest, TC_TRK_BV_02)
+{
+    init(OBJ_TRACK_MODE_CV);
+    std::vector<FilteredObject_t> f;
+    for (int i = 0; i < OBJ_TRACK_MAX + 44; i++) f.push_back(meas(1000 + i, (float)i, 0.0f, 0.0f, 0.0f));
+    EXPECT_EQ(obj_track_update(trk.get(), f.data(), (int)f.size(), &ego, kDt), OBJ_TRACK_MAX);
+    EXPECT_EQ(trk->Dropped, 44);
+    EXPECT_EQ(trk->High_Water, OBJ_TRACK_MAX);
+    EXPECT_EQ(obj_track_find(trk.get(), 1000 + OBJ_TRACK_MAX), -1);
+    EXPECT_GE(obj_track_find(trk.get(), 1000 + OBJ_TRACK_MAX - 1), 0);
+}
+
+/* ID 교체가 잦은 장면 : 해시 조회 = 선형 탐색, 모든 상태 유한 */
+TEST_F(ObjectTrackingTest, TC_TRK_BV_03)
+{
+    init(OBJ_TRACK_MODE_MM);
+    std::vector<FilteredObject_t> f;
+    for (int frame = 0; frame < 200; frame++) {
+        f.clear();
+        int base = frame / 4 * 37;
+        for (int i = 0; i < 120; i++) {
+            int id = base + i * 3;
+            f.push_back(meas(id, rng.uni(0.0f, 150.0f), rng.uni(-8.0f, 8.0f), rng.uni(0.0f, 30.0f), rng.uni(-1.0f, 1.0f)));
+        }
+        obj_track_update(trk.get(), f.data(), (int)f.size(), &ego, kDt);
+
+        for (int s = 0; s < trk->High_Water; s++) {
+            if (!trk->Active[s]) continue;
+            ASSERT_EQ(obj_track_find(trk.get(), trk->Id[s]), s);
+        }
+    }
+    int active = 0;
+    for (int s = 0; s < trk->High_Water; s++) {
+        if (!trk->Active[s]) continue;
+        active++;
+        ObjTrackPrediction_t p;
+        ASSERT_EQ(obj_track_predict(trk.get(), s, 3.0f, &p), 0);
+        EXPECT_TRUE(std::isfinite(p.Position_X) && std::isfinite(p.Position_Y));
+        EXPECT_TRUE(std::isfinite(p.Velocity_X) && std::isfinite(p.Velocity_Y));
+    }
+    EXPECT_EQ(active, trk->Active_Count);
+}
+
+/* 잘못된 인자 */
+TEST_F(ObjectTrackingTest, TC_TRK_RA_01)
+{
+    EXPECT_EQ(obj_track_init(nullptr, &cfg), -1);
+    EXPECT_EQ(obj_track_init(trk.get(), nullptr), -1);
+    ObjTrackConfig_t bad = cfg;
+    bad.Pos_Meas_Var = 0.0f;
+    EXPECT_EQ(obj_track_init(trk.get(), &bad), -1);
+    bad = cfg;
+    bad.Mode_Stay_Prob = 1.5f;
+    EXPECT_EQ(obj_track_init(trk.get(), &bad), -1);
+    obj_track_default_config(nullptr);
+
+    init(OBJ_TRACK_MODE_MM);
+    FilteredObject_t f = meas(1, 10.0f, 0.0f, 5.0f, 0.0f);
+    EXPECT_EQ(obj_track_update(nullptr, &f, 1, &ego, kDt), -1);
+    EXPECT_EQ(obj_track_update(trk.get(), nullptr, 1, &ego, kDt), -1);
+    EXPECT_EQ(obj_track_update(trk.get(), &f, 1, nullptr, kDt), -1);
+    EXPECT_EQ(obj_track_update(trk.get(), &f, -1, &ego, kDt), -1);
+    EXPECT_EQ(obj_track_update(trk.get(), &f, 1, &ego, 0.0f), -1);
+    EXPECT_EQ(trk->Active_Count, 0);
+
+    ObjTrackPrediction_t p;
+    EXPECT_EQ(obj_track_predict(trk.get(), 0, 1.0f, &p), -1);     /* 빈 슬롯 */
+    ASSERT_EQ(obj_track_update(trk.get(), &f, 1, &ego, kDt), 1);
+    EXPECT_EQ(obj_track_predict(trk.get(), 0, 1.0f, nullptr), -1);
+    EXPECT_EQ(obj_track_predict(trk.get(), -1, 1.0f, &p), -1);
+    EXPECT_EQ(obj_track_predict(nullptr, 0, 1.0f, &p), -1);
+    EXPECT_EQ(obj_track_find(nullptr, 1), -1);
+}
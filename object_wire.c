@@ -0,0 +1,170 @@
+#include <math.h>
+#include <string.h>
+
+#include "object_wire.h"
+#include "fast_math.h"
+
+#define OBJWIRE_HDR_SIZE    ((size_t)sizeof(ObjectWireHeader_t))
+#define OBJWIRE_ALIGN4(n)   (((n) + 3u) & ~(size_t)3u)
+
+/* 열 배치 오프셋 (헤더 기준) */
+#define OBJWIRE_COL_ID(n)       OBJWIRE_HDR_SIZE
+#define OBJWIRE_COL_Q(n, f)     (OBJWIRE_HDR_SIZE + 4u * (size_t)(n) + 2u * (size_t)(n) * (size_t)(f))
+#define OBJWIRE_COL_TYPE(n)     OBJWIRE_COL_Q(n, OBJWIRE_Q_COUNT)
+#define OBJWIRE_COL_STATUS(n)   (OBJWIRE_COL_TYPE(n) + (size_t)(n))
+
+/* 0.01 단위 반올림 + int16 포화 */
+static int16_t quantize(float x)
+{
+    float q = x / OBJWIRE_LSB;
+    if (!(q > -32767.5f)) return (q != q) ? 0 : -32767;     /* NaN → 0 */
+    if (q >= 32767.5f)    return 32767;
+    return (int16_t)lrintf(q);
+}
+
+static int16_t quantize_int(int x)
+{
+    if (x >  32767) return 32767;
+    if (x < -32767) return -32767;
+    return (int16_t)x;
+}
+
+static void quantize_object(const ObjectData_t *obj, int16_t q[OBJWIRE_Q_COUNT])
+{
+    q[OBJWIRE_Q_POS_X]    = quantize(obj->Position_X);
+    q[OBJWIRE_Q_POS_Y]    = quantize(obj->Position_Y);
+    q[OBJWIRE_Q_POS_Z]    = quantize(obj->Position_Z);
+    q[OBJWIRE_Q_VEL_X]    = quantize(obj->Velocity_X);
+    q[OBJWIRE_Q_VEL_Y]    = quantize(obj->Velocity_Y);
+    q[OBJWIRE_Q_ACC_X]    = quantize(obj->Accel_X);
+    q[OBJWIRE_Q_ACC_Y]    = quantize(obj->Accel_Y);
+    q[OBJWIRE_Q_HEADING]  = quantize(adas_wrap_deg180(obj->Heading));
+    q[OBJWIRE_Q_DISTANCE] = quantize(obj->Distance < 0.0f ? 0.0f : obj->Distance);
+    q[OBJWIRE_Q_CELL_ID]  = quantize_int(obj->Object_Cell_ID);
+}
+
+size_t object_wire_size(int count, ObjectWireLayout_e layout)
+{
+    if (count < 0 || count > OBJWIRE_MAX_COUNT) return 0;
+
+    if (layout == OBJWIRE_LAYOUT_ROW) {
+        return OBJWIRE_HDR_SIZE + (size_t)count * sizeof(ObjectWireRecord_t);
+    }
+    if (layout == OBJWIRE_LAYOUT_COLUMNAR) {
+        return OBJWIRE_ALIGN4(OBJWIRE_COL_STATUS(count) + (size_t)count);
+    }
+    return 0;
+}
+
+/*─────────────────────────────
+  인코딩
+─────────────────────────────*/
+int object_wire_encode(const ObjectData_t *pObjList, int objCount,
+                       ObjectWireLayout_e layout, void *pBuf, size_t bufSize)
+{
+    if ((!pObjList && objCount > 0) || !pBuf) return -1;
+    if (((uintptr_t)pBuf & 3u) != 0u)         return -1;
+
+    size_t size = object_wire_size(objCount, layout);
+    if (size == 0 || size > bufSize) return -1;
+
+    uint8_t *base = (uint8_t *)pBuf;
+    ObjectWireHeader_t *hdr = (ObjectWireHeader_t *)base;
+    hdr->Magic      = OBJWIRE_MAGIC;
+    hdr->Version    = (uint16_t)OBJWIRE_VERSION;
+    hdr->Layout     = (uint8_t)layout;
+    hdr->Reserved   = 0;
+    hdr->Count      = (uint32_t)objCount;
+    hdr->Total_Size = (uint32_t)size;
+
+    if (layout == OBJWIRE_LAYOUT_ROW) {
+        ObjectWireRecord_t *rec = (ObjectWireRecord_t *)(base + OBJWIRE_HDR_SIZE);
+        for (int i = 0; i < objCount; i++) {
+            rec[i].Object_ID     = (int32_t)pObjList[i].Object_ID;
+            quantize_object(&pObjList[i], rec[i].Q);
+            rec[i].Object_Type   = (uint8_t)pObjList[i].Object_Type;
+            rec[i].Object_Status = (uint8_t)pObjList[i].Object_Status;
+            rec[i].Reserved      = 0;
+        }
+    } else {
+        int32_t *id     = (int32_t *)(base + OBJWIRE_COL_ID(objCount));
+        uint8_t *type   = base + OBJWIRE_COL_TYPE(objCount);
+        uint8_t *status = base + OBJWIRE_COL_STATUS(objCount);
+        for (int i = 0; i < objCount; i++) {
+            int16_t q[OBJWIRE_Q_COUNT];
+            quantize_object(&pObjList[i], q);
+            for (int f = 0; f < OBJWIRE_Q_COUNT; f++) {
+                ((int16_t *)(base + OBJWIRE_COL_Q(objCount, f)))[i] = q[f];
+            }
+            id[i]     = (int32_t)pObjList[i].Object_ID;
+            type[i]   = (uint8_t)pObjList[i].Object_Type;
+            status[i] = (uint8_t)pObjList[i].Object_Status;
+        }
+        size_t used = OBJWIRE_COL_STATUS(objCount) + (size_t)objCount;
+        memset(base + used, 0, size - used);                /* 정렬 패딩 */
+    }
+    return (int)size;
+}
+
+/*─────────────────────────────
+  뷰
+─────────────────────────────*/
+int object_wire_view_init(ObjectWireView_t *pView, const void *pBuf, size_t bufSize)
+{
+    if (!pView || !pBuf || bufSize < OBJWIRE_HDR_SIZE) return -1;
+    if (((uintptr_t)pBuf & 3u) != 0u)                  return -1;
+
+    const uint8_t *base = (const uint8_t *)pBuf;
+    const ObjectWireHeader_t *hdr = (const ObjectWireHeader_t *)base;
+    if (hdr->Magic != OBJWIRE_MAGIC || hdr->Version != OBJWIRE_VERSION) return -1;
+    if (hdr->Count > (uint32_t)OBJWIRE_MAX_COUNT)                       return -1;
+
+    int    n    = (int)hdr->Count;
+    size_t size = object_wire_size(n, (ObjectWireLayout_e)hdr->Layout);
+    if (size == 0 || hdr->Total_Size != (uint32_t)size || size > bufSize) return -1;
+
+    pView->Count  = n;
+    pView->Layout = hdr->Layout;
+    if (hdr->Layout == OBJWIRE_LAYOUT_ROW) {
+        const ObjectWireRecord_t *rec = (const ObjectWireRecord_t *)(base + OBJWIRE_HDR_SIZE);
+        pView->Id = &rec->Object_ID;
+        for (int f = 0; f < OBJWIRE_Q_COUNT; f++) {
+            pView->Q[f] = &rec->Q[f];
+        }
+        pView->Type        = &rec->Object_Type;
+        pView->Status      = &rec->Object_Status;
+        pView->Id_Stride   = (int32_t)(sizeof(ObjectWireRecord_t) / sizeof(int32_t));
+        pView->Q_Stride    = (int32_t)(sizeof(ObjectWireRecord_t) / sizeof(int16_t));
+        pView->Byte_Stride = (int32_t)sizeof(ObjectWireRecord_t);
+    } else {
+        pView->Id = (const int32_t *)(base + OBJWIRE_COL_ID(n));
+        for (int f = 0; f < OBJWIRE_Q_COUNT; f++) {
+            pView->Q[f] = (const int16_t *)(base + OBJWIRE_COL_Q(n, f));
+        }
+        pView->Type        = base + OBJWIRE_COL_TYPE(n);
+        pView->Status      = base + OBJWIRE_COL_STATUS(n);
+        pView->Id_Stride   = 1;
+        pView->Q_Stride    = 1;
+        pView->Byte_Stride = 1;
+    }
+    return 0;
+}
+
+void object_wire_decode_one(const ObjectWireView_t *pView, int i, ObjectData_t *pOut)
+{
+    if (!pView || !pOut || i < 0 || i >= pView->Count) return;
+
+    pOut->Object_ID      = object_wire_id(pView, i);
+    pOut->Object_Type    = object_wire_type(pView, i);
+    pOut->Position_X     = object_wire_f(pView, OBJWIRE_Q_POS_X, i);
+    pOut->Position_Y     = object_wire_f(pView, OBJWIRE_Q_POS_Y, i);
+    pOut->Position_Z     = object_wire_f(pView, OBJWIRE_Q_POS_Z, i);
+    pOut->Velocity_X     = object_wire_f(pView, OBJWIRE_Q_VEL_X, i);
+    pOut->Velocity_Y     = object_wire_f(pView, OBJWIRE_Q_VEL_Y, i);
+    pOut->Accel_X        = object_wire_f(pView, OBJWIRE_Q_ACC_X, i);
+    pOut->Accel_Y        = object_wire_f(pView, OBJWIRE_Q_ACC_Y, i);
+    pOut->Heading        = object_wire_f(pView, OBJWIRE_Q_HEADING, i);
+    pOut->Distance       = object_wire_f(pView, OBJWIRE_Q_DISTANCE, i);
+    pOut->Object_Status  = object_wire_status(pView, i);
+    pOut->Object_Cell_ID = (int)object_wire_q(pView, OBJWIRE_Q_CELL_ID, i);
+}
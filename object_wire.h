@@ -0,0 +1,145 @@
+/****************************************************************************
+ * object_wire.h
+ *
+ * - 객체 리스트(ObjectData_t) 압축 전송 형식 + 제자리(in-place) 읽기 뷰
+ * - ObjectData_t 52 B → 레코드 28 B (위치/속도/가속도/Heading/거리 0.01 단위 int16)
+ * - 배치(layout) 2 종 : 행(레코드 배열), 열(필드별 배열) ― 헤더에 기록
+ * - 수신 측은 역직렬화 없이 ObjectWireView_t 를 만들어 접근자로 직접 읽음
+ *     . 두 배치 모두 (기준 포인터, 보폭) 로 표현 → 접근자 분기 없음
+ *     . select_target_from_object_view (target_selection.h) 가 뷰를 바로 사용
+ * - 바이트 순서 : 리틀 엔디언 호스트 기준 (빅 엔디언에서는 Magic 불일치로 거부)
+ *
+ * 헤더(16 B) : Magic 'OBJW', Version, Layout, Count, Total_Size
+ * 행 배치    : 헤더 + ObjectWireRecord_t[Count]
+ * 열 배치    : 헤더 + int32 ID[Count] + int16 Q[OBJWIRE_Q_COUNT][Count]
+ *              + uint8 Type[Count] + uint8 Status[Count] (+ 4 B 정렬 패딩)
+ *
+ * 양자화 (round-to-nearest, 범위 밖은 포화) :
+ *   위치/속도/가속도 ±327.67, Heading ±180 (인코딩 시 정규화), 거리 0 ~ 327.67 m
+ *   → MAX_OBJECT_DISTANCE(200 m) 밖의 거리도 포화 후 여전히 범위 밖으로 판정됨
+ ****************************************************************************/
+#ifndef OBJECT_WIRE_H
+#define OBJECT_WIRE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "adas_shared.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define OBJWIRE_MAGIC       0x574A424Fu     /* 'OBJW' */
+#define OBJWIRE_VERSION     1u
+#define OBJWIRE_LSB         0.01f           /* 양자화 단위 (Cell ID 제외) */
+#define OBJWIRE_MAX_COUNT   4096
+
+typedef enum {
+    OBJWIRE_LAYOUT_ROW = 0,
+    OBJWIRE_LAYOUT_COLUMNAR
+} ObjectWireLayout_e;
+
+/* int16 양자화 필드 인덱스 */
+typedef enum {
+    OBJWIRE_Q_POS_X = 0,
+    OBJWIRE_Q_POS_Y,
+    OBJWIRE_Q_POS_Z,
+    OBJWIRE_Q_VEL_X,
+    OBJWIRE_Q_VEL_Y,
+    OBJWIRE_Q_ACC_X,
+    OBJWIRE_Q_ACC_Y,
+    OBJWIRE_Q_HEADING,
+    OBJWIRE_Q_DISTANCE,
+    OBJWIRE_Q_CELL_ID,          /* 정수 그대로 (LSB 미적용) */
+    OBJWIRE_Q_COUNT
+} ObjectWireField_e;
+
+typedef struct {
+    uint32_t Magic;
+    uint16_t Version;
+    uint8_t  Layout;            /* ObjectWireLayout_e */
+    uint8_t  Reserved;
+    uint32_t Count;
+    uint32_t Total_Size;        /* 헤더 포함 [byte] */
+} ObjectWireHeader_t;
+
+/* 행 배치 레코드 (자연 정렬, 패딩 없음) */
+typedef struct {
+    int32_t  Object_ID;
+    int16_t  Q[OBJWIRE_Q_COUNT];
+    uint8_t  Object_Type;
+    uint8_t  Object_Status;
+    uint16_t Reserved;
+} ObjectWireRecord_t;
+
+/* 읽기 뷰 : 버퍼를 가리키기만 함 (버퍼 수명 동안 유효) */
+typedef struct {
+    int32_t        Count;
+    uint8_t        Layout;
+    const int32_t *Id;
+    const int16_t *Q[OBJWIRE_Q_COUNT];
+    const uint8_t *Type;
+    const uint8_t *Status;
+    int32_t        Id_Stride;   /* [int32 단위] */
+    int32_t        Q_Stride;    /* [int16 단위] */
+    int32_t        Byte_Stride; /* Type / Status [byte 단위] */
+} ObjectWireView_t;
+
+/**
+ * @brief 인코딩 버퍼 크기 [byte]
+ * @return 필요한 크기, count 범위 밖이면 0
+ */
+size_t object_wire_size(int count, ObjectWireLayout_e layout);
+
+/**
+ * @brief ObjectData_t 리스트 → 전송 형식
+ * @param[out] pBuf : 4 B 정렬 버퍼
+ * @return 기록한 바이트 수, 인자 오류/버퍼 부족 시 -1
+ */
+int object_wire_encode(const ObjectData_t *pObjList, int objCount,
+                       ObjectWireLayout_e layout, void *pBuf, size_t bufSize);
+
+/**
+ * @brief 수신 버퍼 검증 후 뷰 구성 (복사 없음)
+ * @return 0 on success, -1 : 인자 오류 / Magic·Version·크기 불일치 / 정렬 위반
+ */
+int object_wire_view_init(ObjectWireView_t *pView, const void *pBuf, size_t bufSize);
+
+/**
+ * @brief 뷰의 i 번째 객체를 ObjectData_t 로 풀기 (기존 API 호환용)
+ */
+void object_wire_decode_one(const ObjectWireView_t *pView, int i, ObjectData_t *pOut);
+
+/*---------------------------- 접근자 (inline) ----------------------------*/
+
+static inline int16_t object_wire_q(const ObjectWireView_t *pView, ObjectWireField_e f, int i)
+{
+    return pView->Q[f][(ptrdiff_t)i * pView->Q_Stride];
+}
+
+/* 물리량 [m, m/s, m/s^2, °] */
+static inline float object_wire_f(const ObjectWireView_t *pView, ObjectWireField_e f, int i)
+{
+    return (float)object_wire_q(pView, f, i) * OBJWIRE_LSB;
+}
+
+static inline int object_wire_id(const ObjectWireView_t *pView, int i)
+{
+    return pView->Id[(ptrdiff_t)i * pView->Id_Stride];
+}
+
+static inline ObjectType_e object_wire_type(const ObjectWireView_t *pView, int i)
+{
+    return (ObjectType_e)pView->Type[(ptrdiff_t)i * pView->Byte_Stride];
+}
+
+static inline ObjectStatus_e object_wire_status(const ObjectWireView_t *pView, int i)
+{
+    return (ObjectStatus_e)pView->Status[(ptrdiff_t)i * pView->Byte_Stride];
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* OBJECT_WIRE_H */
@@ -0,0 +1,215 @@
+/*********************************************************************
+ * object_wire_test.cpp  ―  객체 리스트 압축 전송 형식 / 제자리 뷰
+ * DUT : object_wire.c, select_target_from_object_view (target_selection.c)
+ *********************************************************************/
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "target_selection.h"
+#include "test_rng.hpp"
+
+namespace {
+
+TestRng g_rng(32u);
+
+std::vector<ObjectData_t> make_objects(int n)
+{
+    std::vector<ObjectData_t> v((size_t)n);
+    for (int i = 0; i < n; i++) {
+        ObjectData_t &o = v[(size_t)i];
+        std::memset(&o, 0, sizeof(o));
+        o.Object_ID      = 1000 + i;
+        o.Object_Type    = (ObjectType_e)(i % 4);
+        o.Position_X     = g_rng.uni(0.0f, 220.0f);
+        o.Position_Y     = g_rng.uni(-6.0f, 6.0f);
+        o.Position_Z     = g_rng.uni(-0.5f, 0.5f);
+        o.Velocity_X     = g_rng.uni(-5.0f, 35.0f);
+        o.Velocity_Y     = g_rng.uni(-1.0f, 1.0f);
+        o.Accel_X        = g_rng.uni(-9.0f, 3.0f);
+        o.Accel_Y        = g_rng.uni(-1.0f, 1.0f);
+        o.Heading        = g_rng.uni(-180.0f, 180.0f);
+        o.Distance       = std::sqrt(o.Position_X * o.Position_X + o.Position_Y * o.Position_Y);
+        o.Object_Status  = (ObjectStatus_e)(i % 4);
+        o.Object_Cell_ID = i % 21;
+    }
+    return v;
+}
+
+/* 4 B 정렬 버퍼 */
+std::vector<uint32_t> encode(const std::vector<ObjectData_t> &objs, ObjectWireLayout_e layout)
+{
+    size_t size = object_wire_size((int)objs.size(), layout);
+    std::vector<uint32_t> buf((size + 3) / 4);
+    int n = object_wire_encode(objs.data(), (int)objs.size(), layout, buf.data(), buf.size() * 4);
+    EXPECT_EQ((size_t)n, size);
+    return buf;
+}
+
+LaneSelectOutput_t make_ls(bool curved)
+{
+    LaneSelectOutput_t ls;
+    std::memset(&ls, 0, sizeof(ls));
+    ls.LS_Lane_Width     = 3.5f;
+    ls.LS_Lane_Offset    = 0.1f;
+    ls.LS_Is_Curved_Lane = curved;
+    ls.LS_Heading_Error  = curved ? 4.0f : 0.0f;
+    return ls;
+}
+
+} /* namespace */
+
+/* 양자화 왕복 오차 : 0.005 (LSB/2) 이내, 정수 필드는 그대로 */
+TEST(ObjectWireTest, TC_OBJW_EQ_01_Quantization)
+{
+    auto objs = make_objects(64);
+    for (ObjectWireLayout_e layout : { OBJWIRE_LAYOUT_ROW, OBJWIRE_LAYOUT_COLUMNAR }) {
+        auto buf = encode(objs, layout);
+        ObjectWireView_t view;
+        ASSERT_EQ(object_wire_view_init(&view, buf.data(), buf.size() * 4), 0);
+        ASSERT_EQ(view.Count, 64);
+        for (int i = 0; i < view.Count; i++) {
+            const ObjectData_t &o = objs[(size_t)i];
+            ObjectData_t d;
+            object_wire_decode_one(&view, i, &d);
+            const float tol = 0.5f * OBJWIRE_LSB + 1e-4f;
+            EXPECT_EQ(d.Object_ID, o.Object_ID);
+            EXPECT_EQ(d.Object_Type, o.Object_Type);
+            EXPECT_EQ(d.Object_Status, o.Object_Status);
+            EXPECT_EQ(d.Object_Cell_ID, o.Object_Cell_ID);
+            EXPECT_NEAR(d.Position_X, o.Position_X, tol);
+            EXPECT_NEAR(d.Position_Y, o.Position_Y, tol);
+            EXPECT_NEAR(d.Position_Z, o.Position_Z, tol);
+            EXPECT_NEAR(d.Velocity_X, o.Velocity_X, tol);
+            EXPECT_NEAR(d.Velocity_Y, o.Velocity_Y, tol);
+            EXPECT_NEAR(d.Accel_X, o.Accel_X, tol);
+            EXPECT_NEAR(d.Accel_Y, o.Accel_Y, tol);
+            EXPECT_NEAR(d.Heading, o.Heading, tol);
+            EXPECT_NEAR(d.Distance, o.Distance, tol);
+        }
+    }
+}
+
+/* 뷰 필터 == 풀어낸 리스트 필터 (비트 일치), 행/열 배치 동일 */
+TEST(ObjectWireTest, TC_OBJW_EQ_02_ViewFilterMatchesList)
+{
+    auto objs = make_objects(128);
+    EgoData_t ego;
+    std::memset(&ego, 0, sizeof(ego));
+    ego.Ego_Velocity_X = 20.0f;
+    ego.Ego_Heading    = 2.0f;
+
+    for (bool curved : { false, true }) {
+        LaneSelectOutput_t ls = make_ls(curved);
+        std::vector<FilteredObject_t> ref(128), rowOut(128), colOut(128);
+
+        auto rowBuf = encode(objs, OBJWIRE_LAYOUT_ROW);
+        auto colBuf = encode(objs, OBJWIRE_LAYOUT_COLUMNAR);
+        ObjectWireView_t rowView, colView;
+        ASSERT_EQ(object_wire_view_init(&rowView, rowBuf.data(), rowBuf.size() * 4), 0);
+        ASSERT_EQ(object_wire_view_init(&colView, colBuf.data(), colBuf.size() * 4), 0);
+
+        std::vector<ObjectData_t> decoded(objs.size());
+        for (int i = 0; i < rowView.Count; i++) object_wire_decode_one(&rowView, i, &decoded[(size_t)i]);
+
+        std::memset(ref.data(), 0, ref.size() * sizeof(FilteredObject_t));
+        std::memset(rowOut.data(), 0, rowOut.size() * sizeof(FilteredObject_t));
+        std::memset(colOut.data(), 0, colOut.size() * sizeof(FilteredObject_t));
+        int nRef = select_target_from_object_list(decoded.data(), (int)decoded.size(), &ego, &ls, ref.data(), 128);
+        int nRow = select_target_from_object_view(&rowView, &ego, &ls, rowOut.data(), 128);
+        int nCol = select_target_from_object_view(&colView, &ego, &ls, colOut.data(), 128);
+
+        ASSERT_GT(nRef, 0);
+        ASSERT_EQ(nRow, nRef);
+        ASSERT_EQ(nCol, nRef);
+        EXPECT_EQ(std::memcmp(ref.data(), rowOut.data(), sizeof(FilteredObject_t) * (size_t)nRef), 0);
+        EXPECT_EQ(std::memcmp(ref.data(), colOut.data(), sizeof(FilteredObject_t) * (size_t)nRef), 0);
+
+        /* 출력 상한 */
+        EXPECT_EQ(select_target_from_object_view(&rowView, &ego, &ls, rowOut.data(), 3), 3);
+    }
+}
+
+/* 크기 : 레코드 28 B (ObjectData_t 대비 절반 남짓), 열 배치는 26 B/객체 + 정렬 */
+TEST(ObjectWireTest, TC_OBJW_BV_01_Size)
+{
+    EXPECT_EQ(sizeof(ObjectWireHeader_t), 16u);
+    EXPECT_EQ(sizeof(ObjectWireRecord_t), 28u);
+    EXPECT_LT(sizeof(ObjectWireRecord_t) * 2, sizeof(ObjectData_t) + 8);
+    EXPECT_EQ(object_wire_size(0, OBJWIRE_LAYOUT_ROW), 16u);
+    EXPECT_EQ(object_wire_size(32, OBJWIRE_LAYOUT_ROW), 16u + 32u * 28u);
+    EXPECT_EQ(object_wire_size(32, OBJWIRE_LAYOUT_COLUMNAR), 16u + 32u * 26u);
+    EXPECT_EQ(object_wire_size(3, OBJWIRE_LAYOUT_COLUMNAR), 16u + 80u);     /* 78 → 80 */
+    EXPECT_EQ(object_wire_size(OBJWIRE_MAX_COUNT + 1, OBJWIRE_LAYOUT_ROW), 0u);
+
+    /* 빈 리스트 : 인코딩/뷰 가능, 필터 결과 0 */
+    uint32_t buf[4];
+    ASSERT_EQ(object_wire_encode(nullptr, 0, OBJWIRE_LAYOUT_ROW, buf, sizeof(buf)), 16);
+    ObjectWireView_t view;
+    ASSERT_EQ(object_wire_view_init(&view, buf, sizeof(buf)), 0);
+    EXPECT_EQ(view.Count, 0);
+}
+
+/* 포화 / Heading 정규화 / NaN */
+TEST(ObjectWireTest, TC_OBJW_BV_02_Saturation)
+{
+    std::vector<ObjectData_t> objs(1);
+    std::memset(&objs[0], 0, sizeof(ObjectData_t));
+    objs[0].Position_X = 1000.0f;
+    objs[0].Position_Y = -1000.0f;
+    objs[0].Velocity_X = NAN;
+    objs[0].Heading    = 270.0f;
+    objs[0].Distance   = 1000.0f;
+    objs[0].Object_Cell_ID = 100000;
+
+    auto buf = encode(objs, OBJWIRE_LAYOUT_ROW);
+    ObjectWireView_t view;
+    ASSERT_EQ(object_wire_view_init(&view, buf.data(), buf.size() * 4), 0);
+    EXPECT_FLOAT_EQ(object_wire_f(&view, OBJWIRE_Q_POS_X, 0), 327.67f);
+    EXPECT_FLOAT_EQ(object_wire_f(&view, OBJWIRE_Q_POS_Y, 0), -327.67f);
+    EXPECT_EQ(object_wire_q(&view, OBJWIRE_Q_VEL_X, 0), 0);
+    EXPECT_FLOAT_EQ(object_wire_f(&view, OBJWIRE_Q_HEADING, 0), -90.0f);
+    EXPECT_GT(object_wire_f(&view, OBJWIRE_Q_DISTANCE, 0), 200.0f);         /* 여전히 범위 밖 */
+    EXPECT_EQ(object_wire_q(&view, OBJWIRE_Q_CELL_ID, 0), 32767);
+
+    EgoData_t ego;
+    std::memset(&ego, 0, sizeof(ego));
+    LaneSelectOutput_t ls = make_ls(false);
+    FilteredObject_t out[1];
+    EXPECT_EQ(select_target_from_object_view(&view, &ego, &ls, out, 1), 0);
+}
+
+/* 무효 입력 : Magic/Version/크기/정렬 */
+TEST(ObjectWireTest, TC_OBJW_RA_01_InvalidBuffer)
+{
+    auto objs = make_objects(4);
+    auto buf  = encode(objs, OBJWIRE_LAYOUT_COLUMNAR);
+    size_t len = buf.size() * 4;
+    ObjectWireView_t view;
+
+    EXPECT_EQ(object_wire_view_init(nullptr, buf.data(), len), -1);
+    EXPECT_EQ(object_wire_view_init(&view, nullptr, len), -1);
+    EXPECT_EQ(object_wire_view_init(&view, buf.data(), len - 4), -1);      /* 잘린 버퍼 */
+    EXPECT_EQ(object_wire_view_init(&view, (const uint8_t *)buf.data() + 2, len - 2), -1);
+
+    ObjectWireHeader_t *hdr = (ObjectWireHeader_t *)buf.data();
+    hdr->Version = OBJWIRE_VERSION + 1;
+    EXPECT_EQ(object_wire_view_init(&view, buf.data(), len), -1);
+    hdr->Version = OBJWIRE_VERSION;
+    hdr->Layout  = 7;
+    EXPECT_EQ(object_wire_view_init(&view, buf.data(), len), -1);
+    hdr->Layout  = OBJWIRE_LAYOUT_COLUMNAR;
+    hdr->Count   = 5;                                                      /* Total_Size 불일치 */
+    EXPECT_EQ(object_wire_view_init(&view, buf.data(), len), -1);
+    hdr->Count   = 4;
+    EXPECT_EQ(object_wire_view_init(&view, buf.data(), len), 0);
+
+    /* 인코딩 : 버퍼 부족 / 오정렬 */
+    uint32_t small[8];
+    EXPECT_EQ(object_wire_encode(objs.data(), 4, OBJWIRE_LAYOUT_ROW, small, sizeof(small)), -1);
+    EXPECT_EQ(object_wire_encode(objs.data(), 4, OBJWIRE_LAYOUT_ROW,
+                                 (uint8_t *)buf.data() + 1, len - 1), -1);
+    EXPECT_EQ(object_wire_encode(nullptr, 4, OBJWIRE_LAYOUT_ROW, buf.data(), len), -1);
+}
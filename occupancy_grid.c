@@ -0,0 +1,211 @@
+#include <math.h>
+#include <string.h>
+
+#include "occupancy_grid.h"
+#include "lane_geometry.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define OCC_GRID_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#define OCC_CHUNK       64          /* 좌표 변환 일괄 처리 단위 */
+#define OCC_Q_SCALE     254.0f      /* 행 내 오프셋 양자화 */
+
+static const float k_half_width[4] = {
+    0.9f,   /* OBJTYPE_CAR */
+    0.3f,   /* OBJTYPE_PEDESTRIAN */
+    0.4f,   /* OBJTYPE_BICYCLE */
+    0.5f,   /* OBJTYPE_MOTORCYCLE */
+};
+
+/*─────────────────────────────
+  좌표 변환 : 행 단위 종좌표 u, 열 단위 횡범위 [cl, ch]
+   - 차선 중심 yc = ofs + x·(c1 + c2·x)
+─────────────────────────────*/
+typedef struct {
+    float Ofs, C1, C2;
+} OccPath_t;
+
+static void transform_scalar(const OccPath_t *p, const float *x, const float *y, const float *hw,
+                             float *u, float *cl, float *ch, int from, int n)
+{
+    const float invRow = 1.0f / OCC_GRID_ROW_LEN;
+    const float invCol = 1.0f / OCC_GRID_COL_WIDTH;
+    for (int i = from; i < n; i++) {
+        float lat = y[i] - (p->Ofs + x[i] * (p->C1 + p->C2 * x[i]));
+        u[i]  = (x[i] - OCC_GRID_X_MIN) * invRow;
+        cl[i] = ((lat - hw[i]) - OCC_GRID_LAT_MIN) * invCol;
+        ch[i] = ((lat + hw[i]) - OCC_GRID_LAT_MIN) * invCol;
+    }
+}
+
+#ifdef OCC_GRID_SSE2
+static void transform_n(const OccPath_t *p, const float *x, const float *y, const float *hw,
+                        float *u, float *cl, float *ch, int n)
+{
+    const __m128 ofs    = _mm_set1_ps(p->Ofs);
+    const __m128 c1     = _mm_set1_ps(p->C1);
+    const __m128 c2     = _mm_set1_ps(p->C2);
+    const __m128 xMin   = _mm_set1_ps(OCC_GRID_X_MIN);
+    const __m128 latMin = _mm_set1_ps(OCC_GRID_LAT_MIN);
+    const __m128 invRow = _mm_set1_ps(1.0f / OCC_GRID_ROW_LEN);
+    const __m128 invCol = _mm_set1_ps(1.0f / OCC_GRID_COL_WIDTH);
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128 vx  = _mm_loadu_ps(x + i);
+        __m128 vy  = _mm_loadu_ps(y + i);
+        __m128 vh  = _mm_loadu_ps(hw + i);
+        __m128 lat = _mm_sub_ps(vy, _mm_add_ps(ofs, _mm_mul_ps(vx, _mm_add_ps(c1, _mm_mul_ps(c2, vx)))));
+        _mm_storeu_ps(u + i,  _mm_mul_ps(_mm_sub_ps(vx, xMin), invRow));
+        _mm_storeu_ps(cl + i, _mm_mul_ps(_mm_sub_ps(_mm_sub_ps(lat, vh), latMin), invCol));
+        _mm_storeu_ps(ch + i, _mm_mul_ps(_mm_sub_ps(_mm_add_ps(lat, vh), latMin), invCol));
+    }
+    transform_scalar(p, x, y, hw, u, cl, ch, i, n);
+}
+#else
+static void transform_n(const OccPath_t *p, const float *x, const float *y, const float *hw,
+                        float *u, float *cl, float *ch, int n)
+{
+    transform_scalar(p, x, y, hw, u, cl, ch, 0, n);
+}
+#endif
+
+/*─────────────────────────────
+  열 범위 → 비트 마스크
+─────────────────────────────*/
+static bool clip_cols(float cl, float ch, int *pC0, int *pC1)
+{
+    float f0 = floorf(cl), f1 = floorf(ch);
+    if (!(f1 >= 0.0f) || !(f0 < (float)OCC_GRID_COLS)) {
+        return false;
+    }
+    *pC0 = (f0 < 0.0f) ? 0 : (int)f0;
+    *pC1 = (f1 > (float)(OCC_GRID_COLS - 1)) ? (OCC_GRID_COLS - 1) : (int)f1;
+    return true;
+}
+
+static uint32_t col_mask(int c0, int c1)
+{
+    int n = c1 - c0 + 1;
+    return (n >= 32) ? 0xFFFFFFFFu : (((1u << n) - 1u) << c0);
+}
+
+static bool corridor_cols(float latRight, float latLeft, int *pC0, int *pC1)
+{
+    const float invCol = 1.0f / OCC_GRID_COL_WIDTH;
+    return clip_cols((latRight - OCC_GRID_LAT_MIN) * invCol,
+                     (latLeft  - OCC_GRID_LAT_MIN) * invCol, pC0, pC1);
+}
+
+/* 행 r 의 열 [c0, c1] 중 최소 종거리 [m] (점유 없으면 false) */
+static bool row_min_range(const OccupancyGrid_t *g, int r, int c0, int c1, float *pX)
+{
+    if (!(g->Occ[r] & col_mask(c0, c1))) return false;
+    unsigned best = OCC_GRID_RANGE_EMPTY;
+    for (int c = c0; c <= c1; c++) {
+        if (g->Min_Range[r][c] < best) best = g->Min_Range[r][c];
+    }
+    *pX = OCC_GRID_X_MIN + (float)r * OCC_GRID_ROW_LEN + (float)best * (OCC_GRID_ROW_LEN / OCC_Q_SCALE);
+    return true;
+}
+
+/*─────────────────────────────
+  공개 함수
+─────────────────────────────*/
+int occ_grid_build(OccupancyGrid_t *pGrid,
+                   const FilteredObject_t *pFiltered, int count,
+                   const LaneData_t *pLaneWp, const LaneSelectOutput_t *pLsData)
+{
+    if (!pGrid) return -1;
+    memset(pGrid->Occ, 0, sizeof(pGrid->Occ));
+    memset(pGrid->Min_Range, OCC_GRID_RANGE_EMPTY, sizeof(pGrid->Min_Range));
+    pGrid->Object_Count  = 0;
+    pGrid->Clipped_Count = 0;
+    pGrid->Lane_Width    = 0.0f;
+    if (!pLsData || !(pLsData->LS_Lane_Width > 0.0f)
+        || count < 0 || (count > 0 && !pFiltered))
+    {
+        return -1;
+    }
+    pGrid->Lane_Width = pLsData->LS_Lane_Width;
+
+    OccPath_t path;
+    path.Ofs = pLsData->LS_Lane_Offset;
+    path.C1  = tanf(-pLsData->LS_Heading_Error * (float)M_PI / 180.0f);
+    path.C2  = pLaneWp ? lane_geometry_half_curvature(pLaneWp->Lane_Curvature) : 0.0f;
+
+    float x[OCC_CHUNK], y[OCC_CHUNK], hw[OCC_CHUNK];
+    float u[OCC_CHUNK], cl[OCC_CHUNK], ch[OCC_CHUNK];
+
+    for (int base = 0; base < count; base += OCC_CHUNK) {
+        int n = (count - base < OCC_CHUNK) ? (count - base) : OCC_CHUNK;
+        for (int i = 0; i < n; i++) {
+            const FilteredObject_t *fo = &pFiltered[base + i];
+            unsigned type = (unsigned)fo->Filtered_Object_Type;
+            x[i]  = fo->Filtered_Position_X;
+            y[i]  = fo->Filtered_Position_Y;
+            hw[i] = k_half_width[(type < 4u) ? type : 0u];
+        }
+        transform_n(&path, x, y, hw, u, cl, ch, n);
+
+        for (int i = 0; i < n; i++) {
+            int c0, c1;
+            if (!(u[i] >= 0.0f) || !(u[i] < (float)OCC_GRID_ROWS) || !clip_cols(cl[i], ch[i], &c0, &c1)) {
+                pGrid->Clipped_Count++;
+                continue;
+            }
+            int     r = (int)u[i];
+            uint8_t q = (uint8_t)((u[i] - (float)r) * OCC_Q_SCALE);
+            pGrid->Occ[r] |= col_mask(c0, c1);
+            for (int c = c0; c <= c1; c++) {
+                if (q < pGrid->Min_Range[r][c]) pGrid->Min_Range[r][c] = q;
+            }
+            pGrid->Object_Count++;
+        }
+    }
+    return 0;
+}
+
+float occ_grid_free_distance(const OccupancyGrid_t *pGrid, float latRight, float latLeft)
+{
+    if (!pGrid || !(latRight <= latLeft)) return -1.0f;
+    int c0, c1;
+    if (!corridor_cols(latRight, latLeft, &c0, &c1)) return OCC_GRID_X_MAX;
+
+    const int r0 = (int)(-OCC_GRID_X_MIN / OCC_GRID_ROW_LEN);     /* X = 0 행 */
+    for (int r = r0; r < OCC_GRID_ROWS; r++) {
+        float xHit;
+        if (row_min_range(pGrid, r, c0, c1, &xHit)) {
+            return xHit;
+        }
+    }
+    return OCC_GRID_X_MAX;
+}
+
+bool occ_grid_lane_clear(const OccupancyGrid_t *pGrid, OccLane_e lane, float xFrom, float xTo)
+{
+    if (!pGrid || !(xFrom <= xTo) || !(pGrid->Lane_Width > 0.0f)
+        || lane < OCC_LANE_RIGHT || lane > OCC_LANE_LEFT)
+    {
+        return false;
+    }
+    float W = pGrid->Lane_Width;
+    float latRight = ((float)lane - 0.5f) * W;
+    int c0, c1;
+    if (!corridor_cols(latRight, latRight + W, &c0, &c1)) return true;
+
+    if (xFrom < OCC_GRID_X_MIN) xFrom = OCC_GRID_X_MIN;
+    if (xTo >= OCC_GRID_X_MAX)  xTo   = OCC_GRID_X_MAX - 1.0e-3f;
+    if (xFrom > xTo) return true;
+
+    int rFrom = (int)((xFrom - OCC_GRID_X_MIN) / OCC_GRID_ROW_LEN);
+    int rTo   = (int)((xTo   - OCC_GRID_X_MIN) / OCC_GRID_ROW_LEN);
+    for (int r = rFrom; r <= rTo; r++) {
+        float xHit;
+        if (row_min_range(pGrid, r, c0, c1, &xHit) && (r < rTo || xHit <= xTo)) {
+            return false;
+        }
+    }
+    return true;
+}
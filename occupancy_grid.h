@@ -0,0 +1,81 @@
+/****************************************************************************
+ * occupancy_grid.h
+ *
+ * - 객체 리스트로 매 프레임 재구성하는 차선 정렬(곡선 좌표) 점유 격자
+ *     . 행 : 차선 중심선 따라 종방향 OCC_GRID_ROW_LEN [m] 간격,
+ *            X = OCC_GRID_X_MIN .. OCC_GRID_X_MAX (후방 포함, X = 0 이 행 경계)
+ *     . 열 : 차선 중심 기준 횡편차 OCC_GRID_COL_WIDTH [m] 간격, 열 0 = 최우측
+ *            (횡편차 = y - (LS_Lane_Offset + tan(-LS_Heading_Error)·x + x²/2R),
+ *             bucket_targets_by_lane 과 같은 차선 중심 다항식)
+ *     . 행마다 점유 비트 1 word + 칸마다 최소 종거리 (행 내 오프셋 8 bit 양자화)
+ *       → 약 4.6 KB, 캐시 상주
+ * - 객체 폭 : 타입별 반폭 (승용 0.9, 보행자 0.3, 자전거 0.4, 이륜 0.5 m) 만큼 열 범위 점유
+ * - 재구성 : 좌표 변환은 4-lane SSE2 (미지원 시 스칼라, 동일 연산 순서 → 결과 동일),
+ *            열/행 산출과 비트 기록은 스칼라
+ * - 질의 : 행 단위 비트 마스크 검사 → O(행 수), 객체 수와 무관
+ *     . occ_grid_free_distance : 경로 회랑(횡편차 범위) 전방 자유 거리
+ *     . occ_grid_lane_clear    : Ego/좌/우 차로의 [xFrom, xTo] 구간 비어 있는지
+ * - 해상도 : 횡 OCC_GRID_COL_WIDTH (칸이 회랑과 겹치면 점유로 간주 → 보수적),
+ *            종 OCC_GRID_ROW_LEN / 254 (칸 최소 거리), 구간 시작 행은 행 단위 (보수적)
+ ****************************************************************************/
+#ifndef OCCUPANCY_GRID_H
+#define OCCUPANCY_GRID_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "adas_shared.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define OCC_GRID_ROWS       128
+#define OCC_GRID_COLS       32          /* = 점유 word 비트 수 */
+#define OCC_GRID_ROW_LEN    2.0f        /* [m] */
+#define OCC_GRID_COL_WIDTH  0.4f        /* [m] */
+#define OCC_GRID_X_MIN      (-56.0f)    /* [m] 후방 한계 (ROW_LEN 의 배수) */
+#define OCC_GRID_X_MAX      (OCC_GRID_X_MIN + OCC_GRID_ROWS * OCC_GRID_ROW_LEN)    /* 200 m */
+#define OCC_GRID_LAT_MIN    (-0.5f * OCC_GRID_COLS * OCC_GRID_COL_WIDTH)           /* -6.4 m */
+#define OCC_GRID_RANGE_EMPTY 0xFFu      /* Min_Range : 빈 칸 */
+
+typedef enum {
+    OCC_LANE_RIGHT = -1,
+    OCC_LANE_EGO   = 0,
+    OCC_LANE_LEFT  = 1
+} OccLane_e;
+
+typedef struct {
+    float    Lane_Width;                /* [m] 이번 프레임 LS_Lane_Width */
+    int32_t  Object_Count;              /* 기록된 객체 수 */
+    int32_t  Clipped_Count;             /* 격자 밖 (종/횡) 객체 수 */
+    uint32_t Occ[OCC_GRID_ROWS];        /* 행별 점유 비트 (bit c = 열 c) */
+    uint8_t  Min_Range[OCC_GRID_ROWS][OCC_GRID_COLS];  /* 행 내 최소 종거리 0..254 (ROW_LEN/254 단위) */
+} OccupancyGrid_t;
+
+/**
+ * @brief 필터링된 객체 리스트로 격자 재구성 (현재 위치 기준)
+ * @param[in] pLaneWp : 차선 곡률 (NULL 이면 직선)
+ * @return 0 on success, -1 on invalid argument (pGrid 가 있으면 빈 격자)
+ */
+int occ_grid_build(OccupancyGrid_t *pGrid,
+                   const FilteredObject_t *pFiltered, int count,
+                   const LaneData_t *pLaneWp, const LaneSelectOutput_t *pLsData);
+
+/**
+ * @brief 횡편차 [latRight, latLeft] 회랑의 X >= 0 전방 첫 점유까지 거리
+ * @return [m] 자유 거리 (비어 있으면 OCC_GRID_X_MAX), -1 on invalid argument
+ */
+float occ_grid_free_distance(const OccupancyGrid_t *pGrid, float latRight, float latLeft);
+
+/**
+ * @brief 차로(Ego / 좌 / 우, 폭 = 격자 Lane_Width) 의 종 구간 [xFrom, xTo] 이 비어 있는지
+ *        (xFrom < 0 이면 후방 포함, 격자 밖 구간은 비어 있는 것으로 봄)
+ * @return true = 비어 있음, 인자 오류 / 빈 격자(Lane_Width 0) 는 false (보수적)
+ */
+bool occ_grid_lane_clear(const OccupancyGrid_t *pGrid, OccLane_e lane, float xFrom, float xTo);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* OCCUPANCY_GRID_H */
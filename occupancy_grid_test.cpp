@@ -0,0 +1,179 @@
+/*********************************************************************
+ * occupancy_grid_test.cpp  ―  차선 정렬 점유 격자 (자유 거리 / 차로 비어 있음)
+ * DUT : occupancy_grid.c
+ *********************************************************************/
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "occupancy_grid.h"
+#include "test_rng.hpp"
+
+namespace {
+
+const float kQ = OCC_GRID_ROW_LEN / 254.0f;     /* 종 양자화 */
+
+class OccupancyGridTest : public ::testing::Test {
+protected:
+    OccupancyGrid_t    grid;
+    LaneData_t         lane;
+    LaneSelectOutput_t ls;
+    TestRng            rng{41u};
+
+    void SetUp() override
+    {
+        std::memset(&grid, 0, sizeof(grid));
+        std::memset(&lane, 0, sizeof(lane));
+        std::memset(&ls, 0, sizeof(ls));
+        ls.LS_Lane_Width = 3.5f;
+    }
+
+    static FilteredObject_t obj(float x, float y, ObjectType_e type = OBJTYPE_CAR)
+    {
+        FilteredObject_t f;
+        std::memset(&f, 0, sizeof(f));
+        f.Filtered_Object_Type = type;
+        f.Filtered_Position_X  = x;
+        f.Filtered_Position_Y  = y;
+        return f;
+    }
+
+    /* 같은 열 양자화 규칙의 객체별 전수 탐색 */
+    static int col_of(float lat) { return (int)std::floor((lat - OCC_GRID_LAT_MIN) / OCC_GRID_COL_WIDTH); }
+
+    static float brute_free(const std::vector<FilteredObject_t> &v, float latR, float latL)
+    {
+        static const float hw[4] = { 0.9f, 0.3f, 0.4f, 0.5f };
+        int k0 = std::max(col_of(latR), 0), k1 = std::min(col_of(latL), OCC_GRID_COLS - 1);
+        float best = OCC_GRID_X_MAX;
+        for (const auto &o : v) {
+            float x = o.Filtered_Position_X, y = o.Filtered_Position_Y;
+            if (x < 0.0f || x >= OCC_GRID_X_MAX) continue;
+            int c0 = std::max(col_of(y - hw[o.Filtered_Object_Type]), 0);
+            int c1 = std::min(col_of(y + hw[o.Filtered_Object_Type]), OCC_GRID_COLS - 1);
+            if (c1 < k0 || c0 > k1 || c0 > c1) continue;
+            best = std::min(best, x);
+        }
+        return best;
+    }
+};
+
+} /* namespace */
+
+/* 단일 차량 : 자유 거리, 차로별 비어 있음 */
+TEST_F(OccupancyGridTest, TC_OCC_EQ_01)
+{
+    FilteredObject_t f = obj(30.3f, 0.0f);
+    ASSERT_EQ(occ_grid_build(&grid, &f, 1, &lane, &ls), 0);
+    EXPECT_EQ(grid.Object_Count, 1);
+    EXPECT_NEAR(occ_grid_free_distance(&grid, -1.0f, 1.0f), 30.3f, kQ);
+    EXPECT_FLOAT_EQ(occ_grid_free_distance(&grid, 2.5f, 4.5f), OCC_GRID_X_MAX);
+    EXPECT_FALSE(occ_grid_lane_clear(&grid, OCC_LANE_EGO, 0.0f, 100.0f));
+    EXPECT_TRUE(occ_grid_lane_clear(&grid, OCC_LANE_EGO, 0.0f, 30.0f));
+    EXPECT_TRUE(occ_grid_lane_clear(&grid, OCC_LANE_LEFT, -50.0f, 150.0f));
+    EXPECT_TRUE(occ_grid_lane_clear(&grid, OCC_LANE_RIGHT, -50.0f, 150.0f));
+}
+
+/* 무작위 장면 : 격자 질의 = 객체별 전수 탐색 (양자화 오차 이내) */
+TEST_F(OccupancyGridTest, TC_OCC_EQ_02)
+{
+    for (int trial = 0; trial < 200; trial++) {
+        int n = (int)rng.uni(0.0f, 150.0f);
+        std::vector<FilteredObject_t> v;
+        for (int i = 0; i < n; i++) {
+            v.push_back(obj(rng.uni(-70.0f, 220.0f), rng.uni(-8.0f, 8.0f), (ObjectType_e)(i % 4)));
+        }
+        ASSERT_EQ(occ_grid_build(&grid, v.data(), n, &lane, &ls), 0);
+        for (float c : { -3.5f, 0.0f, 3.5f }) {
+            float got = occ_grid_free_distance(&grid, c - 1.0f, c + 1.0f);
+            EXPECT_NEAR(got, brute_free(v, c - 1.0f, c + 1.0f), kQ) << "trial " << trial << " c " << c;
+        }
+    }
+}
+
+/* 곡선 (좌회전 R = 300 m) : 차선 중심 위 차량은 Ego 경로 점유 */
+TEST_F(OccupancyGridTest, TC_OCC_EQ_03)
+{
+    lane.Lane_Curvature = 300.0f;
+    FilteredObject_t f[2] = { obj(60.0f, 6.0f), obj(40.0f, 40.0f * 40.0f / 600.0f + 3.5f) };
+    ASSERT_EQ(occ_grid_build(&grid, f, 2, &lane, &ls), 0);
+    EXPECT_NEAR(occ_grid_free_distance(&grid, -1.0f, 1.0f), 60.0f, kQ);
+    EXPECT_FALSE(occ_grid_lane_clear(&grid, OCC_LANE_LEFT, 0.0f, 50.0f));
+    EXPECT_TRUE(occ_grid_lane_clear(&grid, OCC_LANE_RIGHT, -50.0f, 200.0f));
+
+    /* 곡률 없음 → 직선 : 같은 차량이 Ego 경로 밖 (좌측 차로 바깥쪽) */
+    ASSERT_EQ(occ_grid_build(&grid, f, 2, nullptr, &ls), 0);
+    EXPECT_FLOAT_EQ(occ_grid_free_distance(&grid, -1.0f, 1.0f), OCC_GRID_X_MAX);
+    EXPECT_TRUE(occ_grid_lane_clear(&grid, OCC_LANE_EGO, 0.0f, 200.0f));
+    EXPECT_FALSE(occ_grid_lane_clear(&grid, OCC_LANE_LEFT, 0.0f, 50.0f));
+}
+
+/* 차로 변경 : 후방 차량이 있는 옆 차로 */
+TEST_F(OccupancyGridTest, TC_OCC_EQ_04)
+{
+    FilteredObject_t f[3] = { obj(-11.0f, 3.5f), obj(45.0f, 3.4f), obj(20.0f, -3.5f, OBJTYPE_MOTORCYCLE) };
+    ASSERT_EQ(occ_grid_build(&grid, f, 3, &lane, &ls), 0);
+    EXPECT_FALSE(occ_grid_lane_clear(&grid, OCC_LANE_LEFT, -30.0f, 30.0f));
+    EXPECT_TRUE(occ_grid_lane_clear(&grid, OCC_LANE_LEFT, -10.0f, 30.0f));
+    EXPECT_FALSE(occ_grid_lane_clear(&grid, OCC_LANE_LEFT, -10.0f, 45.5f));
+    EXPECT_TRUE(occ_grid_lane_clear(&grid, OCC_LANE_LEFT, -10.0f, 44.5f));
+    EXPECT_FALSE(occ_grid_lane_clear(&grid, OCC_LANE_RIGHT, 0.0f, 30.0f));
+    EXPECT_TRUE(occ_grid_lane_clear(&grid, OCC_LANE_EGO, -56.0f, 200.0f));
+    EXPECT_NEAR(occ_grid_free_distance(&grid, 1.75f, 5.25f), 45.0f, kQ);
+}
+
+/* 경계 : X = 0, 격자 밖 (종/횡), 가장자리 부분 겹침, 객체 수 > 일괄 처리 단위 */
+TEST_F(OccupancyGridTest, TC_OCC_BV_01)
+{
+    std::vector<FilteredObject_t> v = { obj(0.0f, 0.0f), obj(200.0f, 0.0f), obj(-56.5f, 0.0f),
+                                        obj(10.0f, 7.5f), obj(10.0f, 6.8f), obj(-56.0f, 0.0f) };
+    ASSERT_EQ(occ_grid_build(&grid, v.data(), (int)v.size(), &lane, &ls), 0);
+    EXPECT_EQ(grid.Object_Count, 3);
+    EXPECT_EQ(grid.Clipped_Count, 3);
+    EXPECT_FLOAT_EQ(occ_grid_free_distance(&grid, -0.5f, 0.5f), 0.0f);
+    EXPECT_EQ(grid.Occ[33], 0xC0000000u);                           /* X = 10 m 행, 좌측 끝 2 열만 */
+    EXPECT_FALSE(occ_grid_lane_clear(&grid, OCC_LANE_EGO, -100.0f, -55.0f));
+
+    v.clear();
+    for (int i = 0; i < 1000; i++) v.push_back(obj(150.0f - 0.1f * (float)i, 3.5f));
+    ASSERT_EQ(occ_grid_build(&grid, v.data(), (int)v.size(), &lane, &ls), 0);
+    EXPECT_EQ(grid.Object_Count, 1000);
+    EXPECT_NEAR(occ_grid_free_distance(&grid, 2.5f, 4.5f), 50.1f, kQ);
+}
+
+/* 반경 비유한 / |R| < 1 → 직선 (bucket_targets_by_lane 과 같은 검사) */
+TEST_F(OccupancyGridTest, TC_OCC_BV_02)
+{
+    FilteredObject_t f = obj(30.3f, 0.0f);
+    for (float r : { NAN, INFINITY, -0.5f, 0.5f }) {
+        lane.Lane_Curvature = r;
+        ASSERT_EQ(occ_grid_build(&grid, &f, 1, &lane, &ls), 0);
+        EXPECT_EQ(grid.Object_Count, 1) << r;
+        EXPECT_NEAR(occ_grid_free_distance(&grid, -1.0f, 1.0f), 30.3f, kQ) << r;
+    }
+}
+
+/* 잘못된 인자 */
+TEST_F(OccupancyGridTest, TC_OCC_RA_01)
+{
+    FilteredObject_t f = obj(10.0f, 0.0f);
+    EXPECT_EQ(occ_grid_build(nullptr, &f, 1, &lane, &ls), -1);
+    EXPECT_EQ(occ_grid_build(&grid, nullptr, 1, &lane, &ls), -1);
+    EXPECT_EQ(occ_grid_build(&grid, &f, -1, &lane, &ls), -1);
+    EXPECT_EQ(occ_grid_build(&grid, &f, 1, &lane, nullptr), -1);
+    ls.LS_Lane_Width = 0.0f;
+    EXPECT_EQ(occ_grid_build(&grid, &f, 1, &lane, &ls), -1);
+    EXPECT_EQ(grid.Object_Count, 0);
+    EXPECT_FALSE(occ_grid_lane_clear(&grid, OCC_LANE_EGO, 0.0f, 10.0f));
+
+    ls.LS_Lane_Width = 3.5f;
+    ASSERT_EQ(occ_grid_build(&grid, &f, 1, &lane, &ls), 0);
+    EXPECT_FLOAT_EQ(occ_grid_free_distance(nullptr, -1.0f, 1.0f), -1.0f);
+    EXPECT_FLOAT_EQ(occ_grid_free_distance(&grid, 1.0f, -1.0f), -1.0f);
+    EXPECT_FALSE(occ_grid_lane_clear(nullptr, OCC_LANE_EGO, 0.0f, 10.0f));
+    EXPECT_FALSE(occ_grid_lane_clear(&grid, OCC_LANE_EGO, 10.0f, 0.0f));
+    EXPECT_FALSE(occ_grid_lane_clear(&grid, (OccLane_e)2, 0.0f, 10.0f));
+}
@@ -0,0 +1,297 @@
+#include <math.h>
+#include <string.h>
+
+#include "scene_generator.h"
+
+#define RAD2DEG     57.29578f
+
+/*─────────────────────────────
+  난수 유틸 (LCG, golden_trace 와 같은 방식)
+─────────────────────────────*/
+static uint32_t rng_next(uint32_t *s)
+{
+    *s = *s * 1664525u + 1013904223u;
+    return *s;
+}
+
+static float uni(SceneGen_t *g, float lo, float hi)
+{
+    return lo + (hi - lo) * (float)(rng_next(&g->Rng) >> 8) / 16777216.0f;
+}
+
+/*─────────────────────────────
+  차로 기하
+─────────────────────────────*/
+static float lane_center(const SceneGenConfig_t *c, int lane)
+{
+    return (float)(c->Ego_Lane - lane) * c->Lane_Width;
+}
+
+static float oncoming_center(const SceneGenConfig_t *c, int k)
+{
+    return (float)(c->Ego_Lane + 1 + k) * c->Lane_Width;
+}
+
+static float road_right_edge(const SceneGenConfig_t *c)
+{
+    return lane_center(c, c->Lanes - 1) - 0.5f * c->Lane_Width;
+}
+
+/* 반대 차로가 없으면 oncoming_center(c, -1) == lane_center(c, 0) */
+static float road_left_edge(const SceneGenConfig_t *c)
+{
+    return oncoming_center(c, c->Oncoming_Lanes - 1) + 0.5f * c->Lane_Width;
+}
+
+static void next_segment(SceneGen_t *g)
+{
+    g->Curvature       = g->Next_Curvature;
+    g->Curve_Sign      = g->Next_Curve_Sign;
+    g->Next_Curvature  = (uni(g, 0.0f, 1.0f) < g->Cfg.Curve_Ratio) ? uni(g, 150.0f, 1500.0f) : 0.0f;
+    g->Next_Curve_Sign = (rng_next(&g->Rng) & 0x10000u) ? 1.0f : -1.0f;
+    g->Segment_Left   = uni(g, 200.0f, 1000.0f);
+}
+
+/*─────────────────────────────
+  객체 생성 (종류 유지, 새 ID)
+─────────────────────────────*/
+static void spawn(SceneGen_t *g, int i, float x)
+{
+    const SceneGenConfig_t *c = &g->Cfg;
+    ObjectData_t       *o  = &g->Obj[i];
+    SceneGenObjState_t *st = &g->State[i];
+    float side = (rng_next(&g->Rng) & 0x10000u) ? 1.0f : -1.0f;
+
+    memset(o, 0, sizeof(*o));
+    o->Object_ID     = g->Next_Id++;
+    o->Object_Type   = OBJTYPE_CAR;
+    o->Object_Status = OBJSTAT_MOVING;
+    o->Position_X    = x;
+
+    st->Lateral_Speed = 0.0f;
+    st->Maneuver      = SCENE_MANEUVER_KEEP;
+    st->Lane          = 0;
+
+    switch ((SceneObjectKind_e)st->Kind) {
+    case SCENE_OBJ_VEHICLE:
+        st->Lane   = (uint8_t)((rng_next(&g->Rng) >> 16) % (uint32_t)c->Lanes);
+        st->Lane_Y = lane_center(c, st->Lane) + uni(g, -0.3f, 0.3f);
+        o->Velocity_X = c->Ego_Velocity * uni(g, 0.7f, 1.2f);
+        if (((rng_next(&g->Rng) >> 16) & 7u) == 0u) o->Object_Type = OBJTYPE_MOTORCYCLE;
+        break;
+    case SCENE_OBJ_STOPPED:
+        st->Lane   = (uint8_t)((rng_next(&g->Rng) >> 16) % (uint32_t)c->Lanes);
+        st->Lane_Y = lane_center(c, st->Lane) + uni(g, -0.3f, 0.3f);
+        o->Object_Status = OBJSTAT_STOPPED;
+        break;
+    case SCENE_OBJ_PEDESTRIAN:
+        /* 도로 바깥 한쪽에서 반대쪽으로 횡단 */
+        o->Object_Type    = OBJTYPE_PEDESTRIAN;
+        st->Lane_Y        = (side > 0.0f) ? road_left_edge(c) + uni(g, 0.5f, 3.0f)
+                                          : road_right_edge(c) - uni(g, 0.5f, 3.0f);
+        st->Lateral_Speed = -side * uni(g, 0.8f, 1.8f);
+        break;
+    case SCENE_OBJ_BICYCLE:
+        o->Object_Type = OBJTYPE_BICYCLE;
+        st->Lane       = (uint8_t)(c->Lanes - 1);
+        st->Lane_Y     = road_right_edge(c) + uni(g, 0.4f, 0.9f);
+        o->Velocity_X  = uni(g, 3.0f, 8.0f);
+        break;
+    default: /* SCENE_OBJ_ONCOMING */
+        st->Lane         = (uint8_t)((rng_next(&g->Rng) >> 16) % (uint32_t)c->Oncoming_Lanes);
+        st->Lane_Y       = oncoming_center(c, st->Lane) + uni(g, -0.3f, 0.3f);
+        o->Velocity_X    = -uni(g, 15.0f, 30.0f);
+        o->Object_Status = OBJSTAT_ONCOMING;
+        break;
+    }
+    st->Target_Y = st->Lane_Y;
+}
+
+/* 차량 차로 변경 시작 (인접 차로) */
+static void start_lane_change(SceneGen_t *g, int i)
+{
+    const SceneGenConfig_t *c = &g->Cfg;
+    SceneGenObjState_t *st = &g->State[i];
+    int from = st->Lane;
+    int to   = from + (((rng_next(&g->Rng) >> 16) & 1u) ? 1 : -1);
+
+    if (to < 0 || to >= c->Lanes) to = from - (to - from);
+    if (to < 0 || to >= c->Lanes) return;                   /* 1 차로 */
+
+    st->Target_Y      = lane_center(c, to);
+    st->Lateral_Speed = ((st->Target_Y > st->Lane_Y) ? 1.0f : -1.0f) * uni(g, 0.5f, 1.5f);
+    st->Lane          = (uint8_t)to;
+    if (to == c->Ego_Lane) {
+        st->Maneuver = SCENE_MANEUVER_CUT_IN;
+        g->Cut_In_Count++;
+    } else if (from == c->Ego_Lane) {
+        st->Maneuver = SCENE_MANEUVER_CUT_OUT;
+        g->Cut_Out_Count++;
+    } else {
+        st->Maneuver = SCENE_MANEUVER_CHANGE;
+    }
+}
+
+/*─────────────────────────────
+  공개 함수
+─────────────────────────────*/
+void scene_gen_default_config(SceneGenConfig_t *pCfg, int32_t objectCount)
+{
+    if (!pCfg) return;
+
+    memset(pCfg, 0, sizeof(*pCfg));
+    pCfg->Seed             = 1u;
+    pCfg->Object_Count     = objectCount;
+    pCfg->Lanes            = 3;
+    pCfg->Ego_Lane         = 1;
+    pCfg->Oncoming_Lanes   = 1;
+    pCfg->Lane_Width       = 3.5f;
+    pCfg->Range_Front      = 250.0f;
+    pCfg->Range_Rear       = 50.0f;
+    pCfg->Ego_Velocity     = 27.8f;
+    pCfg->Pedestrian_Ratio = 0.05f;
+    pCfg->Bicycle_Ratio    = 0.05f;
+    pCfg->Oncoming_Ratio   = 0.20f;
+    pCfg->Stopped_Ratio    = 0.02f;
+    pCfg->Lane_Change_Rate = 0.05f;
+    pCfg->Curve_Ratio      = 0.4f;
+    pCfg->Dt               = 0.01f;
+}
+
+int scene_gen_init(SceneGen_t *pGen, const SceneGenConfig_t *pCfg)
+{
+    if (!pGen || !pCfg) return -1;
+
+    const SceneGenConfig_t *c = pCfg;
+    float ratioSum = c->Pedestrian_Ratio + c->Bicycle_Ratio + c->Oncoming_Ratio + c->Stopped_Ratio;
+    if (c->Lanes < 1 || c->Lanes > SCENE_GEN_MAX_LANES ||
+        c->Ego_Lane < 0 || c->Ego_Lane >= c->Lanes ||
+        c->Oncoming_Lanes < 0 || c->Oncoming_Lanes > SCENE_GEN_MAX_LANES ||
+        !(c->Lane_Width > 0.0f) || !(c->Range_Front > 0.0f) || !(c->Range_Rear >= 0.0f) ||
+        !(c->Dt > 0.0f) || !(c->Ego_Velocity >= 0.0f) ||
+        !(c->Pedestrian_Ratio >= 0.0f) || !(c->Bicycle_Ratio >= 0.0f) ||
+        !(c->Oncoming_Ratio >= 0.0f) || !(c->Stopped_Ratio >= 0.0f) || !(ratioSum <= 1.0f) ||
+        (c->Oncoming_Lanes == 0 && c->Oncoming_Ratio > 0.0f) ||
+        !(c->Lane_Change_Rate >= 0.0f) || !(c->Curve_Ratio >= 0.0f) || !(c->Curve_Ratio <= 1.0f)) {
+        return -1;
+    }
+
+    float count = (c->Density > 0.0f)
+                ? c->Density * (float)c->Lanes * (c->Range_Front + c->Range_Rear) / 1000.0f
+                : (float)c->Object_Count;
+    if (!(count >= 1.0f) || count > (float)SCENE_GEN_MAX_OBJECTS) return -1;
+
+    memset(pGen, 0, sizeof(*pGen));
+    pGen->Cfg     = *c;
+    pGen->Count   = (int32_t)count;
+    pGen->Next_Id = 1;
+    pGen->Rng     = (uint32_t)(c->Seed ^ (c->Seed >> 32)) * 2654435761u | 1u;
+    pGen->Lane_Phase = uni(pGen, 0.0f, 6.2831853f);
+    next_segment(pGen);
+    next_segment(pGen);
+
+    for (int i = 0; i < pGen->Count; i++) {
+        float u = uni(pGen, 0.0f, 1.0f);
+        SceneObjectKind_e kind;
+        if      ((u -= c->Pedestrian_Ratio) < 0.0f) kind = SCENE_OBJ_PEDESTRIAN;
+        else if ((u -= c->Bicycle_Ratio)    < 0.0f) kind = SCENE_OBJ_BICYCLE;
+        else if ((u -= c->Oncoming_Ratio)   < 0.0f) kind = SCENE_OBJ_ONCOMING;
+        else if ((u -= c->Stopped_Ratio)    < 0.0f) kind = SCENE_OBJ_STOPPED;
+        else                                        kind = SCENE_OBJ_VEHICLE;
+        pGen->State[i].Kind = (uint8_t)kind;
+        spawn(pGen, i, uni(pGen, -c->Range_Rear, c->Range_Front));
+    }
+    return 0;
+}
+
+int scene_gen_step(SceneGen_t *pGen, EgoData_t *pEgo, LaneData_t *pLane)
+{
+    if (!pGen) return -1;
+
+    SceneGen_t *g = pGen;
+    const SceneGenConfig_t *c = &g->Cfg;
+    const float dt    = c->Dt;
+    const float span  = c->Range_Front + c->Range_Rear;
+    const float rightY = road_right_edge(c) - 3.5f;
+    const float leftY  = road_left_edge(c) + 3.5f;
+    const float pChange = c->Lane_Change_Rate * dt;
+
+    g->Step++;
+    g->Segment_Left -= c->Ego_Velocity * dt;
+    if (g->Segment_Left <= 0.0f) {
+        next_segment(g);
+    }
+    g->Lane_Phase += 0.002f;
+    if (g->Lane_Phase > 6.2831853f) g->Lane_Phase -= 6.2831853f;
+    g->Lane_Offset = 0.3f * sinf(g->Lane_Phase);
+
+    /* 곡선 : y += k·x², heading = atan(2k·x) */
+    const float k = (g->Curvature > 0.0f) ? g->Curve_Sign * 0.5f / g->Curvature : 0.0f;
+
+    for (int i = 0; i < g->Count; i++) {
+        ObjectData_t       *o  = &g->Obj[i];
+        SceneGenObjState_t *st = &g->State[i];
+
+        /* 종방향 이동 + 범위 순환 (빠져나간 객체는 반대편 끝에서 새 객체로) */
+        o->Position_X += (o->Velocity_X - c->Ego_Velocity) * dt;
+        if (o->Position_X > c->Range_Front) {
+            spawn(g, i, o->Position_X - span);
+        } else if (o->Position_X < -c->Range_Rear) {
+            spawn(g, i, o->Position_X + span);
+        }
+
+        /* 횡방향 기동 */
+        if (st->Kind == SCENE_OBJ_VEHICLE) {
+            if (st->Maneuver == SCENE_MANEUVER_KEEP) {
+                if (pChange > 0.0f && uni(g, 0.0f, 1.0f) < pChange) {
+                    start_lane_change(g, i);
+                }
+            } else {
+                st->Lane_Y += st->Lateral_Speed * dt;
+                if ((st->Lateral_Speed > 0.0f) ? (st->Lane_Y >= st->Target_Y)
+                                               : (st->Lane_Y <= st->Target_Y)) {
+                    st->Lane_Y        = st->Target_Y;
+                    st->Lateral_Speed = 0.0f;
+                    st->Maneuver      = SCENE_MANEUVER_KEEP;
+                }
+            }
+        } else if (st->Kind == SCENE_OBJ_PEDESTRIAN) {
+            st->Lane_Y += st->Lateral_Speed * dt;
+            if (st->Lane_Y < rightY || st->Lane_Y > leftY) {
+                spawn(g, i, o->Position_X);
+            }
+        }
+
+        float x = o->Position_X;
+        o->Position_Y = g->Lane_Offset + st->Lane_Y + k * x * x;
+        o->Velocity_Y = st->Lateral_Speed;
+
+        float tangent = (k != 0.0f) ? atanf(2.0f * k * x) * RAD2DEG : 0.0f;
+        if (st->Kind == SCENE_OBJ_PEDESTRIAN) {
+            o->Heading = (st->Lateral_Speed > 0.0f) ? 90.0f : -90.0f;
+        } else if (st->Kind == SCENE_OBJ_ONCOMING) {
+            o->Heading = (tangent > 0.0f) ? tangent - 180.0f : tangent + 180.0f;
+        } else {
+            float vx = (o->Velocity_X > 1.0f) ? o->Velocity_X : 1.0f;
+            o->Heading = tangent + atanf(st->Lateral_Speed / vx) * RAD2DEG;
+        }
+        o->Distance = sqrtf(x * x + o->Position_Y * o->Position_Y);
+    }
+
+    if (pEgo) {
+        memset(pEgo, 0, sizeof(*pEgo));
+        pEgo->Ego_Velocity_X = c->Ego_Velocity;
+        pEgo->Ego_Yaw_Rate   = (g->Curvature > 0.0f)
+                             ? g->Curve_Sign * c->Ego_Velocity / g->Curvature * RAD2DEG : 0.0f;
+    }
+    if (pLane) {
+        pLane->Lane_Curvature      = g->Curve_Sign * g->Curvature;          /* 부호 있는 반경 (+ 좌) */
+        pLane->Next_Lane_Curvature = g->Next_Curve_Sign * g->Next_Curvature;
+        pLane->Lane_Type           = (fabsf(pLane->Lane_Curvature) > 0.0f) ? LANE_TYPE_CURVE : LANE_TYPE_STRAIGHT;
+        pLane->Lane_Offset         = g->Lane_Offset;
+        pLane->Lane_Heading        = 2.0f * cosf(g->Lane_Phase);
+        pLane->Lane_Width          = c->Lane_Width;
+        pLane->Lane_Change_Status  = LANE_CHANGE_KEEP;
+    }
+    return g->Count;
+}
@@ -0,0 +1,116 @@
+/****************************************************************************
+ * scene_generator.h
+ *
+ * - 대규모 합성 장면 생성기 : 재현 가능한 ObjectData_t / LaneData_t 스트림
+ *   (수천 개 객체, 디스크 I/O 없이 메모리에서 바로 생성 → 처리량 벤치마크 입력)
+ * - 좌표계 : Ego 기준 (X 전방, Y 좌측), 차로 번호 0 = 가장 왼쪽 동방향 차로
+ * - 객체 종류 : 동방향 차량(차로 유지 / 차로 변경 → Cut-in, Cut-out), 정지 차량,
+ *               보행자(횡단), 자전거(우측 가장자리), 반대 차로 차량
+ * - 곡선 구간 : 객체 Y = 차로 중심 + 부호 × X² / (2R), Heading = 접선 방향
+ *               LaneData_t 에 같은 반경(Lane_Curvature) 과 다음 구간 반경 출력
+ *               (부호 있는 반경 : + 좌곡선, - 우곡선 → lane_geometry / bucket_targets_by_lane /
+ *                occupancy_grid 와 같은 규약, 0 = 직선)
+ * - SceneGen_t 는 크다 (SCENE_GEN_MAX_OBJECTS 기준 ~300 KB) → static 또는 힙에 둘 것
+ ****************************************************************************/
+#ifndef SCENE_GENERATOR_H
+#define SCENE_GENERATOR_H
+
+#include <stdint.h>
+#include "adas_shared.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SCENE_GEN_MAX_OBJECTS   4096
+#define SCENE_GEN_MAX_LANES     8
+
+/* 객체 종류 */
+typedef enum {
+    SCENE_OBJ_VEHICLE = 0,      /* 동방향 차량 */
+    SCENE_OBJ_STOPPED,          /* 정지 차량 */
+    SCENE_OBJ_PEDESTRIAN,       /* 횡단 보행자 */
+    SCENE_OBJ_BICYCLE,          /* 우측 가장자리 자전거 */
+    SCENE_OBJ_ONCOMING          /* 반대 차로 차량 */
+} SceneObjectKind_e;
+
+/* 차량 횡방향 기동 */
+typedef enum {
+    SCENE_MANEUVER_KEEP = 0,
+    SCENE_MANEUVER_CUT_IN,      /* 옆 차로 → Ego 차로 */
+    SCENE_MANEUVER_CUT_OUT,     /* Ego 차로 → 옆 차로 */
+    SCENE_MANEUVER_CHANGE       /* 그 외 차로 변경 */
+} SceneManeuver_e;
+
+typedef struct {
+    uint64_t Seed;
+    int32_t  Object_Count;      /* 객체 수 (Density > 0 이면 무시) */
+    float    Density;           /* [대/km/차로] > 0 : 동방향 차로 수 × 범위로 객체 수 결정 */
+    int32_t  Lanes;             /* 동방향 차로 수 (1 ~ SCENE_GEN_MAX_LANES) */
+    int32_t  Ego_Lane;          /* Ego 차로 번호 (0 ~ Lanes-1) */
+    int32_t  Oncoming_Lanes;    /* 반대 차로 수 (0 ~ SCENE_GEN_MAX_LANES, 왼쪽) */
+    float    Lane_Width;        /* [m] */
+    float    Range_Front;       /* [m] 생성 범위 (전방) */
+    float    Range_Rear;        /* [m] 생성 범위 (후방) */
+    float    Ego_Velocity;      /* [m/s] */
+    float    Pedestrian_Ratio;  /* 종류 비율 (나머지 = 동방향 차량) */
+    float    Bicycle_Ratio;
+    float    Oncoming_Ratio;
+    float    Stopped_Ratio;
+    float    Lane_Change_Rate;  /* [1/s] 차량 1 대당 차로 변경 시작 빈도 */
+    float    Curve_Ratio;       /* 곡선 구간 비율 (0 ~ 1) */
+    float    Dt;                /* [s] 스텝 주기 */
+} SceneGenConfig_t;
+
+/* 객체별 내부 상태 */
+typedef struct {
+    float   Lane_Y;             /* 직선 기준 횡위치 (곡선 보정 전) */
+    float   Target_Y;           /* 차로 변경 목표 횡위치 */
+    float   Lateral_Speed;      /* [m/s] */
+    uint8_t Kind;               /* SceneObjectKind_e */
+    uint8_t Lane;
+    uint8_t Maneuver;           /* SceneManeuver_e */
+    uint8_t Reserved;
+} SceneGenObjState_t;
+
+typedef struct {
+    SceneGenConfig_t   Cfg;
+    uint32_t           Rng;
+    int32_t            Count;
+    int32_t            Next_Id;
+    int64_t            Step;
+    float              Lane_Offset;     /* Ego 의 차로 중심 대비 횡오프셋 */
+    float              Lane_Phase;
+    float              Curvature;       /* 현재 구간 반경 [m], 0 = 직선 */
+    float              Next_Curvature;
+    float              Curve_Sign;      /* +1 좌곡선, -1 우곡선 */
+    float              Next_Curve_Sign;
+    float              Segment_Left;    /* [m] 현재 구간 남은 거리 */
+    int64_t            Cut_In_Count;    /* 누적 기동 수 (검증/통계용) */
+    int64_t            Cut_Out_Count;
+    ObjectData_t       Obj[SCENE_GEN_MAX_OBJECTS];
+    SceneGenObjState_t State[SCENE_GEN_MAX_OBJECTS];
+} SceneGen_t;
+
+/** @brief 기본 구성 (3 차로 중 가운데 Ego, 반대 1 차로, 100 km/h, 10 ms) */
+void scene_gen_default_config(SceneGenConfig_t *pCfg, int32_t objectCount);
+
+/**
+ * @brief 생성기 초기화 (같은 구성·시드 → 같은 스트림)
+ * @return 0 on success, -1 : 인자/구성 오류 (객체 수 0 또는 SCENE_GEN_MAX_OBJECTS 초과 포함)
+ */
+int scene_gen_init(SceneGen_t *pGen, const SceneGenConfig_t *pCfg);
+
+/**
+ * @brief 1 스텝 진행 → pGen->Obj[0 .. return-1] 갱신 (복사 없이 그대로 선택 입력으로 사용)
+ * @param[out] pEgo  : NULL 가능. 속도/요레이트 기록
+ * @param[out] pLane : NULL 가능. 현재 구간 차로 정보
+ * @return 객체 수, -1 on invalid argument
+ */
+int scene_gen_step(SceneGen_t *pGen, EgoData_t *pEgo, LaneData_t *pLane);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SCENE_GENERATOR_H */
@@ -0,0 +1,251 @@
+/*********************************************************************
+ * scene_generator_test.cpp  ―  대규모 합성 장면 생성기
+ * DUT : scene_generator.c
+ *********************************************************************/
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <set>
+#include <vector>
+
+#include "scene_generator.h"
+#include "target_selection.h"
+#include "lane_selection.h"
+
+namespace {
+
+std::unique_ptr<SceneGen_t> make_gen(const SceneGenConfig_t &cfg)
+{
+    std::unique_ptr<SceneGen_t> g(new SceneGen_t);
+    EXPECT_EQ(scene_gen_init(g.get(), &cfg), 0);
+    return g;
+}
+
+} /* namespace */
+
+/* 같은 시드 → 같은 스트림, 다른 시드 → 다른 스트림 */
+TEST(SceneGeneratorTest, TC_SCENE_EQ_01_Reproducible)
+{
+    SceneGenConfig_t cfg;
+    scene_gen_default_config(&cfg, 2000);
+    auto a = make_gen(cfg);
+    auto b = make_gen(cfg);
+    cfg.Seed = 2u;
+    auto c = make_gen(cfg);
+
+    LaneData_t la, lb;
+    for (int s = 0; s < 300; s++) {
+        ASSERT_EQ(scene_gen_step(a.get(), nullptr, &la), 2000);
+        ASSERT_EQ(scene_gen_step(b.get(), nullptr, &lb), 2000);
+        scene_gen_step(c.get(), nullptr, nullptr);
+    }
+    EXPECT_EQ(std::memcmp(a->Obj, b->Obj, sizeof(ObjectData_t) * 2000), 0);
+    EXPECT_EQ(std::memcmp(&la, &lb, sizeof(la)), 0);
+    EXPECT_NE(std::memcmp(a->Obj, c->Obj, sizeof(ObjectData_t) * 2000), 0);
+}
+
+/* 종류 비율 / 종류별 운동 특성 */
+TEST(SceneGeneratorTest, TC_SCENE_EQ_02_Composition)
+{
+    SceneGenConfig_t cfg;
+    scene_gen_default_config(&cfg, 4000);
+    cfg.Pedestrian_Ratio = 0.1f;
+    cfg.Bicycle_Ratio    = 0.1f;
+    cfg.Oncoming_Ratio   = 0.2f;
+    cfg.Oncoming_Lanes   = 2;
+    auto g = make_gen(cfg);
+    for (int s = 0; s < 50; s++) scene_gen_step(g.get(), nullptr, nullptr);
+
+    int ped = 0, bic = 0, onc = 0;
+    for (int i = 0; i < g->Count; i++) {
+        const ObjectData_t &o = g->Obj[i];
+        if (o.Object_Type == OBJTYPE_PEDESTRIAN) {
+            ped++;
+            EXPECT_FLOAT_EQ(o.Velocity_X, 0.0f);
+            EXPECT_NE(o.Velocity_Y, 0.0f);
+        } else if (o.Object_Type == OBJTYPE_BICYCLE) {
+            bic++;
+            EXPECT_LT(o.Velocity_X, 8.01f);
+        } else if (o.Object_Status == OBJSTAT_ONCOMING) {
+            onc++;
+            EXPECT_LT(o.Velocity_X, 0.0f);
+            EXPECT_GT(std::fabs(o.Heading), 150.0f);
+        }
+    }
+    EXPECT_NEAR(ped, 400, 80);
+    EXPECT_NEAR(bic, 400, 80);
+    EXPECT_NEAR(onc, 800, 120);
+}
+
+/* Cut-in / Cut-out : Ego 차로 진입/이탈 기동 발생, 진행 중 횡속도 방향 일치 */
+TEST(SceneGeneratorTest, TC_SCENE_EQ_03_CutInCutOut)
+{
+    SceneGenConfig_t cfg;
+    scene_gen_default_config(&cfg, 1000);
+    cfg.Lane_Change_Rate = 0.5f;
+    cfg.Curve_Ratio      = 0.0f;
+    auto g = make_gen(cfg);
+
+    bool sawCutIn = false, sawCutOut = false;
+    for (int s = 0; s < 500; s++) {
+        scene_gen_step(g.get(), nullptr, nullptr);
+        for (int i = 0; i < g->Count; i++) {
+            const SceneGenObjState_t &st = g->State[i];
+            if (st.Maneuver == SCENE_MANEUVER_CUT_IN) {
+                sawCutIn = true;
+                /* Ego 차로 중심(Lane_Y = 0) 방향으로 이동 */
+                EXPECT_LT(st.Lateral_Speed * st.Lane_Y, 0.0f);
+            } else if (st.Maneuver == SCENE_MANEUVER_CUT_OUT) {
+                sawCutOut = true;
+                EXPECT_EQ(st.Lateral_Speed * st.Target_Y > 0.0f, true);
+            }
+        }
+    }
+    EXPECT_TRUE(sawCutIn);
+    EXPECT_TRUE(sawCutOut);
+    EXPECT_GT(g->Cut_In_Count, 0);
+    EXPECT_GT(g->Cut_Out_Count, 0);
+}
+
+/* 곡선 구간 : LaneData 반경과 객체 횡위치(Y = 중심 + X²/2R) 일치 */
+TEST(SceneGeneratorTest, TC_SCENE_EQ_04_CurvedLane)
+{
+    SceneGenConfig_t cfg;
+    scene_gen_default_config(&cfg, 500);
+    cfg.Curve_Ratio      = 1.0f;
+    cfg.Lane_Change_Rate = 0.0f;
+    cfg.Pedestrian_Ratio = cfg.Bicycle_Ratio = cfg.Oncoming_Ratio = cfg.Stopped_Ratio = 0.0f;
+    auto g = make_gen(cfg);
+
+    LaneData_t lane;
+    EgoData_t  ego;
+    for (int s = 0; s < 5; s++) scene_gen_step(g.get(), &ego, &lane);
+    ASSERT_EQ(lane.Lane_Type, LANE_TYPE_CURVE);
+    EXPECT_GE(std::fabs(lane.Lane_Curvature), 150.0f);
+    EXPECT_LE(std::fabs(lane.Lane_Curvature), 1500.0f);
+    EXPECT_NE(lane.Next_Lane_Curvature, 0.0f);
+    EXPECT_NEAR(ego.Ego_Yaw_Rate, cfg.Ego_Velocity / lane.Lane_Curvature * 57.29578f, 1e-3f);
+
+    for (int i = 0; i < g->Count; i++) {
+        const ObjectData_t &o = g->Obj[i];
+        float bend = o.Position_Y - lane.Lane_Offset - g->State[i].Lane_Y;
+        EXPECT_NEAR(bend, o.Position_X * o.Position_X / (2.0f * lane.Lane_Curvature),
+                    1e-2f + 1e-4f * std::fabs(bend));
+    }
+}
+
+/* 좌 / 우 곡선 모두 : 부호 있는 반경으로 bucket_targets_by_lane 이 Ego 차로 객체를 Ego 버킷에 */
+TEST(SceneGeneratorTest, TC_SCENE_EQ_05_SignedCurveBuckets)
+{
+    SceneGenConfig_t cfg;
+    scene_gen_default_config(&cfg, 300);
+    cfg.Curve_Ratio      = 1.0f;
+    cfg.Lane_Change_Rate = 0.0f;
+    cfg.Pedestrian_Ratio = cfg.Bicycle_Ratio = cfg.Oncoming_Ratio = cfg.Stopped_Ratio = 0.0f;
+    auto g = make_gen(cfg);
+
+    LaneData_t lane;
+    EgoData_t  ego;
+    int seen[2] = { 0, 0 };                                 /* 우, 좌 곡선 틱 수 */
+    for (int s = 0; s < 20000 && (seen[0] < 3 || seen[1] < 3); s++) {
+        scene_gen_step(g.get(), &ego, &lane);
+        if (lane.Lane_Curvature == 0.0f || s % 50 != 0) continue;
+        seen[lane.Lane_Curvature > 0.0f]++;
+        EXPECT_EQ(lane.Lane_Curvature > 0.0f, ego.Ego_Yaw_Rate > 0.0f);   /* 좌곡선 = 좌선회 */
+        EXPECT_EQ(lane.Lane_Type, LANE_TYPE_CURVE);
+
+        /* 좌 / 우 모두 |반경| 으로 곡선 판정 */
+        LaneSelectOutput_t ls = {};
+        ASSERT_EQ(LaneSelection(&lane, &ego, &ls), 0);
+        EXPECT_EQ(ls.LS_Is_Curved_Lane, std::fabs(lane.Lane_Curvature) < LANE_CURVE_THRESHOLD)
+            << "R=" << lane.Lane_Curvature;
+        for (int i = 0; i < g->Count; i++) {
+            const ObjectData_t &o = g->Obj[i];
+            if (g->State[i].Lane_Y != 0.0f || std::fabs(o.Position_X) < 40.0f) continue;
+            PredictedObject_t p = {};
+            p.Predicted_Position_X = o.Position_X;
+            p.Predicted_Position_Y = o.Position_Y;
+            p.Predicted_Distance   = o.Distance;
+            TargetLaneBuckets_t b;
+            ASSERT_EQ(bucket_targets_by_lane(&p, 1, &lane, &ls, &b), 0);
+            EXPECT_EQ(b.Lane[TGT_LANE_EGO].Count, 1)
+                << "R=" << lane.Lane_Curvature << " x=" << o.Position_X << " y=" << o.Position_Y;
+        }
+    }
+    EXPECT_GE(seen[0], 3);
+    EXPECT_GE(seen[1], 3);
+}
+
+/* 범위 / ID 유일성 / 밀도 → 객체 수 */
+TEST(SceneGeneratorTest, TC_SCENE_BV_01_RangeAndDensity)
+{
+    SceneGenConfig_t cfg;
+    scene_gen_default_config(&cfg, 3000);
+    auto g = make_gen(cfg);
+    for (int s = 0; s < 2000; s++) scene_gen_step(g.get(), nullptr, nullptr);
+
+    std::set<int> ids;
+    for (int i = 0; i < g->Count; i++) {
+        EXPECT_LE(g->Obj[i].Position_X, cfg.Range_Front);
+        EXPECT_GE(g->Obj[i].Position_X, -cfg.Range_Rear);
+        ids.insert(g->Obj[i].Object_ID);
+    }
+    EXPECT_EQ((int)ids.size(), g->Count);
+    EXPECT_GT(g->Next_Id, 3000);    /* 범위 이탈 객체 재생성 */
+
+    cfg.Density = 1000.0f;          /* 1000 대/km/차로 × 3 차로 × 0.3 km */
+    auto d = make_gen(cfg);
+    EXPECT_EQ(d->Count, 900);
+    cfg.Density = 5000.0f;          /* 4500 > 최대 */
+    SceneGen_t *tmp = new SceneGen_t;
+    EXPECT_EQ(scene_gen_init(tmp, &cfg), -1);
+    delete tmp;
+}
+
+/* 대규모 객체 리스트를 그대로 Target Selection 입력으로 */
+TEST(SceneGeneratorTest, TC_SCENE_BV_02_DrivesTargetSelection)
+{
+    SceneGenConfig_t cfg;
+    scene_gen_default_config(&cfg, SCENE_GEN_MAX_OBJECTS);
+    auto g = make_gen(cfg);
+
+    std::vector<FilteredObject_t> filtered(SCENE_GEN_MAX_OBJECTS);
+    LaneData_t lane;
+    EgoData_t  ego;
+    LaneSelectOutput_t ls;
+    int total = 0;
+    for (int s = 0; s < 20; s++) {
+        int n = scene_gen_step(g.get(), &ego, &lane);
+        ASSERT_EQ(n, SCENE_GEN_MAX_OBJECTS);
+        ASSERT_EQ(LaneSelection(&lane, &ego, &ls), 0);
+        int f = select_target_from_object_list(g->Obj, n, &ego, &ls, filtered.data(),
+                                               (int)filtered.size());
+        EXPECT_GE(f, 0);
+        EXPECT_LT(f, n);
+        total += f;
+    }
+    EXPECT_GT(total, 0);
+}
+
+/* 무효 구성 */
+TEST(SceneGeneratorTest, TC_SCENE_RA_01_InvalidConfig)
+{
+    std::unique_ptr<SceneGen_t> g(new SceneGen_t);
+    SceneGenConfig_t base;
+    scene_gen_default_config(&base, 100);
+
+    EXPECT_EQ(scene_gen_init(nullptr, &base), -1);
+    EXPECT_EQ(scene_gen_init(g.get(), nullptr), -1);
+    EXPECT_EQ(scene_gen_step(nullptr, nullptr, nullptr), -1);
+
+    SceneGenConfig_t c = base; c.Object_Count = 0;                         EXPECT_EQ(scene_gen_init(g.get(), &c), -1);
+    c = base; c.Object_Count = SCENE_GEN_MAX_OBJECTS + 1;                  EXPECT_EQ(scene_gen_init(g.get(), &c), -1);
+    c = base; c.Lanes = 0;                                                 EXPECT_EQ(scene_gen_init(g.get(), &c), -1);
+    c = base; c.Ego_Lane = 3;                                              EXPECT_EQ(scene_gen_init(g.get(), &c), -1);
+    c = base; c.Oncoming_Lanes = 0;                                        EXPECT_EQ(scene_gen_init(g.get(), &c), -1);
+    c = base; c.Pedestrian_Ratio = 0.9f;                                   EXPECT_EQ(scene_gen_init(g.get(), &c), -1);
+    c = base; c.Dt = 0.0f;                                                 EXPECT_EQ(scene_gen_init(g.get(), &c), -1);
+    c = base; c.Curve_Ratio = NAN;                                         EXPECT_EQ(scene_gen_init(g.get(), &c), -1);
+    c = base; c.Oncoming_Lanes = 0; c.Oncoming_Ratio = 0.0f;               EXPECT_EQ(scene_gen_init(g.get(), &c), 0);
+}
@@ -0,0 +1,323 @@
+#include <math.h>
+#include <string.h>
+
+#include "sensor_association.h"
+
+#define ASSOC_INF   1.0e30f
+#define RAD2DEG     57.29578f
+
+/*─────────────────────────────
+  격자
+─────────────────────────────*/
+/* float 단계에서 [0, n-1] 로 먼저 자른 뒤 변환 (격자 밖 먼 검출도 int 범위 안) */
+static int grid_coord(float v, float lo, float cell, int n)
+{
+    float k = floorf((v - lo) / cell);
+    if (k < 0.0f)             k = 0.0f;
+    if (k > (float)(n - 1))   k = (float)(n - 1);
+    return (int)k;
+}
+
+static int grid_cell(const SensorAssociation_t *a, float x, float y)
+{
+    int cx = grid_coord(x, -a->Cfg.Range_Rear, a->Cfg.Max_Gate_Distance, a->Grid_Nx);
+    int cy = grid_coord(y, -a->Cfg.Half_Width, a->Cfg.Max_Gate_Distance, a->Grid_Ny);
+    return cy * a->Grid_Nx + cx;
+}
+
+/* 위치 유한 + 분산 > 0 (NaN 포함 거부) */
+static int detection_is_valid(const SensorDetection_t *d)
+{
+    return isfinite(d->Position_X) && isfinite(d->Position_Y) &&
+           d->Var_X > 0.0f && d->Var_Y > 0.0f;
+}
+
+/*─────────────────────────────
+  간선 추가 (행 슬롯이 차면 가장 비싼 간선과 교체)
+─────────────────────────────*/
+static void add_edge(SensorAssociation_t *a, int r, int c, float cost)
+{
+    int32_t *cols  = &a->Edge_Col[r * ASSOC_MAX_EDGES_PER_ROW];
+    float   *costs = &a->Edge_Cost[r * ASSOC_MAX_EDGES_PER_ROW];
+    int      n     = a->Row_Edges[r];
+
+    if (n < ASSOC_MAX_EDGES_PER_ROW) {
+        cols[n]  = c;
+        costs[n] = cost;
+        a->Row_Edges[r] = n + 1;
+        a->Edge_Count++;
+        return;
+    }
+    int worst = 0;
+    for (int e = 1; e < n; e++) {
+        if (costs[e] > costs[worst]) worst = e;
+    }
+    a->Edge_Dropped++;
+    if (cost < costs[worst]) {
+        cols[worst]  = c;
+        costs[worst] = cost;
+    }
+}
+
+static void build_edges(SensorAssociation_t *a,
+                        const SensorDetection_t *pRadar, int nR,
+                        const SensorDetection_t *pCam, int nC)
+{
+    const float gate = a->Cfg.Gate_Chi2;
+    const float maxD = a->Cfg.Max_Gate_Distance;
+
+    for (int j = 0; j < nC; j++) {
+        int cell = grid_cell(a, pCam[j].Position_X, pCam[j].Position_Y);
+        a->Camera_Cell[j]    = cell;
+        a->Cell_Next[j]      = a->Cell_Head[cell];
+        a->Cell_Head[cell]   = j;
+    }
+
+    for (int r = 0; r < nR; r++) {
+        const SensorDetection_t *rd = &pRadar[r];
+        int cx = grid_coord(rd->Position_X, -a->Cfg.Range_Rear, maxD, a->Grid_Nx);
+        int cy = grid_coord(rd->Position_Y, -a->Cfg.Half_Width, maxD, a->Grid_Ny);
+
+        a->Row_Edges[r] = 0;
+        for (int gy = cy - 1; gy <= cy + 1; gy++) {
+            if (gy < 0 || gy >= a->Grid_Ny) continue;
+            for (int gx = cx - 1; gx <= cx + 1; gx++) {
+                if (gx < 0 || gx >= a->Grid_Nx) continue;
+                for (int j = a->Cell_Head[gy * a->Grid_Nx + gx]; j >= 0; j = a->Cell_Next[j]) {
+                    float dx = rd->Position_X - pCam[j].Position_X;
+                    float dy = rd->Position_Y - pCam[j].Position_Y;
+                    if (fabsf(dx) > maxD || fabsf(dy) > maxD) continue;
+                    float d2 = dx * dx / (rd->Var_X + pCam[j].Var_X)
+                             + dy * dy / (rd->Var_Y + pCam[j].Var_Y);
+                    if (d2 < gate) {
+                        add_edge(a, r, j, d2);
+                    }
+                }
+            }
+        }
+    }
+
+    /* 사용한 셀만 되돌림 */
+    for (int j = 0; j < nC; j++) {
+        a->Cell_Head[a->Camera_Cell[j]] = -1;
+    }
+}
+
+/*─────────────────────────────
+  최단 증가 경로 할당
+   - 열 0..nC-1 : 카메라, 열 nC+r : 레이더 r 전용 미할당 열 (비용 missCost)
+   - 축약 비용 c(i,j) - u_i - v_j >= 0 유지, u_i = c(i, 할당 열) - v(할당 열)
+─────────────────────────────*/
+static void relax_row(SensorAssociation_t *a, int nC, int i, float base, float ui,
+                      float missCost, int *pTouched)
+{
+    const int32_t *cols  = &a->Edge_Col[i * ASSOC_MAX_EDGES_PER_ROW];
+    const float   *costs = &a->Edge_Cost[i * ASSOC_MAX_EDGES_PER_ROW];
+    const int      n     = a->Row_Edges[i];
+
+    for (int e = 0; e <= n; e++) {
+        int   c    = (e < n) ? cols[e]  : nC + i;
+        float cost = (e < n) ? costs[e] : missCost;
+        if (a->Col_Done[c]) continue;
+        float nd = base + cost - a->Col_V[c] - ui;
+        if (nd < a->Col_Dist[c]) {
+            if (a->Col_Dist[c] >= ASSOC_INF) {
+                a->Touched[(*pTouched)++] = c;
+            }
+            a->Col_Dist[c]      = nd;
+            a->Col_Pred[c]      = i;
+            a->Col_Pred_Cost[c] = cost;
+        }
+    }
+}
+
+static void solve(SensorAssociation_t *a, int nR, int nC)
+{
+    const int   cols     = nC + nR;
+    const float missCost = a->Cfg.Gate_Chi2;
+
+    for (int c = 0; c < cols; c++) {
+        a->Col_V[c]    = 0.0f;
+        a->Col_Row[c]  = -1;
+        a->Col_Dist[c] = ASSOC_INF;
+        a->Col_Done[c] = 0;
+    }
+
+    for (int r0 = 0; r0 < nR; r0++) {
+        int touched = 0;
+        int scanned = 0;    /* Touched[0 .. scanned-1] 를 확정 열 목록으로 재배치 */
+        int final   = -1;
+
+        relax_row(a, nC, r0, 0.0f, 0.0f, missCost, &touched);
+
+        for (;;) {
+            /* 미확정 열 중 최소 거리 */
+            int best = scanned;
+            for (int t = scanned + 1; t < touched; t++) {
+                if (a->Col_Dist[a->Touched[t]] < a->Col_Dist[a->Touched[best]]) best = t;
+            }
+            int j = a->Touched[best];
+            a->Touched[best]    = a->Touched[scanned];
+            a->Touched[scanned] = j;
+            scanned++;
+            a->Col_Done[j] = 1;
+
+            if (a->Col_Row[j] < 0) {
+                final = j;
+                break;
+            }
+            int   i  = a->Col_Row[j];
+            float ui = a->Row_Cost[i] - a->Col_V[j];
+            relax_row(a, nC, i, a->Col_Dist[j], ui, missCost, &touched);
+        }
+
+        /* 열 퍼텐셜 갱신 (확정 열, 최종 열 제외) */
+        const float dmin = a->Col_Dist[final];
+        for (int t = 0; t < scanned - 1; t++) {
+            int k = a->Touched[t];
+            a->Col_V[k] += a->Col_Dist[k] - dmin;
+        }
+
+        /* 증가 경로 반전 */
+        for (int j = final;;) {
+            int i    = a->Col_Pred[j];
+            int prev = a->Row_Col[i];
+            a->Col_Row[j]  = i;
+            a->Row_Cost[i] = a->Col_Pred_Cost[j];
+            a->Row_Col[i]  = j;
+            if (i == r0) break;
+            j = prev;
+        }
+
+        for (int t = 0; t < touched; t++) {
+            int k = a->Touched[t];
+            a->Col_Dist[k] = ASSOC_INF;
+            a->Col_Done[k] = 0;
+        }
+    }
+}
+
+/*─────────────────────────────
+  융합
+─────────────────────────────*/
+static void fill_object(ObjectData_t *o, int id, ObjectType_e type,
+                        float x, float y, float vx, float vy)
+{
+    memset(o, 0, sizeof(*o));
+    o->Object_ID     = id;
+    o->Object_Type   = type;
+    o->Position_X    = x;
+    o->Position_Y    = y;
+    o->Velocity_X    = vx;
+    o->Velocity_Y    = vy;
+    o->Heading       = (fabsf(vx) + fabsf(vy) > 0.1f) ? atan2f(vy, vx) * RAD2DEG : 0.0f;
+    o->Distance      = sqrtf(x * x + y * y);
+    o->Object_Status = OBJSTAT_MOVING;      /* 상태 분류는 select_target_from_object_list */
+}
+
+/*─────────────────────────────
+  공개 함수
+─────────────────────────────*/
+void sensor_assoc_default_config(SensorAssocConfig_t *pCfg)
+{
+    if (!pCfg) return;
+    pCfg->Gate_Chi2         = 9.21f;
+    pCfg->Max_Gate_Distance = 4.0f;
+    pCfg->Range_Front       = 250.0f;
+    pCfg->Range_Rear        = 50.0f;
+    pCfg->Half_Width        = 40.0f;
+}
+
+int sensor_assoc_init(SensorAssociation_t *pAssoc, const SensorAssocConfig_t *pCfg)
+{
+    if (!pAssoc || !pCfg) return -1;
+    if (!(pCfg->Gate_Chi2 > 0.0f) || !(pCfg->Max_Gate_Distance > 0.0f) ||
+        !(pCfg->Range_Front > 0.0f) || !(pCfg->Range_Rear >= 0.0f) || !(pCfg->Half_Width > 0.0f)) {
+        return -1;
+    }
+    float nx = ceilf((pCfg->Range_Front + pCfg->Range_Rear) / pCfg->Max_Gate_Distance);
+    float ny = ceilf(2.0f * pCfg->Half_Width / pCfg->Max_Gate_Distance);
+    if (nx * ny > (float)ASSOC_GRID_MAX_CELLS) return -1;
+
+    memset(pAssoc, 0, sizeof(*pAssoc));
+    pAssoc->Cfg     = *pCfg;
+    pAssoc->Grid_Nx = (int32_t)nx;
+    pAssoc->Grid_Ny = (int32_t)ny;
+    for (int c = 0; c < ASSOC_GRID_MAX_CELLS; c++) {
+        pAssoc->Cell_Head[c] = -1;
+    }
+    return 0;
+}
+
+int sensor_assoc_run(SensorAssociation_t *pAssoc,
+                     const SensorDetection_t *pRadar, int radarCount,
+                     const SensorDetection_t *pCamera, int cameraCount,
+                     ObjectData_t *pOut, int maxOut)
+{
+    if (!pAssoc || pAssoc->Grid_Nx <= 0) return -1;
+    if (radarCount < 0 || radarCount > ASSOC_MAX_DETECTIONS ||
+        cameraCount < 0 || cameraCount > ASSOC_MAX_DETECTIONS ||
+        (radarCount > 0 && !pRadar) || (cameraCount > 0 && !pCamera) ||
+        (pOut && maxOut < 0)) {
+        return -1;
+    }
+    for (int r = 0; r < radarCount; r++) {
+        if (!detection_is_valid(&pRadar[r])) return -1;
+    }
+    for (int j = 0; j < cameraCount; j++) {
+        if (!detection_is_valid(&pCamera[j])) return -1;
+    }
+
+    SensorAssociation_t *a = pAssoc;
+    a->Radar_Count  = radarCount;
+    a->Camera_Count = cameraCount;
+    a->Edge_Count   = 0;
+    a->Edge_Dropped = 0;
+
+    build_edges(a, pRadar, radarCount, pCamera, cameraCount);
+    solve(a, radarCount, cameraCount);
+
+    a->Match_Count = 0;
+    a->Total_Cost  = 0.0f;
+    for (int j = 0; j < cameraCount; j++) {
+        a->Camera_Match[j] = -1;
+    }
+    for (int r = 0; r < radarCount; r++) {
+        int c = a->Row_Col[r];
+        a->Total_Cost += a->Row_Cost[r];
+        if (c < cameraCount) {
+            a->Radar_Match[r]  = c;
+            a->Camera_Match[c] = r;
+            a->Match_Count++;
+        } else {
+            a->Radar_Match[r] = -1;
+        }
+    }
+
+    if (!pOut) return 0;
+
+    int n = 0;
+    for (int r = 0; r < radarCount && n < maxOut; r++) {
+        const SensorDetection_t *rd = &pRadar[r];
+        int c = a->Radar_Match[r];
+        if (c >= 0) {
+            const SensorDetection_t *cd = &pCamera[c];
+            float wx = cd->Var_X / (rd->Var_X + cd->Var_X);     /* 레이더 가중 */
+            float wy = cd->Var_Y / (rd->Var_Y + cd->Var_Y);
+            fill_object(&pOut[n++], rd->Detection_ID, cd->Object_Type,
+                        wx * rd->Position_X + (1.0f - wx) * cd->Position_X,
+                        wy * rd->Position_Y + (1.0f - wy) * cd->Position_Y,
+                        rd->Velocity_X, rd->Velocity_Y);
+        } else {
+            fill_object(&pOut[n++], rd->Detection_ID, rd->Object_Type,
+                        rd->Position_X, rd->Position_Y, rd->Velocity_X, rd->Velocity_Y);
+        }
+    }
+    for (int j = 0; j < cameraCount && n < maxOut; j++) {
+        if (a->Camera_Match[j] >= 0) continue;
+        const SensorDetection_t *cd = &pCamera[j];
+        fill_object(&pOut[n++], ASSOC_CAMERA_ID_OFFSET + cd->Detection_ID, cd->Object_Type,
+                    cd->Position_X, cd->Position_Y, cd->Velocity_X, cd->Velocity_Y);
+    }
+    return n;
+}
@@ -0,0 +1,110 @@
+/****************************************************************************
+ * sensor_association.h
+ *
+ * - 레이더 + 카메라 원시 검출 → 게이팅 → 1:1 할당 → 융합 ObjectData_t 리스트
+ *   (select_target_from_object_list 입력)
+ * - 게이팅 : 카메라 검출을 격자(셀 크기 = Max_Gate_Distance)에 넣고, 레이더마다
+ *            주변 3×3 셀만 검사. |dx|,|dy| <= Max_Gate_Distance 이고
+ *            마할라노비스 거리² d² = dx²/(σx²r+σx²c) + dy²/(σy²r+σy²c) < Gate_Chi2 인 쌍만 간선
+ * - 할당 : 희소 비용 행렬(레이더 행당 최대 ASSOC_MAX_EDGES_PER_ROW 간선)에 대한
+ *          최단 증가 경로(Jonker-Volgenant 형 헝가리안) → 최소 총비용, 최악 O(n³)
+ *          레이더마다 전용 "미할당" 열(비용 = Gate_Chi2) 을 두어 게이트 밖은 자동 미할당
+ * - 융합 : 위치 = 역분산 가중 평균, 속도 = 레이더, 종류 = 카메라
+ *          출력 순서 = 레이더 순서(매칭/레이더 단독) → 카메라 단독 (ID + ASSOC_CAMERA_ID_OFFSET)
+ * - 메모리 : SensorAssociation_t 안의 고정 배열만 사용 (동적 할당 없음, ~200 KB → static/힙)
+ ****************************************************************************/
+#ifndef SENSOR_ASSOCIATION_H
+#define SENSOR_ASSOCIATION_H
+
+#include <stdint.h>
+#include "adas_shared.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ASSOC_MAX_DETECTIONS        1024    /* 센서당 */
+#define ASSOC_MAX_EDGES_PER_ROW     16
+#define ASSOC_GRID_MAX_CELLS        8192
+#define ASSOC_CAMERA_ID_OFFSET      100000
+
+/* 센서 검출 (Ego 좌표계) */
+typedef struct {
+    int32_t      Detection_ID;
+    float        Position_X;        /* [m] (유한) */
+    float        Position_Y;        /* [m] */
+    float        Velocity_X;        /* [m/s] (카메라는 추정값) */
+    float        Velocity_Y;
+    float        Var_X;             /* 위치 분산 [m^2] (> 0) */
+    float        Var_Y;
+    ObjectType_e Object_Type;       /* 레이더는 보통 OBJTYPE_CAR */
+} SensorDetection_t;
+
+typedef struct {
+    float Gate_Chi2;                /* 2 자유도 χ² 게이트 (기본 9.21 = 99 %) */
+    float Max_Gate_Distance;        /* [m] 축별 최대 거리 = 격자 셀 크기 */
+    float Range_Front;              /* [m] 격자 범위 (밖은 가장자리 셀로) */
+    float Range_Rear;
+    float Half_Width;
+} SensorAssocConfig_t;
+
+typedef struct {
+    SensorAssocConfig_t Cfg;
+    int32_t  Grid_Nx, Grid_Ny;
+
+    /* 결과 */
+    int32_t  Radar_Count, Camera_Count;
+    int32_t  Match_Count;
+    int32_t  Edge_Count;
+    int32_t  Edge_Dropped;          /* 행당 간선 한도 초과로 버린 (가장 비싼) 간선 수 */
+    float    Total_Cost;            /* Σ 매칭 d² + 미할당 레이더 × Gate_Chi2 */
+    int32_t  Radar_Match[ASSOC_MAX_DETECTIONS];     /* 카메라 인덱스, -1 = 미할당 */
+    int32_t  Camera_Match[ASSOC_MAX_DETECTIONS];    /* 레이더 인덱스, -1 = 미할당 */
+
+    /* 격자 (카메라 검출 연결 리스트) */
+    int32_t  Cell_Head[ASSOC_GRID_MAX_CELLS];
+    int32_t  Cell_Next[ASSOC_MAX_DETECTIONS];
+    int32_t  Camera_Cell[ASSOC_MAX_DETECTIONS];
+
+    /* 희소 비용 행렬 (레이더 행별 고정 슬롯) */
+    int32_t  Row_Edges[ASSOC_MAX_DETECTIONS];
+    int32_t  Edge_Col[ASSOC_MAX_DETECTIONS * ASSOC_MAX_EDGES_PER_ROW];
+    float    Edge_Cost[ASSOC_MAX_DETECTIONS * ASSOC_MAX_EDGES_PER_ROW];
+
+    /* 최단 증가 경로 작업 영역 (열 = 카메라 + 레이더별 미할당 열) */
+    float    Col_V[2 * ASSOC_MAX_DETECTIONS];
+    float    Col_Dist[2 * ASSOC_MAX_DETECTIONS];
+    float    Col_Pred_Cost[2 * ASSOC_MAX_DETECTIONS];
+    int32_t  Col_Pred[2 * ASSOC_MAX_DETECTIONS];
+    int32_t  Col_Row[2 * ASSOC_MAX_DETECTIONS];
+    uint8_t  Col_Done[2 * ASSOC_MAX_DETECTIONS];
+    int32_t  Touched[2 * ASSOC_MAX_DETECTIONS];
+    int32_t  Row_Col[ASSOC_MAX_DETECTIONS];
+    float    Row_Cost[ASSOC_MAX_DETECTIONS];
+} SensorAssociation_t;
+
+/** @brief 기본 구성 (χ² 9.21, 게이트 4 m, 전방 250 m / 후방 50 m / 좌우 40 m) */
+void sensor_assoc_default_config(SensorAssocConfig_t *pCfg);
+
+/**
+ * @brief 초기화
+ * @return 0 on success, -1 : 인자 오류 또는 격자 셀 수 > ASSOC_GRID_MAX_CELLS
+ */
+int sensor_assoc_init(SensorAssociation_t *pAssoc, const SensorAssocConfig_t *pCfg);
+
+/**
+ * @brief 1 프레임 연관 + 융합
+ * @param[out] pOut   : 융합 객체 리스트 (NULL 이면 연관 결과만 계산)
+ * @param[in]  maxOut : pOut 용량 (넘는 객체는 버림)
+ * @return 출력 객체 수, -1 : 인자 오류 (검출 수 > ASSOC_MAX_DETECTIONS, 분산 <= 0, 위치 NaN/inf 포함)
+ */
+int sensor_assoc_run(SensorAssociation_t *pAssoc,
+                     const SensorDetection_t *pRadar, int radarCount,
+                     const SensorDetection_t *pCamera, int cameraCount,
+                     ObjectData_t *pOut, int maxOut);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SENSOR_ASSOCIATION_H */
@@ -0,0 +1,233 @@
+/*********************************************************************
+ * sensor_association_test.cpp  ―  레이더/카메라 연관 (게이팅 + 할당 + 융합)
+ * DUT : sensor_association.c
+ *********************************************************************/
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "sensor_association.h"
+#include "target_selection.h"
+#include "test_rng.hpp"
+
+namespace {
+
+class SensorAssocTest : public ::testing::Test {
+protected:
+    std::unique_ptr<SensorAssociation_t> assoc{ new SensorAssociation_t };
+    SensorAssocConfig_t cfg;
+    TestRng  rng{5u};
+
+    void SetUp() override
+    {
+        sensor_assoc_default_config(&cfg);
+        ASSERT_EQ(sensor_assoc_init(assoc.get(), &cfg), 0);
+    }
+
+    static SensorDetection_t det(int id, float x, float y, float vx, float varX, float varY,
+                                 ObjectType_e type = OBJTYPE_CAR)
+    {
+        SensorDetection_t d;
+        std::memset(&d, 0, sizeof(d));
+        d.Detection_ID = id;
+        d.Position_X   = x;
+        d.Position_Y   = y;
+        d.Velocity_X   = vx;
+        d.Var_X        = varX;
+        d.Var_Y        = varY;
+        d.Object_Type  = type;
+        return d;
+    }
+
+    /* 같은 게이트 규칙의 비용 (게이트 밖 = -1) */
+    float pair_cost(const SensorDetection_t &r, const SensorDetection_t &c) const
+    {
+        float dx = r.Position_X - c.Position_X, dy = r.Position_Y - c.Position_Y;
+        if (std::fabs(dx) > cfg.Max_Gate_Distance || std::fabs(dy) > cfg.Max_Gate_Distance) return -1.0f;
+        float d2 = dx * dx / (r.Var_X + c.Var_X) + dy * dy / (r.Var_Y + c.Var_Y);
+        return (d2 < cfg.Gate_Chi2) ? d2 : -1.0f;
+    }
+
+    /* 전수 탐색 최소 총비용 */
+    float brute(const std::vector<SensorDetection_t> &R, const std::vector<SensorDetection_t> &C,
+                int r, uint32_t used) const
+    {
+        if (r == (int)R.size()) return 0.0f;
+        float best = cfg.Gate_Chi2 + brute(R, C, r + 1, used);
+        for (int j = 0; j < (int)C.size(); j++) {
+            if (used & (1u << j)) continue;
+            float c = pair_cost(R[(size_t)r], C[(size_t)j]);
+            if (c < 0.0f) continue;
+            float t = c + brute(R, C, r + 1, used | (1u << j));
+            if (t < best) best = t;
+        }
+        return best;
+    }
+};
+
+} /* namespace */
+
+/* 순서가 섞인 잡음 검출 → 올바른 쌍 */
+TEST_F(SensorAssocTest, TC_ASSOC_EQ_01_SimplePairs)
+{
+    std::vector<SensorDetection_t> R = {
+        det(1, 30.0f,  0.1f, 20.0f, 0.1f, 1.0f),
+        det(2, 60.0f,  3.4f, 25.0f, 0.1f, 1.0f),
+        det(3, 90.0f, -3.6f, 15.0f, 0.1f, 1.0f),
+    };
+    std::vector<SensorDetection_t> C = {
+        det(7, 91.5f, -3.5f, 0.0f, 2.0f, 0.1f),
+        det(8, 29.0f,  0.0f, 0.0f, 2.0f, 0.1f, OBJTYPE_MOTORCYCLE),
+        det(9, 61.0f,  3.5f, 0.0f, 2.0f, 0.1f),
+    };
+    std::vector<ObjectData_t> out(8);
+    ASSERT_EQ(sensor_assoc_run(assoc.get(), R.data(), 3, C.data(), 3, out.data(), 8), 3);
+    EXPECT_EQ(assoc->Match_Count, 3);
+    EXPECT_EQ(assoc->Radar_Match[0], 1);
+    EXPECT_EQ(assoc->Radar_Match[1], 2);
+    EXPECT_EQ(assoc->Radar_Match[2], 0);
+    EXPECT_EQ(assoc->Camera_Match[1], 0);
+
+    /* 융합 : X 는 레이더(분산 0.1) 쪽, Y 는 카메라 쪽, 종류는 카메라, 속도는 레이더 */
+    EXPECT_EQ(out[0].Object_ID, 1);
+    EXPECT_EQ(out[0].Object_Type, OBJTYPE_MOTORCYCLE);
+    EXPECT_NEAR(out[0].Position_X, (2.0f * 30.0f + 0.1f * 29.0f) / 2.1f, 1e-4f);
+    EXPECT_NEAR(out[0].Position_Y, (0.1f * 0.1f + 1.0f * 0.0f) / 1.1f, 1e-4f);
+    EXPECT_FLOAT_EQ(out[0].Velocity_X, 20.0f);
+    EXPECT_NEAR(out[0].Distance, std::hypot(out[0].Position_X, out[0].Position_Y), 1e-4f);
+}
+
+/* 최소 총비용 == 전수 탐색 (경합 쌍, 게이트 밖 포함) */
+TEST_F(SensorAssocTest, TC_ASSOC_EQ_02_OptimalVsBruteForce)
+{
+    for (int trial = 0; trial < 300; trial++) {
+        int nR = 1 + trial % 7, nC = 1 + (trial / 7) % 7;
+        std::vector<SensorDetection_t> R, C;
+        for (int i = 0; i < nR; i++) R.push_back(det(i, rng.uni(40.0f, 48.0f), rng.uni(-3.0f, 3.0f), 0.0f, rng.uni(0.1f, 1.0f), rng.uni(0.1f, 1.0f)));
+        for (int j = 0; j < nC; j++) C.push_back(det(j, rng.uni(40.0f, 48.0f), rng.uni(-3.0f, 3.0f), 0.0f, rng.uni(0.1f, 1.0f), rng.uni(0.1f, 1.0f)));
+
+        ASSERT_EQ(sensor_assoc_run(assoc.get(), R.data(), nR, C.data(), nC, nullptr, 0), 0);
+        float expect = brute(R, C, 0, 0u);
+        EXPECT_NEAR(assoc->Total_Cost, expect, 1e-3f * (1.0f + expect)) << "trial " << trial;
+
+        /* 할당 일관성 + 비용 재계산 */
+        float sum = 0.0f;
+        for (int r = 0; r < nR; r++) {
+            int c = assoc->Radar_Match[r];
+            if (c < 0) { sum += cfg.Gate_Chi2; continue; }
+            ASSERT_EQ(assoc->Camera_Match[c], r);
+            float pc = pair_cost(R[(size_t)r], C[(size_t)c]);
+            ASSERT_GE(pc, 0.0f);
+            sum += pc;
+        }
+        EXPECT_NEAR(sum, assoc->Total_Cost, 1e-3f * (1.0f + sum));
+    }
+}
+
+/* 단독 검출 : 레이더 단독은 레이더 값, 카메라 단독은 ID 오프셋 */
+TEST_F(SensorAssocTest, TC_ASSOC_EQ_03_Unmatched)
+{
+    SensorDetection_t R[2] = { det(1, 30.0f, 0.0f, 20.0f, 0.1f, 1.0f),
+                               det(2, 100.0f, 0.0f, 10.0f, 0.1f, 1.0f) };
+    SensorDetection_t C[2] = { det(5, 30.5f, 0.1f, 0.0f, 2.0f, 0.1f),
+                               det(6, 20.0f, 5.0f, 0.0f, 2.0f, 0.1f, OBJTYPE_PEDESTRIAN) };
+    ObjectData_t out[4];
+    ASSERT_EQ(sensor_assoc_run(assoc.get(), R, 2, C, 2, out, 4), 3);
+    EXPECT_EQ(assoc->Match_Count, 1);
+    EXPECT_EQ(out[1].Object_ID, 2);
+    EXPECT_FLOAT_EQ(out[1].Position_X, 100.0f);
+    EXPECT_EQ(out[2].Object_ID, ASSOC_CAMERA_ID_OFFSET + 6);
+    EXPECT_EQ(out[2].Object_Type, OBJTYPE_PEDESTRIAN);
+
+    /* 용량 제한 */
+    ASSERT_EQ(sensor_assoc_run(assoc.get(), R, 2, C, 2, out, 2), 2);
+    /* 한쪽 센서만 */
+    ASSERT_EQ(sensor_assoc_run(assoc.get(), R, 0, C, 2, out, 4), 2);
+    EXPECT_EQ(assoc->Match_Count, 0);
+    ASSERT_EQ(sensor_assoc_run(assoc.get(), R, 2, C, 0, out, 4), 2);
+}
+
+/* 최대 규모 1024 × 1024 : 참 쌍 복원, 격자 가장자리(범위 밖) 포함, 결과 → Target Selection */
+TEST_F(SensorAssocTest, TC_ASSOC_BV_01_FullScale)
+{
+    const int N = ASSOC_MAX_DETECTIONS;
+    std::vector<SensorDetection_t> R(N), C(N);
+    std::vector<int> truth(N);
+    for (int i = 0; i < N; i++) {
+        /* 10 m × 3.5 m 격자 위 참값 (일부는 격자 범위 밖) */
+        float x = -60.0f + 10.0f * (float)(i % 32) + (float)(i / 32 % 2);
+        float y = -45.0f + 3.0f * (float)(i / 32);
+        R[(size_t)i] = det(i, x + rng.uni(-0.2f, 0.2f), y + rng.uni(-0.4f, 0.4f), 10.0f, 0.1f, 0.5f);
+        int j = (i * 389) % N;      /* 카메라 순서 섞기 */
+        truth[(size_t)i] = j;
+        C[(size_t)j] = det(j, x + rng.uni(-0.8f, 0.8f), y + rng.uni(-0.1f, 0.1f), 0.0f, 1.0f, 0.05f);
+    }
+    std::vector<ObjectData_t> out(2 * N);
+    ASSERT_EQ(sensor_assoc_run(assoc.get(), R.data(), N, C.data(), N, out.data(), 2 * N), N);
+    EXPECT_EQ(assoc->Match_Count, N);
+    for (int i = 0; i < N; i++) EXPECT_EQ(assoc->Radar_Match[i], truth[(size_t)i]) << i;
+
+    /* 재실행 (고정 메모리 재사용) 결과 동일 */
+    int32_t first[ASSOC_MAX_DETECTIONS];
+    std::memcpy(first, assoc->Radar_Match, sizeof(first));
+    ASSERT_EQ(sensor_assoc_run(assoc.get(), R.data(), N, C.data(), N, out.data(), 2 * N), N);
+    EXPECT_EQ(std::memcmp(first, assoc->Radar_Match, sizeof(first)), 0);
+
+    EgoData_t ego;
+    std::memset(&ego, 0, sizeof(ego));
+    ego.Ego_Velocity_X = 10.0f;
+    LaneSelectOutput_t ls;
+    std::memset(&ls, 0, sizeof(ls));
+    ls.LS_Lane_Width = 3.5f;
+    std::vector<FilteredObject_t> filtered(N);
+    int f = select_target_from_object_list(out.data(), N, &ego, &ls, filtered.data(), N);
+    EXPECT_GT(f, 0);
+}
+
+/* 행당 간선 한도 : 가장 가까운 후보 유지 */
+TEST_F(SensorAssocTest, TC_ASSOC_BV_02_EdgeLimit)
+{
+    std::vector<SensorDetection_t> C;
+    for (int j = 0; j < 40; j++) C.push_back(det(j, 50.0f + 0.05f * (float)j, 0.0f, 0.0f, 1.0f, 1.0f));
+    SensorDetection_t R = det(0, 50.0f + 0.05f * 39.0f, 0.0f, 0.0f, 1.0f, 1.0f);
+    ASSERT_EQ(sensor_assoc_run(assoc.get(), &R, 1, C.data(), 40, nullptr, 0), 0);
+    EXPECT_EQ(assoc->Edge_Count, ASSOC_MAX_EDGES_PER_ROW);
+    EXPECT_EQ(assoc->Edge_Dropped, 40 - ASSOC_MAX_EDGES_PER_ROW);
+    EXPECT_EQ(assoc->Radar_Match[0], 39);
+}
+
+/* 무효 입력 */
+TEST_F(SensorAssocTest, TC_ASSOC_RA_01_Invalid)
+{
+    SensorDetection_t d = det(0, 10.0f, 0.0f, 0.0f, 1.0f, 1.0f);
+    ObjectData_t out[2];
+    EXPECT_EQ(sensor_assoc_run(nullptr, &d, 1, &d, 1, out, 2), -1);
+    EXPECT_EQ(sensor_assoc_run(assoc.get(), nullptr, 1, &d, 1, out, 2), -1);
+    EXPECT_EQ(sensor_assoc_run(assoc.get(), &d, ASSOC_MAX_DETECTIONS + 1, &d, 1, out, 2), -1);
+    EXPECT_EQ(sensor_assoc_run(assoc.get(), &d, 1, &d, -1, out, 2), -1);
+    SensorDetection_t bad = d;
+    bad.Var_Y = 0.0f;
+    EXPECT_EQ(sensor_assoc_run(assoc.get(), &bad, 1, &d, 1, out, 2), -1);
+    bad = d;
+    bad.Position_X = NAN;
+    EXPECT_EQ(sensor_assoc_run(assoc.get(), &bad, 1, &d, 1, out, 2), -1);
+    bad = d;
+    bad.Position_Y = -INFINITY;
+    EXPECT_EQ(sensor_assoc_run(assoc.get(), &d, 1, &bad, 1, out, 2), -1);
+
+    /* 유한하지만 격자보다 훨씬 먼 검출 : 가장자리 셀로 잘려 정상 처리, 미할당 */
+    SensorDetection_t far = det(1, 1.0e30f, -3.0e38f, 0.0f, 1.0f, 1.0f);
+    EXPECT_EQ(sensor_assoc_run(assoc.get(), &far, 1, &d, 1, out, 2), 2);
+    EXPECT_EQ(assoc->Radar_Match[0], -1);
+
+    SensorAssocConfig_t c = cfg;
+    c.Max_Gate_Distance = 0.0f;
+    EXPECT_EQ(sensor_assoc_init(assoc.get(), &c), -1);
+    c = cfg;
+    c.Max_Gate_Distance = 0.5f;                 /* 600 × 160 셀 > 한도 */
+    EXPECT_EQ(sensor_assoc_init(assoc.get(), &c), -1);
+    EXPECT_EQ(sensor_assoc_init(nullptr, &cfg), -1);
+}
@@ -0,0 +1,210 @@
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L     /* shm_open, ftruncate */
+#endif
+
+#include <string.h>
+#include "sim_bridge.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define SIM_BRIDGE_HAS_SHM 1
+#endif
+
+#define SIM_SLOT_NONE       0xFFFFFFFFu
+#define SIM_READ_RETRY      4           /* begin_read : 기록 중 슬롯 재시도 횟수 */
+
+/* seqlock 원자 연산 (GCC/Clang 내장) */
+#define LOAD_ACQ(p)         __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define LOAD_RLX(p)         __atomic_load_n((p), __ATOMIC_RELAXED)
+#define STORE_REL(p, v)     __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#define STORE_RLX(p, v)     __atomic_store_n((p), (v), __ATOMIC_RELAXED)
+#define FENCE_ACQ()         __atomic_thread_fence(__ATOMIC_ACQUIRE)
+#define FENCE_REL()         __atomic_thread_fence(__ATOMIC_RELEASE)
+
+/* 기록 시작 : seq 홀수 → 이후 데이터 기록이 seq 보다 먼저 보이지 않도록 release 펜스 */
+static inline void seq_write_begin(uint32_t *pSeq)
+{
+    STORE_RLX(pSeq, LOAD_RLX(pSeq) + 1u);
+    FENCE_REL();
+}
+
+static inline void seq_write_end(uint32_t *pSeq)
+{
+    STORE_REL(pSeq, LOAD_RLX(pSeq) + 1u);
+}
+
+/*─────────────────────────────
+  초기화 / 확인
+─────────────────────────────*/
+int sim_bridge_init(SimBridgeRegion_t *pRegion)
+{
+    if (!pRegion) return -1;
+
+    memset(pRegion, 0, sizeof(*pRegion));
+    pRegion->Version       = SIM_BRIDGE_VERSION;
+    pRegion->Region_Size   = (uint32_t)sizeof(SimBridgeRegion_t);
+    pRegion->Latest_Sensor = SIM_SLOT_NONE;
+    STORE_REL(&pRegion->Magic, SIM_BRIDGE_MAGIC);     /* 마지막에 기록 : attach 측 확인 기준 */
+    return 0;
+}
+
+int sim_bridge_check(const SimBridgeRegion_t *pRegion)
+{
+    if (!pRegion) return -1;
+    if (LOAD_ACQ(&pRegion->Magic) != SIM_BRIDGE_MAGIC) return -1;
+    if (pRegion->Version != SIM_BRIDGE_VERSION)         return -1;
+    if (pRegion->Region_Size != (uint32_t)sizeof(SimBridgeRegion_t)) return -1;
+    return 0;
+}
+
+/*─────────────────────────────
+  센서 : 생산자
+─────────────────────────────*/
+SimSensorFrame_t *sim_bridge_sensor_begin_write(SimBridgeRegion_t *pRegion)
+{
+    if (!pRegion) return NULL;
+
+    uint32_t latest = LOAD_RLX(&pRegion->Latest_Sensor);
+    uint32_t slot   = (latest == SIM_SLOT_NONE) ? 0u : (latest ^ 1u);
+    pRegion->Write_Sensor = slot;
+
+    seq_write_begin(&pRegion->Sensor[slot].Seq);
+    return &pRegion->Sensor[slot].Frame;
+}
+
+void sim_bridge_sensor_end_write(SimBridgeRegion_t *pRegion)
+{
+    if (!pRegion) return;
+
+    uint32_t slot = pRegion->Write_Sensor & 1u;
+    seq_write_end(&pRegion->Sensor[slot].Seq);
+    STORE_REL(&pRegion->Latest_Sensor, slot);
+}
+
+/*─────────────────────────────
+  센서 : 제어기 (제자리 읽기)
+─────────────────────────────*/
+const SimSensorFrame_t *sim_bridge_sensor_begin_read(const SimBridgeRegion_t *pRegion,
+                                                     SimReadToken_t          *pToken)
+{
+    if (!pRegion || !pToken) return NULL;
+
+    for (int i = 0; i < SIM_READ_RETRY; i++) {
+        uint32_t slot = LOAD_ACQ(&pRegion->Latest_Sensor);
+        if (slot == SIM_SLOT_NONE) {
+            return NULL;
+        }
+        slot &= 1u;
+        uint32_t seq = LOAD_ACQ(&pRegion->Sensor[slot].Seq);
+        if ((seq & 1u) == 0u) {
+            pToken->Slot = slot;
+            pToken->Seq  = seq;
+            return &pRegion->Sensor[slot].Frame;
+        }
+        /* 게시 직후 다음 프레임 기록이 이미 시작됨 → Latest 재확인 */
+    }
+    return NULL;
+}
+
+int sim_bridge_sensor_object_count(const SimSensorFrame_t *pFrame)
+{
+    if (!pFrame) return 0;
+
+    int32_t n = LOAD_RLX(&pFrame->Object_Count);    /* 검사와 사용이 같은 값이도록 1 회 읽기 */
+    if (n < 0) return 0;
+    return (n > SIM_BRIDGE_MAX_OBJECTS) ? SIM_BRIDGE_MAX_OBJECTS : (int)n;
+}
+
+bool sim_bridge_sensor_end_read(const SimBridgeRegion_t *pRegion,
+                                const SimReadToken_t    *pToken)
+{
+    if (!pRegion || !pToken) return false;
+
+    FENCE_ACQ();                                /* 데이터 읽기가 seq 재확인 뒤로 밀리지 않도록 */
+    return LOAD_RLX(&pRegion->Sensor[pToken->Slot & 1u].Seq) == pToken->Seq;
+}
+
+/*─────────────────────────────
+  제어 출력
+─────────────────────────────*/
+void sim_bridge_control_publish(SimBridgeRegion_t      *pRegion,
+                                uint64_t                frameId,
+                                const VehicleControl_t *pControl)
+{
+    if (!pRegion || !pControl) return;
+
+    seq_write_begin(&pRegion->Control.Seq);
+    pRegion->Control.Frame.Frame_Id = frameId;
+    pRegion->Control.Frame.Control  = *pControl;
+    seq_write_end(&pRegion->Control.Seq);
+}
+
+bool sim_bridge_control_read(const SimBridgeRegion_t *pRegion,
+                             SimControlFrame_t       *pOut)
+{
+    if (!pRegion || !pOut) return false;
+
+    uint32_t seq = LOAD_ACQ(&pRegion->Control.Seq);
+    if (seq == 0u || (seq & 1u)) {
+        return false;                           /* 미게시 / 기록 중 */
+    }
+    *pOut = pRegion->Control.Frame;
+    FENCE_ACQ();
+    return LOAD_RLX(&pRegion->Control.Seq) == seq;
+}
+
+/*─────────────────────────────
+  POSIX 공유메모리
+─────────────────────────────*/
+#ifdef SIM_BRIDGE_HAS_SHM
+SimBridgeRegion_t *sim_bridge_shm_open(const char *name, bool create)
+{
+    if (!name) return NULL;
+
+    int fd = shm_open(name, create ? (O_CREAT | O_RDWR) : O_RDWR, 0600);
+    if (fd < 0) return NULL;
+
+    if (create && ftruncate(fd, (off_t)sizeof(SimBridgeRegion_t)) != 0) {
+        close(fd);
+        return NULL;
+    }
+    void *p = mmap(NULL, sizeof(SimBridgeRegion_t), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (p == MAP_FAILED) return NULL;
+
+    SimBridgeRegion_t *pRegion = (SimBridgeRegion_t *)p;
+    if (create) {
+        sim_bridge_init(pRegion);
+    } else if (sim_bridge_check(pRegion) != 0) {
+        munmap(p, sizeof(SimBridgeRegion_t));
+        return NULL;
+    }
+    return pRegion;
+}
+
+void sim_bridge_shm_close(SimBridgeRegion_t *pRegion, const char *unlinkName)
+{
+    if (pRegion) {
+        munmap(pRegion, sizeof(SimBridgeRegion_t));
+    }
+    if (unlinkName) {
+        shm_unlink(unlinkName);
+    }
+}
+#else
+SimBridgeRegion_t *sim_bridge_shm_open(const char *name, bool create)
+{
+    (void)name;
+    (void)create;
+    return NULL;
+}
+
+void sim_bridge_shm_close(SimBridgeRegion_t *pRegion, const char *unlinkName)
+{
+    (void)pRegion;
+    (void)unlinkName;
+}
+#endif
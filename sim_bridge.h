@@ -0,0 +1,159 @@
+/****************************************************************************
+ * sim_bridge.h
+ *
+ * - 시뮬레이터(Carla 등) ↔ 제어기 공유메모리 브리지
+ * - 센서 프레임(GPS, IMU, Lane, Object list) : 이중 버퍼 + 슬롯별 seqlock
+ *     . 생산자 : 비활성 슬롯에 직접 기록 후 게시 (대기 없음)
+ *     . 제어기 : 최신 슬롯을 복사 없이 제자리에서 읽고, 끝에 seq 재확인
+ *                (생산자가 같은 슬롯을 다시 쓰려면 한 프레임을 더 게시해야 하므로
+ *                 읽기 실패는 제어 주기 > 센서 주기 2 배일 때만 발생)
+ *       . end_read 로 검증하기 전 값은 찢어졌을 수 있음 → 길이 / 인덱스로 쓰는 Object_Count 는
+ *         직접 쓰지 말고 sim_bridge_sensor_object_count 로 한 번 읽어 범위 제한한 값만 사용
+ * - 제어 출력(VehicleControl_t) : 단일 seqlock, 크기가 작아 복사 방식
+ * - 영역은 위치 독립(포인터 없음) → shm_open/mmap, 힙, 정적 버퍼 어디든 사용
+ * - 동기화 : GCC/Clang __atomic 내장 함수 (C99 빌드 유지)
+ ****************************************************************************/
+#ifndef SIM_BRIDGE_H
+#define SIM_BRIDGE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "adas_shared.h"
+#include "arbitration.h"      /* VehicleControl_t */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SIM_BRIDGE_MAGIC        0x41444153u     /* 'ADAS' */
+#define SIM_BRIDGE_VERSION      1u
+#define SIM_BRIDGE_MAX_OBJECTS  32
+#define SIM_BRIDGE_CACHELINE    64
+
+/* 센서 프레임 (생산자 → 제어기) */
+typedef struct {
+    uint64_t     Frame_Id;              /* 생산자 증가 번호 (1 부터) */
+    TimeData_t   Time;
+    GPSData_t    Gps;
+    IMUData_t    Imu;
+    LaneData_t   Lane;
+    int32_t      Object_Count;          /* 0 ~ SIM_BRIDGE_MAX_OBJECTS */
+    ObjectData_t Objects[SIM_BRIDGE_MAX_OBJECTS];
+} SimSensorFrame_t;
+
+/* 제어 출력 (제어기 → 생산자) */
+typedef struct {
+    uint64_t         Frame_Id;          /* 처리한 센서 프레임 번호 */
+    VehicleControl_t Control;
+} SimControlFrame_t;
+
+typedef struct {
+    uint32_t         Seq;               /* 짝수 : 안정, 홀수 : 기록 중 */
+    uint8_t          Pad[SIM_BRIDGE_CACHELINE - sizeof(uint32_t)];
+    SimSensorFrame_t Frame;
+} __attribute__((aligned(SIM_BRIDGE_CACHELINE))) SimSensorSlot_t;
+
+typedef struct {
+    uint32_t          Seq;
+    uint8_t           Pad[SIM_BRIDGE_CACHELINE - sizeof(uint32_t)];
+    SimControlFrame_t Frame;
+} __attribute__((aligned(SIM_BRIDGE_CACHELINE))) SimControlSlot_t;
+
+/* 공유 영역 (shm 에 그대로 매핑) */
+typedef struct {
+    uint32_t Magic;
+    uint32_t Version;
+    uint32_t Region_Size;               /* sizeof(SimBridgeRegion_t) : ABI 확인 */
+    uint32_t Latest_Sensor;             /* 최근 게시 슬롯 (0/1), 게시 전 0xFFFFFFFF */
+    uint32_t Write_Sensor;              /* 생산자 전용 : 기록 중 슬롯 */
+    uint8_t  Pad[SIM_BRIDGE_CACHELINE - 5 * sizeof(uint32_t)];
+
+    SimSensorSlot_t  Sensor[2];
+    SimControlSlot_t Control;
+} SimBridgeRegion_t;
+
+/* 읽기 토큰 : begin_read 가 돌려준 슬롯/seq */
+typedef struct {
+    uint32_t Slot;
+    uint32_t Seq;
+} SimReadToken_t;
+
+/**
+ * @brief 영역 초기화 (생산자, 최초 1 회)
+ * @return 0 on success, -1 on invalid argument
+ */
+int sim_bridge_init(SimBridgeRegion_t *pRegion);
+
+/**
+ * @brief 매직/버전/크기 확인 (제어기 attach 시)
+ * @return 0 : 호환, -1 : 비호환 또는 미초기화
+ */
+int sim_bridge_check(const SimBridgeRegion_t *pRegion);
+
+/*--------------------------- 센서 (생산자) ---------------------------*/
+
+/**
+ * @brief 다음 센서 프레임 기록 시작 → 기록할 슬롯 (제자리 기록)
+ *        sim_bridge_sensor_end_write 로 반드시 게시
+ */
+SimSensorFrame_t *sim_bridge_sensor_begin_write(SimBridgeRegion_t *pRegion);
+
+/** @brief 기록한 슬롯 게시 (Latest_Sensor 갱신) */
+void sim_bridge_sensor_end_write(SimBridgeRegion_t *pRegion);
+
+/*--------------------------- 센서 (제어기) ---------------------------*/
+
+/**
+ * @brief 최신 센서 프레임 (복사 없음)
+ * @return 프레임 포인터, 게시된 프레임이 없거나 기록 중이면 NULL
+ */
+const SimSensorFrame_t *sim_bridge_sensor_begin_read(const SimBridgeRegion_t *pRegion,
+                                                     SimReadToken_t          *pToken);
+
+/**
+ * @brief 읽는 중 프레임의 객체 수 (한 번만 읽어 [0, SIM_BRIDGE_MAX_OBJECTS] 로 제한)
+ *        begin_read ~ end_read 사이에는 f->Object_Count 대신 반드시 이 값을 사용
+ *        (찢어진 읽기여도 Objects 범위 안 → 결과는 end_read 실패 시 폐기)
+ * @return 0 ~ SIM_BRIDGE_MAX_OBJECTS (pFrame NULL 이면 0)
+ */
+int sim_bridge_sensor_object_count(const SimSensorFrame_t *pFrame);
+
+/**
+ * @brief 읽는 동안 덮어쓰기가 없었는지 확인
+ * @return true : 읽은 값 유효, false : 찢어진 읽기 → 결과 폐기 후 재시도
+ */
+bool sim_bridge_sensor_end_read(const SimBridgeRegion_t *pRegion,
+                                const SimReadToken_t    *pToken);
+
+/*----------------------------- 제어 출력 -----------------------------*/
+
+/** @brief 제어 출력 게시 (제어기, 대기 없음) */
+void sim_bridge_control_publish(SimBridgeRegion_t      *pRegion,
+                                uint64_t                frameId,
+                                const VehicleControl_t *pControl);
+
+/**
+ * @brief 최신 제어 출력 복사 (생산자)
+ * @return true : 유효, false : 미게시 또는 기록 중 (다음 주기에 재시도)
+ */
+bool sim_bridge_control_read(const SimBridgeRegion_t *pRegion,
+                             SimControlFrame_t       *pOut);
+
+/*------------------------- POSIX 공유메모리 --------------------------*/
+
+/**
+ * @brief shm_open + mmap
+ * @param name   "/adas_bridge" 형식
+ * @param create true : 생성 + 초기화 (생산자), false : 기존 영역 attach (제어기)
+ * @return 매핑된 영역, 실패 시 NULL
+ */
+SimBridgeRegion_t *sim_bridge_shm_open(const char *name, bool create);
+
+/** @brief munmap (+ unlinkName 이 NULL 이 아니면 shm_unlink) */
+void sim_bridge_shm_close(SimBridgeRegion_t *pRegion, const char *unlinkName);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SIM_BRIDGE_H */
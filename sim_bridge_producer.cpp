@@ -0,0 +1,140 @@
+/*********************************************************************
+ * sim_bridge_producer.cpp  ―  시뮬레이터 대역 생산자 (독립 실행)
+ *
+ * 사용 : sim_bridge_producer [--loopback] [shm 이름(기본 /adas_bridge)] [프레임 수(기본 10000)]
+ *   - shm 영역을 생성하고 합성 센서 프레임을 게시, 프레임마다 제어 출력 수신까지 대기
+ *   - 제어기가 별도 프로세스이면 같은 이름으로 sim_bridge_shm_open(name, false)
+ *   - --loopback : 같은 프로세스 안에서 제어기 스레드가 영역을 따로 attach 하여
+ *                  LaneSelection → select_target_from_object_list → Arbitration 을
+ *                  센서 프레임 제자리 읽기로 수행
+ *   - 왕복(게시 → 제어 출력 수신) 지연 p50 / p99 / max [µs] 출력
+ *********************************************************************/
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "sim_bridge_producer.hpp"
+#include "lane_selection.h"
+#include "target_selection.h"
+
+namespace {
+
+/* 제어기 1 주기 : 센서 프레임을 복사 없이 사용 */
+bool controller_step(SimBridgeRegion_t *region, uint64_t *lastId)
+{
+    SimReadToken_t tok;
+    const SimSensorFrame_t *f = sim_bridge_sensor_begin_read(region, &tok);
+    if (!f || f->Frame_Id == *lastId) return false;
+
+    EgoData_t ego;
+    std::memset(&ego, 0, sizeof(ego));
+    ego.Ego_Velocity_X     = f->Gps.GPS_Velocity_X;
+    ego.Ego_Velocity_Y     = f->Gps.GPS_Velocity_Y;
+    ego.Ego_Acceleration_X = f->Imu.Linear_Acceleration_X;
+    ego.Ego_Yaw_Rate       = f->Imu.Yaw_Rate;
+
+    LaneSelectOutput_t ls;
+    FilteredObject_t   filtered[SIM_BRIDGE_MAX_OBJECTS];
+    LaneSelection(&f->Lane, &ego, &ls);
+    int n = select_target_from_object_list(f->Objects, sim_bridge_sensor_object_count(f), &ego, &ls,
+                                           filtered, SIM_BRIDGE_MAX_OBJECTS);
+    uint64_t id = f->Frame_Id;
+
+    if (!sim_bridge_sensor_end_read(region, &tok)) {
+        return false;                                   /* 찢어진 읽기 : 결과 폐기 */
+    }
+
+    /* 대역 제어 법칙 : 동일 차로 40 m 이내 객체 유무로 가감속, 헤딩 오차 비례 조향 */
+    float accel = 1.0f;
+    for (int i = 0; i < n; i++) {
+        if (std::fabs(filtered[i].Filtered_Position_Y) < 1.75f && filtered[i].Filtered_Position_X < 40.0f) {
+            accel = -1.0f;
+            break;
+        }
+    }
+    VehicleControl_t vc;
+    Arbitration(accel, 0.0f, -ls.LS_Heading_Error, AEB_MODE_NORMAL, &vc);
+    sim_bridge_control_publish(region, id, &vc);
+    *lastId = id;
+    return true;
+}
+
+} /* namespace */
+
+int main(int argc, char **argv)
+{
+    bool        loopback = false;
+    const char *name     = "/adas_bridge";
+    long        frames   = 10000;
+    int         pos      = 0;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--loopback") == 0) {
+            loopback = true;
+        } else if (pos++ == 0) {
+            name = argv[i];
+        } else {
+            frames = std::atol(argv[i]);
+        }
+    }
+    if (frames <= 0) frames = 1;
+
+    SimBridgeRegion_t *region = sim_bridge_shm_open(name, true);
+    if (!region) {
+        std::fprintf(stderr, "shm 생성 실패 : %s\n", name);
+        return 1;
+    }
+
+    std::atomic<bool> stop{ false };
+    std::thread ctrl;
+    if (loopback) {
+        ctrl = std::thread([&] {
+            SimBridgeRegion_t *view = sim_bridge_shm_open(name, false);
+            if (!view) return;
+            uint64_t lastId = 0;
+            while (!stop.load(std::memory_order_relaxed)) {
+                if (!controller_step(view, &lastId)) std::this_thread::yield();
+            }
+            sim_bridge_shm_close(view, nullptr);
+        });
+    }
+
+    adas::SimStandInProducer prod(region);
+    std::vector<double> us;
+    us.reserve((size_t)frames);
+    long missed = 0;
+    for (long i = 0; i < frames; i++) {
+        auto t0 = std::chrono::steady_clock::now();
+        uint64_t id = prod.publishNext();
+        SimControlFrame_t c;
+        bool got = false;
+        while (!got) {
+            got = prod.pollControl(id, &c);
+            if (got) break;
+            if (std::chrono::steady_clock::now() - t0 > std::chrono::milliseconds(100)) break;
+            std::this_thread::yield();
+        }
+        if (!got) {
+            missed++;
+            continue;
+        }
+        us.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count());
+    }
+
+    stop.store(true);
+    if (ctrl.joinable()) ctrl.join();
+    sim_bridge_shm_close(region, name);
+
+    std::printf("frames %ld, 제어 수신 %zu, 시간 초과 %ld\n", frames, us.size(), missed);
+    if (!us.empty()) {
+        std::sort(us.begin(), us.end());
+        std::printf("round-trip [us] p50 %.2f  p99 %.2f  max %.2f\n",
+                    us[us.size() / 2], us[us.size() * 99 / 100], us.back());
+    }
+    return (missed == 0) ? 0 : 1;
+}
@@ -0,0 +1,105 @@
+/****************************************************************************
+ * sim_bridge_producer.hpp
+ *
+ * - 시뮬레이터 대역(stand-in) 생산자 : Carla 없이 sim_bridge 를 구동
+ * - 직선/곡선 차로 + 선행차 접근 + 보행자 횡단의 합성 센서 프레임을
+ *   10 ms 주기 시각으로 생성해 공유 영역에 직접 기록
+ * - sim_bridge_test.cpp, sim_bridge_producer.cpp (독립 실행) 에서 공용
+ ****************************************************************************/
+#ifndef SIM_BRIDGE_PRODUCER_HPP
+#define SIM_BRIDGE_PRODUCER_HPP
+
+#include <cmath>
+#include <cstdint>
+
+#include "sim_bridge.h"
+
+namespace adas {
+
+class SimStandInProducer
+{
+public:
+    explicit SimStandInProducer(SimBridgeRegion_t *region) : region_(region) {}
+
+    /* 다음 프레임 기록 + 게시 → Frame_Id */
+    uint64_t publishNext()
+    {
+        SimSensorFrame_t *f = sim_bridge_sensor_begin_write(region_);
+        if (!f) return 0;
+        fill(*f, ++frameId_);
+        sim_bridge_sensor_end_write(region_);
+        return frameId_;
+    }
+
+    /* frameId 에 대한 제어 출력 수신 여부 (대기 없음) */
+    bool pollControl(uint64_t frameId, SimControlFrame_t *out) const
+    {
+        return sim_bridge_control_read(region_, out) && out->Frame_Id >= frameId;
+    }
+
+    uint64_t lastFrameId() const { return frameId_; }
+
+    /* 프레임 내용 : Frame_Id 로부터 결정적 (찢어진 읽기 검출용 검증 가능) */
+    static void fill(SimSensorFrame_t &f, uint64_t id)
+    {
+        const float t    = 10.0f * (float)id;                  /* [ms] */
+        const float ego  = 20.0f + 2.0f * std::sin(0.001f * t);
+        const bool  bend = ((id / 500u) % 2u) == 1u;
+
+        f.Frame_Id                = id;
+        f.Time.Current_Time       = t;
+        f.Gps.GPS_Velocity_X      = ego;
+        f.Gps.GPS_Velocity_Y      = 0.0f;
+        f.Gps.GPS_Timestamp       = t;
+        f.Imu.Linear_Acceleration_X = 0.002f * std::cos(0.001f * t);
+        f.Imu.Linear_Acceleration_Y = 0.0f;
+        f.Imu.Yaw_Rate            = bend ? 3.0f : 0.0f;
+
+        f.Lane.Lane_Type          = bend ? LANE_TYPE_CURVE : LANE_TYPE_STRAIGHT;
+        f.Lane.Lane_Curvature     = bend ? 400.0f : 0.0f;
+        f.Lane.Next_Lane_Curvature= bend ? 420.0f : 0.0f;
+        f.Lane.Lane_Offset        = 0.2f * std::sin(0.0005f * t);
+        f.Lane.Lane_Heading       = 0.0f;
+        f.Lane.Lane_Width         = 3.5f;
+        f.Lane.Lane_Change_Status = LANE_CHANGE_KEEP;
+
+        f.Object_Count = SIM_BRIDGE_MAX_OBJECTS;
+        for (int i = 0; i < SIM_BRIDGE_MAX_OBJECTS; i++) {
+            ObjectData_t &o = f.Objects[i];
+            o.Object_ID      = (int)(id * SIM_BRIDGE_MAX_OBJECTS + (uint64_t)i);
+            o.Object_Type    = (i == 1) ? OBJTYPE_PEDESTRIAN : OBJTYPE_CAR;
+            o.Position_X     = 15.0f + 6.0f * (float)i - 0.001f * (float)(id % 5000u);
+            o.Position_Y     = (i == 1) ? (3.0f - 0.0005f * (float)(id % 6000u)) : 3.5f * (float)((i % 3) - 1);
+            o.Position_Z     = 0.0f;
+            o.Velocity_X     = (i == 1) ? 0.0f : ego - 1.0f;
+            o.Velocity_Y     = (i == 1) ? -0.05f : 0.0f;
+            o.Accel_X        = 0.0f;
+            o.Accel_Y        = 0.0f;
+            o.Heading        = 0.0f;
+            o.Distance       = std::sqrt(o.Position_X * o.Position_X + o.Position_Y * o.Position_Y);
+            o.Object_Status  = OBJSTAT_MOVING;
+            o.Object_Cell_ID = 0;
+        }
+    }
+
+    /* 읽은 프레임이 Frame_Id 와 일관적인지 (찢어짐 검사) */
+    static bool consistent(const SimSensorFrame_t &f)
+    {
+        if (f.Object_Count != SIM_BRIDGE_MAX_OBJECTS) return false;
+        if (f.Time.Current_Time != 10.0f * (float)f.Frame_Id) return false;
+        for (int i = 0; i < SIM_BRIDGE_MAX_OBJECTS; i++) {
+            if (f.Objects[i].Object_ID != (int)(f.Frame_Id * SIM_BRIDGE_MAX_OBJECTS + (uint64_t)i)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    SimBridgeRegion_t *region_;
+    uint64_t           frameId_ = 0;
+};
+
+} /* namespace adas */
+
+#endif /* SIM_BRIDGE_PRODUCER_HPP */
@@ -0,0 +1,211 @@
+/*********************************************************************
+ * sim_bridge_test.cpp  ―  공유메모리 시뮬레이터 브리지
+ * DUT : sim_bridge.c (seqlock 이중 버퍼 센서 / 제어 출력)
+ * 생산자 : adas::SimStandInProducer (sim_bridge_producer.hpp)
+ *********************************************************************/
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+#include "sim_bridge_producer.hpp"
+
+class SimBridgeTest : public ::testing::Test
+{
+protected:
+    std::unique_ptr<SimBridgeRegion_t> region{ new SimBridgeRegion_t };
+
+    void SetUp() override { ASSERT_EQ(sim_bridge_init(region.get()), 0); }
+};
+
+/* 게시 → 제자리 읽기 → 제어 출력 왕복 */
+TEST_F(SimBridgeTest, TC_SIMB_EQ_01_RoundTrip)
+{
+    adas::SimStandInProducer prod(region.get());
+    SimReadToken_t tok;
+    EXPECT_EQ(sim_bridge_sensor_begin_read(region.get(), &tok), nullptr);   /* 게시 전 */
+
+    uint64_t id = prod.publishNext();
+    const SimSensorFrame_t *f = sim_bridge_sensor_begin_read(region.get(), &tok);
+    ASSERT_NE(f, nullptr);
+    EXPECT_EQ(f->Frame_Id, id);
+    EXPECT_TRUE(adas::SimStandInProducer::consistent(*f));
+    EXPECT_TRUE(sim_bridge_sensor_end_read(region.get(), &tok));
+
+    /* 공유 영역 안을 가리킴 (복사 없음) */
+    EXPECT_GE((const void *)f, (const void *)region.get());
+    EXPECT_LT((const void *)f, (const void *)(region.get() + 1));
+
+    SimControlFrame_t c;
+    EXPECT_FALSE(prod.pollControl(id, &c));
+    VehicleControl_t vc{ 0.3f, 0.0f, -0.1f };
+    sim_bridge_control_publish(region.get(), f->Frame_Id, &vc);
+    ASSERT_TRUE(prod.pollControl(id, &c));
+    EXPECT_EQ(c.Frame_Id, id);
+    EXPECT_FLOAT_EQ(c.Control.throttle, 0.3f);
+    EXPECT_FLOAT_EQ(c.Control.steer, -0.1f);
+}
+
+/* 읽는 중 생산자가 같은 슬롯을 다시 쓰면 end_read 실패 */
+TEST_F(SimBridgeTest, TC_SIMB_BV_01_OverwriteDetected)
+{
+    adas::SimStandInProducer prod(region.get());
+    prod.publishNext();
+    SimReadToken_t tok;
+    const SimSensorFrame_t *f = sim_bridge_sensor_begin_read(region.get(), &tok);
+    ASSERT_NE(f, nullptr);
+
+    prod.publishNext();                                     /* 다른 슬롯 : 영향 없음 */
+    EXPECT_TRUE(sim_bridge_sensor_end_read(region.get(), &tok));
+
+    prod.publishNext();                                     /* 같은 슬롯 재기록 */
+    EXPECT_FALSE(sim_bridge_sensor_end_read(region.get(), &tok));
+
+    /* 기록 중(홀수 seq) 슬롯만 남은 경우 : 최신 게시 슬롯을 돌려줌 */
+    sim_bridge_sensor_begin_write(region.get());
+    f = sim_bridge_sensor_begin_read(region.get(), &tok);
+    ASSERT_NE(f, nullptr);
+    EXPECT_EQ(f->Frame_Id, prod.lastFrameId());
+    sim_bridge_sensor_end_write(region.get());
+}
+
+/* 검증 전 객체 수 : 찢어진 / 손상된 값도 Objects 범위 안으로 제한 */
+TEST_F(SimBridgeTest, TC_SIMB_BV_02_ObjectCountClamp)
+{
+    SimSensorFrame_t *w = sim_bridge_sensor_begin_write(region.get());
+    ASSERT_NE(w, nullptr);
+    w->Frame_Id = 1;
+    w->Object_Count = 10;
+    sim_bridge_sensor_end_write(region.get());
+
+    SimReadToken_t tok;
+    const SimSensorFrame_t *f = sim_bridge_sensor_begin_read(region.get(), &tok);
+    ASSERT_NE(f, nullptr);
+    EXPECT_EQ(sim_bridge_sensor_object_count(f), 10);
+
+    SimSensorFrame_t bad = *f;
+    const int32_t counts[]   = { -1, INT32_MIN, SIM_BRIDGE_MAX_OBJECTS, SIM_BRIDGE_MAX_OBJECTS + 1, INT32_MAX };
+    const int     expected[] = { 0, 0, SIM_BRIDGE_MAX_OBJECTS, SIM_BRIDGE_MAX_OBJECTS, SIM_BRIDGE_MAX_OBJECTS };
+    for (size_t i = 0; i < sizeof(counts) / sizeof(counts[0]); i++) {
+        bad.Object_Count = counts[i];
+        EXPECT_EQ(sim_bridge_sensor_object_count(&bad), expected[i]);
+    }
+    EXPECT_EQ(sim_bridge_sensor_object_count(nullptr), 0);
+}
+
+/* 생산자/제어기 스레드 동시 구동 : 유효 판정된 읽기는 항상 일관적 */
+TEST_F(SimBridgeTest, TC_SIMB_RA_01_ConcurrentNoTornAccept)
+{
+    std::atomic<bool> stop{ false };
+    std::thread producer([&] {
+        adas::SimStandInProducer prod(region.get());
+        for (int i = 0; i < 20000 && !stop.load(); i++) {
+            prod.publishNext();
+            if ((i & 7) == 0) std::this_thread::yield();
+        }
+        stop.store(true);
+    });
+
+    uint64_t lastId = 0;
+    int accepted = 0, rejected = 0;
+    while (!stop.load()) {
+        SimReadToken_t tok;
+        const SimSensorFrame_t *f = sim_bridge_sensor_begin_read(region.get(), &tok);
+        if (!f) { std::this_thread::yield(); continue; }
+        SimSensorFrame_t snapshot = *f;                     /* 검사용 사본 (제어기는 제자리 사용) */
+        if (!sim_bridge_sensor_end_read(region.get(), &tok)) {
+            rejected++;
+            continue;
+        }
+        ASSERT_TRUE(adas::SimStandInProducer::consistent(snapshot)) << snapshot.Frame_Id;
+        ASSERT_GE(snapshot.Frame_Id, lastId);
+        lastId = snapshot.Frame_Id;
+        accepted++;
+        VehicleControl_t vc{ 0.0f, 0.0f, 0.0f };
+        sim_bridge_control_publish(region.get(), snapshot.Frame_Id, &vc);
+    }
+    producer.join();
+    EXPECT_GT(accepted, 0);
+    RecordProperty("rejected", rejected);
+}
+
+/* 왕복 비용 (게시 + 읽기/검증 + 제어 게시 + 제어 읽기) : 한 자릿수 µs 이하 */
+TEST_F(SimBridgeTest, TC_SIMB_RA_02_RoundTripCost)
+{
+    adas::SimStandInProducer prod(region.get());
+    const int N = 20000;
+    std::vector<double> ns;
+    ns.reserve(N);
+    for (int i = 0; i < N; i++) {
+        auto t0 = std::chrono::steady_clock::now();
+        uint64_t id = prod.publishNext();
+        SimReadToken_t tok;
+        const SimSensorFrame_t *f = sim_bridge_sensor_begin_read(region.get(), &tok);
+        ASSERT_NE(f, nullptr);
+        VehicleControl_t vc{ f->Gps.GPS_Velocity_X * 0.01f, 0.0f, f->Lane.Lane_Offset };
+        ASSERT_TRUE(sim_bridge_sensor_end_read(region.get(), &tok));
+        sim_bridge_control_publish(region.get(), f->Frame_Id, &vc);
+        SimControlFrame_t c;
+        ASSERT_TRUE(prod.pollControl(id, &c));
+        ns.push_back(std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count());
+    }
+    std::sort(ns.begin(), ns.end());
+    RecordProperty("p50_ns", (int)ns[N / 2]);
+    RecordProperty("p99_ns", (int)ns[N * 99 / 100]);
+    EXPECT_LT(ns[N / 2], 10000.0);
+}
+
+/* POSIX shm : 생성 측 / attach 측 별도 매핑 */
+TEST_F(SimBridgeTest, TC_SIMB_RA_03_PosixShm)
+{
+    std::string name = "/adas_bridge_test_" + std::to_string((long)getpid());
+    SimBridgeRegion_t *prodMap = sim_bridge_shm_open(name.c_str(), true);
+    if (!prodMap) {
+        GTEST_SKIP() << "shm_open 불가 환경";
+    }
+    SimBridgeRegion_t *ctrlMap = sim_bridge_shm_open(name.c_str(), false);
+    ASSERT_NE(ctrlMap, nullptr);
+    ASSERT_NE(prodMap, ctrlMap);
+
+    adas::SimStandInProducer prod(prodMap);
+    uint64_t id = prod.publishNext();
+    SimReadToken_t tok;
+    const SimSensorFrame_t *f = sim_bridge_sensor_begin_read(ctrlMap, &tok);
+    ASSERT_NE(f, nullptr);
+    EXPECT_EQ(f->Frame_Id, id);
+    EXPECT_TRUE(sim_bridge_sensor_end_read(ctrlMap, &tok));
+
+    VehicleControl_t vc{ 0.0f, 0.5f, 0.0f };
+    sim_bridge_control_publish(ctrlMap, id, &vc);
+    SimControlFrame_t c;
+    ASSERT_TRUE(prod.pollControl(id, &c));
+    EXPECT_FLOAT_EQ(c.Control.brake, 0.5f);
+
+    sim_bridge_shm_close(ctrlMap, nullptr);
+    sim_bridge_shm_close(prodMap, name.c_str());
+    EXPECT_EQ(sim_bridge_shm_open(name.c_str(), false), nullptr);   /* unlink 후 attach 불가 */
+}
+
+/* 무효 입력 / 비호환 영역 */
+TEST_F(SimBridgeTest, TC_SIMB_RA_04_Invalid)
+{
+    EXPECT_EQ(sim_bridge_init(nullptr), -1);
+    EXPECT_EQ(sim_bridge_check(region.get()), 0);
+    region->Version = SIM_BRIDGE_VERSION + 1;
+    EXPECT_EQ(sim_bridge_check(region.get()), -1);
+
+    SimReadToken_t tok{};
+    SimControlFrame_t c;
+    EXPECT_EQ(sim_bridge_sensor_begin_write(nullptr), nullptr);
+    EXPECT_EQ(sim_bridge_sensor_begin_read(nullptr, &tok), nullptr);
+    EXPECT_FALSE(sim_bridge_sensor_end_read(nullptr, &tok));
+    EXPECT_FALSE(sim_bridge_control_read(region.get(), &c));          /* 미게시 */
+    EXPECT_EQ(sim_bridge_shm_open(nullptr, false), nullptr);
+}
@@ -3,15 +3,182 @@
 #include <stdio.h>
 
 #include "target_selection.h"
+#include "fast_math.h"
+#include "lane_geometry.h"
 
 /* ----------------------------------------------------------------
  * 내부 유틸: heading 정규화 (±180°)
  * ---------------------------------------------------------------*/
 static float normalize_heading(float hdg)
 {
+#ifdef ADAS_USE_FAST_MATH
+    return adas_wrap_deg180(hdg);
+#else
+    /* 큰 값 / ±inf 는 fmodf 로 먼저 줄여 반복 횟수 상한 1 회 (|hdg| < 2^27 에서 결과 동일, NaN 그대로) */
+    if (!(fabsf(hdg) <= 540.0f)) hdg = fmodf(hdg, 360.0f);
     while (hdg > 180.0f)   hdg -= 360.0f;
     while (hdg < -180.0f)  hdg += 360.0f;
     return hdg;
+#endif
+}
+
+/* ----------------------------------------------------------------
+ * 곡선 차로 보정 항 (호출당 1 회 : 횡방향 한계, cos(Heading Error))
+ * ---------------------------------------------------------------*/
+void target_curve_terms(const LaneSelectOutput_t *pLsData, TargetCurveTerms_t *pTerms)
+{
+    if (!pLsData || !pTerms) return;
+
+    float Heading_Error_Coeff = 0.05f;
+    float Adjusted_Lateral_Threshold = pLsData->LS_Lane_Width * 0.5f;
+
+    if (pLsData->LS_Is_Curved_Lane && fabsf(pLsData->LS_Heading_Error) > 1.0f) {
+        /* 곡선이면 차선 너비 + (fabs(Heading_Error) * 계수) */
+        Adjusted_Lateral_Threshold += fabsf(pLsData->LS_Heading_Error) * Heading_Error_Coeff;
+    }
+    pTerms->Lateral_Threshold = Adjusted_Lateral_Threshold;
+    pTerms->Curved            = pLsData->LS_Is_Curved_Lane;
+    pTerms->Cos_Heading       = 1.0f;
+    if (pLsData->LS_Is_Curved_Lane) {
+        float he_rad = pLsData->LS_Heading_Error * (float)M_PI / 180.0f;
+        pTerms->Cos_Heading = ADAS_COSF(he_rad);
+    }
+}
+
+void target_curve_memo_reset(TargetCurveMemo_t *pMemo)
+{
+    if (!pMemo) return;
+    memset(pMemo, 0, sizeof(*pMemo));
+}
+
+const TargetCurveTerms_t *target_curve_terms_memo(TargetCurveMemo_t *pMemo,
+                                                  const LaneSelectOutput_t *pLsData)
+{
+    if (!pMemo || !pLsData) return NULL;
+
+    /* 키 : 직선이면 Heading Error 무관 */
+    float key[3];
+    key[0] = pLsData->LS_Is_Curved_Lane ? 1.0f : 0.0f;
+    key[1] = pLsData->LS_Is_Curved_Lane ? pLsData->LS_Heading_Error : 0.0f;
+    key[2] = pLsData->LS_Lane_Width;
+
+    pMemo->Calls++;
+    if (pMemo->Valid && memcmp(pMemo->Key, key, sizeof(key)) == 0) {
+        pMemo->Hits++;
+    } else {
+        target_curve_terms(pLsData, &pMemo->Terms);
+        memcpy(pMemo->Key, key, sizeof(key));
+        pMemo->Valid = 1;
+    }
+    return &pMemo->Terms;
+}
+
+/* ----------------------------------------------------------------
+ * 내부 유틸: 객체 1 개 선별 (범위/횡방향 필터, 상태 분류, 셀 번호)
+ *   - 객체 리스트 / 압축 뷰 입력이 공용으로 사용
+ *   - return false : 제외
+ * ---------------------------------------------------------------*/
+static bool filter_object(float distance, float positionY, float velocityX, float heading,
+                          ObjectStatus_e inStatus,
+                          const EgoData_t *pEgoData, const LaneSelectOutput_t *pLsData,
+                          const TargetCurveTerms_t *pTerms,
+                          ObjectStatus_e *pStatus, float *pDistance, int *pCell)
+{
+    const float LATERAL_EPS = 1e-3f;
+    const float Adjusted_Lateral_Threshold = pTerms->Lateral_Threshold;
+
+    /* 1) 범위 필터링: 거리 200m 이하 */
+    if (distance > 200.0f) {
+        return false;
+    }
+
+    /* 2) 횡방향 필터링: Lateral Position = Obj.PositionY - LS_Lane_Offset */
+    float Object_Lateral_Position = positionY - pLsData->LS_Lane_Offset;
+    float Lane_Center_Offset = fabsf(Object_Lateral_Position);
+
+    float quarterW = pLsData->LS_Lane_Width * 0.25f;
+    float threeQW  = pLsData->LS_Lane_Width * 0.75f;
+
+    if (Lane_Center_Offset > (Adjusted_Lateral_Threshold + LATERAL_EPS)) {
+        return false; /* 최종 한계 초과 시 제외 */
+    }
+    if (Lane_Center_Offset > (pLsData->LS_Lane_Width * 0.5f + LATERAL_EPS) &&
+        Lane_Center_Offset < (threeQW - LATERAL_EPS)) {
+        return false; /* 50% 초과 ~ 75% 미만이면 제외 */
+    }
+
+    /* 3) 상태 분류 */
+    float Relative_Velocity = velocityX - pEgoData->Ego_Velocity_X;
+    float Heading_Difference = fabsf(heading - pEgoData->Ego_Heading);
+    if (Heading_Difference > 180.0f) {
+        Heading_Difference = 360.0f - Heading_Difference;
+    }
+
+    ObjectStatus_e finalStatus = inStatus; /* 우선은 입력된 값으로 초기 */
+
+    /* Oncoming check */
+    if (Heading_Difference >= 150.0f) {
+        finalStatus = OBJSTAT_ONCOMING;
+    }
+    else {
+        /* Moving vs. Stationary: |RelativeVel| >= 0.5 => Moving, else => Stationary */
+        if (fabsf(Relative_Velocity) >= 0.5f) {
+            finalStatus = OBJSTAT_MOVING;
+        }
+        else {
+            /* 정밀하게 구분하려면 "이전 상태가 Moving이었으면 Stopped", ... 
+               여기서는 설계서에 "나머지는 Stationary"라고 단순 처리
+               (이력 기반 Stopped 구분 : object_status_update 후처리) */
+            finalStatus = OBJSTAT_STATIONARY;
+        }
+    }
+
+    /* 4) 곡선 차로 => 거리 보정 */
+    float Adjusted_Object_Distance = distance;
+    if (pTerms->Curved) {
+        float c = pTerms->Cos_Heading;
+        if (fabsf(c) > 1.0e-3f) {
+            Adjusted_Object_Distance = distance / c;
+        }
+    }
+
+    /* 5) 셀 번호 부여 (Base_CellNumber) */
+    int Base_CellNumber = 1;
+    if (Adjusted_Object_Distance <= 60.0f) {
+        Base_CellNumber = 1 + (int)(Adjusted_Object_Distance / 10.0f);
+        if (Base_CellNumber > 6)  Base_CellNumber = 6;
+    }
+    else if (Adjusted_Object_Distance < 120.0f) {
+        float x = Adjusted_Object_Distance - 60.0f;
+        Base_CellNumber = 7 + (int)(x / 10.0f);
+        if (Base_CellNumber > 12) Base_CellNumber = 12;
+    }
+    else {
+        float x = Adjusted_Object_Distance - 120.0f;
+        int delta = (int)floorf(x/10.0f);   // floorf 사용
+        Base_CellNumber = 13 + delta;
+    }
+
+    /* 횡방향 위치 보정 offset => -1, 0, +1 */
+    int   Offset_Adjustment   = 0;
+    if (Lane_Center_Offset <= quarterW) {
+        Offset_Adjustment = -1;
+    }
+    else if (Lane_Center_Offset >= threeQW) {
+        Offset_Adjustment = +1;
+    }
+    else {
+        Offset_Adjustment = 0;
+    }
+
+    int CellNumber = Base_CellNumber + Offset_Adjustment;
+    if (CellNumber < 1)  CellNumber = 1;
+    if (CellNumber > 20) CellNumber = 20;
+
+    *pStatus   = finalStatus;
+    *pDistance = Adjusted_Object_Distance;
+    *pCell     = CellNumber;
+    return true;
 }
 
 /*======================================================================
@@ -24,6 +191,18 @@ int select_target_from_object_list(const ObjectData_t *pObjList,
                                    const LaneSelectOutput_t *pLsData,
                                    FilteredObject_t  *pFilteredList, 
                                    int                maxFilteredCount)
+{
+    return select_target_from_object_list_terms(pObjList, objCount, pEgoData, pLsData, NULL,
+                                                pFilteredList, maxFilteredCount);
+}
+
+int select_target_from_object_list_terms(const ObjectData_t       *pObjList,
+                                         int                       objCount,
+                                         const EgoData_t          *pEgoData,
+                                         const LaneSelectOutput_t *pLsData,
+                                         const TargetCurveTerms_t *pTerms,
+                                         FilteredObject_t         *pFilteredList,
+                                         int                       maxFilteredCount)
 {
     if (!pObjList || !pEgoData || !pLsData || !pFilteredList 
         || objCount <= 0 || maxFilteredCount <= 0) 
@@ -32,15 +211,10 @@ int select_target_from_object_list(const ObjectData_t *pObjList,
     }
 
     int filteredIndex = 0;
-
-    /* 곡선 차로 보정 계수 */
-    const float LATERAL_EPS   = 1e-3f;
-    float Heading_Error_Coeff = 0.05f;
-    float Adjusted_Lateral_Threshold = pLsData->LS_Lane_Width * 0.5f;
-
-    if (pLsData->LS_Is_Curved_Lane && fabsf(pLsData->LS_Heading_Error) > 1.0f) {
-        /* 곡선이면 차선 너비 + (fabs(Heading_Error) * 계수) */
-        Adjusted_Lateral_Threshold += fabsf(pLsData->LS_Heading_Error) * Heading_Error_Coeff;
+    TargetCurveTerms_t terms;
+    if (!pTerms) {
+        target_curve_terms(pLsData, &terms);
+        pTerms = &terms;
     }
 
     for (int i = 0; i < objCount; i++)
@@ -49,113 +223,179 @@ int select_target_from_object_list(const ObjectData_t *pObjList,
             break;
 
         const ObjectData_t *obj = &pObjList[i];
+        ObjectStatus_e finalStatus;
+        float Adjusted_Object_Distance;
+        int   CellNumber;
 
-        /* 1) 범위 필터링: 거리 200m 이하 */
-        if (obj->Distance > 200.0f) {
+        if (!filter_object(obj->Distance, obj->Position_Y, obj->Velocity_X, obj->Heading,
+                           obj->Object_Status, pEgoData, pLsData, pTerms,
+                           &finalStatus, &Adjusted_Object_Distance, &CellNumber)) {
             continue;
         }
 
-        /* 2) 횡방향 필터링: Lateral Position = Obj.PositionY - LS_Lane_Offset */
-        float Object_Lateral_Position = obj->Position_Y - pLsData->LS_Lane_Offset;
-        float Lane_Center_Offset = fabsf(Object_Lateral_Position);
+        /* 최종 Filtered Object 구성 */
+        FilteredObject_t *fObj = &pFilteredList[filteredIndex++];
+        fObj->Filtered_Object_ID           = obj->Object_ID;
+        fObj->Filtered_Object_Type         = obj->Object_Type;
+        fObj->Filtered_Position_X          = obj->Position_X;
+        fObj->Filtered_Position_Y          = obj->Position_Y;
+        fObj->Filtered_Position_Z          = obj->Position_Z;
+        fObj->Filtered_Velocity_X          = obj->Velocity_X;
+        fObj->Filtered_Velocity_Y          = obj->Velocity_Y;
+        fObj->Filtered_Accel_X             = obj->Accel_X;
+        fObj->Filtered_Accel_Y             = obj->Accel_Y;
+        fObj->Filtered_Heading             = normalize_heading(obj->Heading);
+        fObj->Filtered_Distance            = Adjusted_Object_Distance;
+        fObj->Filtered_Object_Status       = finalStatus;
+        fObj->Filtered_Object_Cell_ID      = CellNumber;
+    }
+
+    return filteredIndex; /* 필터링된 객체 수 */
+}
 
-        float quarterW = pLsData->LS_Lane_Width * 0.25f;
-        float threeQW  = pLsData->LS_Lane_Width * 0.75f;
+/*======================================================================
+ * 1-1) select_target_from_object_view
+ *    - select_target_from_object_list 와 동일 판정, 압축 뷰를 제자리에서 읽음
+ *    - 판정에 필요한 4 개 필드만 먼저 읽고, 나머지는 선별된 객체만 읽음
+ *======================================================================*/
+int select_target_from_object_view(const ObjectWireView_t   *pView,
+                                   const EgoData_t          *pEgoData,
+                                   const LaneSelectOutput_t *pLsData,
+                                   FilteredObject_t         *pFilteredList,
+                                   int                       maxFilteredCount)
+{
+    if (!pView || !pEgoData || !pLsData || !pFilteredList
+        || pView->Count <= 0 || maxFilteredCount <= 0)
+    {
+        return 0;
+    }
 
-        if (Lane_Center_Offset > (Adjusted_Lateral_Threshold + LATERAL_EPS)) {
-            continue; /* 최종 한계 초과 시 제외 */
-        }
-        if (Lane_Center_Offset > (pLsData->LS_Lane_Width * 0.5f + LATERAL_EPS) &&
-            Lane_Center_Offset < (threeQW - LATERAL_EPS)) {
-            continue; /* 50% 초과 ~ 75% 미만이면 제외 */
-        }
+    int filteredIndex = 0;
+    TargetCurveTerms_t terms;
+    target_curve_terms(pLsData, &terms);
+
+    for (int i = 0; i < pView->Count; i++)
+    {
+        if (filteredIndex >= maxFilteredCount)
+            break;
 
-        /* 3) 상태 분류 */
-        float Relative_Velocity = obj->Velocity_X - pEgoData->Ego_Velocity_X;
-        float Heading_Difference = fabsf(obj->Heading - pEgoData->Ego_Heading);
-        if (Heading_Difference > 180.0f) {
-            Heading_Difference = 360.0f - Heading_Difference;
+        float heading = object_wire_f(pView, OBJWIRE_Q_HEADING, i);
+        ObjectStatus_e finalStatus;
+        float Adjusted_Object_Distance;
+        int   CellNumber;
+
+        if (!filter_object(object_wire_f(pView, OBJWIRE_Q_DISTANCE, i),
+                           object_wire_f(pView, OBJWIRE_Q_POS_Y, i),
+                           object_wire_f(pView, OBJWIRE_Q_VEL_X, i),
+                           heading, object_wire_status(pView, i),
+                           pEgoData, pLsData, &terms,
+                           &finalStatus, &Adjusted_Object_Distance, &CellNumber)) {
+            continue;
         }
 
-        ObjectStatus_e finalStatus = obj->Object_Status; /* 우선은 입력된 값으로 초기 */
+        FilteredObject_t *fObj = &pFilteredList[filteredIndex++];
+        fObj->Filtered_Object_ID           = object_wire_id(pView, i);
+        fObj->Filtered_Object_Type         = object_wire_type(pView, i);
+        fObj->Filtered_Position_X          = object_wire_f(pView, OBJWIRE_Q_POS_X, i);
+        fObj->Filtered_Position_Y          = object_wire_f(pView, OBJWIRE_Q_POS_Y, i);
+        fObj->Filtered_Position_Z          = object_wire_f(pView, OBJWIRE_Q_POS_Z, i);
+        fObj->Filtered_Velocity_X          = object_wire_f(pView, OBJWIRE_Q_VEL_X, i);
+        fObj->Filtered_Velocity_Y          = object_wire_f(pView, OBJWIRE_Q_VEL_Y, i);
+        fObj->Filtered_Accel_X             = object_wire_f(pView, OBJWIRE_Q_ACC_X, i);
+        fObj->Filtered_Accel_Y             = object_wire_f(pView, OBJWIRE_Q_ACC_Y, i);
+        fObj->Filtered_Heading             = normalize_heading(heading);
+        fObj->Filtered_Distance            = Adjusted_Object_Distance;
+        fObj->Filtered_Object_Status       = finalStatus;
+        fObj->Filtered_Object_Cell_ID      = CellNumber;
+    }
 
-        /* Oncoming check */
-        if (Heading_Difference >= 150.0f) {
-            finalStatus = OBJSTAT_ONCOMING;
-        }
-        else {
-            /* Moving vs. Stationary: |RelativeVel| >= 0.5 => Moving, else => Stationary */
-            if (fabsf(Relative_Velocity) >= 0.5f) {
-                finalStatus = OBJSTAT_MOVING;
-            }
-            else {
-                /* 정밀하게 구분하려면 "이전 상태가 Moving이었으면 Stopped", ... 
-                   여기서는 설계서에 "나머지는 Stationary"라고 단순 처리 */
-                finalStatus = OBJSTAT_STATIONARY;
-            }
-        }
+    return filteredIndex;
+}
 
-        /* 4) 곡선 차로 => 거리 보정 */
-        float Adjusted_Object_Distance = obj->Distance;
-        if (pLsData->LS_Is_Curved_Lane) {
-            float he_rad = pLsData->LS_Heading_Error * (float)M_PI / 180.0f;
-            float c = cosf(he_rad);
-            if (fabsf(c) > 1.0e-3f) {
-                Adjusted_Object_Distance = obj->Distance / c;
-            }
-        }
+/*======================================================================
+ * 1-2) select_target_from_object_compact
+ *    - select_target_from_object_list 와 동일 판정, Hot 32 B 레코드만 스캔
+ *    - Cold(위치 Z, 가속도 Y)는 선별된 객체만 읽음 (Cell ID 는 판정에서 새로 산출)
+ *======================================================================*/
+int select_target_from_object_compact(const ObjCompact_t       *pHot,
+                                      const ObjCompactCold_t   *pCold,
+                                      int                       objCount,
+                                      const EgoData_t          *pEgoData,
+                                      const LaneSelectOutput_t *pLsData,
+                                      FilteredObject_t         *pFilteredList,
+                                      int                       maxFilteredCount)
+{
+    if (!pHot || !pEgoData || !pLsData || !pFilteredList
+        || objCount <= 0 || maxFilteredCount <= 0)
+    {
+        return 0;
+    }
 
-        /* 5) 셀 번호 부여 (Base_CellNumber) */
-        int Base_CellNumber = 1;
-        if (Adjusted_Object_Distance <= 60.0f) {
-            Base_CellNumber = 1 + (int)(Adjusted_Object_Distance / 10.0f);
-            if (Base_CellNumber > 6)  Base_CellNumber = 6;
-        }
-        else if (Adjusted_Object_Distance < 120.0f) {
-            float x = Adjusted_Object_Distance - 60.0f;
-            Base_CellNumber = 7 + (int)(x / 10.0f);
-            if (Base_CellNumber > 12) Base_CellNumber = 12;
-        }
-        else {
-            float x = Adjusted_Object_Distance - 120.0f;
-            int delta = (int)floorf(x/10.0f);   // floorf 사용
-            Base_CellNumber = 13 + delta;
-        }
+    int filteredIndex = 0;
+    TargetCurveTerms_t terms;
+    target_curve_terms(pLsData, &terms);
 
-        /* 횡방향 위치 보정 offset => -1, 0, +1 */
-        int   Offset_Adjustment   = 0;
-        if (Lane_Center_Offset <= quarterW) {
-            Offset_Adjustment = -1;
-        }
-        else if (Lane_Center_Offset >= threeQW) {
-            Offset_Adjustment = +1;
-        }
-        else {
-            Offset_Adjustment = 0;
-        }
+    for (int i = 0; i < objCount; i++)
+    {
+        if (filteredIndex >= maxFilteredCount)
+            break;
 
-        int CellNumber = Base_CellNumber + Offset_Adjustment;
-        if (CellNumber < 1)  CellNumber = 1;
-        if (CellNumber > 20) CellNumber = 20;
+        const ObjCompact_t *obj = &pHot[i];
+        ObjectStatus_e finalStatus;
+        float Adjusted_Object_Distance;
+        int   CellNumber;
+
+        if (!filter_object(obj->Distance, obj->Position_Y, obj->Velocity_X, obj->Heading,
+                           obj_compact_status(obj), pEgoData, pLsData, &terms,
+                           &finalStatus, &Adjusted_Object_Distance, &CellNumber)) {
+            continue;
+        }
 
-        /* 최종 Filtered Object 구성 */
         FilteredObject_t *fObj = &pFilteredList[filteredIndex++];
         fObj->Filtered_Object_ID           = obj->Object_ID;
-        fObj->Filtered_Object_Type         = obj->Object_Type;
+        fObj->Filtered_Object_Type         = (ObjectType_e)obj->Object_Type;
         fObj->Filtered_Position_X          = obj->Position_X;
         fObj->Filtered_Position_Y          = obj->Position_Y;
-        fObj->Filtered_Position_Z          = obj->Position_Z;
+        fObj->Filtered_Position_Z          = pCold ? pCold[i].Position_Z : 0.0f;
         fObj->Filtered_Velocity_X          = obj->Velocity_X;
         fObj->Filtered_Velocity_Y          = obj->Velocity_Y;
         fObj->Filtered_Accel_X             = obj->Accel_X;
-        fObj->Filtered_Accel_Y             = obj->Accel_Y;
+        fObj->Filtered_Accel_Y             = pCold ? pCold[i].Accel_Y : 0.0f;
         fObj->Filtered_Heading             = normalize_heading(obj->Heading);
         fObj->Filtered_Distance            = Adjusted_Object_Distance;
         fObj->Filtered_Object_Status       = finalStatus;
         fObj->Filtered_Object_Cell_ID      = CellNumber;
     }
 
-    return filteredIndex; /* 필터링된 객체 수 */
+    return filteredIndex;
+}
+
+/* ----------------------------------------------------------------
+ * 내부 유틸: 예측 위치/속도 기준 Cut-in / Cut-out 판단
+ * ---------------------------------------------------------------*/
+static void evaluate_cut_flags(PredictedObject_t *po, const LaneSelectOutput_t *pLsData)
+{
+    float vx = po->Predicted_Velocity_X;
+    float vy = po->Predicted_Velocity_Y;
+    float Object_Lateral_Position = po->Predicted_Position_Y - pLsData->LS_Lane_Offset;
+    float CutIn_Threshold = 0.85f;
+    float Ego_Lane_Boundary = pLsData->LS_Lane_Width * 0.5f;
+
+    po->CutIn_Flag  = false;
+    po->CutOut_Flag = false;
+
+    /* Cut-in */
+    if ((vx >= 0.5f) && (fabsf(vy) >= 0.2f) 
+         && (fabsf(Object_Lateral_Position) <= CutIn_Threshold))
+    {
+        po->CutIn_Flag = true;
+    }
+    /* Cut-out */
+    if ((fabsf(vy) >= 0.2f) 
+         && (fabsf(Object_Lateral_Position) > (Ego_Lane_Boundary + CutIn_Threshold)))
+    {
+        po->CutOut_Flag = true;
+    }
 }
 
 /*======================================================================
@@ -175,7 +415,7 @@ int predict_object_future_path(const FilteredObject_t *pFilteredList,
         return 0;
     }
     int predIndex = 0;
-    float t_predict = 3.0f;  /* 3초 예측 시간 */
+    float t_predict = PREDICT_HORIZON_S;  /* 3초 예측 시간 */
 
     for (int i = 0; i < filteredCount; i++)
     {
@@ -231,30 +471,188 @@ int predict_object_future_path(const FilteredObject_t *pFilteredList,
         po->Predicted_Distance = dist;
 
         /* CutIn_Flag, CutOut_Flag 판단 */
-        po->CutIn_Flag  = false;
-        po->CutOut_Flag = false;
+        evaluate_cut_flags(po, pLsData);
+    }
 
-        {
-            float Object_Lateral_Position = po->Predicted_Position_Y - pLsData->LS_Lane_Offset;
-            float CutIn_Threshold = 0.85f;
-            float Ego_Lane_Boundary = pLsData->LS_Lane_Width * 0.5f;
-
-            /* Cut-in */
-            if ((vx >= 0.5f) && (fabsf(vy) >= 0.2f) 
-                 && (fabsf(Object_Lateral_Position) <= CutIn_Threshold))
-            {
-                po->CutIn_Flag = true;
-            }
-            /* Cut-out */
-            if ((fabsf(vy) >= 0.2f) 
-                 && (fabsf(Object_Lateral_Position) > (Ego_Lane_Boundary + CutIn_Threshold)))
-            {
-                po->CutOut_Flag = true;
-            }
+    return predIndex; 
+}
+
+/*======================================================================
+ * 2-1) predict_object_future_path_tracked
+ *    - 기본 예측 후, 트랙(Age ≥ 1)이 있는 객체는 필터 상태로 덮어씀
+ *======================================================================*/
+int predict_object_future_path_tracked(const FilteredObject_t   *pFilteredList,
+                                       int                       filteredCount,
+                                       const LaneData_t         *pLaneWp,
+                                       const LaneSelectOutput_t *pLsData,
+                                       const ObjectTrackTable_t *pTracks,
+                                       PredictedObject_t        *pPredList,
+                                       int                       maxPredCount)
+{
+    int predCount = predict_object_future_path(pFilteredList, filteredCount, pLaneWp,
+                                               pLsData, pPredList, maxPredCount);
+    if (!pTracks) return predCount;
+
+    for (int i = 0; i < predCount; i++)
+    {
+        PredictedObject_t *po = &pPredList[i];
+        int slot = obj_track_find(pTracks, po->Predicted_Object_ID);
+        if (slot < 0 || pTracks->Age[slot] == 0) continue;
+
+        ObjTrackPrediction_t tp;
+        if (obj_track_predict(pTracks, slot, PREDICT_HORIZON_S, &tp) != 0) continue;
+
+        po->Predicted_Position_X = tp.Position_X;
+        po->Predicted_Position_Y = tp.Position_Y;
+        po->Predicted_Velocity_X = tp.Velocity_X;
+        po->Predicted_Velocity_Y = tp.Velocity_Y;
+        po->Predicted_Accel_X    = tp.Accel_X;
+        po->Predicted_Accel_Y    = tp.Accel_Y;
+        po->Predicted_Distance   = sqrtf(tp.Position_X * tp.Position_X
+                                         + tp.Position_Y * tp.Position_Y);
+        evaluate_cut_flags(po, pLsData);
+    }
+    return predCount;
+}
+
+/* ----------------------------------------------------------------
+ * 내부 유틸: ACC / AEB 후보 판정 + 점수 (선정/순위 공용)
+ *   - return false : 후보 아님
+ * ---------------------------------------------------------------*/
+static bool score_acc_candidate(const PredictedObject_t *obj,
+                                const LaneSelectOutput_t *pLsData,
+                                TargetRankEntry_t *pEntry)
+{
+    float py = obj->Predicted_Position_Y;
+
+    /* 정면( |y|<=1.75 ), 타입=car, 상태=Moving/Stopped, cutOut=false */
+    if (!((fabsf(py) <= 1.75f)
+          && (obj->Predicted_Object_Type == OBJTYPE_CAR)
+          && ((obj->Predicted_Object_Status == OBJSTAT_MOVING)
+              ||(obj->Predicted_Object_Status == OBJSTAT_STOPPED))))
+    {
+        return false;
+    }
+
+    /* 점수 = 200-dist + 곡선 추가 보정 */
+    pEntry->Base_Score  = 200.0f - obj->Predicted_Distance;
+    pEntry->Curve_Bonus = 0.0f;
+    pEntry->CutIn_Bonus = 0.0f;
+    pEntry->Ttc_Bonus   = 0.0f;
+    pEntry->Ttc         = 999999.0f;
+
+    float score = pEntry->Base_Score;
+    if (pLsData->LS_Is_Curved_Lane
+        && obj->Predicted_Object_Cell_ID < 5) {
+        pEntry->Curve_Bonus = 10.0f;
+        score += 10.0f;
+    }
+    pEntry->Score = score;
+    return true;
+}
+
+static bool score_aeb_candidate(const PredictedObject_t *obj,
+                                const EgoData_t *pEgoData,
+                                bool Brake_Status,
+                                TargetRankEntry_t *pEntry)
+{
+    float py = obj->Predicted_Position_Y;
+    bool isFront = (fabsf(py) <= 1.75f);
+    bool isSide  = ((fabsf(py) > 1.75f) && (fabsf(py) <= 3.5f));
+    bool aebCandidate = false;
+
+    if (isFront) {
+        /* front + {Moving,Stopped} OR (Stationary & brake_status==true) */
+        if (obj->Predicted_Object_Status == OBJSTAT_MOVING 
+         || obj->Predicted_Object_Status == OBJSTAT_STOPPED) {
+            aebCandidate = true;
         }
+        else if ((obj->Predicted_Object_Status == OBJSTAT_STATIONARY) 
+                  && Brake_Status) {
+            aebCandidate = true;
+        }
+    }
+    else if (isSide) {
+        /* 측면 + cutin => AEB 대상 */
+        if (obj->CutIn_Flag) aebCandidate = true;
+    }
+    if (!aebCandidate) {
+        return false;
     }
 
-    return predIndex; 
+    /* TTC 판단 */
+    float relSpeed = pEgoData->Ego_Velocity_X - obj->Predicted_Velocity_X;
+    float ttc = 999999.0f;
+    if (relSpeed > 0.1f) {
+        ttc = (obj->Predicted_Distance / relSpeed);
+    }
+    /* 점수 = 200-dist + cutin bonus + ttc<3 => +20 */
+    pEntry->Base_Score  = 200.0f - obj->Predicted_Distance;
+    pEntry->Curve_Bonus = 0.0f;
+    pEntry->CutIn_Bonus = 0.0f;
+    pEntry->Ttc_Bonus   = 0.0f;
+    pEntry->Ttc         = ttc;
+
+    float score = pEntry->Base_Score;
+    if (obj->CutIn_Flag) {
+        pEntry->CutIn_Bonus = 30.0f;
+        score += 30.0f; 
+    }
+    if (ttc < 3.0f) {
+        pEntry->Ttc_Bonus = 20.0f;
+        score += 20.0f;
+    }
+    pEntry->Score = score;
+    return true;
+}
+
+/* ----------------------------------------------------------------
+ * 내부 유틸: 선정된 객체 → ACC / AEB 타겟 구조체
+ * ---------------------------------------------------------------*/
+static TargetSituation_e target_situation(const PredictedObject_t *obj,
+                                          const LaneSelectOutput_t *pLsData)
+{
+    /* 상황 (Cut-in/out/Normal etc.) */
+    if (obj->CutIn_Flag) 
+        return TGT_SITU_CUTIN;
+    else if (pLsData->LS_Is_Curved_Lane) 
+        return TGT_SITU_CURVE; /* 예시 */
+    else 
+        return TGT_SITU_NORMAL;
+}
+
+static void fill_acc_target(const PredictedObject_t *obj,
+                            const LaneSelectOutput_t *pLsData,
+                            ACC_Target_t *pAccTarget)
+{
+    pAccTarget->ACC_Target_ID         = obj->Predicted_Object_ID;
+    pAccTarget->ACC_Target_Position_X = obj->Predicted_Position_X;
+    pAccTarget->ACC_Target_Position_Y = obj->Predicted_Position_Y;
+    pAccTarget->ACC_Target_Vel_X      = obj->Predicted_Velocity_X;
+    pAccTarget->ACC_Target_Vel_Y      = obj->Predicted_Velocity_Y;
+    pAccTarget->ACC_Target_Accel_X    = obj->Predicted_Accel_X;
+    pAccTarget->ACC_Target_Accel_Y    = obj->Predicted_Accel_Y;
+    pAccTarget->ACC_Target_Distance   = obj->Predicted_Distance;
+    pAccTarget->ACC_Target_Heading    = obj->Predicted_Heading;
+    pAccTarget->ACC_Target_Status     = obj->Predicted_Object_Status;
+    pAccTarget->ACC_Target_Situation  = target_situation(obj, pLsData);
+}
+
+static void fill_aeb_target(const PredictedObject_t *obj,
+                            const LaneSelectOutput_t *pLsData,
+                            AEB_Target_t *pAebTarget)
+{
+    pAebTarget->AEB_Target_ID         = obj->Predicted_Object_ID;
+    pAebTarget->AEB_Target_Position_X = obj->Predicted_Position_X;
+    pAebTarget->AEB_Target_Position_Y = obj->Predicted_Position_Y;
+    pAebTarget->AEB_Target_Vel_X      = obj->Predicted_Velocity_X;
+    pAebTarget->AEB_Target_Vel_Y      = obj->Predicted_Velocity_Y;
+    pAebTarget->AEB_Target_Accel_X    = obj->Predicted_Accel_X;
+    pAebTarget->AEB_Target_Accel_Y    = obj->Predicted_Accel_Y;
+    pAebTarget->AEB_Target_Distance   = obj->Predicted_Distance;
+    pAebTarget->AEB_Target_Heading    = obj->Predicted_Heading;
+    pAebTarget->AEB_Target_Status     = obj->Predicted_Object_Status;
+    pAebTarget->AEB_Target_Situation  = target_situation(obj, pLsData);
 }
 
 /*======================================================================
@@ -298,126 +696,253 @@ void select_targets_for_acc_aeb(const EgoData_t *pEgoData,
     for (int i = 0; i < predCount; i++)
     {
         const PredictedObject_t *obj = &pPredList[i];
+        TargetRankEntry_t e;
 
         /* Cut-out 제외 */
         if (obj->CutOut_Flag) {
             continue;
         }
-        float px = obj->Predicted_Position_X;
-        float py = obj->Predicted_Position_Y;
-
-        if (px < 0.0f) {
+        if (obj->Predicted_Position_X < 0.0f) {
             /* 후방 => skip */
             continue;
         }
 
-        /*=== ACC 후보 조건 ===*/
-        /* 정면( |y|<=1.75 ), 타입=car, 상태=Moving/Stopped, cutOut=false */
-        if ((fabsf(py) <= 1.75f) 
-            && (obj->Predicted_Object_Type == OBJTYPE_CAR)
-            && ((obj->Predicted_Object_Status == OBJSTAT_MOVING)
-                ||(obj->Predicted_Object_Status == OBJSTAT_STOPPED)))
-        {
-            float dist = obj->Predicted_Distance;
-            /* 점수 = 200-dist + 곡선 추가 보정 */
-            float score = 200.0f - dist;
-            if (pLsData->LS_Is_Curved_Lane 
-                && obj->Predicted_Object_Cell_ID < 5) {
-                score += 10.0f; 
-            }
-            if (score > bestAccScore) {
-                bestAccScore = score;
-                bestAccIdx = i;
-            }
+        /*=== ACC 후보 ===*/
+        if (score_acc_candidate(obj, pLsData, &e) && e.Score > bestAccScore) {
+            bestAccScore = e.Score;
+            bestAccIdx = i;
         }
 
-        /*=== AEB 후보 조건 ===*/
-        bool isFront = (fabsf(py) <= 1.75f);
-        bool isSide  = ((fabsf(py) > 1.75f) && (fabsf(py) <= 3.5f));
-        bool aebCandidate = false;
+        /*=== AEB 후보 ===*/
+        if (score_aeb_candidate(obj, pEgoData, Brake_Status, &e) && e.Score > bestAebScore) {
+            bestAebScore = e.Score;
+            bestAebIdx = i;
+        }
+    }
 
-        if (isFront) {
-            /* front + {Moving,Stopped} OR (Stationary & brake_status==true) */
-            if (obj->Predicted_Object_Status == OBJSTAT_MOVING 
-             || obj->Predicted_Object_Status == OBJSTAT_STOPPED) {
-                aebCandidate = true;
-            }
-            else if ((obj->Predicted_Object_Status == OBJSTAT_STATIONARY) 
-                      && Brake_Status) {
-                aebCandidate = true;
-            }
+    /*=== ACC 최종 타겟 ===*/
+    if (bestAccIdx >= 0) {
+        fill_acc_target(&pPredList[bestAccIdx], pLsData, pAccTarget);
+    }
+
+    /*=== AEB 최종 타겟 ===*/
+    if (bestAebIdx >= 0) {
+        fill_aeb_target(&pPredList[bestAebIdx], pLsData, pAebTarget);
+    }
+}
+
+/*======================================================================
+ * 4) rank_targets_for_acc_aeb
+ *    - 후보 판정/점수는 select_targets_for_acc_aeb 와 동일
+ *    - 기능별 크기 k 최소 힙 (루트 = 현재 k 위 중 최하위) → 할당 없음, O(n log k)
+ *    - 동점은 리스트 앞 객체 우선 (1 위 == select_targets_for_acc_aeb 선정 결과)
+ *======================================================================*/
+
+/* a 가 b 보다 낮은 순위인가 */
+static bool rank_lower(const TargetRankEntry_t *a, const TargetRankEntry_t *b)
+{
+    if (a->Score != b->Score) return a->Score < b->Score;
+    return a->Index > b->Index;
+}
+
+static void heap_sift_down(TargetRankEntry_t *h, int n, int i)
+{
+    for (;;) {
+        int l = 2 * i + 1, r = l + 1, m = i;
+        if (l < n && rank_lower(&h[l], &h[m])) m = l;
+        if (r < n && rank_lower(&h[r], &h[m])) m = r;
+        if (m == i) return;
+        TargetRankEntry_t t = h[i]; h[i] = h[m]; h[m] = t;
+        i = m;
+    }
+}
+
+static void heap_offer(TargetRankEntry_t *h, int *pCount, int k, const TargetRankEntry_t *e)
+{
+    if (*pCount < k) {
+        /* sift up */
+        int i = (*pCount)++;
+        h[i] = *e;
+        while (i > 0) {
+            int p = (i - 1) / 2;
+            if (!rank_lower(&h[i], &h[p])) break;
+            TargetRankEntry_t t = h[i]; h[i] = h[p]; h[p] = t;
+            i = p;
+        }
+    }
+    else if (rank_lower(&h[0], e)) {
+        h[0] = *e;
+        heap_sift_down(h, k, 0);
+    }
+}
+
+/* 최소 힙 → 내림차순 (제자리 힙 정렬) */
+static void heap_sort_desc(TargetRankEntry_t *h, int n)
+{
+    for (int end = n - 1; end > 0; end--) {
+        TargetRankEntry_t t = h[0]; h[0] = h[end]; h[end] = t;
+        heap_sift_down(h, end, 0);
+    }
+}
+
+int rank_targets_for_acc_aeb(const EgoData_t *pEgoData,
+                             const PredictedObject_t *pPredList,
+                             int predCount,
+                             const LaneSelectOutput_t *pLsData,
+                             int k,
+                             TargetRanking_t *pRanking)
+{
+    if (!pRanking) return -1;
+    pRanking->Acc_Count = 0;
+    pRanking->Aeb_Count = 0;
+    if (!pEgoData || !pLsData || predCount < 0 || (predCount > 0 && !pPredList)
+        || k < 1 || k > TARGET_RANK_MAX_K)
+    {
+        return -1;
+    }
+
+    bool Brake_Status = (fabsf(pEgoData->Ego_Velocity_X) < 0.1f);
+
+    for (int i = 0; i < predCount; i++)
+    {
+        const PredictedObject_t *obj = &pPredList[i];
+        TargetRankEntry_t e;
+
+        if (obj->CutOut_Flag || obj->Predicted_Position_X < 0.0f) {
+            continue;
+        }
+        e.Index     = i;
+        e.Object_ID = obj->Predicted_Object_ID;
+
+        if (score_acc_candidate(obj, pLsData, &e)) {
+            heap_offer(pRanking->Acc, &pRanking->Acc_Count, k, &e);
         }
-        else if (isSide) {
-            /* 측면 + cutin => AEB 대상 */
-            if (obj->CutIn_Flag) aebCandidate = true;
+        if (score_aeb_candidate(obj, pEgoData, Brake_Status, &e)) {
+            heap_offer(pRanking->Aeb, &pRanking->Aeb_Count, k, &e);
         }
+    }
 
-        if (aebCandidate)
-        {
-            /* TTC 판단 */
-            float relSpeed = pEgoData->Ego_Velocity_X - obj->Predicted_Velocity_X;
-            float ttc = 999999.0f;
-            if (relSpeed > 0.1f) {
-                ttc = (obj->Predicted_Distance / relSpeed);
-            }
-            /* 점수 = 200-dist + cutin bonus + ttc<3 => +20 */
-            float score = 200.0f - obj->Predicted_Distance;
-            if (obj->CutIn_Flag) {
-                score += 30.0f; 
-            }
-            if (ttc < 3.0f) {
-                score += 20.0f;
-            }
+    heap_sort_desc(pRanking->Acc, pRanking->Acc_Count);
+    heap_sort_desc(pRanking->Aeb, pRanking->Aeb_Count);
+    return 0;
+}
 
-            if (score > bestAebScore) {
-                bestAebScore = score;
-                bestAebIdx = i;
-            }
+/*======================================================================
+ * 5) 순위 → 타겟 (주 타겟 소실/Cut-out 시 재선정 없이 차순위로 전환)
+ *======================================================================*/
+int select_ranked_acc_target(const TargetRanking_t *pRanking,
+                             const PredictedObject_t *pPredList,
+                             const LaneSelectOutput_t *pLsData,
+                             int excludeId,
+                             ACC_Target_t *pAccTarget)
+{
+    if (!pRanking || !pPredList || !pLsData || !pAccTarget) return -1;
+
+    pAccTarget->ACC_Target_ID = -1;
+    pAccTarget->ACC_Target_Situation = TGT_SITU_NORMAL;
+    for (int r = 0; r < pRanking->Acc_Count; r++) {
+        if (pRanking->Acc[r].Object_ID != excludeId) {
+            fill_acc_target(&pPredList[pRanking->Acc[r].Index], pLsData, pAccTarget);
+            return r;
         }
     }
+    return -1;
+}
 
-    /*=== ACC 최종 타겟 ===*/
-    if (bestAccIdx >= 0) {
-        const PredictedObject_t *obj = &pPredList[bestAccIdx];
-        pAccTarget->ACC_Target_ID         = obj->Predicted_Object_ID;
-        pAccTarget->ACC_Target_Position_X = obj->Predicted_Position_X;
-        pAccTarget->ACC_Target_Position_Y = obj->Predicted_Position_Y;
-        pAccTarget->ACC_Target_Vel_X      = obj->Predicted_Velocity_X;
-        pAccTarget->ACC_Target_Vel_Y      = obj->Predicted_Velocity_Y;
-        pAccTarget->ACC_Target_Accel_X    = obj->Predicted_Accel_X;
-        pAccTarget->ACC_Target_Accel_Y    = obj->Predicted_Accel_Y;
-        pAccTarget->ACC_Target_Distance   = obj->Predicted_Distance;
-        pAccTarget->ACC_Target_Heading    = obj->Predicted_Heading;
-        pAccTarget->ACC_Target_Status     = obj->Predicted_Object_Status;
-
-        /* 상황 (Cut-in/out/Normal etc.) */
-        if (obj->CutIn_Flag) 
-            pAccTarget->ACC_Target_Situation = TGT_SITU_CUTIN;
-        else if (pLsData->LS_Is_Curved_Lane) 
-            pAccTarget->ACC_Target_Situation = TGT_SITU_CURVE; /* 예시 */
-        else 
-            pAccTarget->ACC_Target_Situation = TGT_SITU_NORMAL;
+int select_ranked_aeb_target(const TargetRanking_t *pRanking,
+                             const PredictedObject_t *pPredList,
+                             const LaneSelectOutput_t *pLsData,
+                             int excludeId,
+                             AEB_Target_t *pAebTarget)
+{
+    if (!pRanking || !pPredList || !pLsData || !pAebTarget) return -1;
+
+    pAebTarget->AEB_Target_ID = -1;
+    pAebTarget->AEB_Target_Situation = TGT_SITU_NORMAL;
+    for (int r = 0; r < pRanking->Aeb_Count; r++) {
+        if (pRanking->Aeb[r].Object_ID != excludeId) {
+            fill_aeb_target(&pPredList[pRanking->Aeb[r].Index], pLsData, pAebTarget);
+            return r;
+        }
     }
+    return -1;
+}
 
-    /*=== AEB 최종 타겟 ===*/
-    if (bestAebIdx >= 0) {
-        const PredictedObject_t *obj = &pPredList[bestAebIdx];
-        pAebTarget->AEB_Target_ID         = obj->Predicted_Object_ID;
-        pAebTarget->AEB_Target_Position_X = obj->Predicted_Position_X;
-        pAebTarget->AEB_Target_Position_Y = obj->Predicted_Position_Y;
-        pAebTarget->AEB_Target_Vel_X      = obj->Predicted_Velocity_X;
-        pAebTarget->AEB_Target_Vel_Y      = obj->Predicted_Velocity_Y;
-        pAebTarget->AEB_Target_Accel_X    = obj->Predicted_Accel_X;
-        pAebTarget->AEB_Target_Accel_Y    = obj->Predicted_Accel_Y;
-        pAebTarget->AEB_Target_Distance   = obj->Predicted_Distance;
-        pAebTarget->AEB_Target_Heading    = obj->Predicted_Heading;
-        pAebTarget->AEB_Target_Status     = obj->Predicted_Object_Status;
-
-        if (obj->CutIn_Flag) 
-            pAebTarget->AEB_Target_Situation = TGT_SITU_CUTIN;
-        else if (pLsData->LS_Is_Curved_Lane) 
-            pAebTarget->AEB_Target_Situation = TGT_SITU_CURVE;
-        else 
-            pAebTarget->AEB_Target_Situation = TGT_SITU_NORMAL;
+/*======================================================================
+ * 6) bucket_targets_by_lane
+ *    - 차선 중심 다항식 기준 횡편차로 Ego / 좌 / 우 분류 (1 회 순회)
+ *======================================================================*/
+static void lane_bucket_reset(TargetLaneBucket_t *b)
+{
+    b->Count          = 0;
+    b->Overflow       = 0;
+    b->Front_Index    = -1;
+    b->Rear_Index     = -1;
+    b->CutIn_Index    = -1;
+    b->Front_Distance = 999999.0f;
+    b->Rear_Distance  = 999999.0f;
+}
+
+int bucket_targets_by_lane(const PredictedObject_t *pPredList,
+                           int predCount,
+                           const LaneData_t *pLaneWp,
+                           const LaneSelectOutput_t *pLsData,
+                           TargetLaneBuckets_t *pBuckets)
+{
+    if (!pBuckets) return -1;
+    for (int l = 0; l < TGT_LANE_COUNT; l++) {
+        lane_bucket_reset(&pBuckets->Lane[l]);
+    }
+    pBuckets->Outside_Count = 0;
+    if (!pLsData || !(pLsData->LS_Lane_Width > 0.0f)
+        || predCount < 0 || (predCount > 0 && !pPredList))
+    {
+        return -1;
+    }
+
+    const float halfW   = pLsData->LS_Lane_Width * 0.5f;
+    const float outerW  = pLsData->LS_Lane_Width * 1.5f;
+    const float CUTIN_VY = 0.2f;
+    float c1 = tanf(-pLsData->LS_Heading_Error * (float)M_PI / 180.0f);
+    float c2 = pLaneWp ? lane_geometry_half_curvature(pLaneWp->Lane_Curvature) : 0.0f;
+
+    for (int i = 0; i < predCount; i++)
+    {
+        const PredictedObject_t *obj = &pPredList[i];
+        float x   = obj->Predicted_Position_X;
+        float lat = obj->Predicted_Position_Y - (pLsData->LS_Lane_Offset + c1 * x + c2 * x * x);
+        float a   = fabsf(lat);
+
+        if (!(a <= outerW)) {                   /* NaN (비유한 위치 / heading) 포함 */
+            pBuckets->Outside_Count++;
+            continue;
+        }
+        int lane = (a <= halfW) ? TGT_LANE_EGO : ((lat > 0.0f) ? TGT_LANE_LEFT : TGT_LANE_RIGHT);
+        TargetLaneBucket_t *b = &pBuckets->Lane[lane];
+
+        if (b->Count < TARGET_LANE_BUCKET_MAX) b->Index[b->Count++] = i;
+        else                                   b->Overflow++;
+
+        if (x < 0.0f) {
+            if (-x < b->Rear_Distance) {
+                b->Rear_Distance = -x;
+                b->Rear_Index    = i;
+            }
+            continue;
+        }
+        if (!obj->CutOut_Flag && obj->Predicted_Distance < b->Front_Distance) {
+            b->Front_Distance = obj->Predicted_Distance;
+            b->Front_Index    = i;
+        }
+        if (lane != TGT_LANE_EGO) {
+            float towardEgo = (lane == TGT_LANE_LEFT) ? -obj->Predicted_Velocity_Y
+                                                      :  obj->Predicted_Velocity_Y;
+            if ((obj->CutIn_Flag || towardEgo >= CUTIN_VY)
+                && (b->CutIn_Index < 0
+                    || obj->Predicted_Distance < pPredList[b->CutIn_Index].Predicted_Distance)) {
+                b->CutIn_Index = i;
+            }
+        }
     }
+    return 0;
 }
@@ -2,11 +2,79 @@
 #define TARGET_SELECTION_H
 
 #include "adas_shared.h"
+#include "object_wire.h"
+#include "object_compact.h"
+#include "object_tracking.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+#define PREDICT_HORIZON_S   3.0f    /* 경로 예측 시간 [s] */
+
+/* 위험도 순위 (rank_targets_for_acc_aeb) */
+#define TARGET_RANK_MAX_K   8
+
+typedef struct {
+    int   Index;            /* pPredList 인덱스 */
+    int   Object_ID;
+    float Score;            /* 총점 = Base + 보정 */
+    float Base_Score;       /* 200 - 거리 */
+    float Curve_Bonus;      /* ACC : 곡선 & 근거리 셀 +10 */
+    float CutIn_Bonus;      /* AEB : Cut-in +30 */
+    float Ttc_Bonus;        /* AEB : TTC < 3 s +20 */
+    float Ttc;              /* AEB [s] (접근 아님 = 999999) */
+} TargetRankEntry_t;
+
+typedef struct {
+    int               Acc_Count;
+    int               Aeb_Count;
+    TargetRankEntry_t Acc[TARGET_RANK_MAX_K];   /* 점수 내림차순 */
+    TargetRankEntry_t Aeb[TARGET_RANK_MAX_K];
+} TargetRanking_t;
+
+/* 차로별 버킷 (bucket_targets_by_lane) */
+#define TARGET_LANE_BUCKET_MAX  64
+
+typedef enum {
+    TGT_LANE_RIGHT = 0,
+    TGT_LANE_EGO,
+    TGT_LANE_LEFT,
+    TGT_LANE_COUNT
+} TargetLane_e;
+
+typedef struct {
+    int   Count;                            /* Index[] 에 담긴 수 */
+    int   Overflow;                         /* 용량 초과로 Index[] 에서 빠진 수 */
+    int   Front_Index;                      /* 최근접 전방 (X >= 0, Cut-out 제외), 없음 -1 */
+    int   Rear_Index;                       /* 최근접 후방 (X < 0), 없음 -1 */
+    int   CutIn_Index;                      /* 옆 차로 : 최근접 전방 Ego 차로 접근 객체, 없음 -1 */
+    float Front_Distance;                   /* [m] Front_Index 의 Predicted_Distance */
+    float Rear_Distance;                    /* [m] Rear_Index 의 |X| */
+    int   Index[TARGET_LANE_BUCKET_MAX];    /* pPredList 인덱스 (입력 순서) */
+} TargetLaneBucket_t;
+
+typedef struct {
+    TargetLaneBucket_t Lane[TGT_LANE_COUNT];
+    int   Outside_Count;                    /* 세 차로 밖 */
+} TargetLaneBuckets_t;
+
+/* 곡선 차로 보정 항 : LaneSelectOutput_t 로만 결정 (객체와 무관 → 호출당 / 틱당 1 회) */
+typedef struct {
+    float Lateral_Threshold;                /* 곡선 보정 횡방향 한계 [m] */
+    float Cos_Heading;                      /* cos(LS_Heading_Error), 직선이면 1 (미사용) */
+    bool  Curved;                           /* LS_Is_Curved_Lane */
+} TargetCurveTerms_t;
+
+/* 증분 평가 상태 : 직전 키 (곡선 여부, 곡선일 때 Heading Error, 차선 폭) 와 보정 항 */
+typedef struct {
+    float              Key[3];
+    TargetCurveTerms_t Terms;
+    int32_t            Valid;
+    uint64_t           Calls;
+    uint64_t           Hits;
+} TargetCurveMemo_t;
+
 /*
  * 설계서 2.2.4 Target Selection 모듈 인터페이스
  * 1) select_target_from_object_list
@@ -36,6 +104,69 @@ int select_target_from_object_list(
     int                       maxFilteredCount
 );
 
+/** @brief 곡선 차로 보정 항 계산 */
+void target_curve_terms(const LaneSelectOutput_t *pLsData, TargetCurveTerms_t *pTerms);
+
+void target_curve_memo_reset(TargetCurveMemo_t *pMemo);
+
+/**
+ * @brief 곡선 차로 보정 항 (키가 직전과 비트 동일하면 재사용)
+ * @return 보정 항 (pMemo 내부), NULL on invalid argument
+ */
+const TargetCurveTerms_t *target_curve_terms_memo(TargetCurveMemo_t *pMemo,
+                                                  const LaneSelectOutput_t *pLsData);
+
+/**
+ * @brief select_target_from_object_list 와 같음, 곡선 보정 항을 외부에서 전달
+ *        (pTerms 는 같은 pLsData 로 구한 값, NULL 이면 내부 계산)
+ */
+int select_target_from_object_list_terms(
+    const ObjectData_t        *pObjList,
+    int                       objCount,
+    const EgoData_t           *pEgoData,
+    const LaneSelectOutput_t  *pLsData,
+    const TargetCurveTerms_t  *pTerms,
+    FilteredObject_t          *pFilteredList,
+    int                       maxFilteredCount
+);
+
+/**
+ * @brief select_target_from_object_view
+ *        select_target_from_object_list 의 압축 전송 형식(object_wire.h) 입력판.
+ *        ObjectData_t 로 풀지 않고 뷰를 제자리에서 읽음 (행/열 배치 모두).
+ *        결과는 object_wire_decode_one 으로 푼 리스트를 넣었을 때와 비트 단위 동일.
+ *
+ * @param[in]  pView           : object_wire_view_init 으로 구성한 뷰
+ * @return 필터링 후 리스트에 저장된 객체 수
+ */
+int select_target_from_object_view(
+    const ObjectWireView_t    *pView,
+    const EgoData_t           *pEgoData,
+    const LaneSelectOutput_t  *pLsData,
+    FilteredObject_t          *pFilteredList,
+    int                       maxFilteredCount
+);
+
+/**
+ * @brief select_target_from_object_compact
+ *        select_target_from_object_list 의 압축 레코드(object_compact.h) 입력판.
+ *        판정은 Hot 배열만 스캔, Cold 는 통과 객체만 읽음.
+ *        결과는 obj_compact_to_objects 로 푼 리스트를 넣었을 때와 비트 단위 동일.
+ *
+ * @param[in]  pHot            : Hot 레코드 배열
+ * @param[in]  pCold           : Cold 레코드 배열 (NULL 이면 Position_Z / Accel_Y 0)
+ * @return 필터링 후 리스트에 저장된 객체 수
+ */
+int select_target_from_object_compact(
+    const ObjCompact_t        *pHot,
+    const ObjCompactCold_t    *pCold,
+    int                       objCount,
+    const EgoData_t           *pEgoData,
+    const LaneSelectOutput_t  *pLsData,
+    FilteredObject_t          *pFilteredList,
+    int                       maxFilteredCount
+);
+
 /**
  * @brief predict_object_future_path
  *        필터링된 객체 리스트를 입력받아, 3초 후의 위치를 등속/등가속 모델로 예측.
@@ -58,6 +189,25 @@ int predict_object_future_path(
     int                       maxPredCount
 );
 
+/**
+ * @brief predict_object_future_path_tracked
+ *        predict_object_future_path 와 같되, pTracks 에 트랙(1 회 이상 갱신)이 있는 객체는
+ *        원시 속도/가속도 대신 필터 상태(obj_track_predict)로 위치·속도·가속도·거리·Cut 플래그 산출.
+ *        pTracks 는 호출 전 같은 프레임의 obj_track_update 로 갱신되어 있어야 함.
+ *
+ * @param[in]  pTracks : 트랙 테이블 (NULL 이면 predict_object_future_path 와 동일)
+ * @return 예측된 객체 개수
+ */
+int predict_object_future_path_tracked(
+    const FilteredObject_t    *pFilteredList,
+    int                       filteredCount,
+    const LaneData_t          *pLaneWp,
+    const LaneSelectOutput_t  *pLsData,
+    const ObjectTrackTable_t  *pTracks,
+    PredictedObject_t         *pPredList,
+    int                       maxPredCount
+);
+
 /**
  * @brief select_targets_for_acc_aeb
  *        예측된 객체(최종 후보) 리스트 중 ACC, AEB 각각의 최우선 타겟을 선정.
@@ -78,6 +228,71 @@ void select_targets_for_acc_aeb(
     AEB_Target_t              *pAebTarget
 );
 
+/**
+ * @brief rank_targets_for_acc_aeb
+ *        select_targets_for_acc_aeb 와 같은 후보 조건/점수로 ACC, AEB 각각 상위 k 개 후보를
+ *        점수 내림차순으로 반환 (점수 구성 포함). 크기 k 최소 힙, 동적 할당 없음.
+ *        동점은 리스트 앞 객체 우선 → 1 위는 select_targets_for_acc_aeb 선정 결과와 동일.
+ *
+ * @param[in]  k          : 기능별 최대 후보 수 (1 ~ TARGET_RANK_MAX_K)
+ * @param[out] pRanking   : 순위 결과
+ * @return 0 on success, -1 on invalid argument (pRanking 이 있으면 빈 순위)
+ */
+int rank_targets_for_acc_aeb(
+    const EgoData_t           *pEgoData,
+    const PredictedObject_t   *pPredList,
+    int                       predCount,
+    const LaneSelectOutput_t  *pLsData,
+    int                       k,
+    TargetRanking_t           *pRanking
+);
+
+/**
+ * @brief select_ranked_acc_target / select_ranked_aeb_target
+ *        순위에서 excludeId 가 아닌 최상위 후보로 타겟 구조체 구성.
+ *        주 타겟 소실/Cut-out 시 다음 프레임 재선정 없이 차순위로 즉시 전환.
+ *
+ * @param[in]  pPredList  : 순위를 계산한 같은 예측 리스트
+ * @param[in]  excludeId  : 제외할 객체 ID (-1 : 제외 없음)
+ * @return 사용한 순위 (0 = 1 위), -1 : 후보 없음 (타겟 ID = -1) 또는 인자 오류
+ */
+int select_ranked_acc_target(
+    const TargetRanking_t     *pRanking,
+    const PredictedObject_t   *pPredList,
+    const LaneSelectOutput_t  *pLsData,
+    int                       excludeId,
+    ACC_Target_t              *pAccTarget
+);
+
+int select_ranked_aeb_target(
+    const TargetRanking_t     *pRanking,
+    const PredictedObject_t   *pPredList,
+    const LaneSelectOutput_t  *pLsData,
+    int                       excludeId,
+    AEB_Target_t              *pAebTarget
+);
+
+/**
+ * @brief bucket_targets_by_lane
+ *        예측 리스트를 한 번 훑어 Ego / 좌 / 우 차로 버킷으로 분류하고 차로별 대표 후보를 기록.
+ *        차선 중심 y_c(x) = LS_Lane_Offset + tan(-LS_Heading_Error)·x + x²/(2R)
+ *        (R = pLaneWp->Lane_Curvature 곡률 반경, 0 = 직선, + 좌회전)
+ *        횡편차 |y - y_c| <= W/2 : Ego, <= 1.5 W : 좌(+)/우(-), 그 외 Outside (W = LS_Lane_Width)
+ *        → 직선·오프셋 0 이면 Ego 차로 = 기존 정면 판정 |y| <= 1.75 (W = 3.5)
+ *        CutIn_Index : 옆 차로 전방 객체 중 CutIn_Flag 이거나 Ego 차로 쪽 횡속도 >= 0.2 m/s
+ *
+ * @param[in]  pLaneWp   : 차선 곡률 (NULL 이면 직선)
+ * @param[out] pBuckets  : 차로별 결과
+ * @return 0 on success, -1 on invalid argument (pBuckets 가 있으면 빈 버킷)
+ */
+int bucket_targets_by_lane(
+    const PredictedObject_t   *pPredList,
+    int                       predCount,
+    const LaneData_t          *pLaneWp,
+    const LaneSelectOutput_t  *pLsData,
+    TargetLaneBuckets_t       *pBuckets
+);
+
 #ifdef __cplusplus
 }
 #endif
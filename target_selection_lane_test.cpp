@@ -0,0 +1,228 @@
+/*********************************************************************
+ * target_selection_lane_test.cpp  ―  Ego / 좌 / 우 차로 버킷
+ * DUT : bucket_targets_by_lane (+ lane_geometry_half_curvature)
+ *********************************************************************/
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#include "lane_geometry.h"
+#include "target_selection.h"
+#include "test_rng.hpp"
+
+namespace {
+
+const int MAX_OBJS = 200;
+
+class TargetLaneTest : public ::testing::Test {
+protected:
+    EgoData_t           ego;
+    LaneData_t          lane;
+    LaneSelectOutput_t  ls;
+    PredictedObject_t   pred[MAX_OBJS];
+    TargetLaneBuckets_t bk;
+    TestRng             rng{29u};
+
+    void SetUp() override
+    {
+        std::memset(&ego, 0, sizeof(ego));
+        std::memset(&lane, 0, sizeof(lane));
+        std::memset(&ls, 0, sizeof(ls));
+        std::memset(pred, 0, sizeof(pred));
+        std::memset(&bk, 0, sizeof(bk));
+        ego.Ego_Velocity_X = 20.0f;
+        ls.LS_Lane_Width   = 3.5f;
+        lane.Lane_Width    = 3.5f;
+    }
+
+    void put(int i, float x, float y, float vy = 0.0f)
+    {
+        PredictedObject_t &p = pred[i];
+        p.Predicted_Object_ID      = 100 + i;
+        p.Predicted_Object_Type    = OBJTYPE_CAR;
+        p.Predicted_Object_Status  = OBJSTAT_MOVING;
+        p.Predicted_Position_X     = x;
+        p.Predicted_Position_Y     = y;
+        p.Predicted_Velocity_X     = 15.0f;
+        p.Predicted_Velocity_Y     = vy;
+        p.Predicted_Distance       = std::sqrt(x * x + y * y);
+        p.Predicted_Object_Cell_ID = 6;
+    }
+};
+
+} /* namespace */
+
+/* 직선 : 차로 분류, 전방/후방 최근접 */
+TEST_F(TargetLaneTest, TC_LANEB_EQ_01)
+{
+    put(0, 40.0f, 0.2f);
+    put(1, 25.0f, -0.5f);
+    put(2, 30.0f, 3.4f);
+    put(3, -12.0f, 3.6f);
+    put(4, -5.0f, 3.3f);
+    put(5, 60.0f, -3.5f);
+    put(6, 20.0f, 7.5f);          /* 바깥 */
+    ASSERT_EQ(bucket_targets_by_lane(pred, 7, &lane, &ls, &bk), 0);
+
+    const TargetLaneBucket_t &e = bk.Lane[TGT_LANE_EGO];
+    const TargetLaneBucket_t &l = bk.Lane[TGT_LANE_LEFT];
+    const TargetLaneBucket_t &r = bk.Lane[TGT_LANE_RIGHT];
+    EXPECT_EQ(e.Count, 2);
+    EXPECT_EQ(e.Front_Index, 1);
+    EXPECT_EQ(e.Rear_Index, -1);
+    EXPECT_EQ(l.Count, 3);
+    EXPECT_EQ(l.Front_Index, 2);
+    EXPECT_EQ(l.Rear_Index, 4);
+    EXPECT_FLOAT_EQ(l.Rear_Distance, 5.0f);
+    EXPECT_EQ(r.Count, 1);
+    EXPECT_EQ(r.Front_Index, 5);
+    EXPECT_EQ(bk.Outside_Count, 1);
+    EXPECT_EQ(l.Index[0], 2);
+    EXPECT_EQ(l.Index[1], 3);
+    EXPECT_EQ(l.Index[2], 4);
+}
+
+/* 곡선(좌회전 R = 300 m) : 차선 중심 x²/2R 보정 */
+TEST_F(TargetLaneTest, TC_LANEB_EQ_02)
+{
+    lane.Lane_Curvature = 300.0f;
+    put(0, 60.0f, 6.0f);          /* 중심 6 m → Ego */
+    put(1, 60.0f, 2.5f);          /* 중심 대비 -3.5 → 우 */
+    ASSERT_EQ(bucket_targets_by_lane(pred, 2, &lane, &ls, &bk), 0);
+    EXPECT_EQ(bk.Lane[TGT_LANE_EGO].Front_Index, 0);
+    EXPECT_EQ(bk.Lane[TGT_LANE_RIGHT].Front_Index, 1);
+
+    /* 곡률 정보 없으면 (NULL) 직선 가정 */
+    ASSERT_EQ(bucket_targets_by_lane(pred, 2, nullptr, &ls, &bk), 0);
+    EXPECT_EQ(bk.Lane[TGT_LANE_LEFT].Front_Index, 1);
+    EXPECT_EQ(bk.Outside_Count, 1);
+
+    /* 오프셋 + 헤딩 오차 : Ego 가 차선 중심에서 좌측 1 m, 차선이 우측으로 2° */
+    ls.LS_Lane_Offset   = -1.0f;
+    ls.LS_Heading_Error = 2.0f;
+    lane.Lane_Curvature = 0.0f;
+    float yc = -1.0f + std::tan(-2.0f * 3.14159265f / 180.0f) * 50.0f;
+    put(0, 50.0f, yc + 1.6f);
+    put(1, 50.0f, yc - 1.9f);
+    ASSERT_EQ(bucket_targets_by_lane(pred, 2, &lane, &ls, &bk), 0);
+    EXPECT_EQ(bk.Lane[TGT_LANE_EGO].Front_Index, 0);
+    EXPECT_EQ(bk.Lane[TGT_LANE_RIGHT].Front_Index, 1);
+}
+
+/* 직선·오프셋 0 : Ego 차로 대표 = ACC 선정 (모두 이동 차량, Cut-out 없음) */
+TEST_F(TargetLaneTest, TC_LANEB_EQ_03)
+{
+    for (int trial = 0; trial < 50; trial++) {
+        int n = 1 + (int)rng.uni(0.0f, 40.0f);
+        for (int i = 0; i < n; i++) put(i, rng.uni(1.0f, 150.0f), rng.uni(-6.0f, 6.0f));
+        ASSERT_EQ(bucket_targets_by_lane(pred, n, &lane, &ls, &bk), 0);
+        ACC_Target_t acc;
+        AEB_Target_t aeb;
+        std::memset(&acc, 0, sizeof(acc));
+        std::memset(&aeb, 0, sizeof(aeb));
+        select_targets_for_acc_aeb(&ego, pred, n, &ls, &acc, &aeb);
+        int front = bk.Lane[TGT_LANE_EGO].Front_Index;
+        EXPECT_EQ(acc.ACC_Target_ID, front < 0 ? -1 : pred[front].Predicted_Object_ID);
+        EXPECT_EQ(bk.Lane[0].Count + bk.Lane[1].Count + bk.Lane[2].Count + bk.Outside_Count, n);
+    }
+}
+
+/* 끼어들기 예측 : 옆 차로에서 Ego 쪽으로 이동 / CutIn_Flag, Cut-out 은 전방 대표 제외 */
+TEST_F(TargetLaneTest, TC_LANEB_EQ_04)
+{
+    put(0, 30.0f, 3.5f, -0.5f);   /* 좌 → Ego 접근 */
+    put(1, 20.0f, 3.5f, 0.5f);    /* 좌 → 멀어짐 */
+    put(2, 40.0f, -3.5f, 0.0f);
+    pred[2].CutIn_Flag = true;    /* 우, 플래그 */
+    put(3, 50.0f, -3.5f, -0.5f);  /* 우 → 멀어짐 */
+    put(4, 15.0f, 0.0f);
+    pred[4].CutOut_Flag = true;
+    put(5, 35.0f, 0.5f);
+    ASSERT_EQ(bucket_targets_by_lane(pred, 6, &lane, &ls, &bk), 0);
+    EXPECT_EQ(bk.Lane[TGT_LANE_LEFT].CutIn_Index, 0);
+    EXPECT_EQ(bk.Lane[TGT_LANE_LEFT].Front_Index, 1);
+    EXPECT_EQ(bk.Lane[TGT_LANE_RIGHT].CutIn_Index, 2);
+    EXPECT_EQ(bk.Lane[TGT_LANE_EGO].CutIn_Index, -1);
+    EXPECT_EQ(bk.Lane[TGT_LANE_EGO].Front_Index, 5);
+    EXPECT_EQ(bk.Lane[TGT_LANE_EGO].Count, 2);
+}
+
+/* 경계 : |횡편차| = W/2 → Ego, = 1.5 W → 옆 차로, 초과 → 바깥 */
+TEST_F(TargetLaneTest, TC_LANEB_BV_01)
+{
+    put(0, 10.0f, 1.75f);
+    put(1, 10.0f, -1.75f);
+    put(2, 10.0f, 1.76f);
+    put(3, 10.0f, 5.25f);
+    put(4, 10.0f, -5.26f);
+    ASSERT_EQ(bucket_targets_by_lane(pred, 5, &lane, &ls, &bk), 0);
+    EXPECT_EQ(bk.Lane[TGT_LANE_EGO].Count, 2);
+    EXPECT_EQ(bk.Lane[TGT_LANE_LEFT].Count, 2);
+    EXPECT_EQ(bk.Lane[TGT_LANE_RIGHT].Count, 0);
+    EXPECT_EQ(bk.Outside_Count, 1);
+}
+
+/* 용량 초과 : Index[] 는 앞에서부터 채우고 나머지는 Overflow, 대표는 전체 기준 */
+TEST_F(TargetLaneTest, TC_LANEB_BV_02)
+{
+    int n = TARGET_LANE_BUCKET_MAX + 20;
+    for (int i = 0; i < n; i++) put(i, 200.0f - (float)i, 0.0f);
+    ASSERT_EQ(bucket_targets_by_lane(pred, n, &lane, &ls, &bk), 0);
+    EXPECT_EQ(bk.Lane[TGT_LANE_EGO].Count, TARGET_LANE_BUCKET_MAX);
+    EXPECT_EQ(bk.Lane[TGT_LANE_EGO].Overflow, 20);
+    EXPECT_EQ(bk.Lane[TGT_LANE_EGO].Front_Index, n - 1);
+
+    /* 빈 리스트 */
+    ASSERT_EQ(bucket_targets_by_lane(pred, 0, &lane, &ls, &bk), 0);
+    for (int l = 0; l < TGT_LANE_COUNT; l++) {
+        EXPECT_EQ(bk.Lane[l].Count, 0);
+        EXPECT_EQ(bk.Lane[l].Front_Index, -1);
+    }
+}
+
+/* 반경 비유한 / |R| < 1 → 직선 처리 (lane_geometry 와 같은 검사), NaN 횡편차 → 바깥 */
+TEST_F(TargetLaneTest, TC_LANEB_BV_03)
+{
+    const float radii[] = { NAN, INFINITY, -INFINITY, 0.5f, -0.5f, 1.0e-30f };
+    for (float r : radii) {
+        lane.Lane_Curvature = r;
+        put(0, 30.0f, 0.2f);
+        put(1, 60.0f, -0.3f);
+        ASSERT_EQ(bucket_targets_by_lane(pred, 2, &lane, &ls, &bk), 0);
+        EXPECT_EQ(bk.Lane[TGT_LANE_EGO].Count, 2) << r;
+        EXPECT_EQ(bk.Lane[TGT_LANE_EGO].Front_Index, 0) << r;
+        EXPECT_EQ(bk.Lane[TGT_LANE_RIGHT].Count, 0) << r;
+        EXPECT_EQ(bk.Outside_Count, 0) << r;
+    }
+    EXPECT_EQ(lane_geometry_half_curvature(-300.0f), 0.5f / -300.0f);
+    EXPECT_EQ(lane_geometry_half_curvature(-0.0f), 0.0f);
+
+    /* 비유한 위치 / heading 오차 : 어느 차로에도 넣지 않음 */
+    lane.Lane_Curvature = 0.0f;
+    put(0, 30.0f, NAN);
+    put(1, INFINITY, 0.0f);
+    put(2, 20.0f, 0.0f);
+    ASSERT_EQ(bucket_targets_by_lane(pred, 3, &lane, &ls, &bk), 0);
+    EXPECT_EQ(bk.Lane[TGT_LANE_EGO].Count, 1);
+    EXPECT_EQ(bk.Lane[TGT_LANE_RIGHT].Count, 0);
+    EXPECT_EQ(bk.Outside_Count, 2);
+    ls.LS_Heading_Error = NAN;
+    ASSERT_EQ(bucket_targets_by_lane(pred, 3, &lane, &ls, &bk), 0);
+    EXPECT_EQ(bk.Outside_Count, 3);
+    EXPECT_EQ(bk.Lane[TGT_LANE_RIGHT].Front_Index, -1);
+}
+
+/* 잘못된 인자 → -1, 빈 버킷 */
+TEST_F(TargetLaneTest, TC_LANEB_RA_01)
+{
+    put(0, 10.0f, 0.0f);
+    EXPECT_EQ(bucket_targets_by_lane(pred, 1, &lane, &ls, nullptr), -1);
+    EXPECT_EQ(bucket_targets_by_lane(nullptr, 1, &lane, &ls, &bk), -1);
+    EXPECT_EQ(bucket_targets_by_lane(pred, -1, &lane, &ls, &bk), -1);
+    EXPECT_EQ(bucket_targets_by_lane(pred, 1, &lane, nullptr, &bk), -1);
+    ls.LS_Lane_Width = 0.0f;
+    EXPECT_EQ(bucket_targets_by_lane(pred, 1, &lane, &ls, &bk), -1);
+    EXPECT_EQ(bk.Lane[TGT_LANE_EGO].Count, 0);
+    EXPECT_EQ(bk.Lane[TGT_LANE_EGO].Front_Index, -1);
+}
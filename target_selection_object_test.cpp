@@ -11,6 +11,7 @@
 #include <cmath>
 #include "target_selection.h"     // select_target_from_object_list(...) 선언
 #include "adas_shared.h"         // ObjectData_t, EgoData_t, LaneSelectOutput_t 등
+#include "test_rng.hpp"
 
 // 충분한 크기의 필터링 결과 배열 (테스트 목적상 최대 10 ~ 30개 사용 가정)
 static const int MAX_FILTERED = 30;
@@ -1243,3 +1244,38 @@ TEST_F(SelectTargetFromObjectListTest, TC_TGT_ST_RA_30)
     EXPECT_EQ(filteredList[1].Filtered_Object_Status, OBJSTAT_ONCOMING);
 }
 
+
+/* TC_TGT_ST_INC_01 : 곡선 보정 항 재사용 → 결과 비트 동일, 직선은 Heading Error 무관 적중 */
+TEST_F(SelectTargetFromObjectListTest, TC_TGT_ST_INC_01)
+{
+    TargetCurveMemo_t memo;
+    target_curve_memo_reset(&memo);
+    TestRng rng(45u);
+    for (int i = 0; i < 50; i++) {
+        objList[i].Object_ID     = i;
+        objList[i].Position_X    = rng.uni(0.0f, 210.0f);
+        objList[i].Position_Y    = rng.uni(-4.0f, 4.0f);
+        objList[i].Distance      = objList[i].Position_X;
+        objList[i].Velocity_X    = rng.uni(0.0f, 30.0f);
+        objList[i].Heading       = rng.uni(-180.0f, 180.0f);
+    }
+
+    for (int t = 0; t < 400; t++) {
+        lsData.LS_Is_Curved_Lane = (t / 100) % 2 == 1;
+        if (t % 4 == 0) lsData.LS_Heading_Error = rng.uni(-30.0f, 30.0f);
+        FilteredObject_t ref[50], inc[50];
+        std::memset(ref, 0, sizeof(ref));
+        std::memset(inc, 0, sizeof(inc));
+        int nRef = select_target_from_object_list(objList, 50, &egoData, &lsData, ref, 50);
+        const TargetCurveTerms_t *terms = target_curve_terms_memo(&memo, &lsData);
+        ASSERT_NE(terms, nullptr);
+        int nInc = select_target_from_object_list_terms(objList, 50, &egoData, &lsData, terms, inc, 50);
+        ASSERT_EQ(nInc, nRef);
+        ASSERT_EQ(std::memcmp(ref, inc, sizeof(FilteredObject_t) * (size_t)nRef), 0) << "t " << t;
+    }
+    /* 직선 200 호출 : 구간 첫 호출만 계산 (2 구간), 곡선 200 호출 : Heading Error 바뀔 때만 계산 (25 × 2) */
+    EXPECT_EQ(memo.Calls, 400u);
+    EXPECT_EQ(memo.Hits, 400u - 2u - 50u);
+    EXPECT_EQ(target_curve_terms_memo(nullptr, &lsData), nullptr);
+    EXPECT_EQ(target_curve_terms_memo(&memo, nullptr), nullptr);
+}
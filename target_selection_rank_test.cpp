@@ -0,0 +1,184 @@
+/*********************************************************************
+ * target_selection_rank_test.cpp  ―  ACC/AEB 상위 k 위험도 순위
+ * DUT : rank_targets_for_acc_aeb, select_ranked_acc_target, select_ranked_aeb_target
+ *********************************************************************/
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#include "target_selection.h"
+#include "test_rng.hpp"
+
+namespace {
+
+const int MAX_OBJS = 30;
+
+class TargetRankTest : public ::testing::Test {
+protected:
+    EgoData_t          ego;
+    LaneSelectOutput_t ls;
+    PredictedObject_t  pred[MAX_OBJS];
+    TargetRanking_t    rank;
+    TestRng            rng{11u};
+
+    void SetUp() override
+    {
+        std::memset(&ego, 0, sizeof(ego));
+        std::memset(&ls, 0, sizeof(ls));
+        std::memset(pred, 0, sizeof(pred));
+        std::memset(&rank, 0, sizeof(rank));
+        ego.Ego_Velocity_X = 20.0f;
+        ls.LS_Lane_Width   = 3.5f;
+        for (int i = 0; i < MAX_OBJS; i++) {
+            pred[i].Predicted_Object_ID     = 100 + i;
+            pred[i].Predicted_Object_Type   = OBJTYPE_CAR;
+            pred[i].Predicted_Object_Status = OBJSTAT_MOVING;
+            pred[i].Predicted_Position_X    = 50.0f + i;
+            pred[i].Predicted_Distance      = 50.0f + i;
+            pred[i].Predicted_Velocity_X    = 15.0f;
+            pred[i].Predicted_Object_Cell_ID = 6;
+        }
+    }
+
+    void randomize(int n)
+    {
+        for (int i = 0; i < n; i++) {
+            PredictedObject_t &o = pred[i];
+            o.Predicted_Position_X    = rng.uni(-5.0f, 150.0f);
+            o.Predicted_Position_Y    = rng.uni(-4.0f, 4.0f);
+            /* 동점 유발 : 거리 1 m 단위 */
+            o.Predicted_Distance      = (float)(int)rng.uni(0.0f, 150.0f);
+            o.Predicted_Velocity_X    = rng.uni(0.0f, 30.0f);
+            o.Predicted_Object_Type   = (ObjectType_e)((rng.Seed >> 9) % 4u);
+            o.Predicted_Object_Status = (ObjectStatus_e)((rng.Seed >> 13) % 4u);
+            o.Predicted_Object_Cell_ID = (int)rng.uni(1.0f, 20.0f);
+            o.CutIn_Flag  = rng.uni(0.0f, 1.0f) < 0.2f;
+            o.CutOut_Flag = rng.uni(0.0f, 1.0f) < 0.1f;
+        }
+    }
+};
+
+} /* namespace */
+
+/* 1 위 == select_targets_for_acc_aeb, 전체 순서 == 안정 정렬 기준 */
+TEST_F(TargetRankTest, TC_RANK_EQ_01_MatchesArgmaxAndSort)
+{
+    for (int trial = 0; trial < 500; trial++) {
+        int n = 1 + trial % MAX_OBJS;
+        randomize(n);
+        ego.Ego_Velocity_X   = (trial % 7 == 0) ? 0.0f : rng.uni(1.0f, 30.0f);
+        ls.LS_Is_Curved_Lane = (trial % 3 == 0);
+
+        ACC_Target_t acc, accR;
+        AEB_Target_t aeb, aebR;
+        std::memset(&acc, 0, sizeof(acc)); std::memset(&accR, 0, sizeof(accR));
+        std::memset(&aeb, 0, sizeof(aeb)); std::memset(&aebR, 0, sizeof(aebR));
+        select_targets_for_acc_aeb(&ego, pred, n, &ls, &acc, &aeb);
+        ASSERT_EQ(rank_targets_for_acc_aeb(&ego, pred, n, &ls, TARGET_RANK_MAX_K, &rank), 0);
+        select_ranked_acc_target(&rank, pred, &ls, -1, &accR);
+        select_ranked_aeb_target(&rank, pred, &ls, -1, &aebR);
+        ASSERT_EQ(std::memcmp(&acc, &accR, sizeof(acc)), 0) << trial;
+        ASSERT_EQ(std::memcmp(&aeb, &aebR, sizeof(aeb)), 0) << trial;
+
+        /* k = 1 도 같은 1 위 */
+        TargetRanking_t r1;
+        ASSERT_EQ(rank_targets_for_acc_aeb(&ego, pred, n, &ls, 1, &r1), 0);
+        EXPECT_EQ(r1.Acc_Count, std::min(rank.Acc_Count, 1));
+        if (r1.Acc_Count) {
+            EXPECT_EQ(r1.Acc[0].Index, rank.Acc[0].Index);
+        }
+
+        /* 내림차순, 동점은 인덱스 오름차순 */
+        for (int r = 1; r < rank.Aeb_Count; r++) {
+            const TargetRankEntry_t &a = rank.Aeb[r - 1], &b = rank.Aeb[r];
+            EXPECT_TRUE(a.Score > b.Score || (a.Score == b.Score && a.Index < b.Index));
+        }
+    }
+}
+
+/* 점수 구성 */
+TEST_F(TargetRankTest, TC_RANK_EQ_02_ScoreBreakdown)
+{
+    ls.LS_Is_Curved_Lane = true;
+    pred[0].Predicted_Distance       = 20.0f;
+    pred[0].Predicted_Velocity_X     = 10.0f;   /* TTC = 20/10 = 2 s */
+    pred[0].Predicted_Object_Cell_ID = 3;
+    pred[1].Predicted_Position_Y     = 2.5f;    /* 측면 Cut-in */
+    pred[1].CutIn_Flag               = true;
+    pred[1].Predicted_Distance       = 40.0f;
+
+    ASSERT_EQ(rank_targets_for_acc_aeb(&ego, pred, 2, &ls, 4, &rank), 0);
+    ASSERT_EQ(rank.Acc_Count, 1);               /* 측면 객체는 ACC 후보 아님 */
+    EXPECT_EQ(rank.Acc[0].Object_ID, 100);
+    EXPECT_FLOAT_EQ(rank.Acc[0].Base_Score, 180.0f);
+    EXPECT_FLOAT_EQ(rank.Acc[0].Curve_Bonus, 10.0f);
+    EXPECT_FLOAT_EQ(rank.Acc[0].Score, 190.0f);
+
+    ASSERT_EQ(rank.Aeb_Count, 2);
+    EXPECT_EQ(rank.Aeb[0].Object_ID, 100);
+    EXPECT_FLOAT_EQ(rank.Aeb[0].Ttc, 2.0f);
+    EXPECT_FLOAT_EQ(rank.Aeb[0].Ttc_Bonus, 20.0f);
+    EXPECT_FLOAT_EQ(rank.Aeb[0].Score, 200.0f);
+    EXPECT_EQ(rank.Aeb[1].Object_ID, 101);
+    EXPECT_FLOAT_EQ(rank.Aeb[1].CutIn_Bonus, 30.0f);
+    EXPECT_FLOAT_EQ(rank.Aeb[1].Score, 190.0f);
+}
+
+/* 주 타겟 소실 → 차순위 즉시 전환 */
+TEST_F(TargetRankTest, TC_RANK_EQ_03_FallbackToNext)
+{
+    ASSERT_EQ(rank_targets_for_acc_aeb(&ego, pred, 5, &ls, 3, &rank), 0);
+    ASSERT_EQ(rank.Acc_Count, 3);
+
+    ACC_Target_t acc;
+    AEB_Target_t aeb;
+    EXPECT_EQ(select_ranked_acc_target(&rank, pred, &ls, -1, &acc), 0);
+    EXPECT_EQ(acc.ACC_Target_ID, 100);
+    EXPECT_EQ(select_ranked_acc_target(&rank, pred, &ls, 100, &acc), 1);
+    EXPECT_EQ(acc.ACC_Target_ID, 101);
+    EXPECT_FLOAT_EQ(acc.ACC_Target_Distance, 51.0f);
+    EXPECT_EQ(select_ranked_aeb_target(&rank, pred, &ls, 100, &aeb), 1);
+    EXPECT_EQ(aeb.AEB_Target_ID, 101);
+}
+
+/* k 경계 / 동점 / 후보 없음 */
+TEST_F(TargetRankTest, TC_RANK_BV_01_Bounds)
+{
+    for (int i = 0; i < MAX_OBJS; i++) pred[i].Predicted_Distance = 60.0f;   /* 전부 동점 */
+    ASSERT_EQ(rank_targets_for_acc_aeb(&ego, pred, MAX_OBJS, &ls, TARGET_RANK_MAX_K, &rank), 0);
+    ASSERT_EQ(rank.Acc_Count, TARGET_RANK_MAX_K);
+    for (int r = 0; r < TARGET_RANK_MAX_K; r++) EXPECT_EQ(rank.Acc[r].Index, r);
+
+    ASSERT_EQ(rank_targets_for_acc_aeb(&ego, pred, 2, &ls, TARGET_RANK_MAX_K, &rank), 0);
+    EXPECT_EQ(rank.Acc_Count, 2);
+
+    ASSERT_EQ(rank_targets_for_acc_aeb(&ego, pred, 0, &ls, 1, &rank), 0);
+    EXPECT_EQ(rank.Acc_Count, 0);
+    EXPECT_EQ(rank.Aeb_Count, 0);
+    ACC_Target_t acc;
+    EXPECT_EQ(select_ranked_acc_target(&rank, pred, &ls, -1, &acc), -1);
+    EXPECT_EQ(acc.ACC_Target_ID, -1);
+
+    /* 단일 후보를 제외하면 타겟 없음 */
+    ASSERT_EQ(rank_targets_for_acc_aeb(&ego, pred, 1, &ls, 1, &rank), 0);
+    EXPECT_EQ(select_ranked_acc_target(&rank, pred, &ls, 100, &acc), -1);
+    EXPECT_EQ(acc.ACC_Target_ID, -1);
+}
+
+/* 무효 입력 */
+TEST_F(TargetRankTest, TC_RANK_RA_01_Invalid)
+{
+    rank.Acc_Count = 5;
+    EXPECT_EQ(rank_targets_for_acc_aeb(&ego, pred, 3, &ls, 0, &rank), -1);
+    EXPECT_EQ(rank.Acc_Count, 0);
+    EXPECT_EQ(rank_targets_for_acc_aeb(&ego, pred, 3, &ls, TARGET_RANK_MAX_K + 1, &rank), -1);
+    EXPECT_EQ(rank_targets_for_acc_aeb(nullptr, pred, 3, &ls, 1, &rank), -1);
+    EXPECT_EQ(rank_targets_for_acc_aeb(&ego, nullptr, 3, &ls, 1, &rank), -1);
+    EXPECT_EQ(rank_targets_for_acc_aeb(&ego, pred, -1, &ls, 1, &rank), -1);
+    EXPECT_EQ(rank_targets_for_acc_aeb(&ego, pred, 3, &ls, 1, nullptr), -1);
+
+    ACC_Target_t acc;
+    EXPECT_EQ(select_ranked_acc_target(nullptr, pred, &ls, -1, &acc), -1);
+    EXPECT_EQ(select_ranked_aeb_target(&rank, pred, &ls, -1, nullptr), -1);
+}
@@ -0,0 +1,324 @@
+/****************************************************************************
+ * target_selection_tpl.hpp
+ *
+ * - target_selection.c 의 컴파일 타임 구성 템플릿
+ *   select_target_from_object_list / select_targets_for_acc_aeb
+ *   (predict_object_future_path 는 구성 값이 없어 C API 그대로 사용)
+ * - Cfg = DefaultConfig 이면 C API 와 결과 동일
+ * - Cfg::CurveHandling == false : 곡선 횡방향 임계 / 거리(cos) 보정,
+ *   ACC 곡선 가점, TGT_SITU_CURVE 분류 제거
+ * - Cfg::AebObjectTypes : AEB 후보 객체 유형 제한 (예: 보행자 전용)
+ ****************************************************************************/
+#ifndef TARGET_SELECTION_TPL_HPP
+#define TARGET_SELECTION_TPL_HPP
+
+#include <cmath>
+
+#include "adas_config.hpp"
+#include "target_selection.h"
+#include "fast_math.h"
+
+namespace adas {
+
+namespace detail {
+
+inline float normalize_heading(float hdg)
+{
+#ifdef ADAS_USE_FAST_MATH
+    return adas_wrap_deg180(hdg);
+#else
+    /* target_selection.c normalize_heading 과 같은 선 축소 (반복 상한 1 회, ±inf → NaN) */
+    if (!(fabsf(hdg) <= 540.0f)) hdg = fmodf(hdg, 360.0f);
+    while (hdg > 180.0f)   hdg -= 360.0f;
+    while (hdg < -180.0f)  hdg += 360.0f;
+    return hdg;
+#endif
+}
+
+} /* namespace detail */
+
+/*======================================================================
+ * 1) select_target_from_object_list (설계서 2.2.4.1.1)
+ *======================================================================*/
+template <class Cfg = DefaultConfig>
+int select_target_from_object_list(const ObjectData_t       *pObjList,
+                                   int                       objCount,
+                                   const EgoData_t          *pEgoData,
+                                   const LaneSelectOutput_t *pLsData,
+                                   FilteredObject_t         *pFilteredList,
+                                   int                       maxFilteredCount)
+{
+    static_assert(config_is_valid<Cfg>(), "");
+
+    if (!pObjList || !pEgoData || !pLsData || !pFilteredList
+        || objCount <= 0 || maxFilteredCount <= 0)
+    {
+        return 0;
+    }
+
+    int filteredIndex = 0;
+
+    const float LATERAL_EPS = 1e-3f;
+    float Adjusted_Lateral_Threshold = pLsData->LS_Lane_Width * 0.5f;
+    if constexpr (Cfg::CurveHandling) {
+        if (pLsData->LS_Is_Curved_Lane && fabsf(pLsData->LS_Heading_Error) > 1.0f) {
+            Adjusted_Lateral_Threshold += fabsf(pLsData->LS_Heading_Error) * 0.05f;
+        }
+    }
+
+    for (int i = 0; i < objCount; i++)
+    {
+        if (filteredIndex >= maxFilteredCount)
+            break;
+
+        const ObjectData_t *obj = &pObjList[i];
+
+        /* 1) 범위 필터링 */
+        if (obj->Distance > Cfg::MaxObjectDistance) {
+            continue;
+        }
+
+        /* 2) 횡방향 필터링 */
+        float Lane_Center_Offset = fabsf(obj->Position_Y - pLsData->LS_Lane_Offset);
+        float quarterW = pLsData->LS_Lane_Width * 0.25f;
+        float threeQW  = pLsData->LS_Lane_Width * 0.75f;
+
+        if (Lane_Center_Offset > (Adjusted_Lateral_Threshold + LATERAL_EPS)) {
+            continue;
+        }
+        if (Lane_Center_Offset > (pLsData->LS_Lane_Width * 0.5f + LATERAL_EPS) &&
+            Lane_Center_Offset < (threeQW - LATERAL_EPS)) {
+            continue;
+        }
+
+        /* 3) 상태 분류 */
+        float Relative_Velocity  = obj->Velocity_X - pEgoData->Ego_Velocity_X;
+        float Heading_Difference = fabsf(obj->Heading - pEgoData->Ego_Heading);
+        if (Heading_Difference > 180.0f) {
+            Heading_Difference = 360.0f - Heading_Difference;
+        }
+
+        ObjectStatus_e finalStatus;
+        if (Heading_Difference >= 150.0f) {
+            finalStatus = OBJSTAT_ONCOMING;
+        } else if (fabsf(Relative_Velocity) >= 0.5f) {
+            finalStatus = OBJSTAT_MOVING;
+        } else {
+            finalStatus = OBJSTAT_STATIONARY;
+        }
+
+        /* 4) 곡선 차로 => 거리 보정 */
+        float Adjusted_Object_Distance = obj->Distance;
+        if constexpr (Cfg::CurveHandling) {
+            if (pLsData->LS_Is_Curved_Lane) {
+                float he_rad = pLsData->LS_Heading_Error * (float)M_PI / 180.0f;
+                float c = ADAS_COSF(he_rad);
+                if (fabsf(c) > 1.0e-3f) {
+                    Adjusted_Object_Distance = obj->Distance / c;
+                }
+            }
+        }
+
+        /* 5) 셀 번호 */
+        int Base_CellNumber;
+        if (Adjusted_Object_Distance <= 60.0f) {
+            Base_CellNumber = 1 + (int)(Adjusted_Object_Distance / 10.0f);
+            if (Base_CellNumber > 6)  Base_CellNumber = 6;
+        }
+        else if (Adjusted_Object_Distance < 120.0f) {
+            float x = Adjusted_Object_Distance - 60.0f;
+            Base_CellNumber = 7 + (int)(x / 10.0f);
+            if (Base_CellNumber > 12) Base_CellNumber = 12;
+        }
+        else {
+            float x = Adjusted_Object_Distance - 120.0f;
+            Base_CellNumber = 13 + (int)floorf(x / 10.0f);
+        }
+
+        int Offset_Adjustment = 0;
+        if (Lane_Center_Offset <= quarterW) {
+            Offset_Adjustment = -1;
+        } else if (Lane_Center_Offset >= threeQW) {
+            Offset_Adjustment = +1;
+        }
+
+        int CellNumber = Base_CellNumber + Offset_Adjustment;
+        if (CellNumber < 1)  CellNumber = 1;
+        if (CellNumber > 20) CellNumber = 20;
+
+        FilteredObject_t *fObj = &pFilteredList[filteredIndex++];
+        fObj->Filtered_Object_ID      = obj->Object_ID;
+        fObj->Filtered_Object_Type    = obj->Object_Type;
+        fObj->Filtered_Position_X     = obj->Position_X;
+        fObj->Filtered_Position_Y     = obj->Position_Y;
+        fObj->Filtered_Position_Z     = obj->Position_Z;
+        fObj->Filtered_Velocity_X     = obj->Velocity_X;
+        fObj->Filtered_Velocity_Y     = obj->Velocity_Y;
+        fObj->Filtered_Accel_X        = obj->Accel_X;
+        fObj->Filtered_Accel_Y        = obj->Accel_Y;
+        fObj->Filtered_Heading        = detail::normalize_heading(obj->Heading);
+        fObj->Filtered_Distance       = Adjusted_Object_Distance;
+        fObj->Filtered_Object_Status  = finalStatus;
+        fObj->Filtered_Object_Cell_ID = CellNumber;
+    }
+
+    return filteredIndex;
+}
+
+/*======================================================================
+ * 3) select_targets_for_acc_aeb (설계서 2.2.4.1.3)
+ *======================================================================*/
+template <class Cfg = DefaultConfig>
+void select_targets_for_acc_aeb(const EgoData_t          *pEgoData,
+                                const PredictedObject_t  *pPredList,
+                                int                       predCount,
+                                const LaneSelectOutput_t *pLsData,
+                                ACC_Target_t             *pAccTarget,
+                                AEB_Target_t             *pAebTarget)
+{
+    static_assert(config_is_valid<Cfg>(), "");
+
+    if (!pEgoData || !pPredList || !pLsData
+        || !pAccTarget || !pAebTarget || predCount <= 0)
+    {
+        if (pAccTarget) pAccTarget->ACC_Target_ID = -1;
+        if (pAebTarget) pAebTarget->AEB_Target_ID = -1;
+        return;
+    }
+
+    pAccTarget->ACC_Target_ID = -1;
+    pAebTarget->AEB_Target_ID = -1;
+    pAccTarget->ACC_Target_Situation = TGT_SITU_NORMAL;
+    pAebTarget->AEB_Target_Situation = TGT_SITU_NORMAL;
+
+    bool curved = false;
+    if constexpr (Cfg::CurveHandling) {
+        curved = pLsData->LS_Is_Curved_Lane;
+    }
+
+    float bestAccScore = -999999.0f;
+    int   bestAccIdx   = -1;
+    float bestAebScore = -999999.0f;
+    int   bestAebIdx   = -1;
+
+    bool Brake_Status = (fabsf(pEgoData->Ego_Velocity_X) < 0.1f);
+
+    for (int i = 0; i < predCount; i++)
+    {
+        const PredictedObject_t *obj = &pPredList[i];
+
+        if (obj->CutOut_Flag) {
+            continue;
+        }
+        float px = obj->Predicted_Position_X;
+        float py = obj->Predicted_Position_Y;
+        if (px < 0.0f) {
+            continue;
+        }
+
+        /*=== ACC 후보 : 정면, car, Moving/Stopped ===*/
+        if ((fabsf(py) <= Cfg::InPathHalfWidth)
+            && (obj->Predicted_Object_Type == OBJTYPE_CAR)
+            && ((obj->Predicted_Object_Status == OBJSTAT_MOVING)
+                || (obj->Predicted_Object_Status == OBJSTAT_STOPPED)))
+        {
+            float score = Cfg::MaxObjectDistance - obj->Predicted_Distance;
+            if (curved && obj->Predicted_Object_Cell_ID < 5) {
+                score += 10.0f;
+            }
+            if (score > bestAccScore) {
+                bestAccScore = score;
+                bestAccIdx   = i;
+            }
+        }
+
+        /*=== AEB 후보 ===*/
+        if ((Cfg::AebObjectTypes & objtype_bit(obj->Predicted_Object_Type)) == 0u) {
+            continue;
+        }
+        bool isFront = (fabsf(py) <= Cfg::InPathHalfWidth);
+        bool isSide  = ((fabsf(py) > Cfg::InPathHalfWidth) && (fabsf(py) <= Cfg::SideHalfWidth));
+        bool aebCandidate = false;
+
+        if (isFront) {
+            if (obj->Predicted_Object_Status == OBJSTAT_MOVING
+             || obj->Predicted_Object_Status == OBJSTAT_STOPPED) {
+                aebCandidate = true;
+            }
+            else if ((obj->Predicted_Object_Status == OBJSTAT_STATIONARY) && Brake_Status) {
+                aebCandidate = true;
+            }
+        }
+        else if (isSide) {
+            if (obj->CutIn_Flag) aebCandidate = true;
+        }
+
+        if (aebCandidate)
+        {
+            float relSpeed = pEgoData->Ego_Velocity_X - obj->Predicted_Velocity_X;
+            float ttc = 999999.0f;
+            if (relSpeed > 0.1f) {
+                ttc = (obj->Predicted_Distance / relSpeed);
+            }
+            float score = Cfg::MaxObjectDistance - obj->Predicted_Distance;
+            if (obj->CutIn_Flag) {
+                score += 30.0f;
+            }
+            if (ttc < 3.0f) {
+                score += 20.0f;
+            }
+            if (score > bestAebScore) {
+                bestAebScore = score;
+                bestAebIdx   = i;
+            }
+        }
+    }
+
+    /*=== ACC 최종 타겟 ===*/
+    if (bestAccIdx >= 0) {
+        const PredictedObject_t *obj = &pPredList[bestAccIdx];
+        pAccTarget->ACC_Target_ID         = obj->Predicted_Object_ID;
+        pAccTarget->ACC_Target_Position_X = obj->Predicted_Position_X;
+        pAccTarget->ACC_Target_Position_Y = obj->Predicted_Position_Y;
+        pAccTarget->ACC_Target_Vel_X      = obj->Predicted_Velocity_X;
+        pAccTarget->ACC_Target_Vel_Y      = obj->Predicted_Velocity_Y;
+        pAccTarget->ACC_Target_Accel_X    = obj->Predicted_Accel_X;
+        pAccTarget->ACC_Target_Accel_Y    = obj->Predicted_Accel_Y;
+        pAccTarget->ACC_Target_Distance   = obj->Predicted_Distance;
+        pAccTarget->ACC_Target_Heading    = obj->Predicted_Heading;
+        pAccTarget->ACC_Target_Status     = obj->Predicted_Object_Status;
+
+        if (obj->CutIn_Flag)
+            pAccTarget->ACC_Target_Situation = TGT_SITU_CUTIN;
+        else if (curved)
+            pAccTarget->ACC_Target_Situation = TGT_SITU_CURVE;
+        else
+            pAccTarget->ACC_Target_Situation = TGT_SITU_NORMAL;
+    }
+
+    /*=== AEB 최종 타겟 ===*/
+    if (bestAebIdx >= 0) {
+        const PredictedObject_t *obj = &pPredList[bestAebIdx];
+        pAebTarget->AEB_Target_ID         = obj->Predicted_Object_ID;
+        pAebTarget->AEB_Target_Position_X = obj->Predicted_Position_X;
+        pAebTarget->AEB_Target_Position_Y = obj->Predicted_Position_Y;
+        pAebTarget->AEB_Target_Vel_X      = obj->Predicted_Velocity_X;
+        pAebTarget->AEB_Target_Vel_Y      = obj->Predicted_Velocity_Y;
+        pAebTarget->AEB_Target_Accel_X    = obj->Predicted_Accel_X;
+        pAebTarget->AEB_Target_Accel_Y    = obj->Predicted_Accel_Y;
+        pAebTarget->AEB_Target_Distance   = obj->Predicted_Distance;
+        pAebTarget->AEB_Target_Heading    = obj->Predicted_Heading;
+        pAebTarget->AEB_Target_Status     = obj->Predicted_Object_Status;
+
+        if (obj->CutIn_Flag)
+            pAebTarget->AEB_Target_Situation = TGT_SITU_CUTIN;
+        else if (curved)
+            pAebTarget->AEB_Target_Situation = TGT_SITU_CURVE;
+        else
+            pAebTarget->AEB_Target_Situation = TGT_SITU_NORMAL;
+    }
+}
+
+} /* namespace adas */
+
+#endif /* TARGET_SELECTION_TPL_HPP */
@@ -0,0 +1,265 @@
+/*********************************************************************
+ * target_selection_tpl_test.cpp  ―  Lane / Target Selection 구성 템플릿
+ * DUT : adas::LaneSelection<Cfg>, adas::select_target_from_object_list<Cfg>,
+ *       adas::select_targets_for_acc_aeb<Cfg>
+ * REF : lane_selection.c / target_selection.c (C API)
+ *********************************************************************/
+#include <gtest/gtest.h>
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#include "lane_selection_tpl.hpp"
+#include "target_selection_tpl.hpp"
+#include "test_rng.hpp"
+
+/* 구성 타입 : 상수 접기 가능 여부 (컴파일 타임) */
+static_assert(adas::DefaultConfig::CurveHandling, "");
+static_assert(!adas::NoCurveConfig::CurveHandling, "");
+static_assert(adas::NoCurveConfig::LaneCurveThreshold == LANE_CURVE_THRESHOLD, "");
+static_assert(adas::PedestrianAebConfig::AebObjectTypes == adas::objtype_bit(OBJTYPE_PEDESTRIAN), "");
+static_assert(adas::config_is_valid<adas::PedestrianAebConfig>(), "");
+
+/* 좁은 정면 폭 + 짧은 인지 거리 */
+struct NarrowConfig : adas::DefaultConfig {
+    static constexpr float InPathHalfWidth   = 1.0f;
+    static constexpr float MaxObjectDistance = 80.0f;
+};
+
+class TargetSelectionTplTest : public ::testing::Test
+{
+protected:
+    static constexpr int N = 24;
+    TestRng  rng{5u};
+
+    LaneData_t        lane;
+    EgoData_t         ego;
+    ObjectData_t      obj[N];
+
+    void randomScene() {
+        std::memset(&lane, 0, sizeof(lane));
+        std::memset(&ego, 0, sizeof(ego));
+        std::memset(obj, 0, sizeof(obj));
+        lane.Lane_Type           = (rng.uni(0, 1) < 0.5f) ? LANE_TYPE_STRAIGHT : LANE_TYPE_CURVE;
+        lane.Lane_Curvature      = rng.uni(0.0f, 1500.0f);
+        lane.Next_Lane_Curvature = rng.uni(0.0f, 1500.0f);
+        lane.Lane_Offset         = rng.uni(-1.0f, 1.0f);
+        lane.Lane_Heading        = rng.uni(-200.0f, 200.0f);
+        lane.Lane_Width          = rng.uni(3.0f, 4.0f);
+        lane.Lane_Change_Status  = (LaneChangeStatus_e)(rng.Seed % 3);
+        ego.Ego_Velocity_X       = rng.uni(0.0f, 35.0f);
+        ego.Ego_Heading          = rng.uni(-180.0f, 180.0f);
+        for (int i = 0; i < N; i++) {
+            obj[i].Object_ID     = i + 1;
+            obj[i].Object_Type   = (ObjectType_e)(rng.Seed % 4);
+            obj[i].Position_X    = rng.uni(-20.0f, 220.0f);
+            obj[i].Position_Y    = rng.uni(-5.0f, 5.0f);
+            obj[i].Distance      = obj[i].Position_X;
+            obj[i].Velocity_X    = rng.uni(-5.0f, 35.0f);
+            obj[i].Velocity_Y    = rng.uni(-1.0f, 1.0f);
+            obj[i].Accel_X       = rng.uni(-3.0f, 3.0f);
+            obj[i].Heading       = rng.uni(-190.0f, 190.0f);
+            obj[i].Object_Status = (ObjectStatus_e)(rng.Seed % 4);
+        }
+    }
+
+    /* 한 프레임 : Lane → Filter → Predict(C) → Select */
+    template <class Cfg, bool UseCApi>
+    void runFrame(LaneSelectOutput_t &ls, FilteredObject_t *fl, int &fc,
+                  PredictedObject_t *pl, int &pc, ACC_Target_t &acc, AEB_Target_t &aeb) {
+        std::memset(&acc, 0, sizeof(acc));
+        std::memset(&aeb, 0, sizeof(aeb));
+        std::memset(fl, 0, sizeof(FilteredObject_t) * N);
+        if (UseCApi) {
+            LaneSelection(&lane, &ego, &ls);
+            fc = select_target_from_object_list(obj, N, &ego, &ls, fl, N);
+        } else {
+            adas::LaneSelection<Cfg>(&lane, &ego, &ls);
+            fc = adas::select_target_from_object_list<Cfg>(obj, N, &ego, &ls, fl, N);
+        }
+        pc = predict_object_future_path(fl, fc, &lane, &ls, pl, N);
+        if (UseCApi) {
+            select_targets_for_acc_aeb(&ego, pl, pc, &ls, &acc, &aeb);
+        } else {
+            adas::select_targets_for_acc_aeb<Cfg>(&ego, pl, pc, &ls, &acc, &aeb);
+        }
+    }
+};
+
+/* 기본 인스턴스 == C API (비트 단위) */
+TEST_F(TargetSelectionTplTest, TC_TGT_TPL_EQ_01_DefaultMatchesCApi)
+{
+    for (int it = 0; it < 2000; it++) {
+        randomScene();
+        LaneSelectOutput_t lsC, lsT;
+        FilteredObject_t   fC[N], fT[N];
+        PredictedObject_t  pC[N], pT[N];
+        ACC_Target_t       accC, accT;
+        AEB_Target_t       aebC, aebT;
+        int fcC, pcC, fcT, pcT;
+
+        runFrame<adas::DefaultConfig, true>(lsC, fC, fcC, pC, pcC, accC, aebC);
+        runFrame<adas::DefaultConfig, false>(lsT, fT, fcT, pT, pcT, accT, aebT);
+
+        ASSERT_EQ(std::memcmp(&lsC, &lsT, sizeof(lsC)), 0) << it;
+        ASSERT_EQ(fcC, fcT) << it;
+        ASSERT_EQ(std::memcmp(fC, fT, sizeof(FilteredObject_t) * fcC), 0) << it;
+        ASSERT_EQ(std::memcmp(&accC, &accT, sizeof(accC)), 0) << it;
+        ASSERT_EQ(std::memcmp(&aebC, &aebT, sizeof(aebC)), 0) << it;
+    }
+}
+
+/* 곡선 처리 제거 : 곡률과 무관하게 직선 처리 */
+TEST_F(TargetSelectionTplTest, TC_TGT_TPL_EQ_02_NoCurve)
+{
+    randomScene();
+    lane.Lane_Curvature      = 300.0f;
+    lane.Next_Lane_Curvature = 900.0f;
+    lane.Lane_Heading        = ego.Ego_Heading - 20.0f;
+
+    LaneSelectOutput_t ls;
+    ASSERT_EQ(adas::LaneSelection<adas::NoCurveConfig>(&lane, &ego, &ls), 0);
+    EXPECT_FALSE(ls.LS_Is_Curved_Lane);
+    EXPECT_FALSE(ls.LS_Curve_Transition_Flag);
+    EXPECT_NEAR(ls.LS_Heading_Error, 20.0f, 1e-4f);
+
+    /* 곡선 LS 가 들어와도 거리 보정 없음 */
+    ls.LS_Is_Curved_Lane = true;
+    obj[0].Position_Y = lane.Lane_Offset;
+    obj[0].Distance   = 50.0f;
+    FilteredObject_t f[N];
+    int fc = adas::select_target_from_object_list<adas::NoCurveConfig>(obj, 1, &ego, &ls, f, N);
+    ASSERT_EQ(fc, 1);
+    EXPECT_FLOAT_EQ(f[0].Filtered_Distance, 50.0f);
+    fc = adas::select_target_from_object_list<adas::DefaultConfig>(obj, 1, &ego, &ls, f, N);
+    ASSERT_EQ(fc, 1);
+    EXPECT_GT(f[0].Filtered_Distance, 50.0f);
+}
+
+/* 보행자 전용 AEB : car 는 ACC 로만, 보행자는 AEB 로 */
+TEST_F(TargetSelectionTplTest, TC_TGT_TPL_EQ_03_PedestrianAeb)
+{
+    LaneSelectOutput_t ls{};
+    ls.LS_Lane_Width = 3.5f;
+    EgoData_t e{};
+    e.Ego_Velocity_X = 15.0f;
+
+    PredictedObject_t p[2]{};
+    p[0].Predicted_Object_ID = 1;  p[0].Predicted_Object_Type = OBJTYPE_CAR;
+    p[0].Predicted_Position_X = 20.0f;  p[0].Predicted_Distance = 20.0f;
+    p[0].Predicted_Object_Status = OBJSTAT_MOVING;
+    p[1] = p[0];
+    p[1].Predicted_Object_ID = 2;  p[1].Predicted_Object_Type = OBJTYPE_PEDESTRIAN;
+    p[1].Predicted_Position_X = 40.0f;  p[1].Predicted_Distance = 40.0f;
+
+    ACC_Target_t acc;  AEB_Target_t aeb;
+    adas::select_targets_for_acc_aeb<adas::DefaultConfig>(&e, p, 2, &ls, &acc, &aeb);
+    EXPECT_EQ(acc.ACC_Target_ID, 1);
+    EXPECT_EQ(aeb.AEB_Target_ID, 1);
+
+    adas::select_targets_for_acc_aeb<adas::PedestrianAebConfig>(&e, p, 2, &ls, &acc, &aeb);
+    EXPECT_EQ(acc.ACC_Target_ID, 1);
+    EXPECT_EQ(aeb.AEB_Target_ID, 2);
+
+    adas::select_targets_for_acc_aeb<adas::PedestrianAebConfig>(&e, p, 1, &ls, &acc, &aeb);
+    EXPECT_EQ(aeb.AEB_Target_ID, -1);
+}
+
+/* 사용자 구성 : 정면 폭 / 인지 거리 경계 */
+TEST_F(TargetSelectionTplTest, TC_TGT_TPL_BV_01_CustomBounds)
+{
+    LaneSelectOutput_t ls{};
+    ls.LS_Lane_Width = 3.5f;
+    EgoData_t e{};
+    e.Ego_Velocity_X = 10.0f;
+
+    ObjectData_t o[2]{};
+    o[0].Object_ID = 1;  o[0].Distance = 80.0f;
+    o[1].Object_ID = 2;  o[1].Distance = 80.01f;
+    FilteredObject_t f[2];
+    EXPECT_EQ(adas::select_target_from_object_list<NarrowConfig>(o, 2, &e, &ls, f, 2), 1);
+    EXPECT_EQ(adas::select_target_from_object_list<adas::DefaultConfig>(o, 2, &e, &ls, f, 2), 2);
+
+    PredictedObject_t p{};
+    p.Predicted_Object_ID = 7;  p.Predicted_Object_Type = OBJTYPE_CAR;
+    p.Predicted_Position_X = 30.0f;  p.Predicted_Position_Y = 1.2f;
+    p.Predicted_Distance = 30.0f;  p.Predicted_Object_Status = OBJSTAT_MOVING;
+    ACC_Target_t acc;  AEB_Target_t aeb;
+    adas::select_targets_for_acc_aeb<NarrowConfig>(&e, &p, 1, &ls, &acc, &aeb);
+    EXPECT_EQ(acc.ACC_Target_ID, -1);
+    adas::select_targets_for_acc_aeb<adas::DefaultConfig>(&e, &p, 1, &ls, &acc, &aeb);
+    EXPECT_EQ(acc.ACC_Target_ID, 7);
+}
+
+/* 기본 인스턴스 == C API : 경계값 / 비유한 값 (heading, 곡률, 횡위치, 거리) */
+TEST_F(TargetSelectionTplTest, TC_TGT_TPL_BV_02_DefaultMatchesCApiBoundary)
+{
+    const float H[] = { 0.0f, -0.0f, 180.0f, std::nextafter(180.0f, 1e9f), -180.0f, std::nextafter(-180.0f, -1e9f),
+                        190.0f, -190.0f, 360.0f, 540.0f, std::nextafter(540.0f, 1e9f), -540.0f, 1e7f, -1e7f,
+                        FLT_MAX, -FLT_MAX, INFINITY, -INFINITY, NAN, FLT_TRUE_MIN };
+    const float C[] = { 0.0f, -0.0f, FLT_TRUE_MIN, -300.0f, 400.0f, std::nextafter(800.0f, 0.0f), 800.0f,
+                        1200.0f, std::nextafter(1200.0f, 1e9f), INFINITY, NAN };
+    const float Y[] = { 0.0f, 1.75f, std::nextafter(1.75f, 9.0f), -1.75f, 3.5f, std::nextafter(3.5f, 9.0f),
+                        -3.5f, INFINITY, -INFINITY, NAN };
+    const float D[] = { 0.0f, -1.0f, MAX_OBJECT_DISTANCE, std::nextafter(MAX_OBJECT_DISTANCE, 1e9f), 1e30f,
+                        INFINITY, NAN };
+    const int nH = (int)(sizeof(H) / sizeof(H[0]));
+
+    /* Lane Selection : Ego / 차선 heading 전체 조합 */
+    for (int a = 0; a < nH; a++) {
+        for (int b = 0; b < nH; b++) {
+            randomScene();
+            ego.Ego_Heading   = H[a];
+            lane.Lane_Heading = H[b];
+            LaneSelectOutput_t lsC, lsT;
+            std::memset(&lsC, 0, sizeof(lsC));
+            ASSERT_EQ(LaneSelection(&lane, &ego, &lsC), adas::LaneSelection<>(&lane, &ego, &lsT));
+            ASSERT_EQ(std::memcmp(&lsC, &lsT, sizeof(lsC)), 0) << a << "," << b;
+        }
+    }
+
+    /* 전체 프레임 : 필드마다 경계값을 섞은 장면 */
+    for (int it = 0; it < 4000; it++) {
+        randomScene();
+        ego.Ego_Heading          = H[rng.Seed % nH];
+        lane.Lane_Heading        = H[(rng.Seed >> 8) % nH];
+        lane.Lane_Curvature      = C[(rng.Seed >> 12) % (sizeof(C) / sizeof(C[0]))];
+        lane.Next_Lane_Curvature = C[(rng.Seed >> 16) % (sizeof(C) / sizeof(C[0]))];
+        for (int i = 0; i < N; i++) {
+            (void)rng.uni(0.0f, 1.0f);
+            if (rng.Seed & 0x100u) obj[i].Heading    = H[(rng.Seed >> 9) % nH];
+            if (rng.Seed & 0x200u) obj[i].Position_Y = Y[(rng.Seed >> 13) % (sizeof(Y) / sizeof(Y[0]))];
+            if (rng.Seed & 0x400u) obj[i].Distance   = D[(rng.Seed >> 17) % (sizeof(D) / sizeof(D[0]))];
+        }
+
+        LaneSelectOutput_t lsC, lsT;
+        FilteredObject_t   fC[N], fT[N];
+        PredictedObject_t  pC[N], pT[N];
+        ACC_Target_t       accC, accT;
+        AEB_Target_t       aebC, aebT;
+        int fcC, pcC, fcT, pcT;
+        std::memset(&lsC, 0, sizeof(lsC));
+
+        runFrame<adas::DefaultConfig, true>(lsC, fC, fcC, pC, pcC, accC, aebC);
+        runFrame<adas::DefaultConfig, false>(lsT, fT, fcT, pT, pcT, accT, aebT);
+
+        ASSERT_EQ(std::memcmp(&lsC, &lsT, sizeof(lsC)), 0) << it;
+        ASSERT_EQ(fcC, fcT) << it;
+        ASSERT_EQ(std::memcmp(fC, fT, sizeof(FilteredObject_t) * fcC), 0) << it;
+        ASSERT_EQ(std::memcmp(&accC, &accT, sizeof(accC)), 0) << it;
+        ASSERT_EQ(std::memcmp(&aebC, &aebT, sizeof(aebC)), 0) << it;
+    }
+}
+
+/* 무효 입력 : C API 와 같은 반환 */
+TEST_F(TargetSelectionTplTest, TC_TGT_TPL_RA_01_Invalid)
+{
+    LaneSelectOutput_t ls{};
+    EXPECT_EQ(adas::LaneSelection<adas::NoCurveConfig>(nullptr, &ego, &ls), -1);
+    EXPECT_EQ(adas::select_target_from_object_list<adas::NoCurveConfig>(nullptr, 1, &ego, &ls, nullptr, 1), 0);
+    ACC_Target_t acc;  AEB_Target_t aeb;
+    adas::select_targets_for_acc_aeb<adas::PedestrianAebConfig>(&ego, nullptr, 0, &ls, &acc, &aeb);
+    EXPECT_EQ(acc.ACC_Target_ID, -1);
+    EXPECT_EQ(aeb.AEB_Target_ID, -1);
+}
@@ -0,0 +1,202 @@
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L     /* pthread */
+#endif
+
+#include <string.h>
+#include "task_graph.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define CPU_RELAX()         _mm_pause()
+#else
+#define CPU_RELAX()         ((void)0)
+#endif
+
+#define LOAD_ACQ(p)         __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define LOAD_RLX(p)         __atomic_load_n((p), __ATOMIC_RELAXED)
+#define STORE_REL(p, v)     __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#define STORE_RLX(p, v)     __atomic_store_n((p), (v), __ATOMIC_RELAXED)
+#define FETCH_ADD(p, v)     __atomic_fetch_add((p), (v), __ATOMIC_ACQ_REL)
+
+/*─────────────────────────────
+  그래프
+─────────────────────────────*/
+void task_graph_init(TaskGraph_t *pGraph)
+{
+    if (!pGraph) return;
+    memset(pGraph, 0, sizeof(*pGraph));
+}
+
+int task_graph_add(TaskGraph_t *pGraph, TaskFn_t fn, void *pCtx, int chunks, uint32_t depMask)
+{
+    if (!pGraph || !fn || chunks < 1 || pGraph->Count >= TASK_GRAPH_MAX_TASKS) return -1;
+
+    int id = pGraph->Count;
+    if (depMask & ~((1u << id) - 1u)) return -1;      /* 이후 작업 / 자기 자신 의존 금지 */
+
+    TaskNode_t *t = &pGraph->Task[id];
+    memset(t, 0, sizeof(*t));
+    t->Fn     = fn;
+    t->Ctx    = pCtx;
+    t->Chunks = chunks;
+    for (int d = 0; d < id; d++) {
+        if (depMask & (1u << d)) {
+            pGraph->Task[d].Succ_Mask |= 1u << id;
+            t->Dep_Count++;
+        }
+    }
+    pGraph->Count++;
+    return id;
+}
+
+int task_graph_set_chunks(TaskGraph_t *pGraph, int task, int chunks)
+{
+    if (!pGraph || task < 0 || task >= pGraph->Count || chunks < 1) return -1;
+    pGraph->Task[task].Chunks = chunks;
+    return 0;
+}
+
+static void graph_reset(TaskGraph_t *g)
+{
+    for (int i = 0; i < g->Count; i++) {
+        TaskNode_t *t = &g->Task[i];
+        STORE_RLX(&t->Pending, t->Dep_Count);
+        STORE_RLX(&t->Next_Chunk, 0);
+        STORE_RLX(&t->Done_Chunks, 0);
+    }
+    STORE_RLX(&g->Done, 0);
+}
+
+/* 준비된 작업 조각 1 개 실행 → true, 없으면 false */
+static int run_one(TaskGraph_t *g)
+{
+    for (int i = 0; i < g->Count; i++) {
+        TaskNode_t *t = &g->Task[i];
+        if (LOAD_ACQ(&t->Pending) != 0 || LOAD_RLX(&t->Next_Chunk) >= t->Chunks) continue;
+
+        int c = FETCH_ADD(&t->Next_Chunk, 1);
+        if (c >= t->Chunks) continue;
+
+        t->Fn(t->Ctx, c);
+
+        if (FETCH_ADD(&t->Done_Chunks, 1) + 1 == t->Chunks) {
+            uint32_t s = t->Succ_Mask;
+            for (int j = i + 1; j < g->Count; j++) {
+                if (s & (1u << j)) FETCH_ADD(&g->Task[j].Pending, -1);
+            }
+            FETCH_ADD(&g->Done, 1);
+        }
+        return 1;
+    }
+    return 0;
+}
+
+static void drain(TaskGraph_t *g)
+{
+    while (LOAD_ACQ(&g->Done) < g->Count) {
+        if (!run_one(g)) CPU_RELAX();
+    }
+}
+
+/*─────────────────────────────
+  작업자
+   - 새 세대 대기 : spin → park
+   - 참여 : Busy 증가 후 Open 확인 (실행자는 Open 닫은 뒤 Busy 확인, 둘 다 seq_cst)
+─────────────────────────────*/
+static void *worker_main(void *pArg)
+{
+    TaskPool_t *p = (TaskPool_t *)pArg;
+    uint32_t seen = 0;
+
+    for (;;) {
+        uint32_t gen;
+        int spins = 0;
+        while ((gen = LOAD_ACQ(&p->Generation)) == seen && !LOAD_ACQ(&p->Stop)) {
+            if (++spins < p->Spin_Iters) {
+                CPU_RELAX();
+                continue;
+            }
+            pthread_mutex_lock(&p->Lock);
+            while (LOAD_ACQ(&p->Generation) == seen && !LOAD_ACQ(&p->Stop)) {
+                FETCH_ADD(&p->Park_Count, 1u);
+                pthread_cond_wait(&p->Wake, &p->Lock);
+            }
+            pthread_mutex_unlock(&p->Lock);
+            spins = 0;
+        }
+        if (LOAD_ACQ(&p->Stop)) break;
+        seen = gen;
+
+        __atomic_fetch_add(&p->Busy, 1, __ATOMIC_SEQ_CST);
+        if (__atomic_load_n(&p->Open, __ATOMIC_SEQ_CST) == gen) {
+            drain(LOAD_ACQ(&p->Graph));
+        }
+        __atomic_fetch_sub(&p->Busy, 1, __ATOMIC_RELEASE);
+    }
+    return NULL;
+}
+
+int task_pool_init(TaskPool_t *pPool, int workers, int spinIters)
+{
+    if (!pPool || workers < 0 || workers > TASK_POOL_MAX_WORKERS) return -1;
+
+    memset(pPool, 0, sizeof(*pPool));
+    pPool->Spin_Iters = (spinIters < 0) ? TASK_POOL_DEFAULT_SPIN : spinIters;
+    if (pthread_mutex_init(&pPool->Lock, NULL) != 0) return -1;
+    if (pthread_cond_init(&pPool->Wake, NULL) != 0) {
+        pthread_mutex_destroy(&pPool->Lock);
+        return -1;
+    }
+    for (int i = 0; i < workers; i++) {
+        if (pthread_create(&pPool->Thread[i], NULL, worker_main, pPool) != 0) {
+            task_pool_destroy(pPool);
+            return -1;
+        }
+        pPool->Worker_Count++;
+    }
+    return 0;
+}
+
+void task_pool_destroy(TaskPool_t *pPool)
+{
+    if (!pPool) return;
+    pthread_mutex_lock(&pPool->Lock);
+    STORE_REL(&pPool->Stop, 1);
+    pthread_cond_broadcast(&pPool->Wake);
+    pthread_mutex_unlock(&pPool->Lock);
+    for (int i = 0; i < pPool->Worker_Count; i++) {
+        pthread_join(pPool->Thread[i], NULL);
+    }
+    pPool->Worker_Count = 0;
+    pthread_cond_destroy(&pPool->Wake);
+    pthread_mutex_destroy(&pPool->Lock);
+}
+
+int task_graph_run(TaskPool_t *pPool, TaskGraph_t *pGraph)
+{
+    if (!pGraph) return -1;
+    graph_reset(pGraph);
+    if (!pPool || pPool->Worker_Count == 0 || pGraph->Count == 0) {
+        drain(pGraph);
+        return 0;
+    }
+
+    /* 게시 : 그래프 → Open → Generation (release), park 된 작업자 깨움 */
+    uint32_t gen = LOAD_RLX(&pPool->Generation) + 1u;
+    if (gen == 0u) gen = 1u;                        /* 0 = 닫힘 */
+    STORE_REL(&pPool->Graph, pGraph);
+    __atomic_store_n(&pPool->Open, gen, __ATOMIC_SEQ_CST);
+    pthread_mutex_lock(&pPool->Lock);
+    STORE_REL(&pPool->Generation, gen);
+    pthread_cond_broadcast(&pPool->Wake);
+    pthread_mutex_unlock(&pPool->Lock);
+
+    drain(pGraph);
+
+    /* join : 새 참여 차단 후 참여 중 작업자 이탈 대기 */
+    __atomic_store_n(&pPool->Open, 0u, __ATOMIC_SEQ_CST);
+    while (__atomic_load_n(&pPool->Busy, __ATOMIC_SEQ_CST) != 0) {
+        CPU_RELAX();
+    }
+    return 0;
+}
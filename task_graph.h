@@ -0,0 +1,100 @@
+/****************************************************************************
+ * task_graph.h
+ *
+ * - 정적 작업 그래프 실행기 (틱 내 독립 단계 병렬 실행)
+ *     . 그래프 : 작업 ≤ TASK_GRAPH_MAX_TASKS, 선행 작업 비트 마스크로 의존성 지정
+ *                (선행 작업은 이미 추가된 작업만 → 구성상 비순환)
+ *     . 작업은 Chunks 개 조각으로 나뉘어 여러 스레드가 동시에 실행 가능 (fn(ctx, chunk))
+ *     . 실행 : 호출 스레드 + 상주 작업자 풀이 준비된(선행 완료) 작업 조각을 가져가 실행,
+ *              모든 작업 완료 후 반환 (join)
+ * - 작업자 풀 : 생성 시 스레드 고정, 틱 사이 대기는 Spin_Iters 회 spin 후 조건 변수 park
+ * - 틱당 동적 할당 / 시스템 호출 없음 (park 된 작업자 깨우기 제외)
+ * - 동기화 : GCC/Clang __atomic 내장 함수 + pthread (C99 빌드 유지)
+ * - 풀 없이(NULL, 작업자 0) 실행하면 호출 스레드가 위상 순서로 전부 실행
+ ****************************************************************************/
+#ifndef TASK_GRAPH_H
+#define TASK_GRAPH_H
+
+#include <pthread.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TASK_GRAPH_MAX_TASKS    32      /* 선행/후속 마스크 비트 수 */
+#define TASK_POOL_MAX_WORKERS   16
+#define TASK_POOL_DEFAULT_SPIN  20000   /* park 전 spin 횟수 */
+
+typedef void (*TaskFn_t)(void *pCtx, int chunk);
+
+typedef struct {
+    TaskFn_t Fn;
+    void    *Ctx;
+    int32_t  Chunks;            /* >= 1 */
+    int32_t  Dep_Count;         /* 선행 작업 수 */
+    uint32_t Succ_Mask;         /* 후속 작업 비트 */
+
+    /* 실행 중 상태 (원자 접근) */
+    int32_t  Pending;           /* 남은 선행 작업 수 */
+    int32_t  Next_Chunk;        /* 다음에 가져갈 조각 */
+    int32_t  Done_Chunks;
+} TaskNode_t;
+
+typedef struct {
+    int32_t    Count;
+    int32_t    Done;            /* 실행 중 완료 작업 수 (원자) */
+    TaskNode_t Task[TASK_GRAPH_MAX_TASKS];
+} TaskGraph_t;
+
+typedef struct {
+    pthread_t       Thread[TASK_POOL_MAX_WORKERS];
+    int32_t         Worker_Count;
+    int32_t         Spin_Iters;
+    pthread_mutex_t Lock;
+    pthread_cond_t  Wake;
+
+    /* 원자 접근 */
+    TaskGraph_t    *Graph;      /* 현재 실행 그래프 */
+    uint32_t        Generation; /* 실행마다 +1 (작업자 깨움) */
+    uint32_t        Open;       /* 참여 가능한 실행 세대 (0 = 닫힘) */
+    int32_t         Busy;       /* 현재 실행에 참여 중인 작업자 수 */
+    int32_t         Stop;
+    uint32_t        Park_Count; /* 누계 : 작업자 park 횟수 */
+} TaskPool_t;
+
+/** @brief 빈 그래프 */
+void task_graph_init(TaskGraph_t *pGraph);
+
+/**
+ * @brief 작업 추가
+ * @param[in] depMask : 선행 작업 비트 (bit i = 작업 i, 이미 추가된 작업만)
+ * @return 작업 번호, -1 on invalid argument / 용량 초과
+ */
+int task_graph_add(TaskGraph_t *pGraph, TaskFn_t fn, void *pCtx, int chunks, uint32_t depMask);
+
+/** @brief 조각 수 변경 (틱마다 입력 크기에 맞춤, 실행 중 호출 금지) @return 0 / -1 */
+int task_graph_set_chunks(TaskGraph_t *pGraph, int task, int chunks);
+
+/**
+ * @brief 작업자 풀 생성 (workers = 0 이면 스레드 없음)
+ * @param[in] spinIters : 틱 사이 park 전 spin 횟수 (< 0 이면 기본값)
+ * @return 0 on success, -1 on invalid argument / 스레드 생성 실패
+ */
+int task_pool_init(TaskPool_t *pPool, int workers, int spinIters);
+
+/** @brief 작업자 종료 + join */
+void task_pool_destroy(TaskPool_t *pPool);
+
+/**
+ * @brief 그래프 1 회 실행 (호출 스레드도 참여), 모든 작업 완료 및 작업자 이탈 후 반환
+ * @param[in] pPool : NULL 이면 호출 스레드만
+ * @return 0 on success, -1 on invalid argument
+ */
+int task_graph_run(TaskPool_t *pPool, TaskGraph_t *pGraph);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TASK_GRAPH_H */
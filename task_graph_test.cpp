@@ -0,0 +1,273 @@
+/*********************************************************************
+ * task_graph_test.cpp  ―  정적 작업 그래프 실행기 / 파이프라인 병렬 실행
+ * DUT : task_graph.c, adas_pipeline.c (adas_pipeline_step_mt, adas_select_predict_mt)
+ *********************************************************************/
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "task_graph.h"
+#include "adas_pipeline.h"
+#include "golden_trace.h"
+#include "lane_selection.h"
+#include "scene_generator.h"
+#include "target_selection.h"
+
+namespace {
+
+/* 작업별 완료 순번 기록 (의존성 검사) */
+struct OrderCtx {
+    std::atomic<int> seq{0};
+    std::atomic<int> done[TASK_GRAPH_MAX_TASKS];
+    std::atomic<int> hits[1024];
+    uint32_t         deps[TASK_GRAPH_MAX_TASKS];
+    std::atomic<int> violations{0};
+
+    void reset()
+    {
+        for (auto &d : done) d = -1;
+        for (auto &h : hits) h = 0;
+        seq = 0;
+    }
+};
+
+struct TaskArg {
+    OrderCtx *ctx;
+    int       id;
+};
+
+void order_task(void *pCtx, int chunk)
+{
+    TaskArg *a = static_cast<TaskArg *>(pCtx);
+    for (int d = 0; d < TASK_GRAPH_MAX_TASKS; d++) {
+        if ((a->ctx->deps[a->id] & (1u << d)) && a->ctx->done[d] < 0) a->ctx->violations++;
+    }
+    (void)chunk;
+    a->ctx->done[a->id] = a->ctx->seq.fetch_add(1);
+}
+
+void chunk_task(void *pCtx, int chunk)
+{
+    static_cast<OrderCtx *>(pCtx)->hits[chunk]++;
+}
+
+class TaskGraphTest : public ::testing::Test {
+protected:
+    TaskGraph_t graph;
+    TaskPool_t  pool;
+
+    void SetUp() override { task_graph_init(&graph); }
+};
+
+} /* namespace */
+
+/* 다이아몬드 + 사슬 : 모든 실행에서 선행 작업 완료 후 실행, 작업마다 1 회 */
+TEST_F(TaskGraphTest, TC_TGRAPH_EQ_01)
+{
+    static OrderCtx ctx;
+    static TaskArg  arg[8];
+    const uint32_t  deps[8] = { 0u, 1u, 1u, 1u, 0xEu, 0u, 0x20u, 0x50u };
+    for (int i = 0; i < 8; i++) {
+        arg[i] = { &ctx, i };
+        ctx.deps[i] = deps[i];
+        ASSERT_EQ(task_graph_add(&graph, order_task, &arg[i], 1, deps[i]), i);
+    }
+    ASSERT_EQ(task_pool_init(&pool, 3, 1000), 0);
+    for (int run = 0; run < 2000; run++) {
+        ctx.reset();
+        ASSERT_EQ(task_graph_run(&pool, &graph), 0);
+        EXPECT_EQ(ctx.seq.load(), 8) << "run " << run;
+    }
+    task_pool_destroy(&pool);
+    EXPECT_EQ(ctx.violations.load(), 0);
+}
+
+/* 조각 작업 : 모든 조각 정확히 1 회, 후속 작업은 전 조각 완료 후 */
+TEST_F(TaskGraphTest, TC_TGRAPH_EQ_02)
+{
+    static OrderCtx ctx;
+    static TaskArg  tail;
+    ASSERT_EQ(task_graph_add(&graph, chunk_task, &ctx, 1000, 0u), 0);
+    tail = { &ctx, 1 };
+    ctx.deps[1] = 1u;
+    ASSERT_EQ(task_graph_add(&graph, order_task, &tail, 1, 1u), 1);
+    ASSERT_EQ(task_pool_init(&pool, 4, -1), 0);
+    for (int run = 0; run < 200; run++) {
+        ctx.reset();
+        ctx.done[0] = 0;                                /* 조각 작업은 순번 기록 안 함 */
+        ASSERT_EQ(task_graph_set_chunks(&graph, 0, 1 + (run * 37) % 1000), 0);
+        ASSERT_EQ(task_graph_run(&pool, &graph), 0);
+        int n = graph.Task[0].Chunks;
+        for (int c = 0; c < 1024; c++) {
+            ASSERT_EQ(ctx.hits[c].load(), c < n ? 1 : 0) << "run " << run << " chunk " << c;
+        }
+    }
+    task_pool_destroy(&pool);
+    EXPECT_EQ(ctx.violations.load(), 0);
+}
+
+/* 파이프라인 병렬 실행 = 직렬 실행 (합성 시나리오, 출력 비트 일치) */
+TEST_F(TaskGraphTest, TC_TGRAPH_EQ_03)
+{
+    const int kTicks = 3000;
+    GoldenScene_t        scene;
+    AdasPipelineState_t  st;
+    AdasPipelineInput_t  in;
+    std::vector<AdasPipelineOutput_t> ref(kTicks);
+
+    golden_scene_init(&scene, 7u, 0);
+    adas_pipeline_init(&st);
+    for (int t = 0; t < kTicks; t++) {
+        golden_scene_next(&scene, &in);
+        ASSERT_EQ(adas_pipeline_step(&st, &in, &ref[t]), 0);
+    }
+
+    auto mt = std::make_unique<AdasPipelineMt_t>();
+    ASSERT_EQ(task_pool_init(&pool, 2, -1), 0);
+    ASSERT_EQ(adas_pipeline_mt_init(mt.get(), &pool), 0);
+    golden_scene_init(&scene, 7u, 0);
+    adas_pipeline_init(&st);
+    for (int t = 0; t < kTicks; t++) {
+        AdasPipelineOutput_t out;
+        golden_scene_next(&scene, &in);
+        ASSERT_EQ(adas_pipeline_step_mt(mt.get(), &st, &in, &out), 0);
+        ASSERT_EQ(std::memcmp(&out, &ref[t], sizeof(out)), 0) << "tick " << t;
+    }
+    task_pool_destroy(&pool);
+}
+
+/* 대량 객체 select / predict 조각 병렬 = 직렬 호출 */
+TEST_F(TaskGraphTest, TC_TGRAPH_EQ_04)
+{
+    SceneGenConfig_t cfg;
+    scene_gen_default_config(&cfg, SCENE_GEN_MAX_OBJECTS);
+    auto gen = std::make_unique<SceneGen_t>();
+    ASSERT_EQ(scene_gen_init(gen.get(), &cfg), 0);
+
+    auto sel = std::make_unique<AdasSelectMt_t>();
+    ASSERT_EQ(task_pool_init(&pool, 3, -1), 0);
+    ASSERT_EQ(adas_select_mt_init(sel.get(), &pool), 0);
+
+    const int N = SCENE_GEN_MAX_OBJECTS;
+    std::vector<FilteredObject_t>  fRef(N), fMt(N);
+    std::vector<PredictedObject_t> pRef(N), pMt(N);
+    for (int step = 0; step < 20; step++) {
+        EgoData_t ego; LaneData_t lane; LaneSelectOutput_t ls;
+        std::memset(&ego, 0, sizeof(ego));
+        int n = scene_gen_step(gen.get(), &ego, &lane);
+        LaneSelection(&lane, &ego, &ls);
+        int maxPred = (step % 4 == 3) ? 100 : N;        /* 예측 용량 < 필터링 결과 */
+
+        std::memset(fRef.data(), 0, N * sizeof(FilteredObject_t));
+        std::memset(fMt.data(), 0, N * sizeof(FilteredObject_t));
+        int fcRef = select_target_from_object_list(gen->Obj, n, &ego, &ls, fRef.data(), N);
+        int pcRef = predict_object_future_path(fRef.data(), fcRef, &lane, &ls, pRef.data(), maxPred);
+        int fcMt  = -1;
+        int pcMt  = adas_select_predict_mt(sel.get(), gen->Obj, n, &ego, &lane, &ls,
+                                           fMt.data(), N, pMt.data(), maxPred, &fcMt);
+        ASSERT_GT(fcRef, 0);
+        ASSERT_EQ(fcMt, fcRef) << "step " << step;
+        ASSERT_EQ(pcMt, pcRef) << "step " << step;
+        EXPECT_EQ(std::memcmp(fMt.data(), fRef.data(), fcRef * sizeof(FilteredObject_t)), 0);
+        EXPECT_EQ(std::memcmp(pMt.data(), pRef.data(), pcRef * sizeof(PredictedObject_t)), 0);
+    }
+
+    /* 필터링 용량 < 입력 → 직렬 경로 (앞쪽 결과만) */
+    EgoData_t ego; LaneData_t lane; LaneSelectOutput_t ls;
+    std::memset(&ego, 0, sizeof(ego));
+    int n = scene_gen_step(gen.get(), &ego, &lane);
+    LaneSelection(&lane, &ego, &ls);
+    int fcRef = select_target_from_object_list(gen->Obj, n, &ego, &ls, fRef.data(), 50);
+    int fcMt  = -1;
+    adas_select_predict_mt(sel.get(), gen->Obj, n, &ego, &lane, &ls, fMt.data(), 50, pMt.data(), N, &fcMt);
+    EXPECT_EQ(fcMt, fcRef);
+    EXPECT_EQ(std::memcmp(fMt.data(), fRef.data(), fcRef * sizeof(FilteredObject_t)), 0);
+    task_pool_destroy(&pool);
+}
+
+/* 경계 : 작업자 0 / 풀 없음 / 즉시 park(spin 0) 후 재실행 / 최대 작업 수 */
+TEST_F(TaskGraphTest, TC_TGRAPH_BV_01)
+{
+    static OrderCtx ctx;
+    static TaskArg  arg[TASK_GRAPH_MAX_TASKS];
+    for (int i = 0; i < TASK_GRAPH_MAX_TASKS; i++) {
+        arg[i] = { &ctx, i };
+        ctx.deps[i] = (i == 0) ? 0u : (1u << (i - 1));  /* 사슬 */
+        ASSERT_EQ(task_graph_add(&graph, order_task, &arg[i], 1, ctx.deps[i]), i);
+    }
+    EXPECT_EQ(task_graph_add(&graph, order_task, &arg[0], 1, 0u), -1);
+
+    ctx.reset();
+    ASSERT_EQ(task_graph_run(nullptr, &graph), 0);
+    EXPECT_EQ(ctx.seq.load(), TASK_GRAPH_MAX_TASKS);
+    for (int i = 0; i < TASK_GRAPH_MAX_TASKS; i++) EXPECT_EQ(ctx.done[i].load(), i);
+
+    ASSERT_EQ(task_pool_init(&pool, 0, -1), 0);
+    ctx.reset();
+    ASSERT_EQ(task_graph_run(&pool, &graph), 0);
+    EXPECT_EQ(ctx.seq.load(), TASK_GRAPH_MAX_TASKS);
+    task_pool_destroy(&pool);
+
+    ASSERT_EQ(task_pool_init(&pool, 2, 0), 0);
+    for (int run = 0; run < 5; run++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        ctx.reset();
+        ASSERT_EQ(task_graph_run(&pool, &graph), 0);
+        EXPECT_EQ(ctx.seq.load(), TASK_GRAPH_MAX_TASKS);
+    }
+    EXPECT_GT(__atomic_load_n(&pool.Park_Count, __ATOMIC_ACQUIRE), 0u);
+    task_pool_destroy(&pool);
+    EXPECT_EQ(ctx.violations.load(), 0);
+
+    /* 빈 그래프 */
+    TaskGraph_t empty;
+    task_graph_init(&empty);
+    EXPECT_EQ(task_graph_run(nullptr, &empty), 0);
+}
+
+/* 잘못된 인자 */
+TEST_F(TaskGraphTest, TC_TGRAPH_RA_01)
+{
+    static OrderCtx ctx;
+    static TaskArg  a = { &ctx, 0 };
+    EXPECT_EQ(task_graph_add(nullptr, order_task, &a, 1, 0u), -1);
+    EXPECT_EQ(task_graph_add(&graph, nullptr, &a, 1, 0u), -1);
+    EXPECT_EQ(task_graph_add(&graph, order_task, &a, 0, 0u), -1);
+    EXPECT_EQ(task_graph_add(&graph, order_task, &a, 1, 1u), -1);   /* 자기 자신 */
+    ASSERT_EQ(task_graph_add(&graph, order_task, &a, 1, 0u), 0);
+    EXPECT_EQ(task_graph_add(&graph, order_task, &a, 1, 4u), -1);   /* 아직 없는 작업 */
+    EXPECT_EQ(task_graph_set_chunks(&graph, 1, 2), -1);
+    EXPECT_EQ(task_graph_set_chunks(&graph, 0, 0), -1);
+    EXPECT_EQ(task_graph_set_chunks(nullptr, 0, 1), -1);
+    EXPECT_EQ(task_graph_run(nullptr, nullptr), -1);
+
+    EXPECT_EQ(task_pool_init(nullptr, 1, -1), -1);
+    EXPECT_EQ(task_pool_init(&pool, -1, -1), -1);
+    EXPECT_EQ(task_pool_init(&pool, TASK_POOL_MAX_WORKERS + 1, -1), -1);
+    task_pool_destroy(nullptr);
+
+    AdasPipelineState_t  st;
+    AdasPipelineInput_t  in;
+    AdasPipelineOutput_t out;
+    std::memset(&in, 0, sizeof(in));
+    auto mt = std::make_unique<AdasPipelineMt_t>();
+    EXPECT_EQ(adas_pipeline_mt_init(nullptr, nullptr), -1);
+    std::memset(mt.get(), 0, sizeof(*mt));
+    EXPECT_EQ(adas_pipeline_step_mt(mt.get(), &st, &in, &out), -1);  /* 미구성 */
+    ASSERT_EQ(adas_pipeline_mt_init(mt.get(), nullptr), 0);
+    adas_pipeline_init(&st);
+    EXPECT_EQ(adas_pipeline_step_mt(nullptr, &st, &in, &out), -1);
+    EXPECT_EQ(adas_pipeline_step_mt(mt.get(), nullptr, &in, &out), -1);
+    in.Obj_Count = ADAS_PIPELINE_MAX_OBJ + 1;
+    EXPECT_EQ(adas_pipeline_step_mt(mt.get(), &st, &in, &out), -1);
+
+    EXPECT_EQ(adas_select_mt_init(nullptr, nullptr), -1);
+    int fc = -1;
+    EXPECT_EQ(adas_select_predict_mt(nullptr, nullptr, 10, nullptr, nullptr, nullptr,
+                                     nullptr, 10, nullptr, 10, &fc), 0);
+    EXPECT_EQ(fc, 0);
+}
@@ -0,0 +1,31 @@
+/****************************************************************************
+ * test_rng.hpp
+ *
+ * - 단위 시험 공용 난수 : 시드 고정 32 bit LCG (a = 1664525, c = 1013904223)
+ *     . 시드가 같으면 모든 플랫폼에서 같은 열 → 실패 입력 재현
+ *     . uni : 상위 24 bit 로 [lo, hi) 균등 실수
+ * - 시험 전용 (라이브러리에 포함하지 않음)
+ ****************************************************************************/
+#ifndef TEST_RNG_HPP
+#define TEST_RNG_HPP
+
+#include <cstdint>
+
+struct TestRng {
+    uint32_t Seed;
+
+    explicit TestRng(uint32_t seed) : Seed(seed) {}
+
+    uint32_t next()
+    {
+        Seed = Seed * 1664525u + 1013904223u;
+        return Seed;
+    }
+
+    float uni(float lo, float hi)
+    {
+        return lo + (hi - lo) * (float)(next() >> 8) / 16777216.0f;
+    }
+};
+
+#endif /* TEST_RNG_HPP */
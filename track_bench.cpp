@@ -0,0 +1,96 @@
+/*********************************************************************
+ * track_bench.cpp  ―  객체 운동 모델 필터 벤치마크
+ *
+ * 사용 : track_bench [프레임 수(기본 500)]
+ *   - 트랙 64 / 256 개 (scene_generator 장면 + 위치/속도 잡음), 모드 CV / CA / CTRV / MM
+ *   - 1 프레임 obj_track_update 시간을 객체당 [ns] 로 (최소 / 평균)
+ *   - 최적화 빌드(-DCMAKE_BUILD_TYPE=Release) 에서 측정할 것
+ *********************************************************************/
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "object_tracking.h"
+#include "scene_generator.h"
+
+namespace {
+
+uint32_t g_seed = 23u;
+
+float uni(float lo, float hi)
+{
+    g_seed = g_seed * 1664525u + 1013904223u;
+    return lo + (hi - lo) * (float)(g_seed >> 8) / 16777216.0f;
+}
+
+const char *mode_name(ObjTrackMode_e m)
+{
+    switch (m) {
+    case OBJ_TRACK_MODE_CV:   return "CV";
+    case OBJ_TRACK_MODE_CA:   return "CA";
+    case OBJ_TRACK_MODE_CTRV: return "CTRV";
+    default:                  return "MM";
+    }
+}
+
+} /* namespace */
+
+int main(int argc, char **argv)
+{
+    int frames = (argc > 1) ? std::atoi(argv[1]) : 500;
+    if (frames <= 0) frames = 500;
+
+    std::unique_ptr<SceneGen_t>         gen(new SceneGen_t);
+    std::unique_ptr<ObjectTrackTable_t> trk(new ObjectTrackTable_t);
+    std::vector<FilteredObject_t> meas;
+    const int sizes[] = { 64, 256 };
+    const ObjTrackMode_e modes[] = { OBJ_TRACK_MODE_CV, OBJ_TRACK_MODE_CA,
+                                     OBJ_TRACK_MODE_CTRV, OBJ_TRACK_MODE_MM };
+
+    std::printf("%6s %6s %12s %12s\n", "N", "mode", "min[ns/obj]", "mean[ns/obj]");
+    for (int n : sizes) {
+        for (ObjTrackMode_e mode : modes) {
+            SceneGenConfig_t sc;
+            scene_gen_default_config(&sc, n);
+            scene_gen_init(gen.get(), &sc);
+            ObjTrackConfig_t cfg;
+            obj_track_default_config(&cfg);
+            cfg.Mode = mode;
+            if (obj_track_init(trk.get(), &cfg) != 0) return 1;
+
+            EgoData_t ego;
+            std::memset(&ego, 0, sizeof(ego));
+            ego.Ego_Velocity_X = sc.Ego_Velocity;
+
+            double best = 1e30, sum = 0.0;
+            for (int f = 0; f < frames; f++) {
+                scene_gen_step(gen.get(), nullptr, nullptr);
+                meas.clear();
+                for (int i = 0; i < gen->Count && i < n; i++) {
+                    const ObjectData_t &o = gen->Obj[i];
+                    FilteredObject_t m;
+                    std::memset(&m, 0, sizeof(m));
+                    m.Filtered_Object_ID  = o.Object_ID;
+                    m.Filtered_Position_X = o.Position_X + uni(-0.3f, 0.3f);
+                    m.Filtered_Position_Y = o.Position_Y + uni(-0.3f, 0.3f);
+                    m.Filtered_Velocity_X = o.Velocity_X + uni(-0.5f, 0.5f);
+                    m.Filtered_Velocity_Y = o.Velocity_Y + uni(-0.5f, 0.5f);
+                    meas.push_back(m);
+                }
+                auto t0 = std::chrono::steady_clock::now();
+                obj_track_update(trk.get(), meas.data(), (int)meas.size(), &ego, sc.Dt);
+                double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count()
+                            / (double)std::max<size_t>(meas.size(), 1);
+                best = std::min(best, ns);
+                sum += ns;
+            }
+            std::printf("%6d %6s %12.1f %12.1f\n", n, mode_name(mode), best, sum / frames);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,56 @@
+/*********************************************************************
+ * wcet_search.cpp  ―  단계별 최악 실행 시간 유전 탐색
+ *
+ * 사용 : wcet_search [단계당 세대 수(기본 200)] [개체 수(기본 32)] [시드] [반복(기본 3)]
+ *   - golden_trace 합성 시나리오(샤드 0) 500 틱으로 기준 상태를 데우고 다음 32 틱을 씨앗으로 사용
+ *   - 단계마다 목표를 바꿔 세대 진행 (최악 기록은 모든 평가에서 전 단계 갱신)
+ *   - 단계별 최악 ns / 지표 값과 그 입력 전체 출력
+ *   - 최적화 빌드(-DCMAKE_BUILD_TYPE=Release), 가능하면 CPU 고정(taskset)으로 측정할 것
+ *********************************************************************/
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+
+#include "adas_wcet.h"
+#include "golden_trace.h"
+
+int main(int argc, char **argv)
+{
+    int      gens    = (argc > 1) ? std::atoi(argv[1]) : 200;
+    int      pop     = (argc > 2) ? std::atoi(argv[2]) : 32;
+    uint32_t seed    = (argc > 3) ? (uint32_t)std::strtoul(argv[3], nullptr, 0) : 1u;
+    int      repeats = (argc > 4) ? std::atoi(argv[4]) : 3;
+    if (gens < 0 || pop < 2 || pop > ADAS_WCET_MAX_POPULATION || repeats < 1) {
+        std::fprintf(stderr, "usage : wcet_search [generations] [population 2..%d] [seed] [repeats]\n",
+                     ADAS_WCET_MAX_POPULATION);
+        return 2;
+    }
+
+    GoldenScene_t        scene;
+    AdasPipelineState_t  base;
+    AdasPipelineInput_t  seeds[32];
+    AdasPipelineOutput_t out;
+    golden_scene_init(&scene, seed, 0);
+    adas_pipeline_init(&base);
+    for (int t = 0; t < 500; t++) {
+        golden_scene_next(&scene, &seeds[0]);
+        adas_pipeline_step(&base, &seeds[0], &out);
+    }
+    for (int i = 0; i < 32; i++) golden_scene_next(&scene, &seeds[i]);
+
+    std::unique_ptr<AdasWcet_t> w(new AdasWcet_t());
+    AdasWcetConfig_t cfg = { seed, pop, pop / 4 > 0 ? pop / 4 : 1, repeats, 1 };
+    if (adas_wcet_init(w.get(), &cfg, seeds, 32, &base) != 0) return 1;
+    std::printf("metric : %s\n", adas_wcet_metric_name(w->Metric));
+
+    for (int k = 0; k < ADAS_PERF_STAGE_COUNT; k++) {
+        adas_wcet_set_target(w.get(), (AdasPerfStage_e)k);
+        if (adas_wcet_run(w.get(), gens) != 0) return 1;
+        std::printf("  %-12s done (evaluations %lld)\n", adas_perf_stage_name((AdasPerfStage_e)k),
+                    (long long)w->Evaluations);
+    }
+
+    adas_wcet_report(w.get(), stdout);
+    adas_wcet_close(w.get());
+    return 0;
+}